@@ -10,17 +10,25 @@
 #define CONFIG_HIGHRES_IRQ_PRIORITY     (0<<4)
 #define CONFIG_CLOCKTIMER_IRQ_PRIORITY  (1<<4)
 #define CONFIG_DIO_IRQ_PRIORITY         (2<<4)
+// the DAC chains its channel frames from the DMA completion interrupt, it
+// ranks with the gate outputs so a display or console transfer cannot
+// stretch a CV update
+#define CONFIG_DAC_IRQ_PRIORITY         (2<<4)
 #define CONFIG_MIDI_IRQ_PRIORITY        (3<<4)
 #define CONFIG_LCD_IRQ_PRIORITY         (4<<4)
 #define CONFIG_CONSOLE_IRQ_PRIORITY     (5<<4)
+#define CONFIG_SR_IRQ_PRIORITY          (6<<4)
 
 // printf
 #define CONFIG_PRINTF_BUFFER            16
 
 // Debugging
 #define CONFIG_ENABLE_DEBUG             1
+#define CONFIG_ENABLE_CONSOLE_FRAMES    0
 #define CONFIG_ENABLE_PROFILER          0
+#define CONFIG_ENABLE_SAMPLING_PROFILER 1
 #define CONFIG_ENABLE_TASK_PROFILER     1
+#define CONFIG_ENABLE_TRACE             0
 
 // Sanitization
 #define CONFIG_ENABLE_SANITIZE          1
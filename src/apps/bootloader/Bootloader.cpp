@@ -13,13 +13,32 @@
 #include <libopencm3/cm3/scb.h>
 #include <libopencm3/cm3/nvic.h>
 #include <libopencm3/cm3/systick.h>
+#include <libopencm3/stm32/crc.h>
 #include <libopencm3/stm32/flash.h>
+#include <libopencm3/stm32/rcc.h>
 
 #include <cstring>
 
 // version tag of firmware in flash
 const VersionTag &currentVersion = *reinterpret_cast<VersionTag *>(CONFIG_APPLICATION_ADDR + CONFIG_VERSION_TAG_OFFSET);
 
+// header programmed at the start of the staging slot once the staged image
+// is fully written and verified, an interrupted staging pass leaves the
+// magic unprogrammed and the slot reads as empty
+struct StagingHeader {
+    uint32_t magic;
+    uint32_t size;
+    uint32_t crc;
+
+    bool isValid() const {
+        return magic == CONFIG_STAGING_MAGIC &&
+            size > 0 && size <= CONFIG_APPLICATION_SIZE;
+    }
+};
+
+// staging slot header in flash
+const StagingHeader &stagingHeader = *reinterpret_cast<StagingHeader *>(CONFIG_STAGING_ADDR);
+
 static uint32_t flashSectorAddr[] = {
     0x08000000, // Sector 0, 16 Kbytes
     0x08004000, // Sector 1, 16 Kbytes
@@ -35,13 +54,32 @@ static uint32_t flashSectorAddr[] = {
     0x080E0000, // Sector 11, 128 Kbytes
 };
 
-static int flashSectorIndex(uint32_t addr) {
+static void eraseRange(uint32_t addr, size_t size) {
     for (size_t i = 0; i < sizeof(flashSectorAddr) / sizeof(flashSectorAddr[0]); ++i) {
-        if (addr == flashSectorAddr[i]) {
-            return i;
+        if (flashSectorAddr[i] >= addr && flashSectorAddr[i] < addr + size) {
+            printf("erasing sector %zd at 0x%08lx ... ", i, flashSectorAddr[i]);
+            flash_erase_sector(i, 2);
+            flash_wait_for_last_operation();
+            printf("done\n");
         }
     }
-    return -1;
+}
+
+// transfer buffer sized to amortize per-transfer overhead, large reads go
+// through the sd card driver as a single multi-block DMA transfer
+static uint32_t transferBuffer[16 * 1024 / 4];
+
+// hardware CRC unit (CRC-32/MPEG-2 over 32-bit words), used to verify the
+// written image against the data that was programmed
+static void crcReset() {
+    crc_reset();
+}
+
+static uint32_t crcProcess(const uint32_t *data, size_t words) {
+    for (size_t i = 0; i < words; ++i) {
+        CRC_DR = data[i];
+    }
+    return CRC_DR;
 }
 
 extern "C" {
@@ -60,6 +98,8 @@ static void init() {
     Lcd::init();
     SdCard::init();
 
+    rcc_periph_clock_enable(RCC_CRC);
+
     System::startSysTick();
 }
 
@@ -143,6 +183,45 @@ static void drawScreen(const char *current, const char *update, const char *mess
 }
 
 
+// copy the staged image into the application slot and verify the programmed
+// words against the staging crc, the staged image is kept so an interrupted
+// or failed copy can be repeated on the next boot without the sd card
+static bool activateStagedImage(const char *currentStr) {
+    size_t imageSize = stagingHeader.size;
+    size_t imageWords = (imageSize + 3) / 4;
+    const uint32_t *src = reinterpret_cast<const uint32_t *>(CONFIG_STAGING_ADDR + CONFIG_STAGING_IMAGE_OFFSET);
+
+    printf("activating staged image (%zd bytes) ...\n", imageSize);
+    drawScreen(currentStr, "erasing ...");
+
+    flash_unlock();
+
+    eraseRange(CONFIG_APPLICATION_ADDR, imageSize);
+
+    uint32_t addr = CONFIG_APPLICATION_ADDR;
+    for (size_t i = 0; i < imageWords; ++i) {
+        if (i % (sizeof(transferBuffer) / 4) == 0) {
+            char updateStr[32];
+            snprintf(updateStr, sizeof(updateStr), "writing image %d%%", int((i * 100) / imageWords));
+            drawScreen(currentStr, updateStr);
+        }
+        flash_program_word(addr, src[i]);
+        flash_wait_for_last_operation();
+        addr += 4;
+    }
+
+    flash_lock();
+
+    drawScreen(currentStr, "verifying");
+
+    crcReset();
+    uint32_t flashCrc = crcProcess(reinterpret_cast<const uint32_t *>(CONFIG_APPLICATION_ADDR), imageWords);
+
+    printf("computed crc32: 0x%08lx (expected: 0x%08lx)\n", flashCrc, stagingHeader.crc);
+
+    return flashCrc == stagingHeader.crc;
+}
+
 
 static void bootloader() {
     char currentStr[32];
@@ -177,25 +256,31 @@ static void bootloader() {
         printf("no update image found: %s\n", errorStr);
     }
 
+    // the image must fit the application slot
+    if (success && updateSize > CONFIG_APPLICATION_SIZE) {
+        printf("update image too large (%zd bytes)\n", updateSize);
+        snprintf(errorStr, sizeof(errorStr), "image too large");
+        success = false;
+    }
+
     // verify update image md5sum
     if (success) {
         printf("verifying update image ...\n");
 
         MD5 md5;
 
-        uint32_t buf[1024 / 4];
         size_t bytesLeft = updateSize;
         while (bytesLeft > 0) {
             int progress = ((updateSize - bytesLeft) * 100) / updateSize;
             snprintf(updateStr, sizeof(updateStr), "verifying image %d%%", progress);
             drawScreen(currentStr, updateStr);
-            size_t chunkSize = bytesLeft < sizeof(buf) ? bytesLeft : sizeof(buf);
-            if (!UpdateFile::read(buf, chunkSize, errorStr, sizeof(errorStr))) {
+            size_t chunkSize = bytesLeft < sizeof(transferBuffer) ? bytesLeft : sizeof(transferBuffer);
+            if (!UpdateFile::read(transferBuffer, chunkSize, errorStr, sizeof(errorStr))) {
                 success = false;
                 break;
             }
 
-            md5.update(buf, chunkSize);
+            md5.update(transferBuffer, chunkSize);
 
             bytesLeft -= chunkSize;
         }
@@ -234,40 +319,49 @@ static void bootloader() {
         }
     }
 
-    // write update image to flash
+    // write update image to the staging slot, the running image stays
+    // untouched until the staged copy is complete and verified
     if (success && writeUpdate) {
         success = UpdateFile::rewind(errorStr, sizeof(errorStr));
     }
 
+    uint32_t imageCrc = 0;
+
     if (success && writeUpdate) {
-        printf("writing update image to 0x%08lx ...\n", CONFIG_APPLICATION_ADDR);
+        printf("staging update image at 0x%08lx ...\n", CONFIG_STAGING_ADDR);
+
+        drawScreen(currentStr, "erasing ...");
 
         flash_unlock();
+        crcReset();
 
-        uint32_t addr = CONFIG_APPLICATION_ADDR;
-        uint32_t buf[1024 / 4];
+        eraseRange(CONFIG_STAGING_ADDR, CONFIG_STAGING_IMAGE_OFFSET + updateSize);
+
+        uint32_t addr = CONFIG_STAGING_ADDR + CONFIG_STAGING_IMAGE_OFFSET;
         size_t bytesLeft = updateSize;
 
         while (bytesLeft > 0) {
             int progress = ((updateSize - bytesLeft) * 100) / updateSize;
-            snprintf(updateStr, sizeof(updateStr), "writing image %d%%", progress);
+            snprintf(updateStr, sizeof(updateStr), "staging image %d%%", progress);
             drawScreen(currentStr, updateStr);
-            size_t chunkSize = bytesLeft < sizeof(buf) ? bytesLeft : sizeof(buf);
-            if (!UpdateFile::read(buf, chunkSize, errorStr, sizeof(errorStr))) {
+            size_t chunkSize = bytesLeft < sizeof(transferBuffer) ? bytesLeft : sizeof(transferBuffer);
+            if (!UpdateFile::read(transferBuffer, chunkSize, errorStr, sizeof(errorStr))) {
                 success = false;
                 break;
             }
 
-            int sector = flashSectorIndex(addr);
-            if (sector >= 0) {
-                printf("erasing sector %d at 0x%08lx ... ", sector, addr);
-                flash_erase_sector(sector, 2);
-                flash_wait_for_last_operation();
-                printf("done\n");
+            size_t chunkWords = (chunkSize + 3) / 4;
+
+            // pad the trailing bytes so the programmed words and the CRC
+            // are deterministic
+            if (chunkSize % 4 != 0) {
+                memset(reinterpret_cast<uint8_t *>(transferBuffer) + chunkSize, 0xff, 4 - chunkSize % 4);
             }
 
-            for (size_t i = 0; i < (chunkSize + 3) / 4; ++i) {
-                flash_program_word(addr, buf[i]);
+            imageCrc = crcProcess(transferBuffer, chunkWords);
+
+            for (size_t i = 0; i < chunkWords; ++i) {
+                flash_program_word(addr, transferBuffer[i]);
                 flash_wait_for_last_operation();
                 addr += 4;
             }
@@ -275,40 +369,43 @@ static void bootloader() {
             bytesLeft -= chunkSize;
         }
 
-        flash_lock();
-
+        // verify the staged image and seal it with the header, the header is
+        // programmed last so a torn staging pass reads as an empty slot
         if (success) {
-            printf("write successful\n");
+            crcReset();
+            uint32_t stagedCrc = crcProcess(reinterpret_cast<const uint32_t *>(CONFIG_STAGING_ADDR + CONFIG_STAGING_IMAGE_OFFSET), (updateSize + 3) / 4);
+            success = stagedCrc == imageCrc;
+            if (success) {
+                StagingHeader header = { CONFIG_STAGING_MAGIC, uint32_t(updateSize), imageCrc };
+                const uint32_t *headerWords = reinterpret_cast<const uint32_t *>(&header);
+                for (size_t i = 0; i < sizeof(StagingHeader) / 4; ++i) {
+                    flash_program_word(CONFIG_STAGING_ADDR + i * 4, headerWords[i]);
+                    flash_wait_for_last_operation();
+                }
+                printf("staging successful\n");
+            } else {
+                printf("staging failed (crc32 mismatch)\n");
+                snprintf(errorStr, sizeof(errorStr), "staging image failed");
+            }
         } else {
-            printf("failed to write update image: %s\n", errorStr);
+            printf("failed to stage update image: %s\n", errorStr);
         }
+
+        flash_lock();
     }
 
-    // verify written image
+    // activate the staged image
     if (success && writeUpdate) {
-        printf("verifying written image ...\n");
-        drawScreen(currentStr, "verifying");
-
-        MD5 md5;
-        md5.update(reinterpret_cast<void *>(CONFIG_APPLICATION_ADDR), updateSize);
-        MD5::Sum computedMd5;
-        md5.finish(computedMd5);
-
-        printf("computed md5sum: ");
-        for (size_t i = 0; i < sizeof(computedMd5); ++i) {
-            printf("%02x", computedMd5[i]);
-        }
-        printf("\n");
-
-        success = memcmp(updateMd5, computedMd5, sizeof(MD5::Sum)) == 0;
+        success = activateStagedImage(currentStr);
         if (success) {
-            printf("verify successful\n");
+            printf("update successful\n");
             snprintf(updateStr, sizeof(updateStr), "successful");
         } else {
-            printf("verify failed (md5sum mismatch)\n");
+            printf("update failed (crc32 mismatch)\n");
             snprintf(errorStr, sizeof(errorStr), "writing image failed");
 
-            // invalidate version tag
+            // invalidate version tag, the next boot retries the activation
+            // from the staged image
             flash_unlock();
             for (uint32_t addr = 0; addr < sizeof(VersionTag); addr += 4) {
                 flash_program_word(CONFIG_APPLICATION_ADDR + CONFIG_VERSION_TAG_OFFSET + addr, 0);
@@ -337,7 +434,19 @@ int main(void) {
     printf("\nbootloader %d.%d\n", CONFIG_VERSION_MAJOR, CONFIG_VERSION_MINOR);
 
     // enter bootloader mode if encoder is pressed or no valid image is found
-    if (Encoder::down() || !currentVersion.isValid()) {
+    if (Encoder::down()) {
+        bootloader();
+    } else if (!currentVersion.isValid()) {
+        // recover a broken application image from the staging slot before
+        // falling back to the sd card update path
+        if (stagingHeader.isValid()) {
+            char currentStr[32];
+            formatVersion(currentVersion, currentStr, sizeof(currentStr));
+            printf("invalid image, recovering staged image ...\n");
+            if (activateStagedImage(currentStr)) {
+                System::reset();
+            }
+        }
         bootloader();
     } else {
         startApplication();
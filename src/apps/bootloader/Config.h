@@ -16,6 +16,11 @@
 #define CONFIG_UPDATE_FILENAME      "UPDATE.DAT"
 
 #define CONFIG_APPLICATION_ADDR     0x08010000
-#define CONFIG_APPLICATION_SIZE     0xF0000
+#define CONFIG_APPLICATION_SIZE     0x70000
 #define CONFIG_VERSION_TAG_OFFSET   0x400
 #define CONFIG_VERSION_TAG_MAGIC    0xfadebabe
+
+#define CONFIG_STAGING_ADDR         0x08080000
+#define CONFIG_STAGING_SIZE         0x80000
+#define CONFIG_STAGING_IMAGE_OFFSET 0x20
+#define CONFIG_STAGING_MAGIC        0xfeedc0de
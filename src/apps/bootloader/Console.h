@@ -1,6 +1,6 @@
 #pragma once
 
-#include "lib/stb_sprintf.h"
+#include "stb/stb_sprintf.h"
 
 #include <cstdlib>
 
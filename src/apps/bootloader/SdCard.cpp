@@ -59,14 +59,10 @@ bool SdCard::available() {
 
 bool SdCard::read(uint8_t *buf, uint32_t sector, uint8_t count) {
     // DBG("read(sector=%d,count=%d)", sector, count);
-    uint8_t *data = buf;
-    for (uint32_t i = 0; i < count; ++i) {
-        if (!readBlock(sector + i, data)) {
-            return false;
-        }
-        data += 512;
+    if (count == 0) {
+        return true;
     }
-    return true;
+    return readBlocks(sector, buf, count);
 }
 
 bool SdCard::cardDetect() {
@@ -295,9 +291,9 @@ bool SdCard::waitDataReady() {
     return false;
 }
 
-bool SdCard::readBlock(uint32_t address, void *buffer) {
+bool SdCard::readBlocks(uint32_t address, void *buffer, uint32_t count) {
     ASSERT(buffer >= (void *)0x20000000, "buffer not in SRAM");
-    // DBG("readBlock(address=%lu, buffer=%p)", address, buffer);
+    // DBG("readBlocks(address=%lu, buffer=%p, count=%lu)", address, buffer, count);
     if (!waitDataReady()) {
         return false;
     }
@@ -341,11 +337,12 @@ bool SdCard::readBlock(uint32_t address, void *buffer) {
     SDIO_DTIMER = 2400000;
 
     // These two registers must be set before SDIO_DCTRL.
-    SDIO_DLEN = 512;
+    SDIO_DLEN = count * 512;
     SDIO_DCTRL = SDIO_DCTRL_DBLOCKSIZE_9 | SDIO_DCTRL_DMAEN |
                  SDIO_DCTRL_DTDIR | SDIO_DCTRL_DTEN;
 
-    if (sendCommandWait(17, address) != Success) {
+    // CMD17 (READ_SINGLE_BLOCK) / CMD18 (READ_MULTIPLE_BLOCK)
+    if (sendCommandWait(count > 1 ? 18 : 17, address) != Success) {
         return false;
     }
 
@@ -353,8 +350,9 @@ bool SdCard::readBlock(uint32_t address, void *buffer) {
                                           SDIO_STA_RXOVERR |
                                           SDIO_STA_DTIMEOUT |
                                           SDIO_STA_DCRCFAIL);
-    const uint32_t DATA_RX_SUCCESS_FLAGS = (SDIO_STA_DBCKEND |
-                                            SDIO_STA_DATAEND);
+    // DBCKEND fires after every block of a multi-block transfer, DATAEND
+    // only after the full DLEN bytes have been received
+    const uint32_t DATA_RX_SUCCESS_FLAGS = SDIO_STA_DATAEND;
 
     while (!dma_get_interrupt_flag(DMA2, DMA_STREAM3, DMA_TCIF)) {
         // TODO maybe we'd better use interrupts
@@ -377,5 +375,10 @@ bool SdCard::readBlock(uint32_t address, void *buffer) {
         // os::this_task::yield();
     }
 
+    // CMD12 (STOP_TRANSMISSION) terminates a multi-block transfer
+    if (count > 1 && sendCommandWait(12, 0) != Success) {
+        return false;
+    }
+
     return true;
 }
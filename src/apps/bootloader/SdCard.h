@@ -45,7 +45,7 @@ private:
     static bool initCard();
     static bool waitDataReady();
 
-    static bool readBlock(uint32_t address, void *buffer);
+    static bool readBlocks(uint32_t address, void *buffer, uint32_t count);
 
     static bool _initialized;
     static CardInfo _cardInfo;
@@ -28,15 +28,22 @@
 // Settings flash storage
 #define CONFIG_SETTINGS_FLASH_SECTOR    3
 #define CONFIG_SETTINGS_FLASH_ADDR      0x0800C000
+#define CONFIG_SETTINGS_FLASH_SIZE      0x4000
 
-// Parts per quarter note
+// Parts per quarter note (default tick resolution)
 #define CONFIG_PPQN                     192
 
+// Highest selectable tick resolution (see ClockSetup::Ppqn)
+#define CONFIG_PPQN_MAX                 384
+
 // Sequence parts per quarter note resolution
 #define CONFIG_SEQUENCE_PPQN            48
 
 // Default UI frames per second
-#define CONFIG_DEFAULT_UI_FPS           50
+#define CONFIG_DEFAULT_UI_FPS           60
+
+// UI frames per second when idle (no input, no model changes, engine stopped)
+#define CONFIG_IDLE_UI_FPS              5
 
 // CV/Gate channels
 #define CONFIG_CHANNEL_COUNT            8
@@ -0,0 +1,85 @@
+#include "ProfilerExporter.h"
+
+#if CONFIG_ENABLE_PROFILER
+
+#include "model/FileManager.h"
+
+#include "core/fs/File.h"
+#include "core/profiler/Profiler.h"
+#include "core/utils/StringBuilder.h"
+
+#include "os/os.h"
+
+static const char *exportPath = "PROFILE.CSV";
+
+RingBuffer<ProfilerExporter::Snapshot, ProfilerExporter::SnapshotCount> ProfilerExporter::_snapshots;
+bool ProfilerExporter::_headerWritten;
+volatile bool ProfilerExporter::_taskPending;
+
+void ProfilerExporter::update() {
+    Snapshot snapshot;
+    snapshot.timeMs = os::ticks();
+
+    int column = 0;
+    for (int i = 0; i < Profiler::numIntervals() && column < MaxColumns; ++i) {
+        snapshot.values[column++] = Profiler::interval(i).avg;
+    }
+    for (int i = 0; i < Profiler::numCounters() && column < MaxColumns; ++i) {
+        snapshot.values[column++] = Profiler::counter(i).count;
+    }
+    snapshot.columns = column;
+
+    // drop the snapshot when the buffer has not been flushed in time, losing
+    // a sample beats stalling the profiler task
+    if (!_snapshots.full()) {
+        _snapshots.write(snapshot);
+    }
+
+    if (_snapshots.entries() >= FlushThreshold && !_taskPending && FileManager::volumeMounted()) {
+        _taskPending = true;
+        FileManager::task([] () {
+            return writeSnapshots();
+        }, [] (fs::Error result) {
+            _taskPending = false;
+        });
+    }
+}
+
+fs::Error ProfilerExporter::writeSnapshots() {
+    fs::File file(exportPath, _headerWritten ? fs::File::Append : fs::File::Write);
+    if (file.error() != fs::OK) {
+        return file.error();
+    }
+
+    if (!_headerWritten) {
+        FixedStringBuilder<256> header("time");
+        for (int i = 0; i < Profiler::numIntervals(); ++i) {
+            header(",%s", Profiler::interval(i).desc);
+        }
+        for (int i = 0; i < Profiler::numCounters(); ++i) {
+            header(",%s", Profiler::counter(i).desc);
+        }
+        header("\n");
+        if (file.writeAll(header, header.length()) != fs::OK) {
+            return file.error();
+        }
+        _headerWritten = true;
+    }
+
+    while (!_snapshots.empty()) {
+        auto snapshot = _snapshots.read();
+        FixedStringBuilder<256> line("%lu", snapshot.timeMs);
+        for (int i = 0; i < snapshot.columns; ++i) {
+            line(",%lu", snapshot.values[i]);
+        }
+        line("\n");
+        if (file.writeAll(line, line.length()) != fs::OK) {
+            return file.error();
+        }
+    }
+
+    file.close();
+    return file.error();
+}
+
+#endif // CONFIG_ENABLE_PROFILER
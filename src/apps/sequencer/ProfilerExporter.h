@@ -0,0 +1,41 @@
+#pragma once
+
+#include "SystemConfig.h"
+
+#if CONFIG_ENABLE_PROFILER
+
+#include "core/fs/Error.h"
+#include "core/utils/RingBuffer.h"
+
+#include <cstdint>
+
+// Periodically snapshots the profiler's interval and counter stats and
+// appends them as rows of a csv file on the sd card, so performance data
+// can be collected at a gig and analyzed later without a serial hookup.
+// Snapshots accumulate in a ring buffer in RAM and are flushed through the
+// file task, keeping sd card access off the profiler task.
+class ProfilerExporter {
+public:
+    // takes a snapshot of the current profiler stats and queues a flush to
+    // the sd card once enough snapshots have accumulated
+    static void update();
+
+private:
+    static constexpr int MaxColumns = 32;
+    static constexpr size_t SnapshotCount = 8;
+    static constexpr size_t FlushThreshold = SnapshotCount / 2;
+
+    struct Snapshot {
+        uint32_t timeMs;
+        uint8_t columns;
+        uint32_t values[MaxColumns];
+    };
+
+    static fs::Error writeSnapshots();
+
+    static RingBuffer<Snapshot, SnapshotCount> _snapshots;
+    static bool _headerWritten;
+    static volatile bool _taskPending;
+};
+
+#endif // CONFIG_ENABLE_PROFILER
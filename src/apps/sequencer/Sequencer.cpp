@@ -15,13 +15,19 @@
 #include "drivers/UsbH.h"
 #include "drivers/UsbMidi.h"
 #include "drivers/ClockTimer.h"
+#include "drivers/Crc.h"
 #include "drivers/SdCard.h"
 
 #include "os/os.h"
 
 #include "core/profiler/Profiler.h"
+#include "core/profiler/SamplingProfiler.h"
+#include "core/profiler/Trace.h"
 #include "core/fs/Volume.h"
 
+#include "ProfilerExporter.h"
+#include "StartupProfiler.h"
+
 #include "model/Model.h"
 #include "model/FileManager.h"
 #include "engine/Engine.h"
@@ -88,6 +94,7 @@ static void taskAlive(uint32_t task) {
 }
 
 static CCMRAM_BSS os::PeriodicTask<CONFIG_DRIVER_TASK_STACK_SIZE> driverTask("driver", CONFIG_DRIVER_TASK_PRIORITY, os::time::ms(1), [] () {
+    gateOutput.process();
     shiftRegister.process();
     blm.process();
     encoder.process();
@@ -114,16 +121,20 @@ static os::PeriodicTask<CONFIG_FILE_TASK_STACK_SIZE> fsTask("file", CONFIG_FILE_
     // no task alive handling because processTask() can take a long time to complete
 });
 
-#if CONFIG_ENABLE_PROFILER || CONFIG_ENABLE_TASK_PROFILER
+#if CONFIG_ENABLE_PROFILER || CONFIG_ENABLE_TASK_PROFILER || CONFIG_ENABLE_SAMPLING_PROFILER
 static CCMRAM_BSS os::PeriodicTask<CONFIG_PROFILER_TASK_STACK_SIZE> profilerTask("profiler", 0, os::time::ms(5000), [&] () {
 #if CONFIG_ENABLE_PROFILER
     profiler.dump();
+    ProfilerExporter::update();
 #endif // CONFIG_ENABLE_PROFILE
 #if CONFIG_ENABLE_TASK_PROFILER
     os::TaskProfiler::dump();
 #endif // CONFIG_ENABLE_TASK_PROFILER
+#if CONFIG_ENABLE_SAMPLING_PROFILER
+    SamplingProfiler::dump();
+#endif // CONFIG_ENABLE_SAMPLING_PROFILER
 });
-#endif // CONFIG_ENABLE_PROFILER || CONFIG_ENABLE_TASK_PROFILER
+#endif // CONFIG_ENABLE_PROFILER || CONFIG_ENABLE_TASK_PROFILER || CONFIG_ENABLE_SAMPLING_PROFILER
 
 static void assert_handler(const char *filename, int line, const char *msg) {
     ui.showAssert(filename, line, msg);
@@ -144,10 +155,15 @@ int main(void) {
     System::startWatchdog(1000);
     Console::init();
     HighResolutionTimer::init();
+    Crc::init();
 
     dbg_set_assert_handler(&assert_handler);
 
     profiler.init();
+    Trace::init();
+    SamplingProfiler::init([] (SamplingProfiler::TaskHandle task) {
+        return static_cast<const char *>(pcTaskGetName(TaskHandle_t(task)));
+    });
 
     shiftRegister.init();
     clockTimer.init();
@@ -164,12 +180,27 @@ int main(void) {
     usbh.powerOn();
     sdCard.init();
 
+    StartupProfiler::record(StartupProfiler::PhaseDrivers, HighResolutionTimer::us());
+
     model.init();
     model.settings().readFromFlash();
 
+    StartupProfiler::record(StartupProfiler::PhaseModel, HighResolutionTimer::us());
+
     engine.init();
+
+    StartupProfiler::record(StartupProfiler::PhaseEngine, HighResolutionTimer::us());
+
     ui.init();
 
+    StartupProfiler::record(StartupProfiler::PhaseUi, HighResolutionTimer::us());
+
+    for (int phase = 0; phase < StartupProfiler::PhaseLast; ++phase) {
+        DBG("boot: %s finished at %lu us",
+            StartupProfiler::phaseName(StartupProfiler::Phase(phase)),
+            StartupProfiler::phaseUs(StartupProfiler::Phase(phase)));
+    }
+
     System::resetWatchdog();
 
 	os::startScheduler();
@@ -1,11 +1,149 @@
 #include "SequencerApp.h"
 
+#include "model/MemoryMap.h"
+
+#include "core/profiler/Trace.h"
+
 #include "sim/Simulator.h"
+#include "sim/TargetTrace.h"
+#include "sim/TargetTraceRecorder.h"
+#include "sim/TargetTracePlayer.h"
 #include "sim/frontend/Frontend.h"
 
+#include <chrono>
 #include <memory>
+#include <string>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Headless mode: free-runs the engine over deterministic virtual time as fast
+// as the host allows, without the SDL frontend and without rendering the UI.
+// Gate/CV transitions are captured to a target trace, enabling timing
+// regression tests and fast soak tests of long songs. With --replay, an input
+// trace recorded in the frontend (sequencer --record FILE) is injected at its
+// original virtual timestamps while the full application (engine and UI) runs,
+// turning a captured button/encoder/midi sequence into a reproducible
+// performance test.
+static int headlessMain(int argc, char *argv[]) {
+    int bars = 16;
+    std::string traceFilename;
+    std::string replayFilename;
+
+    for (int i = 2; i < argc; ++i) {
+        if (strcmp(argv[i], "--bars") == 0 && i + 1 < argc) {
+            bars = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            traceFilename = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayFilename = argv[++i];
+        } else {
+            printf("usage: sequencer --headless [--bars N] [--trace FILE] [--replay FILE]\n");
+            return 1;
+        }
+    }
+
+    bool replay = !replayFilename.empty();
+
+    std::unique_ptr<SequencerApp> app;
+
+    sim::Simulator sim({
+        .create = [&] () {
+            app.reset(new SequencerApp());
+        },
+        .destroy = [&] () {
+            app.reset();
+        },
+        .update = [&] () {
+            // replay runs the full application so UI costs are captured
+            if (replay) {
+                app->update();
+            } else {
+                app->engine.update();
+            }
+        }
+    });
+
+    sim::TargetTrace targetTrace;
+    sim::TargetTraceRecorder targetTraceRecorder(targetTrace);
+    sim.registerTargetTickObserver(&targetTraceRecorder);
+    sim.registerTargetInputObserver(&targetTraceRecorder);
+    sim.registerTargetOutputObserver(&targetTraceRecorder);
+
+    sim::TargetTrace inputTrace;
+    std::unique_ptr<sim::TargetTracePlayer> inputPlayer;
+    if (replay) {
+        inputTrace.loadFromFile(replayFilename);
+        inputPlayer.reset(new sim::TargetTracePlayer(inputTrace, &sim, nullptr));
+        sim.registerTargetTickObserver(inputPlayer.get());
+    }
+
+    // create the target and start the clock (the replayed inputs drive the
+    // clock themselves)
+    sim.wait(1);
+    if (!replay) {
+        app->engine.clockStart();
+    }
+
+    uint32_t lastTick = uint32_t(bars) * app->engine.measureDivisor();
+
+    if (replay) {
+        // run one second of virtual time past the last recorded input
+        uint32_t durationMs = inputTrace.lastInputTime() + 1000;
+        printf("replaying '%s' (%u ms of virtual time) ...\n", replayFilename.c_str(), unsigned(durationMs));
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+        sim.wait(durationMs);
+        auto endTime = std::chrono::high_resolution_clock::now();
+
+        double wallSeconds = std::chrono::duration<double>(endTime - startTime).count();
+        double virtualSeconds = sim.ticks() * 0.001;
+
+        printf("replayed %.1f s in %.3f s wall time (%.1fx realtime)\n",
+            virtualSeconds, wallSeconds, virtualSeconds / wallSeconds);
+
+        if (!traceFilename.empty()) {
+            targetTrace.saveToFile(traceFilename);
+            printf("trace written to '%s'\n", traceFilename.c_str());
+        }
+
+        return 0;
+    }
+
+    printf("running %d bars (%u ticks) of virtual time ...\n", bars, unsigned(lastTick));
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    while (app->engine.tick() < lastTick) {
+        sim.wait(1);
+    }
+    auto endTime = std::chrono::high_resolution_clock::now();
+
+    double wallSeconds = std::chrono::duration<double>(endTime - startTime).count();
+    double virtualSeconds = sim.ticks() * 0.001;
+
+    printf("simulated %.1f s in %.3f s wall time (%.1fx realtime)\n",
+        virtualSeconds, wallSeconds, virtualSeconds / wallSeconds);
+    printf("captured %zu gate and %zu cv transitions\n",
+        targetTrace.gateOutput.items().size(), targetTrace.dac.items().size());
+
+    if (!traceFilename.empty()) {
+        targetTrace.saveToFile(traceFilename);
+        printf("trace written to '%s'\n", traceFilename.c_str());
+    }
+
+    return 0;
+}
 
 int main(int argc, char *argv[]) {
+    Trace::init();
+
+    MemoryMap::dump();
+
+    if (argc > 1 && strcmp(argv[1], "--headless") == 0) {
+        return headlessMain(argc, argv);
+    }
+
     std::unique_ptr<SequencerApp> app;
 
     sim::Simulator sim({
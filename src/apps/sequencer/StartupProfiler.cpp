@@ -0,0 +1,3 @@
+#include "StartupProfiler.h"
+
+uint32_t StartupProfiler::_phaseUs[StartupProfiler::PhaseLast];
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+
+// Records the completion timestamp of each boot phase in main() so
+// boot-to-first-tick latency can be inspected on the system page. Timestamps
+// are in microseconds since HighResolutionTimer::init().
+class StartupProfiler {
+public:
+    enum Phase {
+        PhaseDrivers,
+        PhaseModel,
+        PhaseEngine,
+        PhaseUi,
+        PhaseLast
+    };
+
+    static const char *phaseName(Phase phase) {
+        switch (phase) {
+        case PhaseDrivers:  return "drivers";
+        case PhaseModel:    return "model";
+        case PhaseEngine:   return "engine";
+        case PhaseUi:       return "ui";
+        case PhaseLast:     break;
+        }
+        return nullptr;
+    }
+
+    static void record(Phase phase, uint32_t us) {
+        _phaseUs[phase] = us;
+    }
+
+    static uint32_t phaseUs(Phase phase) {
+        return _phaseUs[phase];
+    }
+
+    static uint32_t totalUs() {
+        return _phaseUs[PhaseLast - 1];
+    }
+
+private:
+    static uint32_t _phaseUs[PhaseLast];
+};
@@ -1,7 +1,6 @@
 #include "Asteroids.h"
 
 #include "core/Debug.h"
-#include "core/math/Mat3.h"
 #include "core/utils/Random.h"
 #include "core/utils/StringBuilder.h"
 
@@ -17,8 +16,31 @@ static const float TwoPi = 2.f * Pi;
 static const int ScreenWidth = 256;
 static const int ScreenHeight = 64;
 
+// sine table indexed in 1/256th of a turn. all trig in the frame loop goes
+// through the table instead of libm, angles are quantized to ~1.4 degrees
+// which is below what the display resolves
+static std::array<float, 256> sinTable;
+
+static void initSinTable() {
+    for (size_t i = 0; i < sinTable.size(); ++i) {
+        sinTable[i] = std::sin(float(i) * TwoPi / sinTable.size());
+    }
+}
+
+static inline int angleToIndex(float angle) {
+    return int(angle * (256.f / TwoPi)) & 255;
+}
+
+static inline float fastSin(float angle) {
+    return sinTable[angleToIndex(angle)];
+}
+
+static inline float fastCos(float angle) {
+    return sinTable[(angleToIndex(angle) + 64) & 255];
+}
+
 static Vec2 directionFromAngle(float angle) {
-    return Vec2(std::sin(angle), -std::cos(angle));
+    return Vec2(fastSin(angle), -fastCos(angle));
 }
 
 static Random rng;
@@ -51,19 +73,25 @@ static const std::array<Vec2, 4> playerShape = {{
 typedef std::array<Vec2, 16> AsteroidShape;
 static std::array<AsteroidShape, 4> asteroidShapes;
 
-static void drawShape(Canvas &canvas, Mat3 &transform, const Vec2 *vertices, size_t count) {
+// draws a closed shape with the affine transform applied inline (4 multiplies
+// per vertex instead of a full 3x3 matrix multiply)
+static void drawShape(Canvas &canvas, const Vec2 &position, float angle, float scale, const Vec2 *vertices, size_t count) {
+    float s = fastSin(angle) * scale;
+    float c = fastCos(angle) * scale;
+
     Vec2 a, b;
-    a = transform * vertices[0];
+    a = Vec2(c * vertices[0].x - s * vertices[0].y + position.x, s * vertices[0].x + c * vertices[0].y + position.y);
     for (size_t i = 1; i <= count; ++i) {
-        b = transform * vertices[i % count];
+        const Vec2 &v = vertices[i % count];
+        b = Vec2(c * v.x - s * v.y + position.x, s * v.x + c * v.y + position.y);
         canvas.line(a.x, a.y, b.x, b.y);
         a = b;
     }
 }
 
 template<size_t N>
-static void drawShape(Canvas &canvas, Mat3 &transform, const std::array<Vec2, N> &vertices) {
-    drawShape(canvas, transform, vertices.data(), vertices.size());
+static void drawShape(Canvas &canvas, const Vec2 &position, float angle, float scale, const std::array<Vec2, N> &vertices) {
+    drawShape(canvas, position, angle, scale, vertices.data(), vertices.size());
 }
 
 static float shapeRadius(const Vec2 *vertices, size_t count) {
@@ -215,8 +243,7 @@ void Player::draw(Canvas &canvas) {
         return;
     }
     canvas.setColor(0xf);
-    Mat3 transform = Mat3::transform2D(_position, _angle, 1.f);
-    drawShape(canvas, transform, playerShape);
+    drawShape(canvas, _position, _angle, 1.f, playerShape);
 }
 
 //-----------------------------------------------------------------------------
@@ -224,9 +251,11 @@ void Player::draw(Canvas &canvas) {
 //-----------------------------------------------------------------------------
 
 void Asteroid::spawn(uint8_t category, uint8_t shape, const Vec2 &position, const Vec2 &velocity, float angle, float angleVelocity) {
+    // sqrt(2)^(category - 1) for categories 0..3
+    static const float scaleTable[] = { 0.7071f, 1.f, 1.4142f, 2.f };
     _category = category;
     _shape = shape;
-    _scale = std::pow(1.414f, (_category - 1.f));
+    _scale = scaleTable[std::min<size_t>(_category, sizeof(scaleTable) / sizeof(scaleTable[0]) - 1)];
     initBody(_scale * _scale, 0.9f * _scale * shapeRadius(asteroidShapes[_shape]), position, velocity, angle, angleVelocity);
 }
 
@@ -238,8 +267,7 @@ void Asteroid::update(float dt) {
 
 void Asteroid::draw(Canvas &canvas) {
     canvas.setColor(0x7);
-    Mat3 transform = Mat3::transform2D(_position, _angle, _scale);
-    drawShape(canvas, transform, asteroidShapes[_shape]);
+    drawShape(canvas, _position, _angle, _scale, asteroidShapes[_shape]);
 }
 
 //-----------------------------------------------------------------------------
@@ -306,6 +334,7 @@ Game::Game() :
 {}
 
 void Game::init() {
+    initSinTable();
     initAsteroidShapes();
     setState(Intro);
 }
@@ -21,11 +21,17 @@ ArpeggiatorEngine::ArpeggiatorEngine(const Arpeggiator &arpeggiator) :
 void ArpeggiatorEngine::reset() {
     _stepIndex = -1;
     _noteIndex = 0;
-    _noteOrder = 0;
 
     _octave = 0;
     _octaveDirection = 0;
 
+    while (_noteList) {
+        Note *next = _noteList->nextNote;
+        _notePool.release(_noteList);
+        _noteList = next;
+    }
+    _orderHead = nullptr;
+    _orderTail = nullptr;
     _noteCount = 0;
     _noteHoldCount = 0;
 }
@@ -43,12 +49,12 @@ void ArpeggiatorEngine::noteOff(int note) {
     // printNotes();
 }
 
-void ArpeggiatorEngine::tick(uint32_t tick, int swing) {
+void ArpeggiatorEngine::tick(uint32_t tick, int swing, int ppqn) {
     if (!_arpeggiator.hold() && _noteHoldCount == 0) {
         reset();
     }
 
-    uint32_t divisor = _arpeggiator.divisor() * (CONFIG_PPQN / CONFIG_SEQUENCE_PPQN);
+    uint32_t divisor = _arpeggiator.divisor() * (ppqn / CONFIG_SEQUENCE_PPQN);
 
     if (tick % divisor == 0) {
         if (_noteCount > 0) {
@@ -60,12 +66,13 @@ void ArpeggiatorEngine::tick(uint32_t tick, int swing) {
             // flip pattern direction when going down octaves
             int noteIndex = _octaveDirection == -1 ? _noteCount - _noteIndex - 1 : _noteIndex;
 
-            uint8_t note = uint8_t(clamp(_notes[noteIndex].note + _octave * 12, 0, 127));
+            uint8_t note = uint8_t(clamp(noteByIndex(noteIndex) + _octave * 12, 0, 127));
             uint32_t length = std::max(uint32_t(1), uint32_t((divisor * _arpeggiator.gateLength()) / 100));
             // delay note off if gate length is at maximum to enable legato style playback
             length += _arpeggiator.gateLength() == 100 ? 1u : 0u;
-            _eventQueue.push({ Event::NoteOn, Groove::applySwing(tick, swing), note, 127 });
-            _eventQueue.push({ Event::NoteOff, Groove::applySwing(tick + length, swing), note, 0 });
+            uint32_t swingBase = ppqn / 4;
+            _eventQueue.push({ Event::NoteOn, Groove::applySwing(tick, swing, swingBase), note, 127 });
+            _eventQueue.push({ Event::NoteOff, Groove::applySwing(tick + length, swing, swingBase), note, 0 });
         }
     }
 }
@@ -85,64 +92,104 @@ void ArpeggiatorEngine::addNote(int note) {
         return;
     }
 
-    // find insert position
-    int pos = 0;
-    while (pos < _noteCount && note > _notes[pos].note) {
-        ++pos;
+    // find insert position in pitch sorted list
+    Note **link = &_noteList;
+    while (*link && note > (*link)->note) {
+        link = &(*link)->nextNote;
     }
 
     // exit if note is already in note set
-    if (pos < _noteCount && note == _notes[pos].note) {
+    if (*link && note == (*link)->note) {
+        return;
+    }
+
+    Note *item = _notePool.allocate();
+    if (!item) {
         return;
     }
 
-    // insert into ordered note set
+    // insert into pitch sorted list
+    item->note = note;
+    item->nextNote = *link;
+    *link = item;
+
+    // append to insertion ordered list
+    item->nextOrder = nullptr;
+    if (_orderTail) {
+        _orderTail->nextOrder = item;
+    } else {
+        _orderHead = item;
+    }
+    _orderTail = item;
+
     ++_noteCount;
     ++_noteHoldCount;
-    for (int i = _noteCount - 1; i > pos; --i) {
-        _notes[i] = _notes[i - 1];
-    }
-    _notes[pos].note = note;
-    _notes[pos].order = _noteOrder++;
 }
 
 void ArpeggiatorEngine::removeNote(int note) {
-    for (int i = 0; i < _noteCount; ++i) {
-        if (note == _notes[i].note) {
+    for (Note **link = &_noteList; *link; link = &(*link)->nextNote) {
+        if (note == (*link)->note) {
             _noteHoldCount = _noteHoldCount > 0 ? _noteHoldCount - 1 : 0;
             // do not remove note in hold mode
             if (_arpeggiator.hold()) {
                 return;
             }
-            --_noteCount;
-            for (int j = i; j < _noteCount; ++j) {
-                _notes[j] = _notes[j + 1];
+
+            Note *item = *link;
+
+            // unlink from pitch sorted list
+            *link = item->nextNote;
+
+            // unlink from insertion ordered list
+            Note **orderLink = &_orderHead;
+            while (*orderLink != item) {
+                orderLink = &(*orderLink)->nextOrder;
             }
+            *orderLink = item->nextOrder;
+            if (_orderTail == item) {
+                _orderTail = nullptr;
+                for (Note *tail = _orderHead; tail; tail = tail->nextOrder) {
+                    _orderTail = tail;
+                }
+            }
+
+            _notePool.release(item);
+            --_noteCount;
             return;
         }
     }
 }
 
-int ArpeggiatorEngine::noteIndexFromOrder(int order) {
-    // search note index of note with given relative order
-    for (int noteIndex = 0; noteIndex < _noteCount; ++noteIndex) {
-        int currentOrder = 0;
-        for (int i = 0; i < _noteCount; ++i) {
-            if (_notes[i].order < _notes[noteIndex].order) {
-                ++currentOrder;
-            }
-        }
-        if (currentOrder == order) {
-            return noteIndex;
-        }
+int ArpeggiatorEngine::noteByIndex(int index) const {
+    const Note *item = _noteList;
+    while (index-- > 0 && item) {
+        item = item->nextNote;
+    }
+    return item ? item->note : 0;
+}
+
+int ArpeggiatorEngine::noteIndexFromOrder(int order) const {
+    // find note with given relative play order
+    const Note *item = _orderHead;
+    while (order-- > 0 && item) {
+        item = item->nextOrder;
+    }
+    if (!item) {
+        return 0;
+    }
+
+    // map back to index in pitch sorted list
+    int noteIndex = 0;
+    for (const Note *current = _noteList; current && current != item; current = current->nextNote) {
+        ++noteIndex;
     }
-    return 0;
+    return noteIndex;
 }
 
 void ArpeggiatorEngine::printNotes() {
     DBG("notes:");
-    for (int i = 0; i < _noteCount; ++i) {
-        DBG("note: %" PRIu8 ", order: %" PRIu32, _notes[i].note, _notes[i].order);
+    for (const Note *item = _noteList; item; item = item->nextNote) {
+        DBG("note: %" PRIu8, item->note);
     }
 }
 
@@ -4,7 +4,7 @@
 
 #include "model/Arpeggiator.h"
 
-#include <array>
+#include "core/utils/ObjectPool.h"
 
 #include <cstdint>
 
@@ -27,14 +27,15 @@ public:
     void noteOn(int note);
     void noteOff(int note);
 
-    void tick(uint32_t tick, int swing);
+    void tick(uint32_t tick, int swing, int ppqn);
 
     bool getEvent(uint32_t tick, Event &event);
 
 private:
     void addNote(int note);
     void removeNote(int note);
-    int noteIndexFromOrder(int order);
+    int noteByIndex(int index) const;
+    int noteIndexFromOrder(int order) const;
     void printNotes();
 
     void advanceStep();
@@ -46,16 +47,22 @@ private:
 
     int _stepIndex;
     int _noteIndex;
-    uint32_t _noteOrder;
     int8_t _octave;
     int8_t _octaveDirection;
 
+    // held notes are allocated from a fixed pool and threaded on two
+    // intrusive singly-linked lists: one sorted by pitch, one in insertion
+    // order, so noteOn/noteOff never shift or rescan the note set
     struct Note {
         uint8_t note;
-        uint32_t order;
+        Note *nextNote;     // pitch sorted list
+        Note *nextOrder;    // insertion ordered list
     };
 
-    std::array<Note, MaxNotes> _notes;
+    ObjectPool<Note, MaxNotes> _notePool;
+    Note *_noteList = nullptr;
+    Note *_orderHead = nullptr;
+    Note *_orderTail = nullptr;
     int8_t _noteCount;
     int8_t _noteHoldCount;
 
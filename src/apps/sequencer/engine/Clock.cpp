@@ -7,6 +7,7 @@
 #include "core/math/Math.h"
 #include "core/midi/MidiMessage.h"
 #include "drivers/ClockTimer.h"
+#include "drivers/HighResolutionTimer.h"
 
 #include <cmath>
 
@@ -20,6 +21,7 @@ Clock::Clock(ClockTimer &timer) :
 
 void Clock::init() {
     _timer.disable();
+    slavePreArm();
 }
 
 void Clock::setListener(Listener *listener) {
@@ -80,6 +82,7 @@ void Clock::masterStop() {
     requestStop();
 
     _timer.disable();
+    slavePreArm();
 }
 
 void Clock::masterContinue() {
@@ -108,12 +111,43 @@ void Clock::masterReset() {
     requestReset();
 
     _timer.disable();
+    slavePreArm();
 }
 
 void Clock::setMasterBpm(float bpm) {
     os::InterruptLock lock;
 
+    if (bpm == _masterBpm) {
+        return;
+    }
+
     _masterBpm = bpm;
+    _masterBpmFixed = Fixed32_32::fromFloat(bpm);
+    updateOutputClockDuration();
+    if (_state == State::MasterRunning) {
+        setupMasterTimer();
+    }
+}
+
+void Clock::setPpqn(int ppqn) {
+    os::InterruptLock lock;
+
+    if (ppqn == _ppqn) {
+        return;
+    }
+
+    // rescale the tick counters so the musical position is preserved when
+    // the resolution changes while the clock is running, schedules already
+    // queued in the old resolution drain within one step
+    _tick = uint32_t((uint64_t(_tick) * ppqn) / _ppqn);
+    _tickProcessed = uint32_t((uint64_t(_tickProcessed) * ppqn) / _ppqn);
+    _output.nextTick = uint32_t((uint64_t(_output.nextTick) * ppqn) / _ppqn);
+
+    _ppqn = ppqn;
+    _midiTickDivisor = _ppqn / 24;
+    _midiTickCounter = 0;
+    updateOutputClockDuration();
+
     if (_state == State::MasterRunning) {
         setupMasterTimer();
     }
@@ -123,7 +157,7 @@ void Clock::slaveConfigure(int slave, int divisor, bool enabled) {
     _slaves[slave] = { divisor, enabled };
 }
 
-void Clock::slaveTick(int slave) {
+void Clock::slaveTick(int slave, uint32_t timestampUs) {
     os::InterruptLock lock;
 
     if (!slaveEnabled(slave)) {
@@ -136,17 +170,44 @@ void Clock::slaveTick(int slave) {
         // protect against clock rate overload
         _slaveSubTicksPending = std::min(_slaveSubTicksPending + divisor, 2 * divisor);
 
+        // edge time in the internal time base: interpolate between slave
+        // timer ticks using the timestamp captured in the input interrupt,
+        // so edge timing resolves to microseconds instead of the timer period
+        uint32_t edgeUs = _elapsedUs;
+        if (timestampUs != NoTimestamp) {
+            uint32_t offsetUs = timestampUs - _lastTimerTickTimestampUs;
+            if (offsetUs < SlaveTimerPeriod) {
+                edgeUs += offsetUs;
+            }
+        }
+
         // time past since last tick
-        uint32_t periodUs = _elapsedUs - _lastSlaveTickUs;
+        uint32_t periodUs = edgeUs - _lastSlaveTickUs;
 
         // default tick period to 120 bpm
         if (_slaveTickPeriodUs == 0) {
             _slaveTickPeriodUs = (60 * 1000000 * divisor) / (120 * _ppqn);
         }
 
-        // update tick period if we have a valid measurement
+        // phase-locked estimator: smooth the measured tick period and steer
+        // the predicted tick time towards the incoming clock edges, so jitter
+        // on the incoming clock does not modulate the sub tick rate
         if (periodUs > 0 && _lastSlaveTickUs > 0) {
-            _slaveTickPeriodUs = periodUs;
+            _slavePeriodAvg.push(periodUs);
+            _predictedSlaveTickUs += _slaveTickPeriodUs;
+            int32_t phaseErrorUs = int32_t(edgeUs - _predictedSlaveTickUs);
+            if (phaseErrorUs > int32_t(_slaveLockWindowUs) || phaseErrorUs < -int32_t(_slaveLockWindowUs)) {
+                // lost lock -> resync to the incoming clock
+                _slavePeriodAvg.reset();
+                _slavePeriodAvg.push(periodUs);
+                _predictedSlaveTickUs = edgeUs;
+                _slaveTickPeriodUs = periodUs;
+            } else {
+                // correct a fraction of the phase error on each tick
+                _slaveTickPeriodUs = std::max(int32_t(1), int32_t(_slavePeriodAvg()) + phaseErrorUs / SlaveLockGain);
+            }
+        } else {
+            _predictedSlaveTickUs = edgeUs;
         }
 
         _slaveSubTickPeriodUs = _slaveTickPeriodUs / _slaveSubTicksPending;
@@ -156,15 +217,19 @@ void Clock::slaveTick(int slave) {
             _nextSlaveSubTickUs += _slaveSubTickPeriodUs;
         }
 
-        // estimate slave BPM
+        // period of the outgoing midi clock (24 ppqn), derived from the
+        // phase-locked tick period estimate
+        _midiTickPeriodUs = (_slaveTickPeriodUs * _ppqn) / (24 * divisor);
+
+        // estimate slave BPM (integer math, this runs in interrupt context)
         if (periodUs > 0 && _lastSlaveTickUs > 0) {
-            float bpm = (60.f * 1000000 * divisor) / (periodUs * _ppqn);
-            _slaveBpmFiltered = 0.9f * _slaveBpmFiltered + 0.1f * bpm;
-            _slaveBpmAvg.push(_slaveBpmFiltered);
-            _slaveBpm = _slaveBpmAvg();
+            auto bpm = Fixed32_32::fromRatio(int64_t(60) * 1000000 * divisor, int64_t(periodUs) * _ppqn);
+            _slaveBpmFiltered = Fixed32_32::fromRaw((9 * _slaveBpmFiltered.raw() + bpm.raw()) / 10);
+            _slaveBpmAvg.push(_slaveBpmFiltered.raw());
+            _slaveBpm = Fixed32_32::fromRaw(_slaveBpmAvg());
         }
 
-        _lastSlaveTickUs = _elapsedUs;
+        _lastSlaveTickUs = edgeUs;
     }
 }
 
@@ -185,8 +250,14 @@ void Clock::slaveStart(int slave) {
 
     resetTicks();
 
-    _timer.disable();
-    setupSlaveTimer();
+    // when pre-armed, the timer is already configured for slave operation
+    // and starting degenerates to enabling it, so the first tick follows
+    // the start message with interrupt latency instead of setup work
+    if (!_slavePreArmed) {
+        _timer.disable();
+        setupSlaveTimer();
+    }
+    _slavePreArmed = false;
     _timer.enable();
 }
 
@@ -206,6 +277,7 @@ void Clock::slaveStop(int slave) {
     requestStop();
 
     _timer.disable();
+    slavePreArm();
 }
 
 void Clock::slaveContinue(int slave) {
@@ -223,7 +295,10 @@ void Clock::slaveContinue(int slave) {
     _activeSlave = slave;
     requestContinue();
 
-    setupSlaveTimer();
+    if (!_slavePreArmed) {
+        setupSlaveTimer();
+    }
+    _slavePreArmed = false;
     _timer.enable();
 }
 
@@ -243,6 +318,7 @@ void Clock::slaveReset(int slave) {
     requestReset();
 
     _timer.disable();
+    slavePreArm();
 }
 
 void Clock::slaveHandleMidi(int slave, uint8_t msg) {
@@ -268,6 +344,7 @@ void Clock::outputConfigure(int divisor, int pulse) {
     os::InterruptLock lock;
     _output.divisor = divisor;
     _output.pulse = pulse;
+    updateOutputClockDuration();
 }
 
 void Clock::outputConfigureSwing(int swing) {
@@ -309,6 +386,21 @@ bool Clock::checkTick(uint32_t *tick) {
     return false;
 }
 
+bool Clock::checkTickRange(uint32_t *first, uint32_t *last) {
+    os::InterruptLock lock;
+
+    if (_requestedEvents) {
+        return false;
+    }
+    if (_tickProcessed < _tick) {
+        *first = _tickProcessed;
+        *last = _tick - 1;
+        _tickProcessed = _tick;
+        return true;
+    }
+    return false;
+}
+
 void Clock::onClockTimerTick() {
     os::InterruptLock lock;
 
@@ -321,6 +413,7 @@ void Clock::onClockTimerTick() {
     }
     case State::SlaveRunning: {
         _elapsedUs += _timer.period();
+        _lastTimerTickTimestampUs = HighResolutionTimer::us();
 
         if (_slaveSubTicksPending > 0 && _elapsedUs >= _nextSlaveSubTickUs) {
             outputTick(_tick);
@@ -329,6 +422,18 @@ void Clock::onClockTimerTick() {
             _nextSlaveSubTickUs += _slaveSubTickPeriodUs;
         }
 
+        // outgoing midi clock runs on its own phase accumulator instead of
+        // the sub tick scheduler, so downstream gear sees evenly spaced
+        // 24 ppqn ticks even when sub ticks bunch up after a late clock edge
+        if (_midiTickPeriodUs > 0 && _elapsedUs >= _nextMidiTickUs) {
+            outputMidiMessage(MidiMessage::Tick);
+            _nextMidiTickUs += _midiTickPeriodUs;
+            if (_elapsedUs > _nextMidiTickUs) {
+                // resync after a stall or tempo change without bursting
+                _nextMidiTickUs = _elapsedUs;
+            }
+        }
+
         if (_mode == Mode::Auto && (_elapsedUs - _lastSlaveTickUs) > 500000) {
             slaveReset(_activeSlave);
         }
@@ -344,6 +449,10 @@ void Clock::resetTicks() {
     _tickProcessed = 0;
     _slaveSubTicksPending = 0;
     _output.nextTick = 0;
+    _midiTickDivisor = _ppqn / 24;
+    _midiTickCounter = 0;
+    _midiTickPeriodUs = 0;
+    _nextMidiTickUs = 0;
 }
 
 void Clock::requestStart() {
@@ -385,18 +494,37 @@ void Clock::setState(State state) {
 }
 
 void Clock::setupMasterTimer() {
+    _slavePreArmed = false;
     _elapsedUs = 0;
-    uint32_t us = (60 * 1000000) / (_masterBpm * _ppqn);
+    uint32_t us = uint32_t(Fixed32_32::idiv(60 * 1000000, _masterBpmFixed.mulInt(_ppqn)));
     _timer.setPeriod(us);
 }
 
 void Clock::setupSlaveTimer() {
     _elapsedUs = 0;
     _lastSlaveTickUs = 0;
+    _predictedSlaveTickUs = 0;
+    _slavePeriodAvg.reset();
 
     _timer.setPeriod(SlaveTimerPeriod);
 }
 
+// prepare the disabled timer for slave operation ahead of time, so an
+// external start does not pay for the timer reconfiguration; the tick
+// counters are left untouched to keep stop/continue semantics intact
+void Clock::slavePreArm() {
+    setupSlaveTimer();
+    _slavePreArmed = true;
+}
+
+// precomputed on bpm or pulse changes, so outputTick does no fixed point
+// division on the tick path; rounded up so the tick quantized falling edge
+// never cuts the pulse short of the configured width, it only acts as a
+// backstop behind the hardware pulse timer
+void Clock::updateOutputClockDuration() {
+    _output.clockDuration = uint32_t(_masterBpmFixed.mulInt(_ppqn * _output.pulse).divInt(60 * 1000).toInt()) + 1;
+}
+
 void Clock::outputMidiMessage(uint8_t msg) {
     os::InterruptLock lock;
     if (_listener) {
@@ -407,22 +535,30 @@ void Clock::outputMidiMessage(uint8_t msg) {
 void Clock::outputTick(uint32_t tick) {
     outputReset(false);
 
-    if (tick % (_ppqn / 24) == 0) {
-        outputMidiMessage(MidiMessage::Tick);
+    // midi clock: in master mode each timer tick is exactly one internal
+    // tick, so the divide-down counter is jitter free; in slave mode midi
+    // ticks come from the phase accumulator in onClockTimerTick instead
+    // (counter instead of tick % (_ppqn / 24), this runs in the timer
+    // interrupt)
+    if (_state == State::MasterRunning) {
+        if (_midiTickCounter == 0) {
+            outputMidiMessage(MidiMessage::Tick);
+            _midiTickCounter = _midiTickDivisor;
+        }
+        --_midiTickCounter;
     }
 
     // generate output clock with swing
 
     auto applySwing = [this] (uint32_t tick) {
-        return _output.swing != 0 ? Groove::applySwing(tick, _output.swing) : tick;
+        return _output.swing != 0 ? Groove::applySwing(tick, _output.swing, _ppqn / 4) : tick;
     };
 
     if (tick == _output.nextTick) {
         uint32_t divisor = _output.divisor;
-        uint32_t clockDuration = std::max(uint32_t(1), uint32_t(_masterBpm * _ppqn * _output.pulse / (60 * 1000)));
 
         _output.nextTickOn = applySwing(_output.nextTick);
-        _output.nextTickOff = std::min(_output.nextTickOn + clockDuration, applySwing(_output.nextTick + divisor) - 1);
+        _output.nextTickOff = std::min(_output.nextTickOn + _output.clockDuration, applySwing(_output.nextTick + divisor) - 1);
 
         _output.nextTick += divisor;
     }
@@ -2,6 +2,7 @@
 
 #include "Config.h"
 
+#include "core/math/Fixed.h"
 #include "core/utils/MovingAverage.h"
 
 #include "drivers/ClockTimer.h"
@@ -52,7 +53,8 @@ public:
     bool isRunning() const { return _state != State::Idle; }
 
     int ppqn() const { return _ppqn; }
-    float bpm() const { return _state == State::SlaveRunning ? _slaveBpm : _masterBpm; }
+    void setPpqn(int ppqn);
+    float bpm() const { return _state == State::SlaveRunning ? _slaveBpm.toFloat() : _masterBpm; }
     uint32_t tick() const { return _tick; }
     float tickDuration() const { return 60.f / (bpm() * _ppqn); }
 
@@ -66,22 +68,33 @@ public:
     void setMasterBpm(float bpm);
 
     // Slave clock control
+    // timestampUs is the HighResolutionTimer time of the clock edge, ticks
+    // without a timestamp quantize to the slave timer period
+    static constexpr uint32_t NoTimestamp = uint32_t(-1);
     void slaveConfigure(int slave, int divisor, bool enabled);
-    void slaveTick(int slave);
+    void slaveTick(int slave, uint32_t timestampUs = NoTimestamp);
     void slaveStart(int slave);
     void slaveStop(int slave);
     void slaveContinue(int slave);
     void slaveReset(int slave);
     void slaveHandleMidi(int slave, uint8_t msg);
 
+    // lock window of the slave clock estimator, phase errors within the
+    // window are corrected gradually, larger errors resync immediately
+    uint32_t slaveLockWindow() const { return _slaveLockWindowUs; }
+    void setSlaveLockWindow(uint32_t us) { _slaveLockWindowUs = us; }
+
     // Clock output
     void outputConfigure(int divisor, int pulse);
     void outputConfigureSwing(int swing);
     const OutputState &outputState() const { return _outputState; }
+    // width of the output clock pulse in microseconds
+    uint32_t outputClockPulseUs() const { return uint32_t(_output.pulse) * 1000; }
 
     // Sequencer interface
     Event checkEvent();
     bool checkTick(uint32_t *tick);
+    bool checkTickRange(uint32_t *first, uint32_t *last);
 
 private:
     enum class State {
@@ -105,6 +118,9 @@ private:
 
     void setupMasterTimer();
     void setupSlaveTimer();
+    void slavePreArm();
+
+    void updateOutputClockDuration();
 
     void outputMidiMessage(uint8_t msg);
     void outputTick(uint32_t tick);
@@ -116,6 +132,8 @@ private:
 
     static constexpr uint32_t SlaveTimerPeriod = 100; // us
     static constexpr size_t SlaveCount = 4;
+    static constexpr uint32_t DefaultSlaveLockWindowUs = 2000;
+    static constexpr int32_t SlaveLockGain = 4; // fraction of phase error corrected per tick
 
     Listener *_listener = nullptr;
 
@@ -125,6 +143,7 @@ private:
     Mode _mode = Mode::Auto;
 
     float _masterBpm = 120.f;
+    Fixed32_32 _masterBpmFixed = Fixed32_32::fromInt(120);
 
     struct Slave {
         int divisor;
@@ -136,15 +155,23 @@ private:
         int divisor;
         int pulse;
         int swing;
+        uint32_t clockDuration; // output pulse length in ticks, derived from bpm and pulse
         uint32_t nextTick;
         uint32_t nextTickOn;
         uint32_t nextTickOff;
     };
     Output _output;
+    uint32_t _midiTickDivisor = CONFIG_PPQN / 24;
+    uint32_t _midiTickCounter = 0;
+    uint32_t _midiTickPeriodUs = 0; // outgoing midi clock period in slave mode
+    uint32_t _nextMidiTickUs = 0; // time of next outgoing midi clock tick
     OutputState _outputState;
 
     uint32_t _requestedEvents = Reset;
     State _state = State::Idle;
+    // slave timer is kept configured while stopped, so an external start
+    // only has to enable it
+    bool _slavePreArmed = false;
 
     volatile uint32_t _tick;
     volatile uint32_t _tickProcessed;
@@ -152,13 +179,17 @@ private:
     volatile int32_t _activeSlave = -1;
 
     uint32_t _elapsedUs;
+    uint32_t _lastTimerTickTimestampUs = 0; // HighResolutionTimer time of last slave timer tick
     uint32_t _lastSlaveTickUs; // time of last call to slaveTick
     uint32_t _slaveTickPeriodUs = 0; // slave tick period time
     uint32_t _slaveSubTicksPending; // number of slave sub ticks pending
     uint32_t _slaveSubTickPeriodUs = 0; // slave sub tick period time
     uint32_t _nextSlaveSubTickUs; // time of next slave sub tick
+    MovingAverage<uint32_t, 8> _slavePeriodAvg; // smoothed slave tick period
+    uint32_t _predictedSlaveTickUs; // predicted time of next slave tick
+    uint32_t _slaveLockWindowUs = DefaultSlaveLockWindowUs;
 
-    float _slaveBpmFiltered = 0.f;
-    MovingAverage<float, 4> _slaveBpmAvg;
-    float _slaveBpm = 0.f;
+    Fixed32_32 _slaveBpmFiltered;
+    MovingAverage<int64_t, 4> _slaveBpmAvg;
+    Fixed32_32 _slaveBpm;
 };
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "core/utils/RingBuffer.h"
+
+#include <type_traits>
+#include <new>
+
+#include <cstddef>
+#include <cstdint>
+
+// Bounded lock-free SPSC command queue used to hand model mutations from the
+// UI task to the engine task. The UI task posts commands, the engine task
+// executes them at a safe point in Engine::update(), so the engine never has
+// to be suspended for simple model edits.
+// Commands are stored in-place, so they have to be trivially copyable and
+// small enough to fit the inline storage.
+class CommandQueue {
+public:
+    static constexpr size_t CommandCapacity = 16;
+    static constexpr size_t CommandMaxSize = 32;
+
+    template<typename Func>
+    bool post(const Func &func) {
+        static_assert(sizeof(Func) <= CommandMaxSize, "command does not fit inline storage");
+        static_assert(std::is_trivially_copyable<Func>::value, "command has to be trivially copyable");
+        if (_commands.full()) {
+            return false;
+        }
+        Command command;
+        new (command.storage) Func(func);
+        command.execute = [] (void *storage) { (*static_cast<Func *>(storage))(); };
+        _commands.write(command);
+        return true;
+    }
+
+    bool empty() const { return _commands.empty(); }
+
+    size_t pending() const { return _commands.entries(); }
+
+    void executePending() {
+        while (!_commands.empty()) {
+            Command command = _commands.read();
+            command.execute(command.storage);
+        }
+    }
+
+private:
+    struct Command {
+        void (*execute)(void *storage);
+        alignas(8) uint8_t storage[CommandMaxSize];
+    };
+
+    RingBuffer<Command, CommandCapacity> _commands;
+};
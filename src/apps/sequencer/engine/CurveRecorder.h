@@ -4,12 +4,13 @@
 
 #include <array>
 
+#include <cmath>
 #include <cstdint>
 
 class CurveRecorder {
 public:
     void reset() {
-        _writeIndex = 0;
+        _anchorCount = 0;
         _writeCount = 0;
     }
 
@@ -19,24 +20,33 @@ public:
         // record step at the beginning of a step
         // this allows capturing the cv value both at the end of the current step and the start of the next step
         if (relativeTick % divisor == 0) {
-            // fill up buffer with current value
-            while (_writeIndex <= RecordBufferLength) {
-                _buffer[_writeIndex++] = value;
-            }
+            // close the step with a final anchor
+            addAnchor(1.f, value);
 
             // record step if recording has been enabled for the duration of the step
             if (_writeCount == divisor) {
+                rebuildBuffer();
                 result = true;
             }
 
             reset();
         }
 
-        uint32_t writeTo = ((relativeTick % divisor) * RecordBufferLength) / divisor;
-
-        while (writeTo >= _writeIndex) {
-            _buffer[_writeIndex] = value;
-            ++_writeIndex;
+        float position = float(relativeTick % divisor) / divisor;
+
+        if (_anchorCount == 0) {
+            addAnchor(position, value);
+            _slope = 0.f;
+        } else {
+            // only record a new anchor when the value deviates from the linear
+            // prediction of the last anchor, keeping slowly moving inputs cheap
+            // while fast movements still resolve down to single ticks
+            const auto &last = _anchors[_anchorCount - 1];
+            float predicted = last.value + _slope * (position - last.position);
+            if (std::abs(value - predicted) > RecordThreshold) {
+                _slope = (value - last.value) / std::max(position - last.position, 1.f / divisor);
+                addAnchor(position, value);
+            }
         }
 
         ++_writeCount;
@@ -87,9 +97,52 @@ public:
     }
 
 private:
-    static constexpr uint32_t RecordBufferLength = 16;
+    struct Anchor {
+        float position;
+        float value;
+    };
 
+    void addAnchor(float position, float value) {
+        if (_anchorCount > 0 && _anchors[_anchorCount - 1].position >= position) {
+            _anchors[_anchorCount - 1].value = value;
+            return;
+        }
+        if (_anchorCount < MaxAnchors) {
+            _anchors[_anchorCount++] = { position, value };
+        } else {
+            _anchors[MaxAnchors - 1] = { position, value };
+        }
+    }
+
+    // reconstruct the uniformly sampled buffer used for curve matching by
+    // linearly interpolating between the recorded anchors
+    void rebuildBuffer() {
+        uint32_t anchor = 0;
+        for (uint32_t i = 0; i <= RecordBufferLength; ++i) {
+            float position = float(i) / RecordBufferLength;
+            while (anchor + 1 < _anchorCount && _anchors[anchor + 1].position <= position) {
+                ++anchor;
+            }
+            if (anchor + 1 < _anchorCount) {
+                const auto &a = _anchors[anchor];
+                const auto &b = _anchors[anchor + 1];
+                float t = (position - a.position) / (b.position - a.position);
+                _buffer[i] = a.value + (b.value - a.value) * t;
+            } else {
+                _buffer[i] = _anchors[anchor].value;
+            }
+        }
+    }
+
+    static constexpr uint32_t RecordBufferLength = 16;
+    static constexpr uint32_t MaxAnchors = RecordBufferLength + 1;
+    // deviation from the linear prediction (in normalized cv) that triggers a
+    // new anchor, roughly twice the resolution the step min/max are stored at
+    static constexpr float RecordThreshold = 0.01f;
+
+    std::array<Anchor, MaxAnchors> _anchors;
+    uint32_t _anchorCount;
+    float _slope;
     std::array<float, RecordBufferLength + 1> _buffer;
-    uint32_t _writeIndex;
     uint32_t _writeCount;
 };
@@ -13,9 +13,17 @@
 
 static Random rng;
 
-static float evalStepShape(const CurveSequence::Step &step, bool variation, bool invert, float fraction) {
-    auto function = Curve::function(Curve::Type(variation ? step.shapeVariation() : step.shape()));
-    float value = function(fraction);
+static float evalStepShape(const CurveSequence::Step &step, bool variation, bool invert, int morphWeight, float fraction) {
+    auto shape = Curve::Type(variation ? step.shapeVariation() : step.shape());
+    float value;
+    if (morphWeight > 0) {
+        // morph towards the next shape in the table, blending the
+        // precomputed sample tables with a Q8 weight
+        auto nextShape = Curve::Type(std::min(int(shape) + 1, int(Curve::Last) - 1));
+        value = Curve::evalMorphed(shape, nextShape, morphWeight, fraction);
+    } else {
+        value = Curve::evalSampled(shape, fraction);
+    }
     if (invert) {
         value = 1.f - value;
     }
@@ -38,6 +46,7 @@ void CurveTrackEngine::reset() {
     _sequenceState.reset();
     _currentStep = -1;
     _currentStepFraction = 0.f;
+    _stepFractionRate = 0.f;
     _shapeVariation = false;
     _fillMode = CurveTrack::FillMode::None;
     _activity = false;
@@ -53,16 +62,17 @@ void CurveTrackEngine::restart() {
     _sequenceState.reset();
     _currentStep = -1;
     _currentStepFraction = 0.f;
+    _stepFractionRate = 0.f;
 }
 
 void CurveTrackEngine::tick(uint32_t tick) {
     ASSERT(_sequence != nullptr, "invalid sequence");
     const auto &sequence = *_sequence;
-    const auto *linkData = _linkedTrackEngine ? _linkedTrackEngine->linkData() : nullptr;
+    const auto *linkData = _linkedTrackData;
 
     if (linkData) {
         _linkData = *linkData;
-        _sequenceState = *linkData->sequenceState;
+        _sequenceState.copyPosition(*linkData->sequenceState);
 
         updateRecording(linkData->relativeTick, linkData->divisor);
 
@@ -72,7 +82,7 @@ void CurveTrackEngine::tick(uint32_t tick) {
 
         updateOutput(linkData->relativeTick, linkData->divisor);
     } else {
-        uint32_t divisor = sequence.divisor() * (CONFIG_PPQN / CONFIG_SEQUENCE_PPQN);
+        uint32_t divisor = sequence.divisor() * (_engine.ppqn() / CONFIG_SEQUENCE_PPQN);
         uint32_t resetDivisor = sequence.resetMeasure() * _engine.measureDivisor();
         uint32_t relativeTick = resetDivisor == 0 ? tick : tick % resetDivisor;
 
@@ -122,6 +132,13 @@ void CurveTrackEngine::update(float dt) {
         const auto &range = Types::voltageRangeInfo(_sequence->range());
         _cvOutputTarget = range.denormalize(_recordValue);
         _cvOutput = _cvOutputTarget;
+    } else if (_curveTrack.cvUpdateMode() == CurveTrack::CvUpdateMode::Fast &&
+               _engine.state().running() && _currentStep >= 0) {
+        // fast mode re-evaluates the curve at the engine update rate (1 kHz),
+        // interpolating the step fraction between clock ticks so fast shapes
+        // do not stair-step at the tick rate, midi cv still follows per tick
+        _currentStepFraction = std::min(1.f, _currentStepFraction + dt * _stepFractionRate);
+        updateOutputValue();
     }
 
     if (!mute()) {
@@ -136,8 +153,20 @@ void CurveTrackEngine::update(float dt) {
 }
 
 void CurveTrackEngine::changePattern() {
-    _sequence = &_curveTrack.sequence(pattern());
-    _fillSequence = &_curveTrack.sequence(std::min(pattern() + 1, CONFIG_PATTERN_COUNT - 1));
+    // const access, looking at a pattern is not an edit and must not trigger
+    // a snapshot backup
+    const auto &curveTrack = _curveTrack;
+    _sequence = &curveTrack.sequence(pattern());
+    _fillSequence = &curveTrack.sequence(std::min(pattern() + 1, CONFIG_PATTERN_COUNT - 1));
+}
+
+void CurveTrackEngine::prepareNextPattern(int pattern) {
+    // only the free play mode advances through the memoized table
+    if (_curveTrack.playMode() != Types::PlayMode::Free) {
+        return;
+    }
+    const auto &sequence = _curveTrack.sequence(pattern);
+    _sequenceState.prepare(sequence.runMode(), sequence.firstStep(), sequence.lastStep());
 }
 
 void CurveTrackEngine::triggerStep(uint32_t tick, uint32_t divisor) {
@@ -146,8 +175,14 @@ void CurveTrackEngine::triggerStep(uint32_t tick, uint32_t divisor) {
     int gateProbabilityBias = _curveTrack.gateProbabilityBias();
 
     const auto &sequence = *_sequence;
-    _currentStep = SequenceUtils::rotateStep(_sequenceState.step(), sequence.firstStep(), sequence.lastStep(), rotate);
-    const auto &step = sequence.step(_currentStep);
+    // in extended mode odd iterations play the partner pattern's steps using
+    // this sequence's divisor, run mode and step range (the second page of a
+    // 128 step sequence)
+    bool extendedPage = _curveTrack.extendedSteps() && (_sequenceState.iteration() & 1) != 0;
+    const auto &evalSequence = extendedPage ? *_fillSequence : *_sequence;
+    int stepIndex = SequenceUtils::rotateStep(_sequenceState.step(), sequence.firstStep(), sequence.lastStep(), rotate);
+    _currentStep = extendedPage ? stepIndex + CONFIG_STEP_COUNT : stepIndex;
+    const auto &step = evalSequence.step(stepIndex);
 
     _shapeVariation = evalShapeVariation(step, shapeProbabilityBias);
 
@@ -160,8 +195,8 @@ void CurveTrackEngine::triggerStep(uint32_t tick, uint32_t divisor) {
         if (gate & (1 << i) && evalGate(step, gateProbabilityBias)) {
             uint32_t gateStart = (divisor * i) / 4;
             uint32_t gateLength = divisor / 8;
-            _gateQueue.pushReplace({ Groove::applySwing(tick + gateStart, swing()), true });
-            _gateQueue.pushReplace({ Groove::applySwing(tick + gateStart + gateLength, swing()), false });
+            _gateQueue.pushReplace({ _engine.swingTable().apply(tick + gateStart), true });
+            _gateQueue.pushReplace({ _engine.swingTable().apply(tick + gateStart + gateLength), false });
         }
     }
 }
@@ -171,6 +206,17 @@ void CurveTrackEngine::updateOutput(uint32_t relativeTick, uint32_t divisor) {
         return;
     }
 
+    _currentStepFraction = float(relativeTick % divisor) / divisor;
+    // rate at which the step fraction advances, used to interpolate between
+    // clock ticks in fast update mode
+    _stepFractionRate = 1.f / (divisor * _engine.clock().tickDuration());
+
+    updateOutputValue();
+
+    _engine.midiOutputEngine().sendCv(_track.trackIndex(), _cvOutputTarget);
+}
+
+void CurveTrackEngine::updateOutputValue() {
     bool fillVariation = _fillMode == CurveTrack::FillMode::Variation;
     bool fillNextPattern = _fillMode == CurveTrack::FillMode::NextPattern;
     bool fillInvert = _fillMode == CurveTrack::FillMode::Invert;
@@ -178,16 +224,12 @@ void CurveTrackEngine::updateOutput(uint32_t relativeTick, uint32_t divisor) {
     const auto &sequence = *_sequence;
     const auto &range = Types::voltageRangeInfo(sequence.range());
 
-    const auto &evalSequence = fillNextPattern ? *_fillSequence : *_sequence;
-    const auto &step = evalSequence.step(_currentStep);
-
-    _currentStepFraction = float(relativeTick % divisor) / divisor;
-
-    float value = evalStepShape(step, _shapeVariation || fillVariation, fillInvert, _currentStepFraction);
-    value = range.denormalize(value);
-    _cvOutputTarget = value;
+    const auto &evalSequence = (fillNextPattern || _currentStep >= CONFIG_STEP_COUNT) ? *_fillSequence : *_sequence;
+    const auto &step = evalSequence.step(_currentStep % CONFIG_STEP_COUNT);
 
-    _engine.midiOutputEngine().sendCv(_track.trackIndex(), _cvOutputTarget);
+    int morphWeight = (_curveTrack.shapeMorph() * 256) / 100;
+    float value = evalStepShape(step, _shapeVariation || fillVariation, fillInvert, morphWeight, _currentStepFraction);
+    _cvOutputTarget = range.denormalize(value);
 }
 
 bool CurveTrackEngine::isRecording() const {
@@ -198,7 +240,7 @@ bool CurveTrackEngine::isRecording() const {
 }
 
 void CurveTrackEngine::updateRecordValue() {
-    auto &sequence = *_sequence;
+    const auto &sequence = *_sequence;
     const auto &range = Types::voltageRangeInfo(sequence.range());
     auto curveCvInput = _model.project().curveCvInput();
 
@@ -224,9 +266,12 @@ void CurveTrackEngine::updateRecording(uint32_t relativeTick, uint32_t divisor)
     updateRecordValue();
 
     if (_recorder.write(relativeTick, divisor, _recordValue) && _sequenceState.step() >= 0) {
-        auto &sequence = *_sequence;
+        // write through the track so an armed snapshot backs up the pattern,
+        // in extended mode odd iterations record into the partner pattern
+        bool extendedPage = _curveTrack.extendedSteps() && (_sequenceState.iteration() & 1) != 0;
+        auto &sequence = _curveTrack.sequence(extendedPage ? std::min(pattern() + 1, CONFIG_PATTERN_COUNT - 1) : pattern());
         int rotate = _curveTrack.rotate();
-        auto &step = sequence.step(SequenceUtils::rotateStep(_sequenceState.step(), sequence.firstStep(), sequence.lastStep(), rotate));
+        auto &step = sequence.step(SequenceUtils::rotateStep(_sequenceState.step(), _sequence->firstStep(), _sequence->lastStep(), rotate));
         auto match = _recorder.matchCurve();
         step.setShape(match.type);
         step.setMinNormalized(match.min);
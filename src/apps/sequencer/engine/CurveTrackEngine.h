@@ -2,12 +2,12 @@
 
 #include "TrackEngine.h"
 #include "SequenceState.h"
-#include "SortedQueue.h"
+#include "HeapQueue.h"
 #include "CurveRecorder.h"
 
 #include "model/Track.h"
 
-class CurveTrackEngine : public TrackEngine {
+class CurveTrackEngine final : public TrackEngine {
 public:
     CurveTrackEngine(Engine &engine, const Model &model, Track &track, const TrackEngine *linkedTrackEngine) :
         TrackEngine(engine, model, track, linkedTrackEngine),
@@ -24,6 +24,7 @@ public:
     virtual void update(float dt) override;
 
     virtual void changePattern() override;
+    virtual void prepareNextPattern(int pattern) override;
 
     virtual const TrackLinkData *linkData() const override { return &_linkData; }
 
@@ -31,7 +32,21 @@ public:
     virtual bool gateOutput(int index) const override { return _gateOutput; }
     virtual float cvOutput(int index) const override { return _cvOutput; }
     virtual float sequenceProgress() const override {
-        return _currentStep < 0 ? 0.f : float(_currentStep - _sequence->firstStep()) / (_sequence->lastStep() - _sequence->firstStep());
+        if (_currentStep < 0) {
+            return 0.f;
+        }
+        // _currentStep indexes the second page at CONFIG_STEP_COUNT and above
+        // when the track plays extended (128 step) sequences
+        int firstStep = _sequence->firstStep();
+        int span = _sequence->lastStep() - firstStep;
+        int position = _currentStep - firstStep;
+        if (_curveTrack.extendedSteps()) {
+            if (_currentStep >= CONFIG_STEP_COUNT) {
+                position = span + 1 + (_currentStep - CONFIG_STEP_COUNT - firstStep);
+            }
+            span = 2 * span + 1;
+        }
+        return span > 0 ? float(position) / span : 0.f;
     }
 
     const CurveSequence &sequence() const { return *_sequence; }
@@ -43,6 +58,7 @@ public:
 private:
     void triggerStep(uint32_t tick, uint32_t divisor);
     void updateOutput(uint32_t relativeTick, uint32_t divisor);
+    void updateOutputValue();
 
     bool isRecording() const;
     void updateRecordValue();
@@ -55,11 +71,14 @@ private:
     float _recordValue;
     CurveRecorder _recorder;
 
-    CurveSequence *_sequence;
-    CurveSequence *_fillSequence;
+    const CurveSequence *_sequence;
+    const CurveSequence *_fillSequence;
     SequenceState _sequenceState;
     int _currentStep;
     float _currentStepFraction;
+    // step fraction advance per second, used to interpolate between clock
+    // ticks in fast update mode
+    float _stepFractionRate;
     bool _shapeVariation;
     CurveTrack::FillMode _fillMode;
 
@@ -79,5 +98,5 @@ private:
         }
     };
 
-    SortedQueue<Gate, 16, GateCompare> _gateQueue;
+    HeapQueue<Gate, 16, GateCompare> _gateQueue;
 };
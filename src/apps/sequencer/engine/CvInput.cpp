@@ -6,11 +6,14 @@ CvInput::CvInput(Adc &adc) :
 }
 
 void CvInput::init() {
-    _channels.fill(0.f);
+    _channels.fill(0);
 }
 
 void CvInput::update() {
+    // integer affine conversion, one multiply and add per channel at the
+    // 1 kHz update rate instead of a float divide
     for (int i = 0; i < Channels; ++i) {
-        _channels[i] = 5.f - _adc.channel(i) / 6553.5f;
+        const auto &calibration = _calibrations[i];
+        _channels[i] = calibration.offsetVolts + int32_t(_adc.channel(i)) * calibration.slope;
     }
 }
@@ -6,10 +6,23 @@
 
 #include <array>
 
+#include <cstdint>
+
 class CvInput {
 public:
     static constexpr int Channels = CONFIG_CV_INPUT_CHANNELS;
 
+    // Per channel adc code -> volts affine calibration in Q16.16 fixed
+    // point, the input side counterpart to the piecewise linear segment
+    // tables on the CV output side. The defaults model the ideal input
+    // scaler (code 0 -> 5V, full scale -> -5V).
+    struct Calibration {
+        int32_t offsetVolts;    // Q16.16 volts at adc code 0
+        int32_t slope;          // Q16.16 volts per adc code
+
+        Calibration() : offsetVolts(5 * 65536), slope(-10) {}
+    };
+
     CvInput(Adc &adc);
 
     void init();
@@ -17,11 +30,20 @@ public:
     void update();
 
     float channel(int index) const {
+        return _channels[index] * (1.f / 65536.f);
+    }
+
+    // Q16.16 volts, fixed point fast path for the routing engine
+    int32_t channelFixed(int index) const {
         return _channels[index];
     }
 
+    const Calibration &calibration(int index) const { return _calibrations[index]; }
+    void setCalibration(int index, const Calibration &calibration) { _calibrations[index] = calibration; }
+
 private:
     Adc &_adc;
 
-    std::array<float, Channels> _channels;
+    std::array<Calibration, Channels> _calibrations;
+    std::array<int32_t, Channels> _channels;
 };
@@ -1,12 +1,44 @@
 #include "Engine.h"
 
 #include "Config.h"
+#include "ScaleCache.h"
+
+#include "model/UserScale.h"
 
 #include "core/Debug.h"
 #include "core/midi/MidiMessage.h"
+#include "core/profiler/Trace.h"
+
+#include "drivers/HighResolutionTimer.h"
 
 #include "os/os.h"
 
+#include <algorithm>
+
+#include <cstring>
+
+// next multiple of divisor above tick
+static uint32_t nextTickMultiple(uint32_t tick, uint32_t divisor) {
+    return ((tick / divisor) + 1) * divisor;
+}
+
+// visitors for Engine::visitTrackEngine, keeping the dispatched call
+// statically typed so it can inline into the hot tick loop
+struct TickRangeVisitor {
+    uint32_t first;
+    uint32_t last;
+
+    template<typename T>
+    void operator()(T &trackEngine) const { trackEngine.tickRange(first, last); }
+};
+
+struct UpdateVisitor {
+    float dt;
+
+    template<typename T>
+    void operator()(T &trackEngine) const { trackEngine.update(dt); }
+};
+
 Engine::Engine(Model &model, ClockTimer &clockTimer, Adc &adc, Dac &dac, Dio &dio, GateOutput &gateOutput, Midi &midi, UsbMidi &usbMidi) :
     _model(model),
     _project(model.project()),
@@ -21,6 +53,7 @@ Engine::Engine(Model &model, ClockTimer &clockTimer, Adc &adc, Dac &dac, Dio &di
     _routingEngine(*this, model)
 {
     _cvOutputOverrideValues.fill(0.f);
+    _activeTrackEngineContainer.fill(0);
     _trackEngines.fill(nullptr);
 
     _usbMidi.setConnectHandler([this] (uint16_t vendorId, uint16_t productId) { usbMidiConnect(vendorId, productId); });
@@ -35,6 +68,11 @@ void Engine::init() {
     initClock();
     updateClockSetup();
 
+    // invalidate cached scale tables when a user scale is edited
+    UserScale::watch([] (const UserScale &userScale) {
+        ScaleCache::invalidate(userScale);
+    });
+
     // setup track engines
     updateTrackSetups();
     reset();
@@ -42,9 +80,14 @@ void Engine::init() {
     _lastSystemTicks = os::ticks();
 }
 
+// engine update budget, matches the engine task period
+static constexpr uint32_t UpdateBudgetUs = 1000;
+
 void Engine::update() {
+    uint32_t updateStartUs = HighResolutionTimer::us();
     uint32_t systemTicks = os::ticks();
-    float dt = (0.001f * (systemTicks - _lastSystemTicks)) / os::time::ms(1);
+    uint32_t dtMs = (systemTicks - _lastSystemTicks) / os::time::ms(1);
+    float dt = 0.001f * dtMs;
     _lastSystemTicks = systemTicks;
 
     // locking
@@ -58,6 +101,10 @@ void Engine::update() {
         _locked = 0;
     }
 
+    // execute commands posted by the UI task (safe point, engine is not mid-tick)
+    Trace::event(Trace::QueueDepth, _commandQueue.pending());
+    _commandQueue.executePending();
+
     if (_locked) {
         // consume ticks
         uint32_t tick;
@@ -100,9 +147,12 @@ void Engine::update() {
     }
 
     // update tempo
-    _nudgeTempo.update(dt);
+    _nudgeTempo.update(dtMs);
     _clock.setMasterBpm(_project.tempo() * (1.f + _nudgeTempo.strength() * 0.1f));
 
+    // update swing table
+    _swingTable.update(_project.swing(), _clock.ppqn() / 4);
+
     // update clock setup
     updateClockSetup();
 
@@ -112,8 +162,11 @@ void Engine::update() {
     // update play state
     updatePlayState(false);
 
-    // update cv inputs
-    _cvInput.update();
+    // update cv inputs, shed for one cycle after an overloaded update, the
+    // inputs simply hold their last filtered value
+    if (!_updateOverloaded) {
+        _cvInput.update();
+    }
 
     // receive midi events
     receiveMidi();
@@ -121,22 +174,43 @@ void Engine::update() {
     // update routings
     _routingEngine.update();
 
-    uint32_t tick;
-    while (_clock.checkTick(&tick)) {
-        _tick = tick;
+    uint32_t tickFirst, tickLast;
+    while (_clock.checkTickRange(&tickFirst, &tickLast)) {
+        uint32_t tick = tickFirst;
+        while (tick <= tickLast) {
+            _tick = tick;
 
-        // update play state
-        updatePlayState(true);
+            // update play state
+            updatePlayState(true);
 
-        for (auto trackEngine : _trackEngines) {
-            trackEngine->tick(tick);
-        }
+            // process ticks up to the next sync/measure boundary (where play
+            // state may change) as one burst
+            uint32_t nextBoundary = std::min(nextTickMultiple(tick, syncDivisor()), nextTickMultiple(tick, measureDivisor()));
+            uint32_t burstLast = std::min(tickLast, nextBoundary - 1);
+
+            Trace::event(Trace::TickStart, tick);
+            uint32_t tickStartUs = HighResolutionTimer::us();
+            for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+                uint32_t startUs = HighResolutionTimer::us();
+                visitTrackEngine(trackIndex, TickRangeVisitor{ tick, burstLast });
+                _performanceMonitor.addTrackTickSample(trackIndex, HighResolutionTimer::us() - startUs);
+            }
 
-        _midiOutputEngine.tick(tick);
+            for (uint32_t t = tick; t <= burstLast; ++t) {
+                _midiOutputEngine.tick(t);
+            }
+            _performanceMonitor.addTickLatencySample(HighResolutionTimer::us() - tickStartUs);
+            Trace::event(Trace::TickEnd, burstLast);
+
+            tick = burstLast + 1;
+        }
+        _tick = tickLast;
     }
 
-    for (auto trackEngine : _trackEngines) {
-        trackEngine->update(dt);
+    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        uint32_t startUs = HighResolutionTimer::us();
+        visitTrackEngine(trackIndex, UpdateVisitor{ dt });
+        _performanceMonitor.addTrackUpdateSample(trackIndex, HighResolutionTimer::us() - startUs);
     }
 
     updateTrackOutputs();
@@ -145,6 +219,15 @@ void Engine::update() {
     // update cv/gate outputs
     _cvOutput.update();
     _gateOutput.update();
+
+    // budget watermark, an update that overruns the task period is counted
+    // and sheds non-critical work on the next cycle so gate/cv timing
+    // recovers first
+    bool overloaded = HighResolutionTimer::us() - updateStartUs > UpdateBudgetUs;
+    if (overloaded && !_updateOverloaded) {
+        ++_updateOverloadCount;
+    }
+    _updateOverloaded = overloaded;
 }
 
 void Engine::lock() {
@@ -249,11 +332,11 @@ float Engine::nudgeTempoStrength() const {
 }
 
 uint32_t Engine::noteDivisor() const {
-    return _project.timeSignature().noteDivisor();
+    return _project.timeSignature().noteDivisor(_clock.ppqn());
 }
 
 uint32_t Engine::measureDivisor() const {
-    return _project.timeSignature().measureDivisor();
+    return _project.timeSignature().measureDivisor(_clock.ppqn());
 }
 
 float Engine::measureFraction() const {
@@ -293,25 +376,31 @@ bool Engine::sendMidi(MidiPort port, const MidiMessage &message) {
 }
 
 void Engine::showMessage(const char *text, uint32_t duration) {
-    if (_messageHandler) {
-        _messageHandler(text, duration);
-    }
-}
-
-void Engine::setMessageHandler(MessageHandler handler) {
-    _messageHandler = handler;
+    Event event;
+    event.type = Event::Message;
+    std::strncpy(event.message.text, text, sizeof(event.message.text) - 1);
+    event.message.text[sizeof(event.message.text) - 1] = '\0';
+    event.message.duration = duration;
+    postEvent(event);
 }
 
 Engine::Stats Engine::stats() const {
     return {
         .uptime = os::ticks() / os::time::ms(1000),
         .midiRxOverflow = _midi.rxOverflow(),
-        .usbMidiRxOverflow = _usbMidi.rxOverflow()
+        .usbMidiRxOverflow = _usbMidi.rxOverflow(),
+        .updateOverload = _updateOverloadCount
     };
 }
 
 void Engine::onClockOutput(const Clock::OutputState &state) {
-    _dio.clockOutput.set(state.clock);
+    if (state.clock) {
+        // the falling edge is generated by a hardware one-shot timer in the
+        // driver, so the pulse width stays stable regardless of engine load
+        _dio.clockOutputPulse(_clock.outputClockPulseUs());
+    } else {
+        _dio.clockOutput.set(false);
+    }
     switch (_project.clockSetup().clockOutputMode()) {
     case ClockSetup::ClockOutputMode::Reset:
         _dio.resetOutput.set(state.reset);
@@ -343,21 +432,32 @@ void Engine::updateTrackSetups() {
 
         if (!_trackEngines[trackIndex] || _trackEngines[trackIndex]->trackMode() != track.trackMode()) {
             auto &trackEngine = _trackEngines[trackIndex];
-            auto &trackContainer = _trackEngineContainers[trackIndex];
-
+            // build the incoming engine in the inactive container, the
+            // outgoing engine stays intact and keeps producing output until
+            // the pointer swap below; updateTrackSetups() only runs between
+            // tick bursts, so the swap lands on a tick boundary
+            int inactive = _activeTrackEngineContainer[trackIndex] ^ 1;
+            auto &trackContainer = _trackEngineContainers[trackIndex][inactive];
+
+            TrackEngine *newTrackEngine = nullptr;
             switch (track.trackMode()) {
             case Track::TrackMode::Note:
-                trackEngine = trackContainer.create<NoteTrackEngine>(*this, _model, track, linkedTrackEngine);
+                newTrackEngine = trackContainer.create<NoteTrackEngine>(*this, _model, track, linkedTrackEngine);
                 break;
             case Track::TrackMode::Curve:
-                trackEngine = trackContainer.create<CurveTrackEngine>(*this, _model, track, linkedTrackEngine);
+                newTrackEngine = trackContainer.create<CurveTrackEngine>(*this, _model, track, linkedTrackEngine);
                 break;
             case Track::TrackMode::MidiCv:
-                trackEngine = trackContainer.create<MidiCvTrackEngine>(*this, _model, track, linkedTrackEngine);
+                newTrackEngine = trackContainer.create<MidiCvTrackEngine>(*this, _model, track, linkedTrackEngine);
                 break;
             case Track::TrackMode::Last:
                 break;
             }
+
+            if (newTrackEngine) {
+                trackEngine = newTrackEngine;
+                _activeTrackEngineContainer[trackIndex] = inactive;
+            }
         }
 
         // update linked track engine
@@ -389,11 +489,25 @@ void Engine::updateTrackOutputs() {
     }
 }
 
+void Engine::scheduleGateOutput(int trackIndex, bool value, uint32_t timeUs) {
+    if (_gateOutputOverride) {
+        return;
+    }
+
+    const auto &gateOutputTracks = _project.gateOutputTracks();
+    for (int outputIndex = 0; outputIndex < CONFIG_TRACK_COUNT; ++outputIndex) {
+        if (gateOutputTracks[outputIndex] == trackIndex) {
+            _gateOutput.scheduleGate(outputIndex, value, timeUs);
+        }
+    }
+}
+
 void Engine::reset() {
     for (auto trackEngine : _trackEngines) {
         trackEngine->reset();
     }
 
+    _gateOutput.clearSchedule();
     _midiOutputEngine.reset();
 }
 
@@ -423,6 +537,11 @@ void Engine::updatePlayState(bool ticked) {
             (handleSyncedRequests ? PlayState::TrackState::SyncedPatternRequest : 0) |
             (handleLatchedRequests ? PlayState::TrackState::LatchedPatternRequest : 0);
 
+        // exchange the double-buffered pattern state, so a simultaneous
+        // multi-track pattern launch is applied from one consistent snapshot
+        uint64_t requestedPatterns = playState.requestedPatterns();
+        uint8_t patternTracks = playState.takePatternRequests(true, handleSyncedRequests, handleLatchedRequests);
+
         for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
             auto &trackState = playState.trackState(trackIndex);
 
@@ -432,14 +551,16 @@ void Engine::updatePlayState(bool ticked) {
             }
 
             // handle pattern requests
-            if (trackState.hasRequests(patternRequests)) {
-                trackState.setPattern(trackState.requestedPattern());
+            if (patternTracks & (1 << trackIndex)) {
+                trackState.setPattern((requestedPatterns >> (trackIndex << 3)) & 0xff);
                 changedPatterns = true;
             }
 
             // clear requests
             trackState.clearRequests(muteRequests | patternRequests);
         }
+
+        playState.updateAggregateMasks();
     }
 
     // handle song requests
@@ -455,10 +576,10 @@ void Engine::updatePlayState(bool ticked) {
 
         if (songState.hasRequests(playRequests)) {
             int requestedSlot = songState.requestedSlot();
-            if (requestedSlot >= 0 && requestedSlot < song.slotCount()) {
-                const auto &slot = song.slot(requestedSlot);
+            if (requestedSlot >= 0 && requestedSlot < song.playlistLength()) {
+                const auto &entry = song.playlistEntry(requestedSlot);
                 for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
-                    playState.trackState(trackIndex).setPattern(slot.pattern(trackIndex));
+                    playState.trackState(trackIndex).setPattern(entry.pattern(trackIndex));
                 }
 
                 songState.setCurrentSlot(requestedSlot);
@@ -495,26 +616,26 @@ void Engine::updatePlayState(bool ticked) {
     // handle song slot change
 
     if (songState.playing() && handleSongAdvance) {
-        const auto &slot = song.slot(songState.currentSlot());
+        const auto &entry = song.playlistEntry(songState.currentSlot());
         int currentSlot = songState.currentSlot();
         int currentRepeat = songState.currentRepeat();
 
-        if (currentRepeat + 1 < slot.repeats()) {
+        if (currentRepeat + 1 < entry.repeats()) {
             // next repeat
             songState.setCurrentRepeat(currentRepeat + 1);
         } else {
             // next slot
             songState.setCurrentRepeat(0);
-            if (currentSlot + 1 < song.slotCount()) {
+            if (currentSlot + 1 < song.playlistLength()) {
                 songState.setCurrentSlot(currentSlot + 1);
             } else {
                 songState.setCurrentSlot(0);
             }
 
             // update patterns
-            const auto &slot = song.slot(songState.currentSlot());
+            const auto &nextEntry = song.playlistEntry(songState.currentSlot());
             for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
-                playState.trackState(trackIndex).setPattern(slot.pattern(trackIndex));
+                playState.trackState(trackIndex).setPattern(nextEntry.pattern(trackIndex));
                 _trackEngines[trackIndex]->restart();
             }
         }
@@ -522,8 +643,8 @@ void Engine::updatePlayState(bool ticked) {
 
     // abort song mode if slot becomes invalid
 
-    if ((songState.playing() && songState.currentSlot() >= song.slotCount()) ||
-        (songState.currentRepeat() >= song.slot(songState.currentSlot()).repeats())) {
+    if ((songState.playing() && songState.currentSlot() >= song.playlistLength()) ||
+        (songState.currentRepeat() >= song.playlistEntry(songState.currentSlot()).repeats())) {
         playState.stopSong();
     }
 
@@ -532,6 +653,18 @@ void Engine::updatePlayState(bool ticked) {
             _trackEngines[trackIndex]->changePattern();
         }
     }
+
+    // while a synced or latched pattern change is waiting for its boundary,
+    // let the track engines prepare for the incoming pattern so the switch
+    // itself costs next to nothing
+    if (playState.hasSyncedRequests() || playState.hasLatchedRequests()) {
+        for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+            const auto &trackState = playState.trackState(trackIndex);
+            if (trackState.hasPatternRequest()) {
+                _trackEngines[trackIndex]->prepareNextPattern(trackState.requestedPattern());
+            }
+        }
+    }
 }
 
 void Engine::updateOverrides() {
@@ -547,26 +680,37 @@ void Engine::updateOverrides() {
 }
 
 void Engine::usbMidiConnect(uint16_t vendorId, uint16_t productId) {
-    if (_usbMidiConnectHandler) {
-        _usbMidiConnectHandler(vendorId, productId);
-    }
+    Event event;
+    event.type = Event::UsbMidiConnect;
+    event.usbMidi.vendorId = vendorId;
+    event.usbMidi.productId = productId;
+    postEvent(event);
 }
 
 void Engine::usbMidiDisconnect() {
-    if (_usbMidiDisconnectHandler) {
-        _usbMidiDisconnectHandler();
+    Event event;
+    event.type = Event::UsbMidiDisconnect;
+    postEvent(event);
+}
+
+void Engine::postEvent(const Event &event) {
+    // events originate from both the engine and the usb task
+    os::InterruptLock lock;
+    if (_events.writable() >= 1) {
+        _events.write(event);
     }
 }
 
 void Engine::receiveMidi() {
     MidiMessage message;
-    while (_midi.recv(&message)) {
+    uint32_t timestampUs;
+    while (_midi.recv(&message, &timestampUs)) {
         message.fixFakeNoteOff();
-        receiveMidi(MidiPort::Midi, message);
+        receiveMidi(MidiPort::Midi, message, timestampUs);
     }
-    while (_usbMidi.recv(&message)) {
+    while (_usbMidi.recv(&message, &timestampUs)) {
         message.fixFakeNoteOff();
-        receiveMidi(MidiPort::UsbMidi, message);
+        receiveMidi(MidiPort::UsbMidi, message, timestampUs);
     }
 
     // derive MIDI messages from CV/Gate input
@@ -576,12 +720,12 @@ void Engine::receiveMidi() {
         break;
     case Types::CvGateInput::Cv1Cv2:
         _cvGateToMidiConverter.convert(_cvInput.channel(0), _cvInput.channel(1), 0, [this] (const MidiMessage &message) {
-            receiveMidi(MidiPort::CvGate, message);
+            receiveMidi(MidiPort::CvGate, message, HighResolutionTimer::us());
         });
         break;
     case Types::CvGateInput::Cv3Cv4:
         _cvGateToMidiConverter.convert(_cvInput.channel(2), _cvInput.channel(3), 1, [this] (const MidiMessage &message) {
-            receiveMidi(MidiPort::CvGate, message);
+            receiveMidi(MidiPort::CvGate, message, HighResolutionTimer::us());
         });
         break;
     case Types::CvGateInput::Last:
@@ -589,7 +733,7 @@ void Engine::receiveMidi() {
     }
 }
 
-void Engine::receiveMidi(MidiPort port, const MidiMessage &message) {
+void Engine::receiveMidi(MidiPort port, const MidiMessage &message, uint32_t timestampUs) {
     // filter out real-time and system messages
     if (message.isRealTimeMessage() || message.isSystemMessage()) {
         return;
@@ -605,6 +749,14 @@ void Engine::receiveMidi(MidiPort port, const MidiMessage &message) {
     // let midi learn inspect messages (except from virtual CV/Gate messages)
     if (port != MidiPort::CvGate) {
         _midiLearn.receiveMidi(port, message);
+
+        MidiLearn::Result learnResult;
+        if (_midiLearn.takeResult(learnResult)) {
+            Event event;
+            event.type = Event::MidiLearn;
+            event.midiLearn = learnResult;
+            postEvent(event);
+        }
     }
 
     // let routing engine consume messages
@@ -614,7 +766,7 @@ void Engine::receiveMidi(MidiPort port, const MidiMessage &message) {
 
     // let track engines consume messages (only MIDI/CV tracks)
     for (auto trackEngine : _trackEngines) {
-        if (trackEngine->receiveMidi(port, message)) {
+        if (trackEngine->receiveMidi(port, message, timestampUs)) {
             return;
         }
     }
@@ -659,7 +811,7 @@ void Engine::initClock() {
     const auto &clockSetup = _project.clockSetup();
 
     // Forward external clock signals to clock
-    _dio.clockInput.setHandler([&] (bool value) {
+    _dio.clockInput.setHandler([&] (bool value, uint32_t timestampUs) {
         // interrupt context
 
         // start clock on first clock pulse if reset is not hold and clock is not running
@@ -667,12 +819,12 @@ void Engine::initClock() {
             _clock.slaveStart(ClockSourceExternal);
         }
         if (value) {
-            _clock.slaveTick(ClockSourceExternal);
+            _clock.slaveTick(ClockSourceExternal, timestampUs);
         }
     });
 
     // Handle reset or start/stop input
-    _dio.resetInput.setHandler([&] (bool value) {
+    _dio.resetInput.setHandler([&] (bool value, uint32_t timestampUs) {
         // interrupt context
         switch (clockSetup.clockInputMode()) {
         case ClockSetup::ClockInputMode::Reset:
@@ -718,6 +870,22 @@ void Engine::initClock() {
         }
         return false;
     });
+
+    // Forward incoming MIDI to the output inside the driver, bypassing the
+    // engine update loop entirely
+    _midi.setThruFilter([this] (uint8_t data) {
+        switch (_model.project().midiThru()) {
+        case Types::MidiThru::Off:
+            return false;
+        case Types::MidiThru::All:
+            return true;
+        case Types::MidiThru::NonClock:
+            return !MidiMessage::isClockMessage(data);
+        case Types::MidiThru::Last:
+            break;
+        }
+        return false;
+    });
 }
 
 void Engine::updateClockSetup() {
@@ -745,10 +913,14 @@ void Engine::updateClockSetup() {
         break;
     }
 
+    // Configure tick resolution
+    _clock.setPpqn(ClockSetup::ppqnValue(clockSetup.ppqn()));
+    int ppqn = _clock.ppqn();
+
     // Configure clock slaves
-    _clock.slaveConfigure(ClockSourceExternal, clockSetup.clockInputDivisor() * (CONFIG_PPQN / CONFIG_SEQUENCE_PPQN), true);
-    _clock.slaveConfigure(ClockSourceMidi, CONFIG_PPQN / 24, clockSetup.midiRx());
-    _clock.slaveConfigure(ClockSourceUsbMidi, CONFIG_PPQN / 24, clockSetup.usbRx());
+    _clock.slaveConfigure(ClockSourceExternal, clockSetup.clockInputDivisor() * (ppqn / CONFIG_SEQUENCE_PPQN), true);
+    _clock.slaveConfigure(ClockSourceMidi, ppqn / 24, clockSetup.midiRx());
+    _clock.slaveConfigure(ClockSourceUsbMidi, ppqn / 24, clockSetup.usbRx());
 
     // Update from clock input signal
     bool resetInput = _dio.resetInput.get();
@@ -779,7 +951,7 @@ void Engine::updateClockSetup() {
     }
 
     // Configure clock outputs
-    _clock.outputConfigure(clockSetup.clockOutputDivisor() * (CONFIG_PPQN / CONFIG_SEQUENCE_PPQN), clockSetup.clockOutputPulse());
+    _clock.outputConfigure(clockSetup.clockOutputDivisor() * (ppqn / CONFIG_SEQUENCE_PPQN), clockSetup.clockOutputPulse());
 
     // Update clock outputs
     onClockOutput(_clock.outputState());
@@ -2,9 +2,11 @@
 
 #include "EngineState.h"
 #include "Clock.h"
+#include "CommandQueue.h"
 #include "TapTempo.h"
 #include "NudgeTempo.h"
 #include "TrackEngine.h"
+#include "Groove.h"
 #include "NoteTrackEngine.h"
 #include "CurveTrackEngine.h"
 #include "MidiCvTrackEngine.h"
@@ -15,6 +17,7 @@
 #include "MidiPort.h"
 #include "MidiLearn.h"
 #include "CvGateToMidiConverter.h"
+#include "PerformanceMonitor.h"
 
 #include "model/Model.h"
 
@@ -26,6 +29,9 @@
 #include "drivers/Midi.h"
 #include "drivers/UsbMidi.h"
 
+#include "core/utils/FixedFunction.h"
+#include "core/utils/RingBuffer.h"
+
 #include <array>
 
 #include <cstdint>
@@ -33,15 +39,40 @@
 class Engine : private Clock::Listener {
 public:
     typedef Container<NoteTrackEngine, CurveTrackEngine, MidiCvTrackEngine> TrackEngineContainer;
-    typedef std::array<TrackEngineContainer, CONFIG_TRACK_COUNT> TrackEngineContainerArray;
+    // two containers per track: a mode switch builds the incoming engine in
+    // the inactive container while the active engine keeps producing output,
+    // and swaps between tick bursts, so the outputs never see a
+    // half-constructed engine
+    typedef std::array<std::array<TrackEngineContainer, 2>, CONFIG_TRACK_COUNT> TrackEngineContainerArray;
     typedef std::array<TrackEngine *, CONFIG_TRACK_COUNT> TrackEngineArray;
 
-    typedef std::function<bool(MidiPort port, const MidiMessage &message)> MidiReceiveHandler;
-
-    typedef std::function<void(uint16_t vendorId, uint16_t productId)> UsbMidiConnectHandler;
-    typedef std::function<void()> UsbMidiDisconnectHandler;
-
-    typedef std::function<void(const char *text, uint32_t duration)> MessageHandler;
+    typedef FixedFunction<bool(MidiPort port, const MidiMessage &message)> MidiReceiveHandler;
+
+    // event posted from engine context and drained by the ui task through
+    // nextEvent(), replacing per-event callback hops into the ui
+    struct Event {
+        enum Type : uint8_t {
+            Message,
+            UsbMidiConnect,
+            UsbMidiDisconnect,
+            MidiLearn,
+        };
+
+        static constexpr size_t MessageTextLength = 32;
+
+        Type type;
+        union {
+            struct {
+                char text[MessageTextLength];
+                uint16_t duration;
+            } message;
+            struct {
+                uint16_t vendorId;
+                uint16_t productId;
+            } usbMidi;
+            ::MidiLearn::Result midiLearn;
+        };
+    };
 
     enum ClockSource {
         ClockSourceExternal,
@@ -53,6 +84,7 @@ public:
         uint32_t uptime;
         uint32_t midiRxOverflow;
         uint32_t usbMidiRxOverflow;
+        uint32_t updateOverload;
     };
 
     Engine(Model &model, ClockTimer &clockTimer, Adc &adc, Dac &dac, Dio &dio, GateOutput &gateOutput, Midi &midi, UsbMidi &usbMidi);
@@ -65,6 +97,12 @@ public:
     void unlock();
     bool isLocked();
 
+    // command queue (UI task -> engine task)
+    // posts a command for deferred execution at a safe point in update(),
+    // allowing simple model mutations without suspending the engine
+    template<typename Func>
+    bool postCommand(const Func &func) { return _commandQueue.post(func); }
+
     // clock control
     void togglePlay(bool shift = false);
     void clockStart();
@@ -91,6 +129,7 @@ public:
 
     // time base
     uint32_t tick() const { return _tick; }
+    int ppqn() const { return _clock.ppqn(); }
     uint32_t noteDivisor() const;
     uint32_t measureDivisor() const;
     float measureFraction() const;
@@ -101,6 +140,9 @@ public:
     const CvOutput &cvOutput() const { return _cvOutput; }
     const uint8_t gateOutput() const { return _gateOutput.gates(); }
 
+    // schedules a gate change for all gate outputs fed by the given track
+    void scheduleGateOutput(int trackIndex, bool value, uint32_t timeUs);
+
     // gate overrides
     bool gateOutputOverride() const { return _gateOutputOverride; }
     void setGateOutputOverride(bool enabled) { _gateOutputOverride = enabled; }
@@ -116,6 +158,8 @@ public:
 
     const EngineState &state() const { return _state; }
 
+    const Groove::SwingTable &swingTable() const { return _swingTable; }
+
     const TrackEngineArray &trackEngines() const { return _trackEngines; }
           TrackEngineArray &trackEngines()       { return _trackEngines; }
 
@@ -134,24 +178,61 @@ public:
     const MidiLearn &midiLearn() const { return _midiLearn; }
           MidiLearn &midiLearn()       { return _midiLearn; }
 
+    const PerformanceMonitor &performanceMonitor() const { return _performanceMonitor; }
+          PerformanceMonitor &performanceMonitor()       { return _performanceMonitor; }
+
     bool trackEnginesConsistent() const;
 
     bool sendMidi(MidiPort port, const MidiMessage &message);
     void setMidiReceiveHandler(MidiReceiveHandler handler) { _midiReceiveHandler = handler; }
-    void setUsbMidiConnectHandler(UsbMidiConnectHandler handler) { _usbMidiConnectHandler = handler; }
-    void setUsbMidiDisconnectHandler(UsbMidiDisconnectHandler handler) { _usbMidiDisconnectHandler = handler; }
 
     // message handling
     void showMessage(const char *text, uint32_t duration = 1000);
-    void setMessageHandler(MessageHandler handler);
+
+    // events (engine task -> UI task)
+    bool nextEvent(Event &event) {
+        if (_events.readable() < 1) {
+            return false;
+        }
+        event = _events.read();
+        return true;
+    }
 
     Stats stats() const;
 
+    // true while the last engine update overran its budget, non-critical
+    // consumers (led updates) shed their work until it recovers
+    bool updateOverloaded() const { return _updateOverloaded; }
+
 private:
+    void postEvent(const Event &event);
+
     // Clock::Listener
     virtual void onClockOutput(const Clock::OutputState &state) override;
     virtual void onClockMidi(uint8_t data) override;
 
+    // dispatches to the concrete track engine type based on the track mode,
+    // so hot per-tick calls devirtualize and inline (the concrete engine
+    // classes are final); the engine setup is kept consistent with the track
+    // mode by updateTrackSetups()
+    template<typename Visitor>
+    inline void visitTrackEngine(int trackIndex, const Visitor &visitor) {
+        auto &container = _trackEngineContainers[trackIndex][_activeTrackEngineContainer[trackIndex]];
+        switch (_project.track(trackIndex).trackMode()) {
+        case Track::TrackMode::Note:
+            visitor(container.as<NoteTrackEngine>());
+            break;
+        case Track::TrackMode::Curve:
+            visitor(container.as<CurveTrackEngine>());
+            break;
+        case Track::TrackMode::MidiCv:
+            visitor(container.as<MidiCvTrackEngine>());
+            break;
+        case Track::TrackMode::Last:
+            break;
+        }
+    }
+
     void updateTrackSetups();
     void updateTrackOutputs();
     void reset();
@@ -162,7 +243,7 @@ private:
     void usbMidiDisconnect();
 
     void receiveMidi();
-    void receiveMidi(MidiPort port, const MidiMessage &message);
+    void receiveMidi(MidiPort port, const MidiMessage &message, uint32_t timestampUs);
     void monitorMidi(const MidiMessage &message);
 
     void initClock();
@@ -177,14 +258,18 @@ private:
 
     EngineState _state;
 
+    CommandQueue _commandQueue;
+
     CvInput _cvInput;
     CvOutput _cvOutput;
 
     Clock _clock;
+    Groove::SwingTable _swingTable;
     TapTempo _tapTempo;
     NudgeTempo _nudgeTempo;
 
     TrackEngineContainerArray _trackEngineContainers;
+    std::array<uint8_t, CONFIG_TRACK_COUNT> _activeTrackEngineContainer;
     TrackEngineArray _trackEngines;
 
     MidiOutputEngine _midiOutputEngine;
@@ -192,11 +277,11 @@ private:
     RoutingEngine _routingEngine;
     MidiLearn _midiLearn;
     MidiReceiveHandler _midiReceiveHandler;
-    UsbMidiConnectHandler _usbMidiConnectHandler;
-    UsbMidiDisconnectHandler _usbMidiDisconnectHandler;
 
     CvGateToMidiConverter _cvGateToMidiConverter;
 
+    PerformanceMonitor _performanceMonitor;
+
     // locking
     volatile uint32_t _requestLock = 0;
     volatile uint32_t _requestUnlock = 0;
@@ -206,6 +291,9 @@ private:
 
     uint32_t _lastSystemTicks = 0;
 
+    uint32_t _updateOverloadCount = 0;
+    bool _updateOverloaded = false;
+
     // midi monitoring
     struct {
         int8_t lastNote = -1;
@@ -220,5 +308,5 @@ private:
     bool _cvOutputOverride = false;
     std::array<float, CvOutput::Channels> _cvOutputOverrideValues;
 
-    MessageHandler _messageHandler;
+    RingBuffer<Event, 8> _events;
 };
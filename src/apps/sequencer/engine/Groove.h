@@ -2,6 +2,8 @@
 
 #include "Config.h"
 
+#include <array>
+
 #include <cstdint>
 
 namespace Groove {
@@ -25,4 +27,48 @@ static uint32_t applySwing(uint32_t tick, int swing, uint32_t base = CONFIG_PPQN
     return beat * period + tick;
 }
 
+// Precomputed swing-offset lookup table. The swing mapping is periodic over
+// two bases, so the table covers one period and applying swing in the hot
+// tick path becomes a single table read instead of arithmetic with divisions.
+// The table is only regenerated when the swing amount changes.
+class SwingTable {
+public:
+    SwingTable() {
+        generate(50, CONFIG_PPQN / 4);
+    }
+
+    int swing() const { return _swing; }
+
+    // regenerate table if swing or base (tick resolution) has changed
+    void update(int swing, uint32_t base = CONFIG_PPQN / 4) {
+        if (swing != _swing || base != _base) {
+            generate(swing, base);
+        }
+    }
+
+    // same mapping as applySwing() with the configured base
+    uint32_t apply(uint32_t tick) const {
+        uint32_t beat = tick / _period;
+        return beat * _period + _table[tick % _period];
+    }
+
+private:
+    void generate(int swing, uint32_t base) {
+        _swing = swing;
+        _base = base;
+        _period = 2 * base;
+        for (uint32_t tick = 0; tick < _period; ++tick) {
+            _table[tick] = applySwing(tick, swing, base);
+        }
+    }
+
+    // sized for the highest selectable tick resolution
+    static constexpr uint32_t MaxPeriod = 2 * (CONFIG_PPQN_MAX / 4);
+
+    int _swing;
+    uint32_t _base;
+    uint32_t _period;
+    std::array<uint16_t, MaxPeriod> _table;
+};
+
 } // namespace Groove
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <utility>
+#include <functional>
+
+#include <cstdint>
+
+// Fixed-capacity priority queue implemented as a binary min-heap, giving
+// O(log n) push/pop instead of SortedQueue's O(n) insertion sort. Uses the
+// same static storage approach and API as SortedQueue for elements that are
+// only consumed from the front. Elements with equal priority are popped in
+// insertion order (stable), which the gate queues rely on to keep on/off
+// edges scheduled at the same tick in order.
+template<typename T, size_t Capacity, typename Compare = std::less<T>>
+class HeapQueue {
+public:
+    HeapQueue() {
+        clear();
+    }
+
+    void clear() {
+        _size = 0;
+        _sequence = 0;
+    }
+
+    size_t capacity() const {
+        return Capacity;
+    }
+
+    size_t size() const {
+        return _size;
+    }
+
+    bool empty() const {
+        return _size == 0;
+    }
+
+    bool full() const {
+        return _size == Capacity;
+    }
+
+    void push(const T &value) {
+        _queue[_size] = { value, _sequence++ };
+        siftUp(_size);
+        ++_size;
+    }
+
+    // push value and drop all queued elements that compare greater, matching
+    // SortedQueue::pushReplace() semantics (elements comparing equal are kept)
+    void pushReplace(const T &value) {
+        Compare compare;
+        size_t count = 0;
+        for (size_t i = 0; i < _size; ++i) {
+            if (!compare(value, _queue[i].value)) {
+                _queue[count++] = _queue[i];
+            }
+        }
+        _size = count;
+        // restore heap property
+        for (size_t i = _size / 2; i > 0; --i) {
+            siftDown(i - 1);
+        }
+        push(value);
+    }
+
+    const T &front() const { return _queue[0].value; }
+          T &front()       { return _queue[0].value; }
+
+    void pop() {
+        if (_size > 0) {
+            --_size;
+            _queue[0] = _queue[_size];
+            siftDown(0);
+        }
+    }
+
+private:
+    struct Entry {
+        T value;
+        uint32_t sequence;
+    };
+
+    bool less(const Entry &a, const Entry &b) const {
+        Compare compare;
+        if (compare(a.value, b.value)) {
+            return true;
+        }
+        if (compare(b.value, a.value)) {
+            return false;
+        }
+        return int32_t(a.sequence - b.sequence) < 0;
+    }
+
+    void siftUp(size_t pos) {
+        while (pos > 0) {
+            size_t parent = (pos - 1) / 2;
+            if (!less(_queue[pos], _queue[parent])) {
+                break;
+            }
+            std::swap(_queue[pos], _queue[parent]);
+            pos = parent;
+        }
+    }
+
+    void siftDown(size_t pos) {
+        while (true) {
+            size_t child = 2 * pos + 1;
+            if (child >= _size) {
+                break;
+            }
+            if (child + 1 < _size && less(_queue[child + 1], _queue[child])) {
+                ++child;
+            }
+            if (!less(_queue[child], _queue[pos])) {
+                break;
+            }
+            std::swap(_queue[pos], _queue[child]);
+            pos = child;
+        }
+    }
+
+    std::array<Entry, Capacity> _queue;
+    size_t _size;
+    uint32_t _sequence;
+};
@@ -2,6 +2,8 @@
 #include "Engine.h"
 #include "MidiUtils.h"
 
+#include "drivers/HighResolutionTimer.h"
+
 #include "os/os.h"
 
 #include <cmath>
@@ -9,11 +11,15 @@
 
 
 void MidiCvTrackEngine::reset() {
+    updateEventFilter();
     _arpeggiatorEnabled = false;
     _activity = false;
     _pitchBend = 0;
     _channelPressure = 0;
     _slideActive = false;
+    _cvOutputsDirty = true;
+    _cvOutputConfig = CvOutputConfig();
+    _cvOutputs.fill(0.f);
     resetVoices();
 }
 
@@ -27,6 +33,24 @@ void MidiCvTrackEngine::tick(uint32_t tick) {
 }
 
 void MidiCvTrackEngine::update(float dt) {
+    // recompile the event filter when the source config has changed
+    if (_midiCvTrack.source() != _filterSource) {
+        updateEventFilter();
+    }
+
+    // invalidate the cached cv outputs when the output config has changed
+    CvOutputConfig cvOutputConfig = {
+        int8_t(_midiCvTrack.transpose()),
+        uint8_t(_midiCvTrack.voices()),
+        uint8_t(_midiCvTrack.voiceConfig()),
+        uint8_t(_midiCvTrack.modulationRange()),
+        uint8_t(_midiCvTrack.pitchBendRange()),
+    };
+    if (cvOutputConfig != _cvOutputConfig) {
+        _cvOutputConfig = cvOutputConfig;
+        _cvOutputsDirty = true;
+    }
+
     updateArpeggiator();
 
     // run arpeggiator even if clock is not running
@@ -42,48 +66,115 @@ void MidiCvTrackEngine::update(float dt) {
 
     // update monophonic portamento
     if (_midiCvTrack.voices() == 1) {
-        _pitchCvOutputTarget = noteToCv(_voices.front().note + _midiCvTrack.transpose()) + pitchBendToCv(_pitchBend);
+        if (_cvOutputsDirty) {
+            const auto *voice = _voiceByOutput[0];
+            if (voice) {
+                _monoNote = voice->note;
+            }
+            _pitchCvOutputTarget = noteToCv(_monoNote + _midiCvTrack.transpose()) + pitchBendToCv(_pitchBend);
+        }
         if (_slideActive && _midiCvTrack.slideTime() > 0) {
-            _pitchCvOutput += (_pitchCvOutputTarget - _pitchCvOutput) * std::min(1.f, dt * (200 - 2 * _midiCvTrack.slideTime()));
-        } else {
+            // an active slide keeps changing the pitch output until the slew
+            // limiter has settled on the target
+            float pitchCvOutput = _pitchCvOutputSlew.update(_pitchCvOutputTarget, SlewLimiter::coefficient(dt, _midiCvTrack.slideTime()));
+            if (pitchCvOutput != _pitchCvOutput) {
+                _pitchCvOutput = pitchCvOutput;
+                _cvOutputsDirty = true;
+            }
+        } else if (_cvOutputsDirty) {
+            _pitchCvOutputSlew.set(_pitchCvOutputTarget);
             _pitchCvOutput = _pitchCvOutputTarget;
         }
     }
+
+    if (_cvOutputsDirty) {
+        updateCvOutputs();
+        _cvOutputsDirty = false;
+    }
+}
+
+void MidiCvTrackEngine::updateEventFilter() {
+    const auto &source = _midiCvTrack.source();
+    _filterSource = source;
+    _filterPort = uint8_t(source.port());
+    _filterChannelMask = source.isOmni() ? 0xffff : (1 << source.channel());
+
+    for (auto &action : _eventActions) {
+        action = EventAction::Ignore;
+    }
+    auto set = [this] (MidiMessage::ChannelMessage channelMessage, EventAction action) {
+        _eventActions[(channelMessage >> 4) & 0x7] = action;
+    };
+    set(MidiMessage::NoteOff, EventAction::NoteOff);
+    set(MidiMessage::NoteOn, EventAction::NoteOn);
+    set(MidiMessage::KeyPressure, EventAction::KeyPressure);
+    set(MidiMessage::ChannelPressure, EventAction::ChannelPressure);
+    set(MidiMessage::PitchBend, EventAction::PitchBend);
 }
 
-bool MidiCvTrackEngine::receiveMidi(MidiPort port, const MidiMessage &message) {
+bool MidiCvTrackEngine::receiveMidi(MidiPort port, const MidiMessage &message, uint32_t timestampUs) {
+    // compiled event filter: a table load keyed on the status nibble and a
+    // channel mask test reject broadcast traffic (clock, active sensing,
+    // events on other channels) in a few loads
+    uint8_t status = message.status();
+    EventAction action = _eventActions[(status >> 4) & 0x7];
+    if (action == EventAction::Ignore ||
+        port != MidiPort(_filterPort) ||
+        (_filterChannelMask & (1 << (status & 0xf))) == 0) {
+        return false;
+    }
+
     // filter notes that are not in the key range
-    if (message.isNoteOn() || message.isNoteOff()) {
+    if (action == EventAction::NoteOn || action == EventAction::NoteOff) {
         if (message.note() < _midiCvTrack.lowNote() || message.note() > _midiCvTrack.highNote()) {
             return false;
         }
     }
 
-    if (MidiUtils::matchSource(port, message, _midiCvTrack.source())) {
-        if (_arpeggiatorEnabled) {
-            if (message.isNoteOn()) {
-                _arpeggiatorEngine.noteOn(message.note());
-            } else if (message.isNoteOff()) {
-                _arpeggiatorEngine.noteOff(message.note());
+    if (_arpeggiatorEnabled) {
+        switch (action) {
+        case EventAction::NoteOn:
+            _arpeggiatorEngine.noteOn(message.note());
+            break;
+        case EventAction::NoteOff:
+            _arpeggiatorEngine.noteOff(message.note());
+            break;
+        default:
+            break;
+        }
+    } else {
+        switch (action) {
+        case EventAction::NoteOn:
+            addVoice(message.note(), message.velocity(), timestampUs);
+            break;
+        case EventAction::NoteOff:
+            removeVoice(message.note());
+            break;
+        case EventAction::KeyPressure: {
+            auto voice = findVoice(message.note());
+            if (voice && voice->pressure != message.keyPressure()) {
+                voice->pressure = message.keyPressure();
+                _cvOutputsDirty = true;
             }
-        } else {
-            if (message.isNoteOn()) {
-                addVoice(message.note(), message.velocity());
-            } else if (message.isNoteOff()) {
-                removeVoice(message.note());
-            } else if (message.isKeyPressure()) {
-                auto voice = findVoice(message.note());
-                if (voice) {
-                    voice->pressure = message.keyPressure();
-                }
-            } else if (message.isChannelPressure()) {
+            break;
+        }
+        case EventAction::ChannelPressure:
+            if (_channelPressure != message.channelPressure()) {
                 _channelPressure = message.channelPressure();
-            } else if (message.isPitchBend()) {
+                _cvOutputsDirty = true;
+            }
+            break;
+        case EventAction::PitchBend:
+            if (_pitchBend != message.pitchBend()) {
                 _pitchBend = message.pitchBend();
+                _cvOutputsDirty = true;
             }
-
-            updateActivity();
+            break;
+        default:
+            break;
         }
+
+        updateActivity();
     }
 
     // do not consume midi events to allow other midi/cv tracks react to the same events
@@ -95,40 +186,41 @@ bool MidiCvTrackEngine::activity() const {
 }
 
 bool MidiCvTrackEngine::gateOutput(int index) const {
-    int voiceIndex = _voiceByOutput[index % _midiCvTrack.voices()];
-    if (voiceIndex != -1) {
-        const auto &voice = _voices[voiceIndex];
+    const auto *voice = _voiceByOutput[index % _midiCvTrack.voices()];
+    if (voice) {
         uint32_t delay = _midiCvTrack.retrigger() ? RetriggerDelay : 0;
-        return !mute() && voice.isActive() && (voice.ticks - os::ticks()) >= delay;
+        return !mute() && voice->isActive() && (voice->ticks - os::ticks()) >= delay;
     }
     return false;
 }
 
 float MidiCvTrackEngine::cvOutput(int index) const {
+    int totalOutputs = _midiCvTrack.voices() * (int(_midiCvTrack.voiceConfig()) + 1);
+    return _cvOutputs[index % totalOutputs];
+}
+
+void MidiCvTrackEngine::updateCvOutputs() {
     int transpose = _midiCvTrack.transpose();
     int voices = _midiCvTrack.voices();
     int signals = int(_midiCvTrack.voiceConfig()) + 1;
-    int totalOutputs = voices * signals;
-    index %= totalOutputs;
-    int voiceIndex = index % voices;
-    int signalIndex = index / voices;
-
-    voiceIndex = _voiceByOutput[index % _midiCvTrack.voices()];
-    if (voiceIndex != -1) {
-        const auto &voice = _voices[voiceIndex];
-        switch (signalIndex) {
-        case 0: return voices == 1 ? _pitchCvOutput : noteToCv(voice.note + transpose) + pitchBendToCv(_pitchBend);
-        case 1: return valueToCv(voice.velocity);
-        case 2: return valueToCv(voice.pressure) + valueToCv(_channelPressure);
+
+    for (int index = 0; index < voices * signals; ++index) {
+        int signalIndex = index / voices;
+        const auto *voice = _voiceByOutput[index % voices];
+        float value = 0.f;
+        if (voice) {
+            switch (signalIndex) {
+            case 0: value = voices == 1 ? _pitchCvOutput : noteToCv(voice->note + transpose) + pitchBendToCv(_pitchBend); break;
+            case 1: value = valueToCv(voice->velocity); break;
+            case 2: value = valueToCv(voice->pressure) + valueToCv(_channelPressure); break;
+            }
         }
+        _cvOutputs[index] = value;
     }
-    return 0.f;
 }
 
 void MidiCvTrackEngine::updateActivity() {
-    _activity = std::any_of(_voices.begin(), _voices.end(), [] (const Voice &voice) {
-        return voice.isActive();
-    });
+    _activity = _voiceHead != nullptr;
 }
 
 void MidiCvTrackEngine::updateArpeggiator() {
@@ -148,12 +240,12 @@ void MidiCvTrackEngine::updateArpeggiator() {
 }
 
 void MidiCvTrackEngine::tickArpeggiator(uint32_t tick) {
-    _arpeggiatorEngine.tick(tick, swing());
+    _arpeggiatorEngine.tick(tick, swing(), _engine.ppqn());
 
     ArpeggiatorEngine::Event event;
     while (_arpeggiatorEngine.getEvent(tick, event)) {
         if (event.action == ArpeggiatorEngine::Event::NoteOn) {
-            addVoice(event.note, event.velocity);
+            addVoice(event.note, event.velocity, HighResolutionTimer::us());
         } else if (event.action == ArpeggiatorEngine::Event::NoteOff) {
             removeVoice(event.note);
         }
@@ -176,143 +268,214 @@ float MidiCvTrackEngine::pitchBendToCv(int value) const {
 }
 
 void MidiCvTrackEngine::resetVoices() {
-    for (auto &voice : _voices) {
-        voice.reset();
-    }
-    _voiceByOutput.fill(-1);
+    _voicePool.forEach([this] (Voice &voice) {
+        _voicePool.release(&voice);
+    });
+    _voiceHead = nullptr;
+    _voiceTail = nullptr;
+    _voiceByOutput.fill(nullptr);
     _nextOutput = -1;
+    _monoNote = 60;
+    _cvOutputsDirty = true;
 }
 
-void MidiCvTrackEngine::addVoice(int note, int velocity) {
+void MidiCvTrackEngine::addVoice(int note, int velocity, uint32_t timestampUs) {
     // activate slide if there already are active voices
-    _slideActive = _midiCvTrack.voices() == 1 && std::any_of(_voices.begin(), _voices.end(), [] (const Voice &voice) {
-        return voice.isActive();
-    });
+    _slideActive = _midiCvTrack.voices() == 1 && _voiceHead != nullptr;
+
+    reclaimExcessOutputs();
+
+    // take a voice from the free-list, otherwise steal one
+    Voice *voice = _voicePool.allocate();
+    int output = -1;
+    if (!voice) {
+        voice = stealVoice();
+        // reuse the output of the stolen voice
+        output = voice->output;
+        if (output != -1) {
+            _voiceByOutput[output] = nullptr;
+        }
+    }
 
-    // find a free voice
-    const auto it = std::find_if(_voices.begin(), _voices.end(), [] (const Voice &voice) {
-        return !voice.isActive() && !voice.isAllocated();
-    });
+    voice->ticks = os::ticks();
+    voice->timestampUs = timestampUs;
+    voice->note = note;
+    voice->velocity = velocity;
+    voice->pressure = 0;
+    voice->output = -1;
+    appendVoice(voice);
 
-    // override last voice (lowest priority) if all are used
-    auto &voice = it == _voices.end() ? _voices.back() : *it;
+    if (output == -1) {
+        output = allocateOutput(*voice);
+    }
+    if (output != -1) {
+        voice->output = output;
+        _voiceByOutput[output] = voice;
+    }
 
-    voice.reset();
-    voice.ticks = os::ticks();
-    voice.note = note;
-    voice.velocity = velocity;
-    voice.pressure = 0;
+    _cvOutputsDirty = true;
 
-    sortVoices();
+    // printVoices();
 }
 
 void MidiCvTrackEngine::removeVoice(int note) {
-    auto voice = findVoice(note);
-    if (voice) {
-        voice->release();
+    Voice *voice = findVoice(note);
+    if (!voice) {
+        return;
     }
 
-    sortVoices();
-}
+    voice->release();
+    unlinkVoice(voice);
 
-MidiCvTrackEngine::Voice *MidiCvTrackEngine::findVoice(int note) {
-    auto it = std::find_if(_voices.begin(), _voices.end(), [note] (const Voice &voice) {
-        return voice.isActive() && voice.note == note;
-    });
+    reclaimExcessOutputs();
 
-    return it == _voices.end() ? nullptr : it;
-}
+    if (voice->isAllocated()) {
+        // hand the output over to the highest priority voice still waiting for
+        // one, otherwise keep the released voice mapped so the cv output holds
+        // its pitch
+        Voice *successor = nullptr;
+        for (Voice *v = _voiceHead; v; v = v->next) {
+            if (!v->isAllocated() && (!successor || higherPriority(*v, *successor))) {
+                successor = v;
+            }
+        }
+        if (successor) {
+            successor->output = voice->output;
+            _voiceByOutput[voice->output] = successor;
+            _voicePool.release(voice);
+        }
+    } else {
+        _voicePool.release(voice);
+    }
 
-void MidiCvTrackEngine::sortVoices() {
-    // move all active voices to front of array
-    auto activeEnd = std::stable_partition(_voices.begin(), _voices.end(), [] (const Voice &voice) {
-        return voice.isActive();
-    });
+    _cvOutputsDirty = true;
 
-    // sort based on note priority
-    auto notePriority = _midiCvTrack.notePriority();
-    std::sort(_voices.begin(), activeEnd, [notePriority] (const Voice &a, const Voice &b) {
-        switch (notePriority) {
-        case MidiCvTrack::NotePriority::LastNote:
-            return a.ticks > b.ticks;
-        case MidiCvTrack::NotePriority::FirstNote:
-            return a.ticks < b.ticks;
-        case MidiCvTrack::NotePriority::LowestNote:
-            return a.note < b.note;
-        case MidiCvTrack::NotePriority::HighestNote:
-            return a.note > b.note;
-        case MidiCvTrack::NotePriority::Last:
-            break;
+    // printVoices();
+}
+
+MidiCvTrackEngine::Voice *MidiCvTrackEngine::findVoice(int note) {
+    for (Voice *voice = _voiceHead; voice; voice = voice->next) {
+        if (voice->note == note) {
+            return voice;
         }
-        return false;
-    });
+    }
+    return nullptr;
+}
 
-    // update voice allocation
-    int voices = _midiCvTrack.voices();
+void MidiCvTrackEngine::appendVoice(Voice *voice) {
+    voice->next = nullptr;
+    if (_voiceTail) {
+        _voiceTail->next = voice;
+    } else {
+        _voiceHead = voice;
+    }
+    _voiceTail = voice;
+}
 
-    // reset excess voices
-    for (int i = 0; i < int(_voices.size()); ++i) {
-        auto &voice = _voices[i];
-        if (voice.output >= voices) {
-            voice.reset();
+void MidiCvTrackEngine::unlinkVoice(Voice *voice) {
+    Voice **link = &_voiceHead;
+    Voice *prev = nullptr;
+    while (*link && *link != voice) {
+        prev = *link;
+        link = &(*link)->next;
+    }
+    if (*link) {
+        *link = voice->next;
+        if (_voiceTail == voice) {
+            _voiceTail = prev;
         }
     }
+}
 
-    // helper to allocate a new voice output
-    auto allocateOutput = [this, voices] () -> int {
-        // try to allocate output in round-fashion, either a new output or released voice
-        for (int i = 0; i < int(VoiceCount); ++i) {
-            ++_nextOutput;
-            _nextOutput = _nextOutput >= voices ? 0 : _nextOutput;
-            bool isFree = std::none_of(_voices.begin(), _voices.end(), [this] (const Voice &v) {
-                return v.isActive() && v.output == _nextOutput;
-            });
-            if (isFree) {
-                for (auto &voice : _voices) {
-                    if (voice.output == _nextOutput) {
-                        voice.output = -1;
-                    }
-                }
-                return _nextOutput;
-            }
+MidiCvTrackEngine::Voice *MidiCvTrackEngine::stealVoice() {
+    // prefer reclaiming a released voice that is only kept for its cv output
+    for (auto voice : _voiceByOutput) {
+        if (voice && !voice->isActive()) {
+            return voice;
         }
+    }
 
-        // otherwise steal lowest priority output
-        for (int i = int(_voices.size()) - 1; i >= 0; --i) {
-            auto &voice = _voices[i];
-            if (voice.isAllocated()) {
-                int output = voice.output;
-                voice.output = -1;
-                return output;
-            }
+    // otherwise steal the lowest priority active voice
+    Voice *victim = _voiceHead;
+    for (Voice *voice = _voiceHead; voice; voice = voice->next) {
+        if (higherPriority(*victim, *voice)) {
+            victim = voice;
         }
+    }
+    unlinkVoice(victim);
+    return victim;
+}
 
-        return -1;
-    };
+int MidiCvTrackEngine::allocateOutput(const Voice &requester) {
+    int voices = _midiCvTrack.voices();
 
-    // allocate new voices in round-robin fashion
+    // try to allocate an output in round-robin fashion, either an unused
+    // output or one only holding a released voice
     for (int i = 0; i < voices; ++i) {
-        auto &voice = _voices[i];
-        if (voice.isActive() && !voice.isAllocated()) {
-            voice.output = allocateOutput();
+        _nextOutput = (_nextOutput + 1) % voices;
+        Voice *voice = _voiceByOutput[_nextOutput];
+        if (!voice || !voice->isActive()) {
+            if (voice) {
+                _voicePool.release(voice);
+                _voiceByOutput[_nextOutput] = nullptr;
+            }
+            return _nextOutput;
         }
     }
 
-    // update allocation map
-    _voiceByOutput.fill(-1);
-    for (int i = 0; i < int(_voices.size()); ++i) {
-        const auto &voice = _voices[i];
-        if (voice.isAllocated()) {
-            _voiceByOutput[voice.output] = i;
+    // otherwise steal the output of the lowest priority sounding voice
+    Voice *victim = nullptr;
+    for (Voice *voice = _voiceHead; voice; voice = voice->next) {
+        if (voice->isAllocated() && (!victim || higherPriority(*victim, *voice))) {
+            victim = voice;
         }
     }
+    if (victim && higherPriority(requester, *victim)) {
+        int output = victim->output;
+        victim->output = -1;
+        return output;
+    }
 
-    // printVoices();
+    return -1;
+}
+
+void MidiCvTrackEngine::reclaimExcessOutputs() {
+    // reset voices on outputs that no longer exist when the voice count is lowered
+    int voices = _midiCvTrack.voices();
+    for (int output = voices; output < int(VoiceCount); ++output) {
+        Voice *voice = _voiceByOutput[output];
+        if (voice) {
+            if (voice->isActive()) {
+                unlinkVoice(voice);
+            }
+            _voicePool.release(voice);
+            _voiceByOutput[output] = nullptr;
+        }
+    }
+    if (_nextOutput >= voices) {
+        _nextOutput = -1;
+    }
+}
+
+bool MidiCvTrackEngine::higherPriority(const Voice &a, const Voice &b) const {
+    switch (_midiCvTrack.notePriority()) {
+    case MidiCvTrack::NotePriority::LastNote:
+        return int32_t(a.timestampUs - b.timestampUs) > 0;
+    case MidiCvTrack::NotePriority::FirstNote:
+        return int32_t(a.timestampUs - b.timestampUs) < 0;
+    case MidiCvTrack::NotePriority::LowestNote:
+        return a.note < b.note;
+    case MidiCvTrack::NotePriority::HighestNote:
+        return a.note > b.note;
+    case MidiCvTrack::NotePriority::Last:
+        break;
+    }
+    return false;
 }
 
 void MidiCvTrackEngine::printVoices() {
     DBG("voices");
-    for (auto voice : _voices) {
-        DBG("%" PRIu32 " %d %d", voice.ticks, int(voice.note), int(voice.output));
+    for (const Voice *voice = _voiceHead; voice; voice = voice->next) {
+        DBG("%" PRIu32 " %d %d", voice->ticks, int(voice->note), int(voice->output));
     }
 }
@@ -2,10 +2,13 @@
 
 #include "TrackEngine.h"
 #include "ArpeggiatorEngine.h"
+#include "SlewLimiter.h"
 
 #include "model/Track.h"
 
-class MidiCvTrackEngine : public TrackEngine {
+#include "core/utils/ObjectPool.h"
+
+class MidiCvTrackEngine final : public TrackEngine {
 public:
     MidiCvTrackEngine(Engine &engine, const Model &model, Track &track, const TrackEngine *linkedTrackEngine) :
         TrackEngine(engine, model, track, linkedTrackEngine),
@@ -22,7 +25,7 @@ public:
     virtual void tick(uint32_t tick) override;
     virtual void update(float dt) override;
 
-    virtual bool receiveMidi(MidiPort port, const MidiMessage &message) override;
+    virtual bool receiveMidi(MidiPort port, const MidiMessage &message, uint32_t timestampUs) override;
 
     virtual bool activity() const override;
     virtual bool gateOutput(int index) const override;
@@ -34,15 +37,12 @@ private:
 
     struct Voice {
         uint32_t ticks = 0;
+        uint32_t timestampUs = 0;
         uint8_t note = 60;
         uint8_t velocity = 0;
         uint8_t pressure = 0;
         int8_t output = -1;
-
-        void reset() {
-            ticks = 0;
-            output = -1;
-        }
+        Voice *next = nullptr;
 
         void release() { ticks = 0; }
 
@@ -50,6 +50,36 @@ private:
         bool isAllocated() const { return output != -1; }
     };
 
+    // what to do with an incoming event, compiled from the source config
+    enum class EventAction : uint8_t {
+        Ignore,
+        NoteOff,
+        NoteOn,
+        KeyPressure,
+        ChannelPressure,
+        PitchBend,
+    };
+
+    // output config affecting the cv conversion, kept for change detection
+    struct CvOutputConfig {
+        int8_t transpose;
+        uint8_t voices;
+        uint8_t voiceConfig;
+        uint8_t modulationRange;
+        uint8_t pitchBendRange;
+
+        bool operator!=(const CvOutputConfig &other) const {
+            return transpose != other.transpose ||
+                voices != other.voices ||
+                voiceConfig != other.voiceConfig ||
+                modulationRange != other.modulationRange ||
+                pitchBendRange != other.pitchBendRange;
+        }
+    };
+
+    void updateEventFilter();
+    void updateCvOutputs();
+
     void updateActivity();
 
     void updateArpeggiator();
@@ -61,23 +91,40 @@ private:
 
     void resetVoices();
 
-    void addVoice(int note, int velocity);
+    void addVoice(int note, int velocity, uint32_t timestampUs);
     void removeVoice(int note);
     Voice *findVoice(int note);
 
-    void sortVoices();
+    void appendVoice(Voice *voice);
+    void unlinkVoice(Voice *voice);
+    Voice *stealVoice();
+    int allocateOutput(const Voice &requester);
+    void reclaimExcessOutputs();
+    bool higherPriority(const Voice &a, const Voice &b) const;
+
     void printVoices();
 
     const MidiCvTrack &_midiCvTrack;
 
+    // event filter compiled from the source config, rebuilt on config change
+    MidiSourceConfig _filterSource;
+    uint8_t _filterPort;
+    uint16_t _filterChannelMask;
+    EventAction _eventActions[8];   // indexed by status nibble
+
     ArpeggiatorEngine _arpeggiatorEngine;
     bool _arpeggiatorEnabled;
     float _arpeggiatorTime;
     uint32_t _arpeggiatorTick;
 
-    std::array<Voice, VoiceCount> _voices;
-    std::array<int8_t, VoiceCount> _voiceByOutput;
+    // voices are allocated from a pool (free-list) and kept in an intrusive
+    // list in note-on order (oldest first) used for voice stealing
+    ObjectPool<Voice, VoiceCount> _voicePool;
+    Voice *_voiceHead;
+    Voice *_voiceTail;
+    std::array<Voice *, VoiceCount> _voiceByOutput;
     int8_t _nextOutput;
+    uint8_t _monoNote;
 
     bool _activity;
 
@@ -88,4 +135,12 @@ private:
     bool _slideActive;
     float _pitchCvOutputTarget;
     float _pitchCvOutput;
+    SlewLimiter _pitchCvOutputSlew;
+
+    // cv outputs are recomputed when a note/bend/pressure event or a config
+    // change marks them dirty and read from this cache in between, so the
+    // steady state costs a single flag test per update
+    bool _cvOutputsDirty;
+    CvOutputConfig _cvOutputConfig;
+    std::array<float, VoiceCount * 3> _cvOutputs;
 };
@@ -1,16 +1,34 @@
 #include "MidiLearn.h"
 
+#include "os/os.h"
+
+// minimum interval between scored events of the same candidate. a wiggled
+// controller sends hundreds of events per second, scoring a bounded number
+// of them is enough to learn and keeps the receive path cheap while armed
+static constexpr uint32_t ScoreIntervalMs = 10;
+
 MidiLearn::MidiLearn() {
     reset();
 }
 
 void MidiLearn::start(ResultCallback callback) {
     reset();
+    _hasPendingResult = false;
     _callback = callback;
 }
 
 void MidiLearn::stop() {
     _callback = nullptr;
+    _hasPendingResult = false;
+}
+
+bool MidiLearn::takeResult(Result &result) {
+    if (!_hasPendingResult) {
+        return false;
+    }
+    _hasPendingResult = false;
+    result = _pendingResult;
+    return true;
 }
 
 void MidiLearn::receiveMidi(MidiPort port, const MidiMessage &message) {
@@ -18,13 +36,35 @@ void MidiLearn::receiveMidi(MidiPort port, const MidiMessage &message) {
         return;
     }
 
+    // filter on the message type before touching any state
+    bool isNote = message.isNoteOn() || message.isNoteOff();
+    if (!isNote && !message.isPitchBend() && !message.isControlChange()) {
+        return;
+    }
+
+    // rate limit scoring on dense streams: events that do not change the
+    // current candidate are dropped within the scoring interval, so a
+    // controller flooding identical candidates costs a timestamp test per
+    // event instead of disturbing playback
+    bool sameCandidate = port == _port && message.channel() == _channel;
+    if (sameCandidate && message.isControlChange()) {
+        sameCandidate = message.controlNumber() == _controlNumber;
+    } else if (sameCandidate && isNote) {
+        sameCandidate = message.note() == _note;
+    }
+    uint32_t ticks = os::ticks();
+    if (sameCandidate && ticks - _lastScoreTicks < os::time::ms(ScoreIntervalMs)) {
+        return;
+    }
+    _lastScoreTicks = ticks;
+
     if (port != _port || message.channel() != _channel) {
         reset();
         _port = port;
         _channel = message.channel();
     }
 
-    if (message.isNoteOn() || message.isNoteOff()) {
+    if (isNote) {
         if (message.note() != _note) {
             _eventCounters[int(Event::Note)] = 0;
             _note = message.note();
@@ -44,8 +84,6 @@ void MidiLearn::receiveMidi(MidiPort port, const MidiMessage &message) {
         } else {
             ++_eventCounters[int(Event::ControlAbsolute)];
         }
-    } else {
-        return;
     }
 
     if (_eventCounters[int(Event::Note)] >= 4) {
@@ -76,7 +114,6 @@ void MidiLearn::emitResult(Result result) {
     }
     _lastResult = result;
 
-    if (_callback) {
-        _callback(result);
-    }
+    _pendingResult = result;
+    _hasPendingResult = true;
 }
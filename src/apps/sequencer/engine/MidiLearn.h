@@ -4,8 +4,9 @@
 
 #include "core/midi/MidiMessage.h"
 
+#include "core/utils/FixedFunction.h"
+
 #include <array>
-#include <functional>
 
 class MidiLearn {
 public:
@@ -35,17 +36,29 @@ public:
         }
     };
 
-    typedef std::function<void(const Result &result)> ResultCallback;
+    typedef FixedFunction<void(const Result &result)> ResultCallback;
 
     MidiLearn();
 
     void start(ResultCallback callback);
     void stop();
 
-    bool isActive() const { return _callback != nullptr; }
+    bool isActive() const { return bool(_callback); }
 
     void receiveMidi(MidiPort port, const MidiMessage &message);
 
+    // engine context, returns true when a result has been learned since the
+    // last call, the result is delivered to the ui through the engine event
+    // queue and dispatched there
+    bool takeResult(Result &result);
+
+    // ui context
+    void dispatchResult(const Result &result) {
+        if (_callback) {
+            _callback(result);
+        }
+    }
+
 private:
     void reset();
     void emitResult(Result result);
@@ -58,6 +71,10 @@ private:
     int8_t _note;
 
     Result _lastResult;
+    uint32_t _lastScoreTicks = 0;
+
+    Result _pendingResult;
+    bool _hasPendingResult = false;
 
     std::array<uint8_t, size_t(Event::Last)> _eventCounters;
 };
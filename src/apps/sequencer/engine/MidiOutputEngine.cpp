@@ -27,6 +27,8 @@ void MidiOutputEngine::tick(uint32_t tick) {
     // be conservative and make this 50 events per second
     uint32_t ccSendDivisor = nextPowerOfTwo(uint32_t(std::floor(1.f / (50.f * _engine.clock().tickDuration()))));
 
+    // first pass: handle configuration changes and send slide/note events on
+    // all outputs, so notes are never delayed behind pending control changes
     for (int outputIndex = 0; outputIndex < CONFIG_MIDI_OUTPUT_COUNT; ++outputIndex) {
         const auto &output = _midiOutput.output(outputIndex);
         auto &outputState = _outputStates[outputIndex];
@@ -45,10 +47,11 @@ void MidiOutputEngine::tick(uint32_t tick) {
         MidiPort port = MidiPort(output.target().port());
         int channel = output.target().channel();
 
-        // send slide requests
+        // send slide requests, keep the request pending if the port is busy
         if (outputState.hasRequest(OutputState::Slide)) {
-            sendMidi(port, MidiMessage::makeControlChange(channel, 65, outputState.slide ? 127 : 0));
-            outputState.clearRequest(OutputState::Slide);
+            if (sendMidi(port, MidiMessage::makeControlChange(channel, 65, outputState.slide ? 127 : 0))) {
+                outputState.clearRequest(OutputState::Slide);
+            }
         }
 
         // send note requests
@@ -86,11 +89,23 @@ void MidiOutputEngine::tick(uint32_t tick) {
 
             outputState.clearRequest(OutputState::NoteOn | OutputState::NoteOff);
         }
+    }
 
-        // send control change requests
-        if (tick % ccSendDivisor == 0 && outputState.hasRequest(OutputState::ControlChange)) {
-            sendMidi(port, MidiMessage::makeControlChange(channel, output.controlNumber(), outputState.control));
-            outputState.clearRequest(OutputState::ControlChange);
+    // second pass: send pending control changes, rate limited and coalesced
+    // to the most recent value (superseded values never enter the queue, a
+    // pending request is simply retried with the latest value)
+    if (tick % ccSendDivisor == 0) {
+        for (int outputIndex = 0; outputIndex < CONFIG_MIDI_OUTPUT_COUNT; ++outputIndex) {
+            const auto &output = _midiOutput.output(outputIndex);
+            auto &outputState = _outputStates[outputIndex];
+
+            if (outputState.hasRequest(OutputState::ControlChange)) {
+                MidiPort port = MidiPort(output.target().port());
+                int channel = output.target().channel();
+                if (sendMidi(port, MidiMessage::makeControlChange(channel, output.controlNumber(), outputState.control))) {
+                    outputState.clearRequest(OutputState::ControlChange);
+                }
+            }
         }
     }
 }
@@ -163,7 +178,7 @@ void MidiOutputEngine::resetOutput(int outputIndex) {
     outputState.reset();
 }
 
-void MidiOutputEngine::sendMidi(MidiPort port, const MidiMessage &message) {
+bool MidiOutputEngine::sendMidi(MidiPort port, const MidiMessage &message) {
     // MidiMessage::dump(message);
-    _engine.sendMidi(port, message);
+    return _engine.sendMidi(port, message);
 }
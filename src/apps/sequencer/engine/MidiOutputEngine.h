@@ -64,7 +64,7 @@ private:
 
     void resetOutput(int outputIndex);
 
-    void sendMidi(MidiPort port, const MidiMessage &message);
+    bool sendMidi(MidiPort port, const MidiMessage &message);
 
     Engine &_engine;
     const MidiOutput &_midiOutput;
@@ -2,9 +2,12 @@
 
 #include "Engine.h"
 #include "Groove.h"
+#include "ScaleCache.h"
 #include "SequenceUtils.h"
 
 #include "core/Debug.h"
+
+#include "drivers/HighResolutionTimer.h"
 #include "core/utils/Random.h"
 #include "core/math/Math.h"
 
@@ -12,14 +15,38 @@
 
 static Random rng;
 
+// how far ahead gate changes are handed to the gate output driver, in ticks
+static constexpr uint32_t GateScheduleLookaheadTicks = 2;
+
 // evaluate if step gate is active
 static bool evalStepGate(const NoteSequence::Step &step, int probabilityBias) {
     int probability = clamp(step.gateProbability() + probabilityBias, -1, NoteSequence::GateProbability::Max);
     return step.gate() && int(rng.nextRange(NoteSequence::GateProbability::Range)) <= probability;
 }
 
+// Deterministic conditions (first/loop counts) only depend on the loop
+// iteration. They are precomputed into one result bit per condition value
+// whenever the iteration changes, so evaluating them on the trigger path is
+// a single bit test instead of modulo arithmetic. Fill and pre conditions
+// depend on runtime state and stay evaluated in place.
+static uint64_t buildConditionTable(int iteration) {
+    uint64_t table = 1 << int(Types::Condition::Off);
+    auto set = [&table] (Types::Condition condition, bool value) {
+        if (value) {
+            table |= uint64_t(1) << int(condition);
+        }
+    };
+    set(Types::Condition::First, iteration == 0);
+    set(Types::Condition::NotFirst, iteration != 0);
+    for (int index = int(Types::Condition::Loop); index < int(Types::Condition::Last); ++index) {
+        auto loop = Types::conditionLoop(Types::Condition(index));
+        set(Types::Condition(index), iteration % loop.base == loop.offset);
+    }
+    return table;
+}
+
 // evaluate step condition
-static bool evalStepCondition(const NoteSequence::Step &step, int iteration, bool fill, bool &prevCondition) {
+static bool evalStepCondition(const NoteSequence::Step &step, uint64_t conditionTable, bool fill, bool &prevCondition) {
     auto condition = step.condition();
     switch (condition) {
     case Types::Condition::Off:                                         return true;
@@ -27,17 +54,10 @@ static bool evalStepCondition(const NoteSequence::Step &step, int iteration, boo
     case Types::Condition::NotFill:     prevCondition = !fill;          return prevCondition;
     case Types::Condition::Pre:                                         return prevCondition;
     case Types::Condition::NotPre:                                      return !prevCondition;
-    case Types::Condition::First:       prevCondition = iteration == 0; return prevCondition;
-    case Types::Condition::NotFirst:    prevCondition = iteration != 0; return prevCondition;
     default:
-        int index = int(condition);
-        if (index >= int(Types::Condition::Loop) && index < int(Types::Condition::Last)) {
-            auto loop = Types::conditionLoop(condition);
-            prevCondition = iteration % loop.base == loop.offset;
-            return prevCondition;
-        }
+        prevCondition = (conditionTable >> int(condition)) & 1;
+        return prevCondition;
     }
-    return true;
 }
 
 // evaluate step retrigger count
@@ -76,18 +96,41 @@ static float evalStepNote(const NoteSequence::Step &step, int probabilityBias, c
         }
         note = NoteSequence::Note::clamp(note + offset);
     }
-    return scale.noteToVolts(note);
+    return ScaleCache::noteToVolts(scale, note);
+}
+
+// Recorded steps share all fields except note and length. The prototype is
+// pre-armed once, so committing a recorded note is a copy of the packed step
+// data and two field writes instead of a dozen read-modify-write setters.
+static NoteSequence::Step makeRecordStepPrototype() {
+    NoteSequence::Step step;
+    step.setGate(true);
+    step.setGateProbability(NoteSequence::GateProbability::Max);
+    step.setRetrigger(0);
+    step.setRetriggerProbability(NoteSequence::RetriggerProbability::Max);
+    step.setLengthVariationRange(0);
+    step.setLengthVariationProbability(NoteSequence::LengthVariationProbability::Max);
+    step.setNoteVariationRange(0);
+    step.setNoteVariationProbability(NoteSequence::NoteVariationProbability::Max);
+    step.setCondition(Types::Condition::Off);
+    return step;
 }
 
+static const NoteSequence::Step recordStepPrototype = makeRecordStepPrototype();
+
 void NoteTrackEngine::reset() {
     _freeRelativeTick = 0;
     _sequenceState.reset();
     _currentStep = -1;
+    _currentStepPage = false;
     _prevCondition = false;
+    _conditionTableIteration = uint32_t(-1);
     _activity = false;
     _gateOutput = false;
+    _scheduledGateTick = 0;
     _cvOutput = 0.f;
     _cvOutputTarget = 0.f;
+    _cvOutputSlew.set(0.f);
     _slideActive = false;
     _gateQueue.clear();
     _cvQueue.clear();
@@ -105,18 +148,18 @@ void NoteTrackEngine::restart() {
 void NoteTrackEngine::tick(uint32_t tick) {
     ASSERT(_sequence != nullptr, "invalid sequence");
     const auto &sequence = *_sequence;
-    const auto *linkData = _linkedTrackEngine ? _linkedTrackEngine->linkData() : nullptr;
+    const auto *linkData = _linkedTrackData;
 
     if (linkData) {
         _linkData = *linkData;
-        _sequenceState = *linkData->sequenceState;
+        _sequenceState.copyPosition(*linkData->sequenceState);
 
         if (linkData->relativeTick % linkData->divisor == 0) {
             recordStep(tick, linkData->divisor);
             triggerStep(tick, linkData->divisor);
         }
     } else {
-        uint32_t divisor = sequence.divisor() * (CONFIG_PPQN / CONFIG_SEQUENCE_PPQN);
+        uint32_t divisor = sequence.divisor() * (_engine.ppqn() / CONFIG_SEQUENCE_PPQN);
         uint32_t resetDivisor = sequence.resetMeasure() * _engine.measureDivisor();
         uint32_t relativeTick = resetDivisor == 0 ? tick : tick % resetDivisor;
 
@@ -164,6 +207,19 @@ void NoteTrackEngine::tick(uint32_t tick) {
         midiOutputEngine.sendGate(_track.trackIndex(), _gateOutput);
     }
 
+    // schedule the upcoming gate change by wall clock time, the driver task
+    // emits it on time even when the engine task is running late
+    if (!_gateQueue.empty()) {
+        const auto &next = _gateQueue.front();
+        uint32_t ticksAhead = next.tick - tick;
+        if (ticksAhead > 0 && ticksAhead <= GateScheduleLookaheadTicks && next.tick != _scheduledGateTick) {
+            bool gate = (!mute() || fill()) && next.gate;
+            uint32_t timeUs = HighResolutionTimer::us() + uint32_t(ticksAhead * _engine.clock().tickDuration() * 1000000.f);
+            _engine.scheduleGateOutput(_track.trackIndex(), gate, timeUs);
+            _scheduledGateTick = next.tick;
+        }
+    }
+
     while (!_cvQueue.empty() && tick >= _cvQueue.front().tick) {
         if (!mute() || _noteTrack.cvUpdateMode() == NoteTrack::CvUpdateMode::Always) {
             _cvOutputTarget = _cvQueue.front().cv;
@@ -182,7 +238,6 @@ void NoteTrackEngine::update(float dt) {
 
     const auto &sequence = *_sequence;
     const auto &scale = sequence.selectedScale(_model.project().scale());
-    int rootNote = sequence.selectedRootNote(_model.project().rootNote());
     int octave = _noteTrack.octave();
     int transpose = _noteTrack.transpose();
 
@@ -198,15 +253,17 @@ void NoteTrackEngine::update(float dt) {
     // override due to monitoring or recording
     bool isStepRecordMode = _model.project().recordMode() == Types::RecordMode::StepRecord;
     if (!running && (!recording || isStepRecordMode) && _monitorStepIndex >= 0) {
-        // step monitoring (first priority)
-        const auto &step = sequence.step(_monitorStepIndex);
-        _cvOutputTarget = evalStepNote(step, 0, scale, rootNote, octave, transpose, false);
+        // step monitoring (first priority), indices at CONFIG_STEP_COUNT and
+        // above monitor the second page of an extended sequence
+        const auto &monitorSequence = _monitorStepIndex >= CONFIG_STEP_COUNT ? *_fillSequence : sequence;
+        const auto &step = monitorSequence.step(_monitorStepIndex % CONFIG_STEP_COUNT);
+        _cvOutputTarget = evalStepNote(step, 0, monitorSequence.selectedScale(_model.project().scale()), monitorSequence.selectedRootNote(_model.project().rootNote()), octave, transpose, false);
         _activity = _gateOutput = true;
         _monitorOverrideActive = true;
     } else if ((!running || !isStepRecordMode) && _recordHistory.isNoteActive()) {
         // midi monitoring (second priority)
         int note = noteFromMidiNote(_recordHistory.activeNote()) + evalTransposition(scale, octave, transpose);
-        _cvOutputTarget = scale.noteToVolts(note);
+        _cvOutputTarget = ScaleCache::noteToVolts(scale, note);
         _activity = _gateOutput = true;
         _monitorOverrideActive = true;
     } else {
@@ -217,15 +274,28 @@ void NoteTrackEngine::update(float dt) {
     }
 
     if (_slideActive && _noteTrack.slideTime() > 0) {
-        _cvOutput += (_cvOutputTarget - _cvOutput) * std::min(1.f, dt * (200 - 2 * _noteTrack.slideTime()));
+        _cvOutput = _cvOutputSlew.update(_cvOutputTarget, SlewLimiter::coefficient(dt, _noteTrack.slideTime()));
     } else {
+        _cvOutputSlew.set(_cvOutputTarget);
         _cvOutput = _cvOutputTarget;
     }
 }
 
 void NoteTrackEngine::changePattern() {
-    _sequence = &_noteTrack.sequence(pattern());
-    _fillSequence = &_noteTrack.sequence(std::min(pattern() + 1, CONFIG_PATTERN_COUNT - 1));
+    // const access, looking at a pattern is not an edit and must not trigger
+    // a snapshot backup
+    const auto &noteTrack = _noteTrack;
+    _sequence = &noteTrack.sequence(pattern());
+    _fillSequence = &noteTrack.sequence(std::min(pattern() + 1, CONFIG_PATTERN_COUNT - 1));
+}
+
+void NoteTrackEngine::prepareNextPattern(int pattern) {
+    // only the free play mode advances through the memoized table
+    if (_noteTrack.playMode() != Types::PlayMode::Free) {
+        return;
+    }
+    const auto &sequence = _noteTrack.sequence(pattern);
+    _sequenceState.prepare(sequence.runMode(), sequence.firstStep(), sequence.lastStep());
 }
 
 void NoteTrackEngine::monitorMidi(uint32_t tick, const MidiMessage &message) {
@@ -233,8 +303,9 @@ void NoteTrackEngine::monitorMidi(uint32_t tick, const MidiMessage &message) {
 
     if (_engine.recording() && _model.project().recordMode() == Types::RecordMode::StepRecord) {
         if (message.isNoteOn()) {
-            // record to step
-            auto &step = _sequence->step(_currentRecordStep);
+            // record to step, write through the track so an armed snapshot
+            // backs up the pattern first
+            auto &step = _noteTrack.sequence(pattern()).step(_currentRecordStep);
             step.setGate(true);
             step.setNote(noteFromMidiNote(message.note()));
 
@@ -248,7 +319,8 @@ void NoteTrackEngine::monitorMidi(uint32_t tick, const MidiMessage &message) {
 }
 
 void NoteTrackEngine::setMonitorStep(int index) {
-    _monitorStepIndex = (index >= 0 && index < CONFIG_STEP_COUNT) ? index : -1;
+    int stepCount = _noteTrack.extendedSteps() ? 2 * CONFIG_STEP_COUNT : CONFIG_STEP_COUNT;
+    _monitorStepIndex = (index >= 0 && index < stepCount) ? index : -1;
 
     // in step record mode, select step to start recording recording from
     if (_engine.recording() && _model.project().recordMode() == Types::RecordMode::StepRecord &&
@@ -257,6 +329,12 @@ void NoteTrackEngine::setMonitorStep(int index) {
     }
 }
 
+int NoteTrackEngine::recordPattern() const {
+    // recording follows the page that was playing when the step was
+    // triggered, the second page lives in the partner pattern
+    return _currentStepPage ? std::min(pattern() + 1, CONFIG_PATTERN_COUNT - 1) : pattern();
+}
+
 void NoteTrackEngine::triggerStep(uint32_t tick, uint32_t divisor) {
     int octave = _noteTrack.octave();
     int transpose = _noteTrack.transpose();
@@ -267,38 +345,51 @@ void NoteTrackEngine::triggerStep(uint32_t tick, uint32_t divisor) {
     bool useFillCondition = fillStep && _noteTrack.fillMode() == NoteTrack::FillMode::Condition;
 
     const auto &sequence = *_sequence;
-    const auto &evalSequence = useFillSequence ? *_fillSequence : *_sequence;
-    _currentStep = SequenceUtils::rotateStep(_sequenceState.step(), sequence.firstStep(), sequence.lastStep(), rotate);
-    const auto &step = evalSequence.step(_currentStep);
+    // in extended mode odd iterations play the partner pattern's steps using
+    // this sequence's divisor, run mode and step range (the second page of a
+    // 128 step sequence), page selection is a single parity test
+    bool extendedPage = _noteTrack.extendedSteps() && (_sequenceState.iteration() & 1) != 0;
+    const auto &evalSequence = (useFillSequence || extendedPage) ? *_fillSequence : *_sequence;
+    int stepIndex = SequenceUtils::rotateStep(_sequenceState.step(), sequence.firstStep(), sequence.lastStep(), rotate);
+    _currentStep = extendedPage ? stepIndex + CONFIG_STEP_COUNT : stepIndex;
+    _currentStepPage = extendedPage;
+    const auto &step = evalSequence.step(stepIndex);
 
     uint32_t gateOffset = (divisor * step.gateOffset()) / (NoteSequence::GateOffset::Max + 1);
 
     bool stepGate = evalStepGate(step, _noteTrack.gateProbabilityBias()) || useFillGates;
     if (stepGate) {
-        stepGate = evalStepCondition(step, _sequenceState.iteration(), useFillCondition, _prevCondition);
+        if (_sequenceState.iteration() != _conditionTableIteration) {
+            _conditionTable = buildConditionTable(_sequenceState.iteration());
+            _conditionTableIteration = _sequenceState.iteration();
+        }
+        stepGate = evalStepCondition(step, _conditionTable, useFillCondition, _prevCondition);
     }
 
     if (stepGate) {
         uint32_t stepLength = (divisor * evalStepLength(step, _noteTrack.lengthBias())) / NoteSequence::Length::Range;
         int stepRetrigger = evalStepRetrigger(step, _noteTrack.retriggerProbabilityBias());
         if (stepRetrigger > 1) {
-            uint32_t retriggerLength = divisor / stepRetrigger;
+            if (divisor != _retriggerDivisor) {
+                updateRetriggerLengths(divisor);
+            }
+            uint32_t retriggerLength = _retriggerLengths[stepRetrigger];
             uint32_t retriggerOffset = 0;
             while (stepRetrigger-- > 0 && retriggerOffset <= stepLength) {
-                _gateQueue.pushReplace({ Groove::applySwing(tick + gateOffset + retriggerOffset, swing()), true });
-                _gateQueue.pushReplace({ Groove::applySwing(tick + gateOffset + retriggerOffset + retriggerLength / 2, swing()), false });
+                _gateQueue.pushReplace({ _engine.swingTable().apply(tick + gateOffset + retriggerOffset), true });
+                _gateQueue.pushReplace({ _engine.swingTable().apply(tick + gateOffset + retriggerOffset + retriggerLength / 2), false });
                 retriggerOffset += retriggerLength;
             }
         } else {
-            _gateQueue.pushReplace({ Groove::applySwing(tick + gateOffset, swing()), true });
-            _gateQueue.pushReplace({ Groove::applySwing(tick + gateOffset + stepLength, swing()), false });
+            _gateQueue.pushReplace({ _engine.swingTable().apply(tick + gateOffset), true });
+            _gateQueue.pushReplace({ _engine.swingTable().apply(tick + gateOffset + stepLength), false });
         }
     }
 
     if (stepGate || _noteTrack.cvUpdateMode() == NoteTrack::CvUpdateMode::Always) {
         const auto &scale = evalSequence.selectedScale(_model.project().scale());
         int rootNote = evalSequence.selectedRootNote(_model.project().rootNote());
-        _cvQueue.push({ Groove::applySwing(tick + gateOffset, swing()), evalStepNote(step, _noteTrack.noteProbabilityBias(), scale, rootNote, octave, transpose), step.slide() });
+        _cvQueue.push({ _engine.swingTable().apply(tick + gateOffset), evalStepNote(step, _noteTrack.noteProbabilityBias(), scale, rootNote, octave, transpose), step.slide() });
     }
 }
 
@@ -310,26 +401,23 @@ void NoteTrackEngine::recordStep(uint32_t tick, uint32_t divisor) {
     bool stepWritten = false;
 
     auto writeStep = [this, divisor, &stepWritten] (int stepIndex, int note, int lengthTicks) {
-        auto &step = _sequence->step(stepIndex);
-        int length = (lengthTicks * NoteSequence::Length::Range) / divisor;
-
-        step.setGate(true);
-        step.setGateProbability(NoteSequence::GateProbability::Max);
-        step.setRetrigger(0);
-        step.setRetriggerProbability(NoteSequence::RetriggerProbability::Max);
-        step.setLength(length);
-        step.setLengthVariationRange(0);
-        step.setLengthVariationProbability(NoteSequence::LengthVariationProbability::Max);
-        step.setNote(noteFromMidiNote(note));
-        step.setNoteVariationRange(0);
-        step.setNoteVariationProbability(NoteSequence::NoteVariationProbability::Max);
-        step.setCondition(Types::Condition::Off);
+        // write through the track so an armed snapshot backs up the pattern
+        auto &step = _noteTrack.sequence(recordPattern()).step(stepIndex);
+
+        // start from the pre-armed prototype, slide and gate offset are
+        // performance data and survive the recording as before
+        auto newStep = recordStepPrototype;
+        newStep.setSlide(step.slide());
+        newStep.setGateOffset(step.gateOffset());
+        newStep.setLength((lengthTicks * NoteSequence::Length::Range) / divisor);
+        newStep.setNote(noteFromMidiNote(note));
+        step = newStep;
 
         stepWritten = true;
     };
 
     auto clearStep = [this] (int stepIndex) {
-        auto &step = _sequence->step(stepIndex);
+        auto &step = _noteTrack.sequence(recordPattern()).step(stepIndex);
 
         step.clear();
     };
@@ -370,6 +458,15 @@ void NoteTrackEngine::recordStep(uint32_t tick, uint32_t divisor) {
     }
 }
 
+// the divisor only changes with the sequence config, so the subdivision
+// lengths for all retrigger counts are computed once and reused until then
+void NoteTrackEngine::updateRetriggerLengths(uint32_t divisor) {
+    for (size_t count = 1; count < sizeof(_retriggerLengths) / sizeof(_retriggerLengths[0]); ++count) {
+        _retriggerLengths[count] = divisor / count;
+    }
+    _retriggerDivisor = divisor;
+}
+
 int NoteTrackEngine::noteFromMidiNote(uint8_t midiNote) const {
     const auto &scale = _sequence->selectedScale(_model.project().scale());
     int rootNote = _sequence->selectedRootNote(_model.project().rootNote());
@@ -2,11 +2,12 @@
 
 #include "TrackEngine.h"
 #include "SequenceState.h"
-#include "SortedQueue.h"
+#include "HeapQueue.h"
 #include "Groove.h"
 #include "RecordHistory.h"
+#include "SlewLimiter.h"
 
-class NoteTrackEngine : public TrackEngine {
+class NoteTrackEngine final : public TrackEngine {
 public:
     NoteTrackEngine(Engine &engine, const Model &model, Track &track, const TrackEngine *linkedTrackEngine) :
         TrackEngine(engine, model, track, linkedTrackEngine),
@@ -23,6 +24,7 @@ public:
     virtual void update(float dt) override;
 
     virtual void changePattern() override;
+    virtual void prepareNextPattern(int pattern) override;
 
     virtual void monitorMidi(uint32_t tick, const MidiMessage &message) override;
 
@@ -32,7 +34,21 @@ public:
     virtual bool gateOutput(int index) const override { return _gateOutput; }
     virtual float cvOutput(int index) const override { return _cvOutput; }
     virtual float sequenceProgress() const override {
-        return _currentStep < 0 ? 0.f : float(_currentStep - _sequence->firstStep()) / (_sequence->lastStep() - _sequence->firstStep());
+        if (_currentStep < 0) {
+            return 0.f;
+        }
+        // _currentStep indexes the second page at CONFIG_STEP_COUNT and above
+        // when the track plays extended (128 step) sequences
+        int firstStep = _sequence->firstStep();
+        int span = _sequence->lastStep() - firstStep;
+        int position = _currentStep - firstStep;
+        if (_noteTrack.extendedSteps()) {
+            if (_currentStep >= CONFIG_STEP_COUNT) {
+                position = span + 1 + (_currentStep - CONFIG_STEP_COUNT - firstStep);
+            }
+            span = 2 * span + 1;
+        }
+        return span > 0 ? float(position) / span : 0.f;
     }
 
     const NoteSequence &sequence() const { return *_sequence; }
@@ -46,19 +62,33 @@ public:
 private:
     void triggerStep(uint32_t tick, uint32_t divisor);
     void recordStep(uint32_t tick, uint32_t divisor);
+    int recordPattern() const;
+    void updateRetriggerLengths(uint32_t divisor);
     int noteFromMidiNote(uint8_t midiNote) const;
 
     NoteTrack &_noteTrack;
 
     TrackLinkData _linkData;
 
-    NoteSequence *_sequence;
+    const NoteSequence *_sequence;
     const NoteSequence *_fillSequence;
 
     uint32_t _freeRelativeTick;
     SequenceState _sequenceState;
     int _currentStep;
+    // page of the last triggered step in extended mode, recording follows
+    // the page that was playing when the recorded step was triggered
+    bool _currentStepPage;
     bool _prevCondition;
+    // deterministic condition results for the current loop iteration, one
+    // bit per condition value
+    uint64_t _conditionTable = 0;
+    uint32_t _conditionTableIteration = uint32_t(-1);
+
+    // retrigger subdivision lengths for the current divisor, indexed by
+    // retrigger count, so ratcheted steps do not divide on the trigger path
+    uint32_t _retriggerDivisor = 0;
+    uint32_t _retriggerLengths[NoteSequence::Retrigger::Max + 2];
 
     int _monitorStepIndex = -1;
 
@@ -70,6 +100,7 @@ private:
     bool _gateOutput;
     float _cvOutput;
     float _cvOutputTarget;
+    SlewLimiter _cvOutputSlew;
     bool _slideActive;
 
     struct Gate {
@@ -83,7 +114,8 @@ private:
         }
     };
 
-    SortedQueue<Gate, 16, GateCompare> _gateQueue;
+    HeapQueue<Gate, 16, GateCompare> _gateQueue;
+    uint32_t _scheduledGateTick;
 
     struct Cv {
         uint32_t tick;
@@ -97,5 +129,5 @@ private:
         }
     };
 
-    SortedQueue<Cv, 16, CvCompare> _cvQueue;
+    HeapQueue<Cv, 16, CvCompare> _cvQueue;
 };
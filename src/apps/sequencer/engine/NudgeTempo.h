@@ -1,9 +1,12 @@
 #pragma once
 
-#include "core/math/Math.h"
+#include "core/math/Fixed.h"
 
 #include <cstdint>
 
+// Ramps a tempo nudge strength towards full scale while a direction is
+// held. The ramp accumulates in fixed point, so the tiny per-update
+// increments are not absorbed by float rounding at high update rates.
 class NudgeTempo {
 public:
     NudgeTempo() {
@@ -14,18 +17,24 @@ public:
     }
 
     float strength() const {
-        return _strength;
+        return _strength.toFloat();
     }
 
-    void update(float dt) {
+    void update(uint32_t dtMs) {
         if (_direction == 0) {
-            _strength = 0.f;
+            _strength = Fixed16_16();
         } else {
-            _strength = clamp(_strength + _direction * dt, -1.f, 1.f);
+            _strength = Fixed16_16::clamp(
+                _strength + Fixed16_16::fromRatio(int32_t(_direction) * int32_t(dtMs), RampTimeMs),
+                Fixed16_16::fromInt(-1), Fixed16_16::fromInt(1)
+            );
         }
     }
 
 private:
+    // time to ramp from zero to full strength
+    static const int32_t RampTimeMs = 1000;
+
     int8_t _direction = 0;
-    float _strength = 0.f;
+    Fixed16_16 _strength;
 };
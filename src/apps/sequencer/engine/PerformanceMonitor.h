@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Config.h"
+
+#include <algorithm>
+#include <array>
+
+#include <cstdint>
+
+// Collects timing of the engine hot path using HighResolutionTimer samples:
+// per-track min/avg/max of TrackEngine::tick()/update() and a histogram of
+// the total per-tick processing latency. Displayed on the monitor page to
+// tell which track type is responsible when the engine task starves the UI.
+class PerformanceMonitor {
+public:
+    struct Timing {
+        uint32_t minUs() const { return _count > 0 ? _minUs : 0; }
+        uint32_t maxUs() const { return _maxUs; }
+        uint32_t avgUs() const { return _count > 0 ? uint32_t(_totalUs / _count) : 0; }
+
+        void addSample(uint32_t us) {
+            _minUs = std::min(_minUs, us);
+            _maxUs = std::max(_maxUs, us);
+            _totalUs += us;
+            ++_count;
+        }
+
+        void reset() {
+            _minUs = uint32_t(-1);
+            _maxUs = 0;
+            _totalUs = 0;
+            _count = 0;
+        }
+
+    private:
+        uint32_t _minUs = uint32_t(-1);
+        uint32_t _maxUs = 0;
+        uint64_t _totalUs = 0;
+        uint32_t _count = 0;
+    };
+
+    // tick latency histogram with power-of-two us bins (1us, 2us, 4us, ...)
+    static constexpr int HistogramBins = 16;
+
+    const Timing &trackTickTiming(int trackIndex) const { return _trackTickTimings[trackIndex]; }
+    const Timing &trackUpdateTiming(int trackIndex) const { return _trackUpdateTimings[trackIndex]; }
+
+    const std::array<uint32_t, HistogramBins> &tickLatencyHistogram() const { return _tickLatencyHistogram; }
+
+    void addTrackTickSample(int trackIndex, uint32_t us) {
+        _trackTickTimings[trackIndex].addSample(us);
+    }
+
+    void addTrackUpdateSample(int trackIndex, uint32_t us) {
+        _trackUpdateTimings[trackIndex].addSample(us);
+    }
+
+    void addTickLatencySample(uint32_t us) {
+        int bin = 0;
+        while (us > 1 && bin < HistogramBins - 1) {
+            us >>= 1;
+            ++bin;
+        }
+        ++_tickLatencyHistogram[bin];
+    }
+
+    void reset() {
+        for (auto &timing : _trackTickTimings) {
+            timing.reset();
+        }
+        for (auto &timing : _trackUpdateTimings) {
+            timing.reset();
+        }
+        _tickLatencyHistogram.fill(0);
+    }
+
+private:
+    std::array<Timing, CONFIG_TRACK_COUNT> _trackTickTimings;
+    std::array<Timing, CONFIG_TRACK_COUNT> _trackUpdateTimings;
+    std::array<uint32_t, HistogramBins> _tickLatencyHistogram = {};
+};
@@ -1,6 +1,5 @@
 #pragma once
 
-#include "core/utils/RingBuffer.h"
 #include "core/midi/MidiMessage.h"
 
 #include <array>
@@ -22,6 +21,9 @@ public:
         int8_t note;
     };
 
+    // history depth, enough to rebuild several steps of a live take
+    static constexpr size_t Depth = 32;
+
     RecordHistory() {
         clear();
     }
@@ -30,6 +32,8 @@ public:
         _activeNote = -1;
         _size = 0;
         _write = 0;
+        _oldestTick = 0;
+        _lastTick = 0;
     }
 
     size_t size() const { return _size; }
@@ -64,8 +68,16 @@ public:
         }
     }
 
-    const Event &operator[](int index) const {
-        return _events[(_write + index - _size + _events.size()) % _events.size()];
+    Event operator[](int index) const {
+        // absolute ticks are reconstructed by summing deltas from the oldest
+        // event, consumers iterate in order so the cost stays negligible
+        size_t oldest = (_write + Depth - _size) % Depth;
+        uint32_t tick = _oldestTick;
+        for (int i = 1; i <= index; ++i) {
+            tick += _events[(oldest + i) % Depth].deltaTick;
+        }
+        const auto &packed = _events[(oldest + index) % Depth];
+        return { tick, Type(packed.type), packed.note };
     }
 
     bool isNoteActive() const {
@@ -77,14 +89,42 @@ public:
     }
 
 private:
+    // events are stored with 16 bit tick deltas (4 bytes per event instead
+    // of 8), so the deeper history costs half the RAM a flat encoding would
+    struct PackedEvent {
+        uint16_t deltaTick;
+        int8_t note;
+        uint8_t type;
+    };
+
     void write(const Event &event) {
-        _events[_write] = event;
-        _write = (_write + 1) % _events.size();
+        uint32_t delta = event.tick - _lastTick;
+
+        if (_size > 0 && (event.tick < _lastTick || delta > 0xffff)) {
+            // gap not representable, events this old are useless for recording
+            int8_t activeNote = _activeNote;
+            clear();
+            _activeNote = activeNote;
+        }
+
+        if (_size == 0) {
+            _oldestTick = event.tick;
+            delta = 0;
+        } else if (_size == Depth) {
+            // evict the oldest event, when full it sits at the write position
+            _oldestTick += _events[(_write + 1) % Depth].deltaTick;
+        }
+
+        _events[_write] = PackedEvent{ uint16_t(delta), event.note, uint8_t(event.type) };
+        _write = (_write + 1) % Depth;
         _size = std::min(_events.size(), _size + 1);
+        _lastTick = event.tick;
     }
 
     int8_t _activeNote;
     size_t _size;
     size_t _write;
-    std::array<Event, 4> _events;
+    uint32_t _oldestTick;
+    uint32_t _lastTick;
+    std::array<PackedEvent, Depth> _events;
 };
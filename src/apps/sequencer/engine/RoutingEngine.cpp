@@ -3,6 +3,8 @@
 #include "Engine.h"
 #include "MidiUtils.h"
 
+#include <cmath>
+
 // for allowing direct mapping
 static_assert(int(MidiPort::Midi) == int(Types::MidiPort::Midi), "invalid mapping");
 static_assert(int(MidiPort::UsbMidi) == int(Types::MidiPort::UsbMidi), "invalid mapping");
@@ -10,9 +12,16 @@ static_assert(int(MidiPort::UsbMidi) == int(Types::MidiPort::UsbMidi), "invalid
 RoutingEngine::RoutingEngine(Engine &engine, Model &model) :
     _engine(engine),
     _routing(model.project().routing())
-{}
+{
+    // smoothing setting n maps to a time constant of n * 10 ms
+    _smoothingCoefficients[0] = 65536;
+    for (size_t i = 1; i < _smoothingCoefficients.size(); ++i) {
+        _smoothingCoefficients[i] = int32_t(65536.f * (1.f - std::exp(-1.f / (i * 10.f))));
+    }
+}
 
 void RoutingEngine::update() {
+    updateMidiSourceIndex();
     updateSources();
     updateSinks();
 }
@@ -20,18 +29,17 @@ void RoutingEngine::update() {
 bool RoutingEngine::receiveMidi(MidiPort port, const MidiMessage &message) {
     bool consumed = false;
 
-    for (int routeIndex = 0; routeIndex < CONFIG_ROUTE_COUNT; ++routeIndex) {
-        const auto &route = _routing.route(routeIndex);
-        if (route.active() &&
-            route.source() == Routing::Source::Midi &&
-            MidiUtils::matchSource(port, message, route.midiSource().source())
-        ) {
-            const auto &midiSource = route.midiSource();
+    for (int entryIndex = 0; entryIndex < _midiSourceCount; ++entryIndex) {
+        const auto &entry = _midiSourceIndex[entryIndex];
+        if (MidiUtils::matchSource(port, message, entry.source.source())) {
+            const auto &midiSource = entry.source;
+            int routeIndex = entry.routeIndex;
             auto &sourceValue = _sourceValues[routeIndex];
+            int32_t previousValue = sourceValue;
             switch (midiSource.event()) {
             case Routing::MidiSource::Event::ControlAbsolute:
                 if (message.controlNumber() == midiSource.controlNumber()) {
-                    sourceValue = message.controlValue() * (1.f / 127.f);
+                    sourceValue = (message.controlValue() * 65536) / 127;
                     consumed = true;
                 }
                 break;
@@ -39,68 +47,98 @@ bool RoutingEngine::receiveMidi(MidiPort port, const MidiMessage &message) {
                 if (message.controlNumber() == midiSource.controlNumber()) {
                     int value = message.controlValue();
                     value = value >= 64 ? 64 - value : value;
-                    sourceValue = clamp(sourceValue + value * (1.f / 127.f), 0.f, 1.f);
+                    sourceValue = clamp(sourceValue + (value * 65536) / 127, int32_t(0), int32_t(65536));
                     consumed = true;
                 }
                 break;
             case Routing::MidiSource::Event::PitchBend:
                 if (message.isPitchBend()) {
-                    sourceValue = (message.pitchBend() + 0x2000) * (1.f / 16383.f);
+                    sourceValue = ((message.pitchBend() + 0x2000) * 65536) / 16383;
                     consumed = true;
                 }
                 break;
             case Routing::MidiSource::Event::NoteMomentary:
                 if (message.isNoteOn() && message.note() == midiSource.note()) {
-                    sourceValue = 1.f;
+                    sourceValue = 65536;
                     consumed = true;
                 } else if (message.isNoteOff() && message.note() == midiSource.note()) {
-                    sourceValue = 0.f;
+                    sourceValue = 0;
                     consumed = true;
                 }
                 break;
             case Routing::MidiSource::Event::NoteToggle:
                 if (message.isNoteOn() && message.note() == midiSource.note()) {
-                    sourceValue = sourceValue < 0.5f ? 1.f : 0.f;
+                    sourceValue = sourceValue < 32768 ? 65536 : 0;
                     consumed = true;
                 }
                 break;
             case Routing::MidiSource::Event::NoteVelocity:
                 if (message.isNoteOn() && message.note() == midiSource.note()) {
-                    sourceValue = message.velocity() * (1.f / 127.f);
+                    sourceValue = (message.velocity() * 65536) / 127;
                     consumed = true;
                 }
                 break;
             case Routing::MidiSource::Event::NoteRange:
                 if (message.isNoteOn() && message.note() >= midiSource.note() && message.note() < midiSource.note() + midiSource.noteRange()) {
-                    sourceValue = (message.note() - midiSource.note()) / float(midiSource.noteRange() - 1);
+                    sourceValue = ((message.note() - midiSource.note()) * 65536) / (midiSource.noteRange() - 1);
                     consumed = true;
                 }
                 break;
             case Routing::MidiSource::Event::Last:
                 break;
             }
+            if (sourceValue != previousValue) {
+                _dirtySources |= (1u << routeIndex);
+            }
         }
     }
 
     return consumed;
 }
 
+void RoutingEngine::updateMidiSourceIndex() {
+    uint8_t count = 0;
+
+    for (int routeIndex = 0; routeIndex < CONFIG_ROUTE_COUNT; ++routeIndex) {
+        const auto &route = _routing.route(routeIndex);
+        if (route.active() && route.source() == Routing::Source::Midi) {
+            auto &entry = _midiSourceIndex[count++];
+            entry.routeIndex = uint8_t(routeIndex);
+            entry.source = route.midiSource();
+        }
+    }
+
+    _midiSourceCount = count;
+}
+
 void RoutingEngine::updateSources() {
     for (int routeIndex = 0; routeIndex < CONFIG_ROUTE_COUNT; ++routeIndex) {
         const auto &route = _routing.route(routeIndex);
         if (route.active()) {
             auto &sourceValue = _sourceValues[routeIndex];
+
+            // mark source dirty when the value has moved more than the ADC
+            // noise floor, so unchanged routes are skipped in updateSinks()
+            auto updateSourceValue = [this, &sourceValue, routeIndex] (int32_t value) {
+                if (std::abs(value - sourceValue) > CvSourceDeltaThreshold) {
+                    sourceValue = value;
+                    _dirtySources |= (1u << routeIndex);
+                }
+            };
+
             switch (route.source()) {
             case Routing::Source::None:
-                sourceValue = 0.f;
+                updateSourceValue(0);
                 break;
             case Routing::Source::CvIn1:
             case Routing::Source::CvIn2:
             case Routing::Source::CvIn3:
             case Routing::Source::CvIn4: {
+                // calibrated CV inputs stay in fixed point all the way into
+                // the source value
                 const auto &range = Types::voltageRangeInfo(route.cvSource().range());
                 int index = int(route.source()) - int(Routing::Source::CvIn1);
-                sourceValue = range.normalize(_engine.cvInput().channel(index));
+                updateSourceValue(range.normalizeFixed(_engine.cvInput().channelFixed(index)));
                 break;
             }
             case Routing::Source::CvOut1:
@@ -113,7 +151,7 @@ void RoutingEngine::updateSources() {
             case Routing::Source::CvOut8: {
                 const auto &range = Types::voltageRangeInfo(route.cvSource().range());
                 int index = int(route.source()) - int(Routing::Source::CvOut1);
-                sourceValue = range.normalize(_engine.cvOutput().channel(index));
+                updateSourceValue(int32_t(range.normalize(_engine.cvOutput().channel(index)) * 65536.f));
                 break;
             }
             case Routing::Source::Midi:
@@ -127,11 +165,21 @@ void RoutingEngine::updateSources() {
 }
 
 void RoutingEngine::updateSinks() {
+    uint32_t dirtySources = _dirtySources;
+    _dirtySources = 0;
+
     for (int routeIndex = 0; routeIndex < CONFIG_ROUTE_COUNT; ++routeIndex) {
         const auto &route = _routing.route(routeIndex);
         auto &routeState = _routeStates[routeIndex];
 
         bool routeChanged = route.target() != routeState.target || route.tracks() != routeState.tracks;
+        bool valueChanged = (dirtySources & (1u << routeIndex)) ||
+            route.min() != routeState.min || route.max() != routeState.max;
+
+        if (!routeChanged && !valueChanged && !routeState.settling) {
+            // source and route unchanged -> target still holds the written value
+            continue;
+        }
 
         if (routeChanged) {
             // disable previous routing
@@ -140,7 +188,25 @@ void RoutingEngine::updateSinks() {
 
         if (route.active()) {
             auto target = route.target();
-            float value = route.min() + _sourceValues[routeIndex] * (route.max() - route.min());
+            float value = route.min() + _sourceValues[routeIndex] * (1.f / 65536.f) * (route.max() - route.min());
+            int smoothing = route.smoothing();
+            if (smoothing > 0 && !routeChanged) {
+                // settle towards the raw value with the precomputed one-pole
+                // coefficient, the route keeps being re-evaluated until the
+                // smoothed value has converged
+                float rawValue = value;
+                value = routeState.smoother.update(rawValue, _smoothingCoefficients[smoothing]);
+                float span = route.max() - route.min();
+                routeState.settling = std::abs(rawValue - value) > span * (1.f / 4096.f);
+                if (!routeState.settling) {
+                    routeState.smoother.set(rawValue);
+                    value = rawValue;
+                }
+            } else {
+                // snap on route changes and when smoothing is off
+                routeState.smoother.set(value);
+                routeState.settling = false;
+            }
             if (Routing::isEngineTarget(target)) {
                 writeEngineTarget(target, value);
             } else {
@@ -155,6 +221,9 @@ void RoutingEngine::updateSinks() {
             routeState.target = route.target();
             routeState.tracks = route.tracks();
         }
+
+        routeState.min = route.min();
+        routeState.max = route.max();
     }
 }
 
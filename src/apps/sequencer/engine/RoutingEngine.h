@@ -3,6 +3,7 @@
 #include "Config.h"
 
 #include "MidiPort.h"
+#include "SlewLimiter.h"
 
 #include "model/Model.h"
 
@@ -20,23 +21,60 @@ public:
 
     void update();
 
+    // force re-evaluation of all routes on the next update
+    void forceUpdate() { _dirtySources = ~uint32_t(0); }
+
     bool receiveMidi(MidiPort port, const MidiMessage &message);
 
 private:
+    void updateMidiSourceIndex();
     void updateSources();
     void updateSinks();
 
     void writeEngineTarget(Routing::Target target, float normalized);
 
+    // minimum normalized CV source movement to re-evaluate a route,
+    // roughly the ADC noise floor (1/8192 in Q16.16)
+    static constexpr int32_t CvSourceDeltaThreshold = 8;
+
     Engine &_engine;
     Routing &_routing;
 
-    std::array<float, CONFIG_ROUTE_COUNT> _sourceValues;
+    // normalized source values in Q16.16 fixed point, so the per-update
+    // source scan stays integer end-to-end for the calibrated CV inputs,
+    // conversion to float happens at the sink boundary for dirty routes only
+    std::array<int32_t, CONFIG_ROUTE_COUNT> _sourceValues;
+
+    // compact index of the active midi routes, rebuilt in update(), so
+    // receiveMidi() only scans the midi route candidates instead of
+    // checking every route per message
+    struct MidiSourceEntry {
+        uint8_t routeIndex;
+        Routing::MidiSource source;
+    };
+
+    std::array<MidiSourceEntry, CONFIG_ROUTE_COUNT> _midiSourceIndex;
+    uint8_t _midiSourceCount = 0;
+
+    // per-source dirty flags, set when a source value has changed, so
+    // unchanged routes are skipped in updateSinks()
+    uint32_t _dirtySources = ~uint32_t(0);
 
     struct RouteState {
         Routing::Target target = Routing::Target::None;
         uint8_t tracks = 0;
+        float min = 0.f;
+        float max = 0.f;
+        // one-pole smoother towards the raw routed value, the route keeps
+        // being re-evaluated while settling towards it
+        SlewLimiter smoother;
+        bool settling = false;
     };
 
     std::array<RouteState, CONFIG_ROUTE_COUNT> _routeStates;
+
+    // Q16.16 one-pole coefficients indexed by the route smoothing setting,
+    // precomputed for the 1 ms routing update period, so the per-update
+    // smoothing path is a single fixed-point multiply
+    std::array<int32_t, 101> _smoothingCoefficients;
 };
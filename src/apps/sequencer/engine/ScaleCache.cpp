@@ -0,0 +1,50 @@
+#include "ScaleCache.h"
+
+#include <algorithm>
+
+std::array<ScaleCache::CachedTable, 8> ScaleCache::_cachedTables;
+uint32_t ScaleCache::_ticket = 0;
+
+float ScaleCache::noteToVolts(const Scale &scale, int note) {
+    if (note < -NoteOffset || note >= NoteRange - NoteOffset) {
+        return scale.noteToVolts(note);
+    }
+
+    for (auto &cachedTable : _cachedTables) {
+        if (cachedTable.ticket != 0 && cachedTable.scale == &scale) {
+            cachedTable.ticket = nextTicket();
+            return cachedTable.volts[note + NoteOffset];
+        }
+    }
+
+    return buildTable(scale).volts[note + NoteOffset];
+}
+
+void ScaleCache::invalidate(const Scale &scale) {
+    for (auto &cachedTable : _cachedTables) {
+        if (cachedTable.ticket != 0 && cachedTable.scale == &scale) {
+            cachedTable.ticket = 0;
+        }
+    }
+}
+
+void ScaleCache::invalidateAll() {
+    for (auto &cachedTable : _cachedTables) {
+        cachedTable.ticket = 0;
+    }
+}
+
+ScaleCache::CachedTable &ScaleCache::buildTable(const Scale &scale) {
+    auto cachedTable = std::min_element(_cachedTables.begin(), _cachedTables.end());
+    cachedTable->scale = &scale;
+    for (int note = 0; note < NoteRange; ++note) {
+        cachedTable->volts[note] = scale.noteToVolts(note - NoteOffset);
+    }
+    cachedTable->ticket = nextTicket();
+    return *cachedTable;
+}
+
+uint32_t ScaleCache::nextTicket() {
+    _ticket = std::max(uint32_t(1), _ticket + 1);
+    return _ticket;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "model/Scale.h"
+
+#include <array>
+
+#include <cstdint>
+
+// Cache of note -> volts lookup tables for the scales in active use.
+// Converting a step note to a CV value through Scale::noteToVolts involves a
+// virtual call and a division, which adds up as it sits in the note output
+// hot path of every track. The cache keeps a small set of tables keyed by
+// scale, evicting the least recently used one, so the conversion becomes a
+// single table lookup. Tables are independent of the root note, which is
+// applied to the note index before the conversion.
+class ScaleCache {
+public:
+    // note range covered by a table, centered around note 0
+    static constexpr int NoteRange = 128;
+    static constexpr int NoteOffset = NoteRange / 2;
+
+    static float noteToVolts(const Scale &scale, int note);
+
+    static void invalidate(const Scale &scale);
+    static void invalidateAll();
+
+private:
+    struct CachedTable {
+        uint32_t ticket = 0;
+        const Scale *scale;
+        std::array<float, NoteRange> volts;
+
+        bool operator<(const CachedTable &other) const {
+            return ticket < other.ticket;
+        }
+    };
+
+    static CachedTable &buildTable(const Scale &scale);
+    static uint32_t nextTicket();
+
+    static std::array<CachedTable, 8> _cachedTables;
+    static uint32_t _ticket;
+};
@@ -3,10 +3,59 @@
 #include "core/Debug.h"
 #include "core/math/Math.h"
 
+#include <algorithm>
+
 static int randomStep(int firstStep, int lastStep, Random &rng) {
     return rng.nextRange(lastStep - firstStep + 1) + firstStep;
 }
 
+// single advance of the deterministic run modes, only used to fill the next
+// step table
+uint8_t SequenceState::computeAdvance(Types::RunMode runMode, int firstStep, int lastStep, int step, int direction) {
+    bool iterate = false;
+
+    switch (runMode) {
+    case Types::RunMode::Forward:
+        if (step >= lastStep) {
+            step = firstStep;
+            iterate = true;
+        } else {
+            ++step;
+        }
+        break;
+    case Types::RunMode::Backward:
+        if (step <= firstStep) {
+            step = lastStep;
+            iterate = true;
+        } else {
+            --step;
+        }
+        break;
+    case Types::RunMode::Pendulum:
+    case Types::RunMode::PingPong:
+        if (direction > 0 && step >= lastStep) {
+            direction = -1;
+        } else if (direction < 0 && step <= firstStep) {
+            direction = 1;
+            iterate = true;
+        } else {
+            if (runMode == Types::RunMode::Pendulum) {
+                step += direction;
+            }
+        }
+        if (runMode == Types::RunMode::PingPong) {
+            step += direction;
+        }
+        break;
+    default:
+        break;
+    }
+
+    return uint8_t(step) |
+        (direction < 0 ? DirectionFlag : 0) |
+        (iterate ? IterationFlag : 0);
+}
+
 void SequenceState::reset() {
     _step = -1;
     _prevStep = -1;
@@ -14,75 +63,93 @@ void SequenceState::reset() {
     _iteration = 0;
 }
 
-void SequenceState::advanceFree(Types::RunMode runMode, int firstStep, int lastStep, Random &rng) {
-     ASSERT(firstStep <= lastStep, "invalid first/last step");
+void SequenceState::rebuildNextStepTable(Types::RunMode runMode, int firstStep, int lastStep) {
+    _tableRunMode = runMode;
+    _tableFirstStep = firstStep;
+    _tableLastStep = lastStep;
 
-   _prevStep = _step;
+    for (int step = 0; step < CONFIG_STEP_COUNT; ++step) {
+        int clamped = clamp(step, firstStep, lastStep);
+        _nextStep[_activeTable][0][step] = computeAdvance(runMode, firstStep, lastStep, clamped, 1);
+        _nextStep[_activeTable][1][step] = computeAdvance(runMode, firstStep, lastStep, clamped, -1);
+    }
+}
 
-    if (_step == -1) {
-        // first step
-        switch (runMode) {
-        case Types::RunMode::Forward:
-        case Types::RunMode::Pendulum:
-        case Types::RunMode::PingPong:
-            _step = firstStep;
-            break;
-        case Types::RunMode::Backward:
-            _step = lastStep;
-            break;
-        case Types::RunMode::Random:
-        case Types::RunMode::RandomWalk:
-            _step = randomStep(firstStep, lastStep, rng);
-            break;
-        case Types::RunMode::Last:
-            break;
-        }
-    } else {
-        // advance step
-        _step = clamp(int(_step), firstStep, lastStep);
+void SequenceState::prepare(Types::RunMode runMode, int firstStep, int lastStep) {
+    if (firstStep > lastStep || !usesNextStepTable(runMode)) {
+        return;
+    }
 
-        switch (runMode) {
-        case Types::RunMode::Forward:
-            if (_step >= lastStep) {
-                _step = firstStep;
-                ++_iteration;
-            } else {
-                ++_step;
-            }
-            break;
-        case Types::RunMode::Backward:
-            if (_step <= firstStep) {
-                _step = lastStep;
-                ++_iteration;
-            } else {
-                --_step;
-            }
-            break;
-        case Types::RunMode::Pendulum:
-        case Types::RunMode::PingPong:
-            if (_direction > 0 && _step >= lastStep) {
-                _direction = -1;
-            } else if (_direction < 0 && _step <= firstStep) {
-                _direction = 1;
-                ++_iteration;
-            } else {
-                if (runMode == Types::RunMode::Pendulum) {
-                    _step += _direction;
+    // the active table already matches, nothing to prepare
+    if (runMode == _tableRunMode && firstStep == _tableFirstStep && lastStep == _tableLastStep) {
+        return;
+    }
+
+    // restart preparation when the target changes
+    if (runMode != _prepareRunMode || firstStep != _prepareFirstStep || lastStep != _prepareLastStep) {
+        _prepareRunMode = runMode;
+        _prepareFirstStep = firstStep;
+        _prepareLastStep = lastStep;
+        _prepareStep = 0;
+    }
+
+    if (_prepareStep >= CONFIG_STEP_COUNT) {
+        return;
+    }
+
+    // fill a small slice of the inactive table per call, spreading the
+    // rebuild over the ticks leading up to the switch
+    uint8_t table = _activeTable ^ 1;
+    int end = std::min(int(_prepareStep) + PrepareSliceSteps, CONFIG_STEP_COUNT);
+    for (int step = _prepareStep; step < end; ++step) {
+        int clamped = clamp(step, firstStep, lastStep);
+        _nextStep[table][0][step] = computeAdvance(runMode, firstStep, lastStep, clamped, 1);
+        _nextStep[table][1][step] = computeAdvance(runMode, firstStep, lastStep, clamped, -1);
+    }
+    _prepareStep = end;
+}
+
+void SequenceState::advanceFree(Types::RunMode runMode, int firstStep, int lastStep, Random &rng) {
+    ASSERT(firstStep <= lastStep, "invalid first/last step");
+
+    _prevStep = _step;
+
+    switch (runMode) {
+    case Types::RunMode::Random:
+        _step = randomStep(firstStep, lastStep, rng);
+        break;
+    case Types::RunMode::RandomWalk:
+        advanceRandomWalk(firstStep, lastStep, rng);
+        break;
+    default:
+        if (_step == -1) {
+            // first step
+            _step = runMode == Types::RunMode::Backward ? lastStep : firstStep;
+            _direction = 1;
+        } else {
+            // advance step through the memoized table
+            if (runMode != _tableRunMode || firstStep != _tableFirstStep || lastStep != _tableLastStep) {
+                if (runMode == _prepareRunMode && firstStep == _prepareFirstStep && lastStep == _prepareLastStep &&
+                    _prepareStep >= CONFIG_STEP_COUNT) {
+                    // a fully prepared table is waiting, just switch to it
+                    _activeTable ^= 1;
+                    _tableRunMode = runMode;
+                    _tableFirstStep = firstStep;
+                    _tableLastStep = lastStep;
+                    _prepareRunMode = Types::RunMode::Last;
+                    _prepareStep = 0;
+                } else {
+                    rebuildNextStepTable(runMode, firstStep, lastStep);
                 }
             }
-            if (runMode == Types::RunMode::PingPong) {
-                _step += _direction;
+            uint8_t entry = _nextStep[_activeTable][_direction < 0 ? 1 : 0][clamp(int(_step), 0, CONFIG_STEP_COUNT - 1)];
+            _step = entry & StepMask;
+            _direction = (entry & DirectionFlag) ? -1 : 1;
+            if (entry & IterationFlag) {
+                ++_iteration;
             }
-            break;
-        case Types::RunMode::Random:
-            _step = randomStep(firstStep, lastStep, rng);
-            break;
-        case Types::RunMode::RandomWalk:
-            advanceRandomWalk(firstStep, lastStep, rng);
-            break;
-        case Types::RunMode::Last:
-            break;
         }
+        break;
     }
 }
 
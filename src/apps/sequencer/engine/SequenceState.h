@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Config.h"
+
 #include "model/Types.h"
 
 #include "core/utils/Random.h"
@@ -15,14 +17,58 @@ public:
 
     void reset();
 
+    // copies the play position from another sequence state without touching
+    // the memoized next step tables, used by linked tracks each tick
+    void copyPosition(const SequenceState &other) {
+        _step = other._step;
+        _prevStep = other._prevStep;
+        _direction = other._direction;
+        _iteration = other._iteration;
+    }
+
     void advanceFree(Types::RunMode runMode, int firstStep, int lastStep, Random &rng);
     void advanceAligned(int absoluteStep, Types::RunMode runMode, int firstStep, int lastStep, Random &rng);
 
+    // incrementally builds the next step table for an upcoming run mode and
+    // step range (e.g. a pending synced pattern change) into the inactive
+    // buffer, a few steps per call, so the advance at the switch boundary
+    // finds the table already built and costs a single table load
+    void prepare(Types::RunMode runMode, int firstStep, int lastStep);
+
 private:
     void advanceRandomWalk(int firstStep, int lastStep, Random &rng);
+    void rebuildNextStepTable(Types::RunMode runMode, int firstStep, int lastStep);
+    static uint8_t computeAdvance(Types::RunMode runMode, int firstStep, int lastStep, int step, int direction);
+
+    static_assert(CONFIG_STEP_COUNT <= 64, "next step table entries hold 6 bit step indices");
+
+    static constexpr uint8_t StepMask = 0x3f;
+    static constexpr uint8_t DirectionFlag = 0x40;  // next direction is backward
+    static constexpr uint8_t IterationFlag = 0x80;  // advance wraps into a new iteration
 
     int8_t _step;
     int8_t _prevStep;
     int8_t _direction;
     uint32_t _iteration;
+
+    static constexpr int PrepareSliceSteps = 8;
+
+    bool usesNextStepTable(Types::RunMode runMode) const {
+        return runMode != Types::RunMode::Random && runMode != Types::RunMode::RandomWalk;
+    }
+
+    // memoized advance function for the deterministic run modes, indexed by
+    // [table][backward][step] and rebuilt when the run mode or step range
+    // changes, so the per-advance work is a single table load; the tables are
+    // double-buffered so a prepared table can be built up while the active
+    // one is still in use
+    Types::RunMode _tableRunMode = Types::RunMode::Last;
+    int8_t _tableFirstStep = -1;
+    int8_t _tableLastStep = -1;
+    uint8_t _activeTable = 0;
+    Types::RunMode _prepareRunMode = Types::RunMode::Last;
+    int8_t _prepareFirstStep = -1;
+    int8_t _prepareLastStep = -1;
+    uint8_t _prepareStep = 0;
+    uint8_t _nextStep[2][2][CONFIG_STEP_COUNT];
 };
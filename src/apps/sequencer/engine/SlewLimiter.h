@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+
+// Exponential slew limiter used for note slides and portamento. The value is
+// held in Q16.16 fixed-point so updating a channel costs one integer multiply
+// and add per update. The smoothing coefficient only depends on the update
+// interval and the slide time setting, so it can be computed once and shared
+// by all channels slewing at the same rate.
+class SlewLimiter {
+public:
+    // Q16.16 smoothing coefficient for a given update interval and slide
+    // time setting (0-100), clamped to at most 1
+    static int32_t coefficient(float dt, int slideTime) {
+        float k = dt * (200 - 2 * slideTime);
+        return int32_t((k < 1.f ? k : 1.f) * 65536.f);
+    }
+
+    void set(float value) {
+        _value = toFixed(value);
+    }
+
+    float value() const {
+        return _value * (1.f / 65536.f);
+    }
+
+    // move the current value towards target by the given coefficient
+    float update(float target, int32_t coefficient) {
+        _value += int32_t((int64_t(toFixed(target) - _value) * coefficient) >> 16);
+        return value();
+    }
+
+private:
+    static int32_t toFixed(float value) {
+        return int32_t(value * 65536.f);
+    }
+
+    int32_t _value = 0;
+};
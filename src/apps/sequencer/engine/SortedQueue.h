@@ -4,6 +4,8 @@
 #include <utility>
 #include <functional>
 
+#include <cstddef>
+
 template<typename T, size_t Capacity, typename Compare = std::less<T>>
 class SortedQueue {
 public:
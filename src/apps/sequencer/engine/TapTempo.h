@@ -1,7 +1,18 @@
 #pragma once
 
+#include "core/math/Fixed.h"
+
 #include "drivers/HighResolutionTimer.h"
 
+#include <algorithm>
+
+#include <cstdint>
+#include <cstddef>
+
+// Derives the tempo from a window of tap intervals. The window is filtered
+// with median-of-window outlier rejection, so a single mistimed tap does not
+// skew the tempo, and the interval to bpm conversion runs in fixed point on
+// the clock's Fixed32_32 type for microsecond interval resolution.
 class TapTempo {
 public:
     TapTempo() {
@@ -10,30 +21,79 @@ public:
 
     void reset() {
         _lastTime = 0;
-        _lastInterval = 0;
+        _index = 0;
+        _count = 0;
     }
 
     float tap(float bpm) {
         uint32_t currentTime = HighResolutionTimer::us();
         uint32_t interval = currentTime - _lastTime;
+        bool start = _lastTime == 0;
+        _lastTime = currentTime;
 
-        // reset averaging on first tap or if current interval is far off the last interval
-        if (_lastTime == 0 || (interval < _lastInterval / 2 || interval > _lastInterval * 2)) {
-            _intervalAverage.reset();
-            _intervalAverage.push(uint32_t(60000000 / bpm));
-        } else {
-            _intervalAverage.push(interval);
-            bpm = 60000000.f / _intervalAverage();
+        // ignore taps faster than the maximum tempo (switch bounce)
+        if (!start && interval < MinInterval) {
+            return bpm;
         }
 
-        _lastTime = currentTime;
-        _lastInterval = interval;
+        // a tap far off the current window (or slower than the minimum
+        // tempo) starts a new measurement
+        if (!start && _count > 0) {
+            uint32_t median = windowMedian();
+            start = interval < median / 2 || interval > median * 2;
+        }
+        if (!start && _count == 0) {
+            start = interval > MaxInterval;
+        }
+
+        if (start) {
+            _index = 0;
+            _count = 0;
+            return bpm;
+        }
 
-        return bpm;
+        push(interval);
+
+        // average the samples within 25% of the window median, outliers
+        // stay in the window but do not contribute to the tempo
+        uint32_t median = windowMedian();
+        uint64_t sum = 0;
+        uint32_t num = 0;
+        for (size_t i = 0; i < _count; ++i) {
+            uint32_t sample = _history[i];
+            uint32_t deviation = sample > median ? sample - median : median - sample;
+            if (deviation <= median / 4) {
+                sum += sample;
+                ++num;
+            }
+        }
+
+        // the median itself always passes the filter, so num >= 1
+        return Fixed32_32::fromRatio(60000000, int64_t(sum / num)).toFloat();
     }
 
 private:
+    // interval bounds matching the 1 to 1000 bpm tempo range
+    static const uint32_t MinInterval = 60000000 / 1000;
+    static const uint32_t MaxInterval = 60000000 / 1;
+
+    void push(uint32_t interval) {
+        _history[_index] = interval;
+        _index = (_index + 1) % History;
+        _count = _count < History ? _count + 1 : History;
+    }
+
+    uint32_t windowMedian() const {
+        uint32_t sorted[History];
+        std::copy(&_history[0], &_history[_count], &sorted[0]);
+        std::sort(&sorted[0], &sorted[_count]);
+        return sorted[_count / 2];
+    }
+
+    static const size_t History = 8;
+
     uint32_t _lastTime;
-    uint32_t _lastInterval;
-    MovingAverage<uint32_t, 8> _intervalAverage;
+    uint32_t _history[History];
+    size_t _index;
+    size_t _count;
 };
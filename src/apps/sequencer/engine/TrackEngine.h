@@ -32,15 +32,18 @@ public:
         _engine(engine),
         _model(model),
         _track(track),
-        _trackState(model.project().playState().trackState(track.trackIndex())),
-        _linkedTrackEngine(linkedTrackEngine)
+        _trackState(model.project().playState().trackState(track.trackIndex()))
     {
+        setLinkedTrackEngine(linkedTrackEngine);
         changePattern();
     }
 
     const TrackEngine *linkedTrackEngine() const { return _linkedTrackEngine; }
     void setLinkedTrackEngine(const TrackEngine *linkedTrackEngine) {
         _linkedTrackEngine = linkedTrackEngine;
+        // resolve the master's link data once, so ticking a linked track does
+        // not go through a virtual call each tick
+        _linkedTrackData = linkedTrackEngine ? linkedTrackEngine->linkData() : nullptr;
     }
 
     template<typename T>
@@ -64,9 +67,24 @@ public:
     virtual void tick(uint32_t tick) = 0;
     virtual void update(float dt) = 0;
 
+    // process a burst of pending ticks [first, last] in one call, used to
+    // bound catch-up cost after a scheduling hiccup
+    virtual void tickRange(uint32_t first, uint32_t last) {
+        for (uint32_t t = first; t <= last; ++t) {
+            tick(t);
+        }
+    }
+
     virtual void changePattern() {}
 
-    virtual bool receiveMidi(MidiPort port, const MidiMessage &message) { return false; }
+    // called each tick while a synced or latched pattern change is pending,
+    // allows the engine to prepare for the incoming pattern ahead of the
+    // switch boundary
+    virtual void prepareNextPattern(int pattern) {}
+
+    // timestampUs is the time the message was received in the driver, allowing
+    // sub-update-accurate handling of note events
+    virtual bool receiveMidi(MidiPort port, const MidiMessage &message, uint32_t timestampUs) { return false; }
     virtual void monitorMidi(uint32_t tick, const MidiMessage &message) {}
 
     virtual const TrackLinkData *linkData() const { return nullptr; }
@@ -96,6 +114,7 @@ protected:
     Track &_track;
     const PlayState::TrackState &_trackState;
     const TrackEngine *_linkedTrackEngine;
+    const TrackLinkData *_linkedTrackData;
 };
 
 #undef SANITIZE_TRACK_MODE
@@ -44,8 +44,14 @@ void RandomGenerator::update()  {
 
     int size = _pattern.size();
 
+    // batched prng fill: one 32-bit draw yields four 8-bit pattern values,
+    // so rebuilding a full sequence rolls the generator 16 times instead of
+    // once per step
+    static_assert(CONFIG_STEP_COUNT % 4 == 0, "pattern size must be a multiple of 4");
+    uint32_t words[CONFIG_STEP_COUNT / 4];
+    rng.nextN(words, size / 4);
     for (int i = 0; i < size; ++i) {
-        _pattern[i] = rng.nextRange(255);
+        _pattern[i] = (words[i / 4] >> ((i % 4) * 8)) & 0xff;
     }
 
     for (int iteration = 0; iteration < _smooth; ++iteration) {
@@ -64,7 +70,11 @@ void RandomGenerator::update()  {
         _pattern[i] = clamp(value, 0, 255);
     }
 
-    for (size_t i = 0; i < _pattern.size(); ++i) {
-        _builder.setValue(i, _pattern[i] * (1.f / 255.f));
+    // write the whole pattern through the bulk store, one virtual call
+    // instead of one per step
+    float values[CONFIG_STEP_COUNT];
+    for (int i = 0; i < size; ++i) {
+        values[i] = _pattern[i] * (1.f / 255.f);
     }
+    _builder.setValues(values, size);
 }
@@ -2,11 +2,45 @@
 
 namespace Rhythm {
 
-// based on https://bitbucket.org/sjcastroe/bjorklunds-algorithm
-Pattern euclidean(int beats, int steps) {
-    // make sure beats <= steps
-    beats = std::min(beats, steps);
+Pattern pattern(const StaticPattern &staticPattern) {
+    Pattern result(staticPattern.length);
+    for (int i = 0; i < staticPattern.length; ++i) {
+        if (staticPattern.mask & (uint64_t(1) << i)) {
+            result.set(i);
+        }
+    }
+    return result;
+}
 
+struct BuiltinPattern {
+    const char *name;
+    StaticPattern pattern;
+};
+
+static constexpr BuiltinPattern builtinPatterns[] = {
+    { "Tresillo",       parse("x--x--x-") },
+    { "Cinquillo",      parse("x-xx-xx-") },
+    { "Son Clave",      parse("x--x--x---x-x---") },
+    { "Rumba Clave",    parse("x--x---x--x-x---") },
+    { "Bossa Nova",     parse("x--x--x---x--x--") },
+    { "Shiko",          parse("x---x-x---x-x---") },
+    { "Gahu",           parse("x--x--x---x---x-") },
+};
+
+int builtinPatternCount() {
+    return sizeof(builtinPatterns) / sizeof(builtinPatterns[0]);
+}
+
+const char *builtinPatternName(int index) {
+    return builtinPatterns[index].name;
+}
+
+Pattern builtinPattern(int index) {
+    return pattern(builtinPatterns[index].pattern);
+}
+
+// based on https://bitbucket.org/sjcastroe/bjorklunds-algorithm
+static Pattern computeEuclidean(int beats, int steps) {
     Pattern x;
     x.set(0, true);
     int xCount = beats;
@@ -52,4 +86,31 @@ Pattern euclidean(int beats, int steps) {
     return pattern;
 }
 
+// memoization cache over the (beats, steps) space, direct-mapped. scrubbing
+// a generator parameter revisits the same combinations over and over, the
+// cache makes those lookups allocation-free and instant. rotation is cheap
+// and applied by the caller on the cached pattern.
+struct CacheEntry {
+    uint8_t beats = 0;
+    uint8_t steps = 0;
+    Pattern pattern;
+};
+
+static constexpr size_t CacheSize = 16;
+static CacheEntry cache[CacheSize];
+
+Pattern euclidean(int beats, int steps) {
+    // make sure beats <= steps
+    beats = std::min(beats, steps);
+
+    auto &entry = cache[(beats * 31 + steps) % CacheSize];
+    if (entry.beats != beats || entry.steps != steps) {
+        entry.beats = beats;
+        entry.steps = steps;
+        entry.pattern = computeEuclidean(beats, steps);
+    }
+
+    return entry.pattern;
+}
+
 } // namespace Rhythm
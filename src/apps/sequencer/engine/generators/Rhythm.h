@@ -4,10 +4,47 @@
 
 #include "RhythmString.h"
 
+#include <cstdint>
+
 namespace Rhythm {
 
     typedef RhythmString<CONFIG_STEP_COUNT> Pattern;
 
+    // Compile-time rhythm pattern parsing
+    //
+    // Textual patterns ('x' = pulse, any other character = rest) are parsed
+    // into a mask/length pair at compile time, so built-in rhythm tables are
+    // flash-resident constants with no boot or runtime parse cost and no RAM
+    // footprint. Patterns are limited to the 64 bits of the mask, which
+    // matches CONFIG_STEP_COUNT.
+
+    struct StaticPattern {
+        uint64_t mask;
+        uint8_t length;
+    };
+
+    namespace detail {
+        // C++11 constexpr, hence the recursive formulation
+        constexpr uint64_t parseMask(const char *str, int index) {
+            return *str == '\0' ? 0 : ((*str == 'x' || *str == 'X' ? uint64_t(1) << index : 0) | parseMask(str + 1, index + 1));
+        }
+        constexpr int parseLength(const char *str) {
+            return *str == '\0' ? 0 : 1 + parseLength(str + 1);
+        }
+    } // namespace detail
+
+    constexpr StaticPattern parse(const char *str) {
+        return { detail::parseMask(str, 0), uint8_t(detail::parseLength(str)) };
+    }
+
+    // expands a precomputed pattern into a rhythm string
+    Pattern pattern(const StaticPattern &staticPattern);
+
+    // built-in rhythm pattern library, parsed at compile time
+    int builtinPatternCount();
+    const char *builtinPatternName(int index);
+    Pattern builtinPattern(int index);
+
     Pattern euclidean(int beats, int steps);
 
 } // namespace Rhythm
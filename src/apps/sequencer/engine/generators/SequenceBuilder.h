@@ -3,6 +3,9 @@
 #include "model/NoteSequence.h"
 #include "model/CurveSequence.h"
 
+#include <array>
+#include <bitset>
+
 class SequenceBuilder {
 public:
     virtual void revert() = 0;
@@ -20,65 +23,119 @@ public:
     virtual float value(int index) const = 0;
     virtual void setValue(int index, float value) = 0;
 
+    // bulk variant of setValue, writes count values starting at the first step
+    virtual void setValues(const float *values, int count) = 0;
+
     virtual void clearSteps() = 0;
     virtual void copyStep(int fromIndex, int toIndex) = 0;
 };
 
+// Edits the sequence in place and journals the original content of each step
+// on first modification. Generators re-apply their pattern on every parameter
+// change; with the journal, only steps whose value actually changes are
+// written, which keeps previewing cheap while the engine is playing the
+// edited sequence.
 template<typename T>
 class SequenceBuilderImpl : public SequenceBuilder {
 public:
     SequenceBuilderImpl(T &sequence, typename T::Layer layer) :
-        _edit(sequence),
-        _original(sequence),
+        _sequence(sequence),
         _layer(layer),
-        _range(T::layerRange(layer))
+        _range(T::layerRange(layer)),
+        _originalFirstStep(sequence.firstStep()),
+        _originalLastStep(sequence.lastStep())
     {}
 
     void revert() override {
-        _edit = _original;
+        _sequence.setFirstStep(_originalFirstStep);
+        _sequence.setLastStep(_originalLastStep);
+        for (int i = 0; i < CONFIG_STEP_COUNT; ++i) {
+            if (_journaled[i]) {
+                _sequence.step(i) = _journal[i];
+            }
+        }
+        _journaled.reset();
     }
 
     int originalLength() const override {
-        return _original.lastStep() - _original.firstStep() + 1;
+        return _originalLastStep - _originalFirstStep + 1;
     }
 
     float originalValue(int index) const override {
-        int layerValue = _original.step(_original.firstStep() + index).layerValue(_layer);
+        int layerValue = originalStep(_originalFirstStep + index).layerValue(_layer);
         return float(layerValue - _range.min) / (_range.max - _range.min);
     }
 
     int length() const override {
-        return _edit.lastStep() - _edit.firstStep() + 1;
+        return _sequence.lastStep() - _sequence.firstStep() + 1;
     }
 
     void setLength(int length) override {
-        _edit.setFirstStep(0);
-        _edit.setLastStep(length - 1);
+        _sequence.setFirstStep(0);
+        _sequence.setLastStep(length - 1);
     }
 
     float value(int index) const override {
-        int layerValue = _edit.step(_edit.firstStep() + index).layerValue(_layer);
+        int layerValue = _sequence.step(_sequence.firstStep() + index).layerValue(_layer);
         return float(layerValue - _range.min) / (_range.max - _range.min);
     }
 
     void setValue(int index, float value) override {
+        int stepIndex = _sequence.firstStep() + index;
         int layerValue = std::round(value * (_range.max - _range.min) + _range.min);
-        _edit.step(_edit.firstStep() + index).setLayerValue(_layer, layerValue);
+        auto &step = _sequence.step(stepIndex);
+        if (step.layerValue(_layer) != layerValue) {
+            journal(stepIndex);
+            step.setLayerValue(_layer, layerValue);
+        }
+    }
+
+    void setValues(const float *values, int count) override {
+        int firstStep = _sequence.firstStep();
+        float range = _range.max - _range.min;
+        for (int i = 0; i < count; ++i) {
+            int stepIndex = firstStep + i;
+            int layerValue = std::round(values[i] * range + _range.min);
+            auto &step = _sequence.step(stepIndex);
+            if (step.layerValue(_layer) != layerValue) {
+                journal(stepIndex);
+                step.setLayerValue(_layer, layerValue);
+            }
+        }
     }
 
     void clearSteps() override {
-        _edit.clearSteps();
+        for (int i = 0; i < CONFIG_STEP_COUNT; ++i) {
+            journal(i);
+        }
+        _sequence.clearSteps();
     }
 
     void copyStep(int fromIndex, int toIndex) override {
-        _edit.step(_edit.firstStep() + toIndex) = _original.step(_original.firstStep() + fromIndex);
+        int toStepIndex = _sequence.firstStep() + toIndex;
+        journal(toStepIndex);
+        _sequence.step(toStepIndex) = originalStep(_originalFirstStep + fromIndex);
     }
 
 private:
-    T &_edit;
-    T _original;
+    const typename T::Step &originalStep(int stepIndex) const {
+        return _journaled[stepIndex] ? _journal[stepIndex] : _sequence.step(stepIndex);
+    }
+
+    void journal(int stepIndex) {
+        if (!_journaled[stepIndex]) {
+            _journaled.set(stepIndex);
+            _journal[stepIndex] = _sequence.step(stepIndex);
+        }
+    }
+
+    T &_sequence;
     typename T::Layer _layer;
     Types::LayerRange _range;
+    int _originalFirstStep;
+    int _originalLastStep;
+    std::bitset<CONFIG_STEP_COUNT> _journaled;
+    std::array<typename T::Step, CONFIG_STEP_COUNT> _journal;
 };
 
 typedef SequenceBuilderImpl<NoteSequence> NoteSequenceBuilder;
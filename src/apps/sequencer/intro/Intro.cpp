@@ -39,10 +39,18 @@ static void transformVertices(const Mat4 &transform, const Vec3 *src, Vec3 *dst,
 }
 
 Intro::Intro() {
+    init();
 }
 
 void Intro::init() {
     _time = 0.f;
+
+    Vec3 eye(0.f, 0.f, -15.f);
+    Vec3 target(0.f);
+    Vec3 up(0.f, 1.f, 0.f);
+    Mat4 viewMatrix = Mat4::lookAt(eye, target - eye, up);
+    Mat4 projMatrix = Mat4::perspective(deg2rad(20.f), 1.f, 0.1f, 40.f);
+    _viewProjMatrix = projMatrix * viewMatrix;
 }
 
 void Intro::update(float dt) {
@@ -55,13 +63,6 @@ void Intro::draw(Canvas &canvas) {
     canvas.fill();
     canvas.setColor(0xf);
 
-    Vec3 eye(0.f, 0.f, -15.f);
-    Vec3 target(0.f);
-    Vec3 up(0.f, 1.f, 0.f);
-    Mat4 viewMatrix = Mat4::lookAt(eye, target - eye, up);
-
-    Mat4 projMatrix = Mat4::perspective(deg2rad(20.f), 1.f, 0.1f, 40.f);
-
     Vec2 positions[8];
 
     canvas.setBlendMode(BlendMode::Add);
@@ -69,7 +70,7 @@ void Intro::draw(Canvas &canvas) {
 
     for (int instance = -2; instance <= 2; ++instance) {
         Mat4 modelMatrix = Mat4::translate(Vec3(instance * 6.f, 0.f, 0.f)) * Mat4::rotXYZ(Vec3((_time + instance) * 0.3, (_time + instance) * 0.7, (_time + instance) * 1.3));
-        Mat4 modelViewProjMatrix = projMatrix * viewMatrix * modelMatrix;
+        Mat4 modelViewProjMatrix = _viewProjMatrix * modelMatrix;
 
         for (int i = 0; i < 8; ++i) {
             const auto &src = boxVertices[i];
@@ -2,6 +2,8 @@
 
 #include "core/gfx/Canvas.h"
 
+#include "core/math/Mat4.h"
+
 class Intro {
 public:
     Intro();
@@ -13,4 +15,6 @@ public:
 
 private:
     float _time;
+    // camera is fixed, view and projection are set up once
+    Mat4 _viewProjMatrix;
 };
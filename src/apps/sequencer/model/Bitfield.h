@@ -63,6 +63,13 @@ public:
     BitField &operator--()         { return *this = *this - 1; }
     T operator--(int)              { T r = *this; --*this; return r; }
 
+    // extract/insert operate on a word held by the caller, so multiple fields
+    // can be combined and written back with a single load/store
+    static constexpr T mask()                  { return T(Mask) << Index; }
+    static constexpr T extract(T word)         { return (word >> Index) & T(Mask); }
+    static constexpr T pack(T value)           { return (value & T(Mask)) << Index; }
+    static constexpr T insert(T word, T value) { return (word & ~mask()) | pack(value); }
+
 private:
     T value_;
 };
@@ -84,6 +91,11 @@ public:
 
     explicit operator bool() const { return value_ & (Mask << Index); }
 
+    static constexpr T mask()                     { return T(Mask) << Index; }
+    static constexpr T extract(T word)            { return (word >> Index) & T(Mask); }
+    static constexpr T pack(bool value)           { return T(value ? 1 : 0) << Index; }
+    static constexpr T insert(T word, bool value) { return (word & ~mask()) | pack(value); }
+
 private:
     T value_;
 };
@@ -84,15 +84,13 @@ public:
         }
 
         uint16_t voltsToValue(float volts) const {
-            volts = clamp(volts, float(MinVoltage), float(MaxVoltage));
-            float fIndex = (volts - MinVoltage) * ItemsPerVolt;
-            int index = std::floor(fIndex);
-            if (index < ItemCount - 1) {
-                float t = fIndex - index;
-                return lerp(t, item(index), item(index + 1));
-            } else {
-                return item(ItemCount - 1);
-            }
+            // position in 16.16 fixed point relative to MinVoltage
+            int32_t fixed = clamp(
+                int32_t((volts - MinVoltage) * (ItemsPerVolt * 65536.f)),
+                int32_t(0), int32_t((ItemCount - 1) << 16)
+            );
+            const auto &segment = _segments[fixed >> 16];
+            return uint16_t(segment.offset + ((segment.slope * (fixed & 0xffff)) >> 16));
         }
 
         void clear();
@@ -102,8 +100,18 @@ public:
 
     private:
         void update();
+        void updateSegments();
+
+        // precomputed piecewise linear volts -> dac code segments, one per
+        // calibration interval, so the conversion in the CV update path is a
+        // table lookup and a fixed point multiply
+        struct Segment {
+            int32_t offset;     // dac code at the segment start
+            int32_t slope;      // dac code delta across the segment
+        };
 
         ItemArray _items;
+        std::array<Segment, ItemCount> _segments;
     };
 
     typedef std::array<CvOutput, CONFIG_CV_OUTPUT_CHANNELS> CvOutputArray;
@@ -27,7 +27,7 @@ void ClipBoard::copyNoteSequence(const NoteSequence &noteSequence) {
 void ClipBoard::copyNoteSequenceSteps(const NoteSequence &noteSequence, const SelectedSteps &selectedSteps) {
     _type = Type::NoteSequenceSteps;
     auto &noteSequenceSteps = _container.as<NoteSequenceSteps>();
-    noteSequenceSteps.sequence = noteSequence;
+    noteSequenceSteps.steps = noteSequence.steps();
     noteSequenceSteps.selected = selectedSteps;
 }
 
@@ -39,7 +39,7 @@ void ClipBoard::copyCurveSequence(const CurveSequence &curveSequence) {
 void ClipBoard::copyCurveSequenceSteps(const CurveSequence &curveSequence, const SelectedSteps &selectedSteps) {
     _type = Type::CurveSequenceSteps;
     auto &curveSequenceSteps = _container.as<CurveSequenceSteps>();
-    curveSequenceSteps.sequence = curveSequence;
+    curveSequenceSteps.steps = curveSequence.steps();
     curveSequenceSteps.selected = selectedSteps;
 }
 
@@ -85,7 +85,7 @@ void ClipBoard::pasteNoteSequence(NoteSequence &noteSequence) const {
 void ClipBoard::pasteNoteSequenceSteps(NoteSequence &noteSequence, const SelectedSteps &selectedSteps) const {
     if (canPasteNoteSequenceSteps()) {
         const auto &noteSequenceSteps = _container.as<NoteSequenceSteps>();
-        ModelUtils::copySteps(noteSequenceSteps.sequence.steps(), noteSequenceSteps.selected, noteSequence.steps(), selectedSteps);
+        ModelUtils::copySteps(noteSequenceSteps.steps, noteSequenceSteps.selected, noteSequence.steps(), selectedSteps);
     }
 }
 
@@ -99,7 +99,7 @@ void ClipBoard::pasteCurveSequence(CurveSequence &curveSequence) const {
 void ClipBoard::pasteCurveSequenceSteps(CurveSequence &curveSequence, const SelectedSteps &selectedSteps) const {
     if (canPasteCurveSequenceSteps()) {
         const auto &curveSequenceSteps = _container.as<CurveSequenceSteps>();
-        ModelUtils::copySteps(curveSequenceSteps.sequence.steps(), curveSequenceSteps.selected, curveSequence.steps(), selectedSteps);
+        ModelUtils::copySteps(curveSequenceSteps.steps, curveSequenceSteps.selected, curveSequence.steps(), selectedSteps);
     }
 }
 
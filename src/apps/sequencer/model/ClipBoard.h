@@ -8,13 +8,12 @@
 #include "Project.h"
 #include "UserScale.h"
 
+#include "core/utils/BitSet.h"
 #include "core/utils/Container.h"
 
-#include <bitset>
-
 class ClipBoard {
 public:
-    typedef std::bitset<CONFIG_STEP_COUNT> SelectedSteps;
+    typedef BitSet<CONFIG_STEP_COUNT> SelectedSteps;
 
     ClipBoard(Project &project);
 
@@ -56,13 +55,15 @@ private:
         UserScale,
     };
 
+    // only the packed step storage is kept on the clipboard, sequence
+    // settings are not involved in step copy/paste
     struct NoteSequenceSteps {
-        NoteSequence sequence;
+        NoteSequence::StepArray steps;
         SelectedSteps selected;
     };
 
     struct CurveSequenceSteps {
-        CurveSequence sequence;
+        CurveSequence::StepArray steps;
         SelectedSteps selected;
     };
 
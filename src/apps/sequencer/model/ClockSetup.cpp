@@ -4,6 +4,7 @@
 void ClockSetup::clear() {
     _mode = Mode::Auto;
     _shiftMode = ShiftMode::Restart;
+    _ppqn = Ppqn::Ppqn192;
     _clockInputDivisor = 12;
     _clockInputMode = ClockInputMode::Reset;
     _clockOutputDivisor = 12;
@@ -21,6 +22,7 @@ void ClockSetup::write(WriteContext &context) const {
     auto &writer = context.writer;
     writer.write(_mode);
     writer.write(_shiftMode);
+    writer.write(_ppqn);
     writer.write(_clockInputDivisor);
     writer.write(_clockInputMode);
     writer.write(_clockOutputDivisor);
@@ -37,6 +39,7 @@ void ClockSetup::read(ReadContext &context) {
     auto &reader = context.reader;
     reader.read(_mode);
     reader.read(_shiftMode);
+    reader.read(_ppqn, ProjectVersion::Version22);
     reader.read(_clockInputDivisor);
     reader.read(_clockInputMode);
     reader.read(_clockOutputDivisor);
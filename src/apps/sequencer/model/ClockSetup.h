@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Config.h"
+
 #include "Serialize.h"
 #include "ModelUtils.h"
 
@@ -46,6 +48,30 @@ public:
         return nullptr;
     }
 
+    enum class Ppqn : uint8_t {
+        Ppqn192 = 0,
+        Ppqn384,
+        Last
+    };
+
+    static const char *ppqnName(Ppqn ppqn) {
+        switch (ppqn) {
+        case Ppqn::Ppqn192: return "192";
+        case Ppqn::Ppqn384: return "384";
+        case Ppqn::Last:    break;
+        }
+        return nullptr;
+    }
+
+    static int ppqnValue(Ppqn ppqn) {
+        switch (ppqn) {
+        case Ppqn::Ppqn192: return 192;
+        case Ppqn::Ppqn384: return 384;
+        case Ppqn::Last:    break;
+        }
+        return CONFIG_PPQN;
+    }
+
     enum class ClockInputMode : uint8_t {
         Reset = 0,
         Run,
@@ -116,6 +142,27 @@ public:
         str(shiftModeName(shiftMode()));
     }
 
+    // ppqn
+
+    // tick resolution of the sequencer, changing it while the clock is
+    // running rescales the tick counters to keep the musical position
+    Ppqn ppqn() const { return _ppqn; }
+    void setPpqn(Ppqn ppqn) {
+        ppqn = ModelUtils::clampedEnum(ppqn);
+        if (ppqn != _ppqn) {
+            _ppqn = ppqn;
+            _dirty = true;
+        }
+    }
+
+    void editPpqn(int value, int shift) {
+        setPpqn(ModelUtils::adjustedEnum(ppqn(), value));
+    }
+
+    void printPpqn(StringBuilder &str) const {
+        str(ppqnName(ppqn()));
+    }
+
     // clockInputDivisor
 
     int clockInputDivisor() const { return _clockInputDivisor; }
@@ -316,6 +363,7 @@ public:
 private:
     Mode _mode;
     ShiftMode _shiftMode;
+    Ppqn _ppqn;
     uint8_t _clockInputDivisor;
     ClockInputMode _clockInputMode;
     uint8_t _clockOutputDivisor;
@@ -1,8 +1,11 @@
 #include "Curve.h"
 
+#include "core/math/Math.h"
+
 #include <algorithm>
 
 #include <cmath>
+#include <cstdint>
 
 static const float Pi = 3.1415926536f;
 static const float TwoPi = 2.f * Pi;
@@ -102,3 +105,46 @@ Curve::Function Curve::function(Type type) {
 float Curve::eval(Type type, float x) {
     return functions[type](x);
 }
+
+// Curve shapes sampled at init-time into 16-bit tables (matching the DAC
+// resolution), evaluated with linear interpolation between samples.
+static constexpr int SampleCount = 128;
+
+struct SampledCurves {
+    uint16_t samples[Curve::Last][SampleCount + 1];
+
+    SampledCurves() {
+        for (int type = 0; type < Curve::Last; ++type) {
+            for (int i = 0; i <= SampleCount; ++i) {
+                float value = functions[type](float(i) / SampleCount);
+                samples[type][i] = uint16_t(clamp(value, 0.f, 1.f) * 65535.f);
+            }
+        }
+    }
+};
+
+static SampledCurves sampledCurves;
+
+float Curve::evalSampled(Type type, float x) {
+    const uint16_t *samples = sampledCurves.samples[type];
+    float pos = clamp(x, 0.f, 1.f) * SampleCount;
+    int index = std::min(int(pos), SampleCount - 1);
+    float fraction = pos - index;
+    float value = samples[index] + (samples[index + 1] - samples[index]) * fraction;
+    return value * (1.f / 65535.f);
+}
+
+float Curve::evalMorphed(Type a, Type b, int weight, float x) {
+    const uint16_t *samplesA = sampledCurves.samples[a];
+    const uint16_t *samplesB = sampledCurves.samples[b];
+    float pos = clamp(x, 0.f, 1.f) * SampleCount;
+    int index = std::min(int(pos), SampleCount - 1);
+    float fraction = pos - index;
+    int w = clamp(weight, 0, 256);
+    // blend both sample pairs in integer before the single interpolation,
+    // products stay below 2^25 so the accumulation fits an int comfortably
+    int s0 = (samplesA[index] * (256 - w) + samplesB[index] * w) >> 8;
+    int s1 = (samplesA[index + 1] * (256 - w) + samplesB[index + 1] * w) >> 8;
+    float value = s0 + (s1 - s0) * fraction;
+    return value * (1.f / 65535.f);
+}
@@ -28,5 +28,14 @@ public:
     static Function function(Type type);
 
     static float eval(Type type, float x);
+
+    // sampled evaluation with linear interpolation between samples, used as
+    // fast path in the engine tick path to avoid per-sample transcendental math
+    static float evalSampled(Type type, float x);
+
+    // blended evaluation between two sampled shapes, weight is Q8 fixed-point
+    // (0 = shape a, 256 = shape b), same cost as evalSampled plus one extra
+    // table fetch and two integer multiplies per sample pair
+    static float evalMorphed(Type a, Type b, int weight, float x);
 };
 
@@ -77,15 +77,10 @@ void CurveSequence::Step::setLayerValue(Layer layer, int value) {
 }
 
 void CurveSequence::Step::clear() {
-    _data0.raw = 0;
-    _data1.raw = 0;
-    setShape(0);
-    setShapeVariation(0);
-    setShapeVariationProbability(0);
-    setMin(0);
-    setMax(Max::Max);
-    setGate(0);
-    setGateProbability(GateProbability::Max);
+    // default values are packed into whole words at compile time and written
+    // with a single store per word instead of a read-modify-write per field
+    _data0.raw = decltype(_data0.max)::pack(Max::Max);
+    _data1.raw = decltype(_data1.gateProbability)::pack(GateProbability::Max);
 }
 
 void CurveSequence::Step::write(WriteContext &context) const {
@@ -14,6 +14,7 @@
 #include <array>
 #include <cstdint>
 #include <initializer_list>
+#include <type_traits>
 
 class CurveSequence {
 public:
@@ -161,6 +162,9 @@ public:
         } _data1;
     };
 
+    // step storage is moved around with memcpy/memmove in bulk operations
+    static_assert(std::is_trivially_copyable<Step>::value, "Step must be trivially copyable");
+
     typedef std::array<Step, CONFIG_STEP_COUNT> StepArray;
 
     //----------------------------------------
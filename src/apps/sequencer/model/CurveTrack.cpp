@@ -12,6 +12,9 @@ void CurveTrack::writeRouted(Routing::Target target, int intValue, float floatVa
     case Routing::Target::ShapeProbabilityBias:
         setShapeProbabilityBias(intValue, true);
         break;
+    case Routing::Target::ShapeMorph:
+        setShapeMorph(intValue, true);
+        break;
     case Routing::Target::GateProbabilityBias:
         setGateProbabilityBias(intValue, true);
         break;
@@ -23,11 +26,16 @@ void CurveTrack::writeRouted(Routing::Target target, int intValue, float floatVa
 void CurveTrack::clear() {
     setPlayMode(Types::PlayMode::Aligned);
     setFillMode(FillMode::None);
+    setExtendedSteps(false);
+    setCvUpdateMode(CvUpdateMode::Tick);
     setSlideTime(0);
     setRotate(0);
     setShapeProbabilityBias(0);
+    setShapeMorph(0);
     setGateProbabilityBias(0);
 
+    endSnapshot();
+
     for (auto &sequence : _sequences) {
         sequence.clear();
     }
@@ -37,9 +45,12 @@ void CurveTrack::write(WriteContext &context) const {
     auto &writer = context.writer;
     writer.write(_playMode);
     writer.write(_fillMode);
+    writer.write(_extendedSteps);
+    writer.write(_cvUpdateMode);
     writer.write(_slideTime.base);
     writer.write(_rotate.base);
     writer.write(_shapeProbabilityBias.base);
+    writer.write(_shapeMorph.base);
     writer.write(_gateProbabilityBias.base);
     writeArray(context, _sequences);
 }
@@ -48,9 +59,12 @@ void CurveTrack::read(ReadContext &context) {
     auto &reader = context.reader;
     reader.read(_playMode);
     reader.read(_fillMode);
+    reader.read(_extendedSteps, ProjectVersion::Version23);
+    reader.read(_cvUpdateMode, ProjectVersion::Version24);
     reader.read(_slideTime.base, ProjectVersion::Version8);
     reader.read(_rotate.base);
     reader.read(_shapeProbabilityBias.base, ProjectVersion::Version15);
+    reader.read(_shapeMorph.base, ProjectVersion::Version27);
     reader.read(_gateProbabilityBias.base, ProjectVersion::Version15);
     readArray(context, _sequences);
 }
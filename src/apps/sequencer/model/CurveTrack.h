@@ -35,6 +35,23 @@ public:
         return nullptr;
     }
 
+    // CvUpdateMode
+
+    enum class CvUpdateMode : uint8_t {
+        Tick,
+        Fast,
+        Last
+    };
+
+    static const char *cvUpdateModeName(CvUpdateMode mode) {
+        switch (mode) {
+        case CvUpdateMode::Tick:    return "Tick";
+        case CvUpdateMode::Fast:    return "1kHz";
+        case CvUpdateMode::Last:    break;
+        }
+        return nullptr;
+    }
+
     //----------------------------------------
     // Properties
     //----------------------------------------
@@ -69,6 +86,41 @@ public:
         str(fillModeName(fillMode()));
     }
 
+    // extendedSteps
+
+    // chains each pattern with the next one into a 128 step sequence, see
+    // NoteTrack::extendedSteps
+    bool extendedSteps() const { return _extendedSteps; }
+    void setExtendedSteps(bool extendedSteps) {
+        _extendedSteps = extendedSteps;
+    }
+
+    void editExtendedSteps(int value, bool shift) {
+        setExtendedSteps(value > 0);
+    }
+
+    void printExtendedSteps(StringBuilder &str) const {
+        ModelUtils::printYesNo(str, extendedSteps());
+    }
+
+    // cvUpdateMode
+
+    // in fast mode the curve is re-evaluated at the engine update rate
+    // (1 kHz) instead of once per clock tick, interpolating the step
+    // position between ticks for smooth fast modulation
+    CvUpdateMode cvUpdateMode() const { return _cvUpdateMode; }
+    void setCvUpdateMode(CvUpdateMode cvUpdateMode) {
+        _cvUpdateMode = ModelUtils::clampedEnum(cvUpdateMode);
+    }
+
+    void editCvUpdateMode(int value, bool shift) {
+        setCvUpdateMode(ModelUtils::adjustedEnum(cvUpdateMode(), value));
+    }
+
+    void printCvUpdateMode(StringBuilder &str) const {
+        str(cvUpdateModeName(cvUpdateMode()));
+    }
+
     // slideTime
 
     int slideTime() const { return _slideTime.get(isRouted(Routing::Target::SlideTime)); }
@@ -123,6 +175,26 @@ public:
         str("%+.1f%%", shapeProbabilityBias() * 12.5f);
     }
 
+    // shapeMorph
+
+    // blends the played shape towards the next shape in the curve table,
+    // evaluated from the precomputed sample tables at no extra tick cost
+    int shapeMorph() const { return _shapeMorph.get(isRouted(Routing::Target::ShapeMorph)); }
+    void setShapeMorph(int shapeMorph, bool routed = false) {
+        _shapeMorph.set(clamp(shapeMorph, 0, 100), routed);
+    }
+
+    void editShapeMorph(int value, bool shift) {
+        if (!isRouted(Routing::Target::ShapeMorph)) {
+            setShapeMorph(ModelUtils::adjustedByStep(shapeMorph(), value, 5, !shift));
+        }
+    }
+
+    void printShapeMorph(StringBuilder &str) const {
+        printRouted(str, Routing::Target::ShapeMorph);
+        str("%d%%", shapeMorph());
+    }
+
     // gateProbabilityBias
 
     int gateProbabilityBias() const { return _gateProbabilityBias.get(isRouted(Routing::Target::GateProbabilityBias)); }
@@ -147,7 +219,42 @@ public:
           CurveSequenceArray &sequences()       { return _sequences; }
 
     const CurveSequence &sequence(int index) const { return _sequences[index]; }
-          CurveSequence &sequence(int index)       { return _sequences[index]; }
+          CurveSequence &sequence(int index)       {
+              // an armed snapshot backs up the pattern right before its
+              // first edit, so unedited tracks never pay for the copy
+              if (int8_t(index) == _snapshotSource && !_snapshotCopied) {
+                  _sequences[SnapshotIndex] = _sequences[index];
+                  _snapshotCopied = true;
+              }
+              return _sequences[index];
+          }
+
+    //----------------------------------------
+    // Snapshot
+    //----------------------------------------
+
+    // Arms the snapshot slot as a lazy backup of the given pattern. No data
+    // is copied here, the non-const sequence() accessor copies the pattern
+    // into the slot before the first edit.
+    void startSnapshot(int pattern) {
+        _snapshotSource = pattern;
+        _snapshotCopied = false;
+    }
+
+    // Restores the pattern from the backup if it was edited since
+    // startSnapshot() and disarms the snapshot.
+    void revertSnapshot() {
+        if (_snapshotCopied) {
+            _sequences[_snapshotSource] = _sequences[SnapshotIndex];
+        }
+        endSnapshot();
+    }
+
+    // Disarms the snapshot, keeping the edits in place.
+    void endSnapshot() {
+        _snapshotSource = -1;
+        _snapshotCopied = false;
+    }
 
     //----------------------------------------
     // Routing
@@ -169,6 +276,8 @@ public:
     void read(ReadContext &context);
 
 private:
+    static constexpr int SnapshotIndex = CONFIG_PATTERN_COUNT;
+
     void setTrackIndex(int trackIndex) {
         _trackIndex = trackIndex;
         for (auto &sequence : _sequences) {
@@ -179,12 +288,18 @@ private:
     int8_t _trackIndex = -1;
     Types::PlayMode _playMode;
     FillMode _fillMode;
+    bool _extendedSteps;
+    CvUpdateMode _cvUpdateMode;
     Routable<uint8_t> _slideTime;
     Routable<int8_t> _rotate;
     Routable<int8_t> _shapeProbabilityBias;
+    Routable<uint8_t> _shapeMorph;
     Routable<int8_t> _gateProbabilityBias;
 
     CurveSequenceArray _sequences;
 
+    int8_t _snapshotSource = -1;
+    bool _snapshotCopied = false;
+
     friend class Track;
 };
@@ -1,31 +1,44 @@
 #include "FileManager.h"
 
+#include "core/fs/FileWriter.h"
+#include "core/fs/FileReader.h"
+#include "core/hash/FnvHash.h"
 #include "core/utils/StringBuilder.h"
 
 #include "os/os.h"
 
 #include <algorithm>
+#include <bitset>
 
 #include <cstring>
 
 uint32_t FileManager::_volumeState = 0;
 uint32_t FileManager::_nextVolumeStateCheckTicks = 0;
 
-std::array<FileManager::CachedSlotInfo, 4> FileManager::_cachedSlotInfos;
-uint32_t FileManager::_cachedSlotInfoTicket = 0;
+size_t FileManager::_volumeSizeTotal = 0;
+size_t FileManager::_volumeSizeFree = 0;
+volatile bool FileManager::_volumeStatsValid = false;
 
-FileManager::TaskExecuteCallback FileManager::_taskExecuteCallback;
-FileManager::TaskResultCallback FileManager::_taskResultCallback;
+std::array<std::array<FileManager::CachedSlotInfo, FileManager::SlotCount>, FileManager::FileTypeCount> FileManager::_cachedSlotInfos;
+
+FileManager::PrefetchState FileManager::_prefetchState = FileManager::PrefetchState::Idle;
+uint8_t FileManager::_prefetchTypeIndex = 0;
+uint8_t FileManager::_prefetchSlot = 0;
+bool FileManager::_prefetchIndexDirty = false;
+
+std::array<FileManager::Task, FileManager::TaskQueueSize> FileManager::_tasks;
+uint8_t FileManager::_taskSequence;
 volatile uint32_t FileManager::_taskPending;
 
 struct FileTypeInfo {
     const char *dir;
     const char *ext;
+    uint32_t extHash;   // compile-time hash used for extension matching
 };
 
 FileTypeInfo fileTypeInfos[] = {
-    { "PROJECTS", "PRO" },
-    { "SCALES", "SCA" },
+    { "PROJECTS", "PRO", fnv1a("PRO") },
+    { "SCALES", "SCA", fnv1a("SCA") },
 };
 
 static void slotPath(StringBuilder &str, FileType type, int slot) {
@@ -33,12 +46,51 @@ static void slotPath(StringBuilder &str, FileType type, int slot) {
     str("%s/%03d.%s", info.dir, slot + 1, info.ext);
 }
 
+// parse the slot number from a "NNN.EXT" directory entry, -1 if the entry is
+// not a slot file of the given type. the extension is matched against the
+// precomputed hash, hashing the tail covers the length check as well
+static int slotFromName(const FileTypeInfo &info, const char *name) {
+    int slot = 0;
+    for (int i = 0; i < 3; ++i) {
+        if (name[i] < '0' || name[i] > '9') {
+            return -1;
+        }
+        slot = slot * 10 + (name[i] - '0');
+    }
+    if (name[3] != '.' || fnv1a(&name[4]) != info.extHash) {
+        return -1;
+    }
+    slot -= 1;
+    return (slot >= 0 && slot < FileManager::SlotCount) ? slot : -1;
+}
+
+static void indexPath(StringBuilder &str, int typeIndex) {
+    str("%s/INDEX.DAT", fileTypeInfos[typeIndex].dir);
+}
+
+static constexpr uint32_t IndexFileMagic = 0x58444e49; // "INDX"
+static constexpr uint32_t IndexFileVersion = 0;
+
+struct IndexEntry {
+    uint32_t mtime; // 0 if slot is unused
+    char name[FileHeader::NameLength];
+} __attribute__((packed));
+
+static const char *autoSavePath = "PROJECTS/AUTOSAVE.DAT";
+
 void FileManager::init() {
     _volumeState = 0;
     _nextVolumeStateCheckTicks = 0;
-    _taskExecuteCallback = nullptr;
-    _taskResultCallback = nullptr;
+    for (auto &task : _tasks) {
+        task.executeCallback = nullptr;
+        task.resultCallback = nullptr;
+        task.pending = false;
+    }
+    _taskSequence = 0;
     _taskPending = 0;
+    _prefetchState = PrefetchState::Idle;
+    _volumeStatsValid = false;
+    invalidateAllSlots();
 }
 
 bool FileManager::volumeAvailable() {
@@ -51,15 +103,21 @@ bool FileManager::volumeMounted() {
 
 fs::Error FileManager::format() {
     invalidateAllSlots();
+    startPrefetch();
+    _volumeStatsValid = false;
     return fs::volume().format();
 }
 
-fs::Error FileManager::saveProject(Project &project, int slot) {
+fs::Error FileManager::saveProject(Project &project, int slot, const Project::WriteGuard &guard) {
     return saveFile(FileType::Project, slot, [&] (const char *path) {
-        auto result = project.write(path);
+        auto result = project.write(path, guard);
         if (result == fs::OK) {
             project.setSlot(slot);
             saveLastProject(slot);
+            // edits are persisted in the slot now, drop the autosave journal
+            if (fs::exists(autoSavePath)) {
+                fs::remove(autoSavePath);
+            }
         }
         return result;
     });
@@ -89,6 +147,28 @@ fs::Error FileManager::loadLastProject(Project &project) {
     return result;
 }
 
+fs::Error FileManager::autoSaveProject(Project &project) {
+    const auto &info = fileTypeInfos[int(FileType::Project)];
+    if (!fs::exists(info.dir)) {
+        fs::mkdir(info.dir);
+    }
+
+    return project.autoSave(autoSavePath);
+}
+
+fs::Error FileManager::loadAutoSavedProject(Project &project) {
+    auto result = project.readAutoSave(autoSavePath);
+    if (result == fs::OK) {
+        project.setSlot(-1);
+    }
+
+    return result;
+}
+
+bool FileManager::autoSavedProjectExists() {
+    return fs::exists(autoSavePath);
+}
+
 fs::Error FileManager::saveUserScale(const UserScale &userScale, int slot) {
     return saveFile(FileType::UserScale, slot, [&] (const char *path) {
         return userScale.write(path);
@@ -106,20 +186,7 @@ void FileManager::slotInfo(FileType type, int slot, SlotInfo &info) {
         return;
     }
 
-    info.used = false;
-
-    FixedStringBuilder<32> path;
-    slotPath(path, type, slot);
-
-    if (fs::exists(path)) {
-        fs::File file(path, fs::File::Read);
-        FileHeader header;
-        size_t lenRead;
-        if (file.read(&header, sizeof(header), &lenRead) == fs::OK && lenRead == sizeof(header)) {
-            header.readName(info.name, sizeof(info.name));
-            info.used = true;
-        }
-    }
+    readSlotInfo(type, slot, info);
 
     cacheSlot(type, slot, info);
 }
@@ -130,10 +197,88 @@ bool FileManager::slotUsed(FileType type, int slot) {
     return info.used;
 }
 
-void FileManager::task(TaskExecuteCallback executeCallback, TaskResultCallback resultCallback) {
-    _taskExecuteCallback = executeCallback;
-    _taskResultCallback = resultCallback;
-    _taskPending = 1;
+bool FileManager::volumeStats(size_t &total, size_t &free) {
+    if (!_volumeStatsValid) {
+        return false;
+    }
+    total = _volumeSizeTotal;
+    free = _volumeSizeFree;
+    return true;
+}
+
+void FileManager::task(TaskExecuteCallback executeCallback, TaskResultCallback resultCallback, TaskPriority priority) {
+    TaskResultCallback supersededResultCallback;
+
+    {
+        os::InterruptLock lock;
+
+        Task *slot = nullptr;
+        for (auto &entry : _tasks) {
+            if (!entry.pending) {
+                slot = &entry;
+                break;
+            }
+        }
+
+        if (!slot) {
+            // queue is full, supersede the oldest low priority task (or the
+            // oldest task altogether if all of them are high priority)
+            for (auto &entry : _tasks) {
+                if (entry.priority == TaskPriority::Low && (!slot || int8_t(entry.seq - slot->seq) < 0)) {
+                    slot = &entry;
+                }
+            }
+            if (!slot) {
+                for (auto &entry : _tasks) {
+                    if (!slot || int8_t(entry.seq - slot->seq) < 0) {
+                        slot = &entry;
+                    }
+                }
+            }
+            supersededResultCallback = slot->resultCallback;
+            --_taskPending;
+        }
+
+        slot->executeCallback = executeCallback;
+        slot->resultCallback = resultCallback;
+        slot->priority = priority;
+        slot->seq = _taskSequence++;
+        slot->pending = true;
+        ++_taskPending;
+    }
+
+    if (supersededResultCallback) {
+        // completed on the caller's context, the task never executed
+        supersededResultCallback(fs::TIMEOUT);
+    }
+}
+
+bool FileManager::takeTask(Task &task) {
+    os::InterruptLock lock;
+
+    Task *best = nullptr;
+    for (auto &entry : _tasks) {
+        if (!entry.pending) {
+            continue;
+        }
+        if (!best || int(entry.priority) > int(best->priority) ||
+            (entry.priority == best->priority && int8_t(entry.seq - best->seq) < 0)) {
+            best = &entry;
+        }
+    }
+
+    if (!best) {
+        return false;
+    }
+
+    task.executeCallback = best->executeCallback;
+    task.resultCallback = best->resultCallback;
+    best->executeCallback = nullptr;
+    best->resultCallback = nullptr;
+    best->pending = false;
+    --_taskPending;
+
+    return true;
 }
 
 void FileManager::processTask() {
@@ -145,26 +290,58 @@ void FileManager::processTask() {
         uint32_t newVolumeState = fs::volume().available() ? Available : 0;
         if (newVolumeState & Available) {
             if (!(_volumeState & Mounted)) {
-                newVolumeState |= (fs::volume().mount() == fs::OK) ? Mounted : 0;
+                if (fs::volume().mount() == fs::OK) {
+                    newVolumeState |= Mounted;
+                    // warm the slot info cache in the background
+                    startPrefetch();
+                }
             } else {
                 newVolumeState |= Mounted;
             }
         } else {
             invalidateAllSlots();
+            _prefetchState = PrefetchState::Idle;
+            _volumeStatsValid = false;
         }
 
         _volumeState = newVolumeState;
     }
 
-    if (_taskPending) {
-        fs::Error result = _taskExecuteCallback();
-        _taskPending = 0;
-        _taskResultCallback(result);
+    Task task;
+    bool executedTask = false;
+    while (takeTask(task)) {
+        fs::Error result = task.executeCallback();
+        task.resultCallback(result);
+        executedTask = true;
+    }
+
+    if (executedTask && _volumeStatsValid) {
+        // tasks may have changed the card contents, refreshing is cheap now
+        // that FatFs tracks the free cluster count
+        updateVolumeStats();
+    }
+
+    if (!executedTask && (_volumeState & Mounted)) {
+        if (_prefetchState != PrefetchState::Idle) {
+            processPrefetch();
+        } else if (!_volumeStatsValid) {
+            // initial free space query, may scan the whole fat
+            updateVolumeStats();
+        }
+    }
+}
+
+void FileManager::updateVolumeStats() {
+    size_t total, free;
+    if (fs::volume().stats(&total, &free) == fs::OK) {
+        _volumeSizeTotal = total;
+        _volumeSizeFree = free;
+        _volumeStatsValid = true;
     }
 }
 
 
-fs::Error FileManager::saveFile(FileType type, int slot, std::function<fs::Error(const char *)> write) {
+fs::Error FileManager::saveFile(FileType type, int slot, FixedFunction<fs::Error(const char *), 24> write) {
     const auto &info = fileTypeInfos[int(type)];
     if (!fs::exists(info.dir)) {
         fs::mkdir(info.dir);
@@ -176,12 +353,14 @@ fs::Error FileManager::saveFile(FileType type, int slot, std::function<fs::Error
     auto result = write(path);
     if (result == fs::OK) {
         invalidateSlot(type, slot);
+        // pick up the new modification time and update the index file
+        startPrefetch();
     }
 
     return result;
 }
 
-fs::Error FileManager::loadFile(FileType type, int slot, std::function<fs::Error(const char *)> read) {
+fs::Error FileManager::loadFile(FileType type, int slot, FixedFunction<fs::Error(const char *)> read) {
     const auto &info = fileTypeInfos[int(type)];
     if (!fs::exists(info.dir)) {
         fs::mkdir(info.dir);
@@ -218,39 +397,218 @@ fs::Error FileManager::loadLastProject(int &slot) {
 }
 
 bool FileManager::cachedSlot(FileType type, int slot, SlotInfo &info) {
-    for (auto &cachedSlotInfo : _cachedSlotInfos) {
-        if (cachedSlotInfo.ticket != 0 && cachedSlotInfo.type == type && cachedSlotInfo.slot == slot) {
-            info = cachedSlotInfo.info;
-            cachedSlotInfo.ticket = nextCachedSlotTicket();
-            return true;
-        }
+    const auto &entry = _cachedSlotInfos[int(type)][slot];
+    if (entry.state == CacheState::Valid) {
+        info = entry.info;
+        return true;
     }
     return false;
 }
 
 void FileManager::cacheSlot(FileType type, int slot, const SlotInfo &info) {
-    auto cachedSlotInfo = std::min_element(_cachedSlotInfos.begin(), _cachedSlotInfos.end());
-    cachedSlotInfo->type = type;
-    cachedSlotInfo->slot = slot;
-    cachedSlotInfo->info = info;
-    cachedSlotInfo->ticket = nextCachedSlotTicket();
+    auto &entry = _cachedSlotInfos[int(type)][slot];
+    entry.info = info;
+    // set the state last to not expose a partially updated entry
+    entry.state = CacheState::Valid;
 }
 
 void FileManager::invalidateSlot(FileType type, int slot) {
-    for (auto &cachedSlotInfo : _cachedSlotInfos) {
-        if (cachedSlotInfo.ticket != 0 && cachedSlotInfo.type == type && cachedSlotInfo.slot == slot) {
-            cachedSlotInfo.ticket = 0;
+    auto &entry = _cachedSlotInfos[int(type)][slot];
+    entry.state = CacheState::Invalid;
+    entry.mtime = 0;
+}
+
+void FileManager::invalidateAllSlots() {
+    for (auto &entries : _cachedSlotInfos) {
+        for (auto &entry : entries) {
+            entry.state = CacheState::Invalid;
+            entry.mtime = 0;
         }
     }
 }
 
-void FileManager::invalidateAllSlots() {
-    for (auto &cachedSlotInfo : _cachedSlotInfos) {
-        cachedSlotInfo.ticket = 0;
+void FileManager::readSlotInfo(FileType type, int slot, SlotInfo &info) {
+    info.used = false;
+    info.name[0] = '\0';
+
+    FixedStringBuilder<32> path;
+    slotPath(path, type, slot);
+
+    if (fs::exists(path)) {
+        fs::File file(path, fs::File::Read);
+        FileHeader header;
+        size_t lenRead;
+        if (file.read(&header, sizeof(header), &lenRead) == fs::OK && lenRead == sizeof(header)) {
+            header.readName(info.name, sizeof(info.name));
+            info.used = true;
+        }
+    }
+}
+
+void FileManager::startPrefetch() {
+    _prefetchState = PrefetchState::Scan;
+    _prefetchTypeIndex = 0;
+    _prefetchSlot = 0;
+    _prefetchIndexDirty = false;
+}
+
+void FileManager::processPrefetch() {
+    switch (_prefetchState) {
+    case PrefetchState::Idle:
+        break;
+    case PrefetchState::Scan:
+        prefetchScan(_prefetchTypeIndex);
+        _prefetchSlot = 0;
+        _prefetchState = PrefetchState::ReadHeaders;
+        break;
+    case PrefetchState::ReadHeaders:
+        prefetchReadHeaders(_prefetchTypeIndex);
+        if (_prefetchSlot >= SlotCount) {
+            _prefetchState = PrefetchState::WriteIndex;
+        }
+        break;
+    case PrefetchState::WriteIndex:
+        if (_prefetchIndexDirty) {
+            writeIndex(_prefetchTypeIndex);
+        }
+        if (++_prefetchTypeIndex < FileTypeCount) {
+            _prefetchState = PrefetchState::Scan;
+        } else {
+            _prefetchState = PrefetchState::Idle;
+        }
+        break;
+    }
+}
+
+void FileManager::prefetchScan(int typeIndex) {
+    auto &entries = _cachedSlotInfos[typeIndex];
+    const auto &typeInfo = fileTypeInfos[typeIndex];
+
+    _prefetchIndexDirty = false;
+
+    // read slot names & modification times recorded in the index file into
+    // invalid slots (as unverified candidates)
+    {
+        FixedStringBuilder<32> path;
+        indexPath(path, typeIndex);
+        fs::FileReader fileReader(path);
+        uint32_t magic = 0, version = 0, slotCount = 0;
+        bool valid =
+            fileReader.error() == fs::OK &&
+            fileReader.read(&magic, sizeof(magic)) == fs::OK &&
+            fileReader.read(&version, sizeof(version)) == fs::OK &&
+            fileReader.read(&slotCount, sizeof(slotCount)) == fs::OK &&
+            magic == IndexFileMagic && version == IndexFileVersion && slotCount == SlotCount;
+        if (valid) {
+            for (int slot = 0; slot < SlotCount; ++slot) {
+                IndexEntry indexEntry;
+                if (fileReader.read(&indexEntry, sizeof(indexEntry)) != fs::OK) {
+                    valid = false;
+                    break;
+                }
+                auto &entry = entries[slot];
+                if (entry.state == CacheState::Invalid && indexEntry.mtime != 0) {
+                    entry.mtime = indexEntry.mtime;
+                    std::memcpy(entry.info.name, indexEntry.name, FileHeader::NameLength);
+                    entry.info.name[FileHeader::NameLength] = '\0';
+                    entry.info.used = true;
+                    entry.state = CacheState::FromIndex;
+                }
+            }
+        }
+        if (!valid) {
+            _prefetchIndexDirty = true;
+        }
+    }
+
+    // scan the directory and validate cached & candidate entries against the
+    // actual modification times, this is a single pass over the directory and
+    // does not open any files
+    std::bitset<SlotCount> found;
+    if (fs::exists(typeInfo.dir)) {
+        fs::Directory dir(typeInfo.dir);
+        while (dir.next()) {
+            const auto &fileInfo = dir.info();
+            int slot = slotFromName(typeInfo, fileInfo.name());
+            if (slot < 0) {
+                continue;
+            }
+            found[slot] = true;
+            auto &entry = entries[slot];
+            if ((entry.state == CacheState::Valid || entry.state == CacheState::FromIndex) &&
+                entry.mtime != 0 && entry.mtime == fileInfo.mtime()) {
+                entry.state = CacheState::Valid;
+            } else {
+                entry.mtime = fileInfo.mtime();
+                entry.state = CacheState::Pending;
+            }
+        }
+    }
+
+    // slots without a file are known to be unused
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        if (!found[slot]) {
+            auto &entry = entries[slot];
+            if (entry.state == CacheState::FromIndex || (entry.state == CacheState::Valid && entry.info.used)) {
+                // index or cache claimed a file that no longer exists
+                _prefetchIndexDirty = true;
+            }
+            entry.info.used = false;
+            entry.info.name[0] = '\0';
+            entry.mtime = 0;
+            entry.state = CacheState::Valid;
+        }
     }
 }
 
-uint32_t FileManager::nextCachedSlotTicket() {
-    _cachedSlotInfoTicket = std::max(uint32_t(1), _cachedSlotInfoTicket + 1);
-    return _cachedSlotInfoTicket;
+void FileManager::prefetchReadHeaders(int typeIndex) {
+    auto &entries = _cachedSlotInfos[typeIndex];
+
+    // only read a few headers per call to not starve pending file tasks
+    int budget = 4;
+    while (_prefetchSlot < SlotCount && budget > 0) {
+        if (_taskPending) {
+            return;
+        }
+        auto &entry = entries[_prefetchSlot];
+        if (entry.state != CacheState::Valid) {
+            SlotInfo info;
+            readSlotInfo(FileType(typeIndex), _prefetchSlot, info);
+            cacheSlot(FileType(typeIndex), _prefetchSlot, info);
+            _prefetchIndexDirty = true;
+            --budget;
+        }
+        ++_prefetchSlot;
+    }
+}
+
+void FileManager::writeIndex(int typeIndex) {
+    const auto &entries = _cachedSlotInfos[typeIndex];
+
+    FixedStringBuilder<32> path;
+    indexPath(path, typeIndex);
+
+    fs::FileWriter fileWriter(path);
+    if (fileWriter.error() != fs::OK) {
+        return;
+    }
+
+    uint32_t magic = IndexFileMagic;
+    uint32_t version = IndexFileVersion;
+    uint32_t slotCount = SlotCount;
+    fileWriter.write(&magic, sizeof(magic));
+    fileWriter.write(&version, sizeof(version));
+    fileWriter.write(&slotCount, sizeof(slotCount));
+
+    for (const auto &entry : entries) {
+        IndexEntry indexEntry;
+        indexEntry.mtime = entry.info.used ? entry.mtime : 0;
+        std::memset(indexEntry.name, 0, sizeof(indexEntry.name));
+        if (entry.info.used) {
+            std::memcpy(indexEntry.name, entry.info.name, std::min(sizeof(indexEntry.name), std::strlen(entry.info.name)));
+        }
+        fileWriter.write(&indexEntry, sizeof(indexEntry));
+    }
+
+    fileWriter.finish();
 }
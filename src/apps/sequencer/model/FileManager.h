@@ -6,8 +6,9 @@
 
 #include "core/fs/FileSystem.h"
 
+#include "core/utils/FixedFunction.h"
+
 #include <array>
-#include <functional>
 
 #include <cstdint>
 
@@ -20,15 +21,22 @@ public:
 
     static fs::Error format();
 
-    static fs::Error saveProject(Project &project, int slot);
+    static fs::Error saveProject(Project &project, int slot, const Project::WriteGuard &guard = Project::WriteGuard());
     static fs::Error loadProject(Project &project, int slot);
     static fs::Error loadLastProject(Project &project);
 
+    static fs::Error autoSaveProject(Project &project);
+    static fs::Error loadAutoSavedProject(Project &project);
+    static bool autoSavedProjectExists();
+
     static fs::Error saveUserScale(const UserScale &userScale, int slot);
     static fs::Error loadUserScale(UserScale &userScale, int slot);
 
     // Slot information
 
+    static constexpr int FileTypeCount = 2;
+    static constexpr int SlotCount = 128;
+
     struct SlotInfo {
         bool used;
         char name[FileHeader::NameLength + 1];
@@ -37,17 +45,37 @@ public:
     static void slotInfo(FileType type, int slot, SlotInfo &info);
     static bool slotUsed(FileType type, int slot);
 
-    // File tasks
+    // Volume statistics
+    //
+    // The initial free space query can scan the whole FAT and take seconds
+    // on large cards, so it runs on the file task in the background after
+    // mounting. Once known, FatFs tracks the free cluster count on our own
+    // writes and refreshing the cache is cheap. Returns false while the
+    // scan has not completed yet, sizes are in kilobytes.
+
+    static bool volumeStats(size_t &total, size_t &free);
 
-    typedef std::function<fs::Error(void)> TaskExecuteCallback;
-    typedef std::function<void(fs::Error)> TaskResultCallback;
+    // File tasks
+    //
+    // Tasks are queued and executed on the file task in priority order, so a
+    // save does not get stuck behind queued low priority work. When the queue
+    // overflows, the oldest low priority task is superseded and completed
+    // with TIMEOUT.
+
+    typedef FixedFunction<fs::Error(void)> TaskExecuteCallback;
+    typedef FixedFunction<void(fs::Error)> TaskResultCallback;
+
+    enum class TaskPriority : uint8_t {
+        Low,
+        High,
+    };
 
-    static void task(TaskExecuteCallback executeCallback, TaskResultCallback resultCallback);
+    static void task(TaskExecuteCallback executeCallback, TaskResultCallback resultCallback, TaskPriority priority = TaskPriority::Low);
     static void processTask();
 
 private:
-    static fs::Error saveFile(FileType type, int slot, std::function<fs::Error(const char *)> write);
-    static fs::Error loadFile(FileType type, int slot, std::function<fs::Error(const char *)> read);
+    static fs::Error saveFile(FileType type, int slot, FixedFunction<fs::Error(const char *), 24> write);
+    static fs::Error loadFile(FileType type, int slot, FixedFunction<fs::Error(const char *)> read);
 
     static fs::Error saveLastProject(int slot);
     static fs::Error loadLastProject(int &slot);
@@ -56,17 +84,42 @@ private:
     static void cacheSlot(FileType type, int slot, const SlotInfo &info);
     static void invalidateSlot(FileType type, int slot);
     static void invalidateAllSlots();
-    static uint32_t nextCachedSlotTicket();
+
+    static void readSlotInfo(FileType type, int slot, SlotInfo &info);
+
+    // Slot information for every slot is cached in RAM. The cache is warmed
+    // by a background prefetch running on the file task right after the
+    // volume is mounted, so the file browser does not have to open files on
+    // first visit. To avoid reading every file header on each mount, slot
+    // names are persisted in an index file per directory and validated
+    // against the FAT modification times found when scanning the directory.
+
+    enum class CacheState : uint8_t {
+        Invalid,    // no information
+        FromIndex,  // name read from index file, not validated yet
+        Pending,    // file found in directory, header needs to be read
+        Valid,      // information is up-to-date
+    };
 
     struct CachedSlotInfo {
-        uint32_t ticket = 0;
-        FileType type;
-        uint8_t slot;
+        CacheState state;
+        uint32_t mtime;
         SlotInfo info;
+    };
+
+    static void updateVolumeStats();
 
-        bool operator < (const CachedSlotInfo &other) const {
-            return ticket < other.ticket;
-        }
+    static void startPrefetch();
+    static void processPrefetch();
+    static void prefetchScan(int typeIndex);
+    static void prefetchReadHeaders(int typeIndex);
+    static void writeIndex(int typeIndex);
+
+    enum class PrefetchState : uint8_t {
+        Idle,
+        Scan,           // read index file & scan directory
+        ReadHeaders,    // read headers of out-of-date slot files
+        WriteIndex,     // persist updated index file
     };
 
     enum VolumeState {
@@ -77,10 +130,30 @@ private:
     static uint32_t _volumeState;
     static uint32_t _nextVolumeStateCheckTicks;
 
-    static std::array<CachedSlotInfo, 4> _cachedSlotInfos;
-    static uint32_t _cachedSlotInfoTicket;
+    static size_t _volumeSizeTotal;
+    static size_t _volumeSizeFree;
+    static volatile bool _volumeStatsValid;
+
+    static std::array<std::array<CachedSlotInfo, SlotCount>, FileTypeCount> _cachedSlotInfos;
+
+    static PrefetchState _prefetchState;
+    static uint8_t _prefetchTypeIndex;
+    static uint8_t _prefetchSlot;
+    static bool _prefetchIndexDirty;
+
+    struct Task {
+        TaskExecuteCallback executeCallback;
+        TaskResultCallback resultCallback;
+        TaskPriority priority;
+        uint8_t seq;
+        bool pending;
+    };
+
+    static constexpr size_t TaskQueueSize = 4;
+
+    static bool takeTask(Task &task);
 
-    static TaskExecuteCallback _taskExecuteCallback;
-    static TaskResultCallback _taskResultCallback;
+    static std::array<Task, TaskQueueSize> _tasks;
+    static uint8_t _taskSequence;
     static volatile uint32_t _taskPending;
 };
@@ -4,6 +4,7 @@
 
 class FlashWriter {
 public:
+    // erase the given sector and write from address
     FlashWriter(uint32_t address, uint32_t sector) :
         _address(address)
     {
@@ -11,6 +12,13 @@ public:
         Flash::eraseSector(sector);
     }
 
+    // write from address into already erased flash
+    FlashWriter(uint32_t address) :
+        _address(address)
+    {
+        Flash::unlock();
+    }
+
     ~FlashWriter() {
         finish();
         Flash::lock();
@@ -0,0 +1,45 @@
+#include "Config.h"
+
+#include "MemoryMap.h"
+#include "Model.h"
+
+#include "core/Debug.h"
+
+static const MemoryMap::Entry entries[] = {
+    { "MODEL",      sizeof(Model),                  1 },
+    { "PROJECT",    sizeof(Project),                1 },
+    { "TRACK",      sizeof(Track),                  CONFIG_TRACK_COUNT },
+    { "NOTE TRK",   sizeof(NoteTrack),              1 },
+    { "CURVE TRK",  sizeof(CurveTrack),             1 },
+    { "MIDICV TRK", sizeof(MidiCvTrack),            1 },
+    { "NOTE SEQ",   sizeof(NoteSequence),           CONFIG_PATTERN_COUNT },
+    { "NOTE STEP",  sizeof(NoteSequence::Step),     CONFIG_STEP_COUNT },
+    { "CURVE SEQ",  sizeof(CurveSequence),          CONFIG_PATTERN_COUNT },
+    { "CURVE STEP", sizeof(CurveSequence::Step),    CONFIG_STEP_COUNT },
+    { "SONG",       sizeof(Song),                   1 },
+    { "PLAY STATE", sizeof(PlayState),              1 },
+    { "ROUTING",    sizeof(Routing),                1 },
+    { "SETTINGS",   sizeof(Settings),               1 },
+    { "USER SCALE", sizeof(UserScale),              CONFIG_USER_SCALE_COUNT },
+    { "CLIPBOARD",  sizeof(ClipBoard),              1 },
+};
+
+int MemoryMap::entryCount() {
+    return sizeof(entries) / sizeof(entries[0]);
+}
+
+const MemoryMap::Entry &MemoryMap::entry(int index) {
+    return entries[index];
+}
+
+void MemoryMap::dump() {
+    DBG("memory map:");
+    for (const auto &entry : entries) {
+        DBG("%-10s %6lu x %3u = %7lu bytes",
+            entry.name,
+            static_cast<unsigned long>(entry.unitSize),
+            entry.unitCount,
+            static_cast<unsigned long>(entry.totalSize())
+        );
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * Static memory accounting for the model.
+ *
+ * Firmware variants trade CONFIG_PATTERN_COUNT, CONFIG_STEP_COUNT and
+ * similar settings against the available SRAM. The table below exposes the
+ * size and instance count of each model component, so these tradeoffs can be
+ * judged from data on the system page or in the sim instead of digging
+ * through the map file. Nested components list their per-parent count, e.g.
+ * sequences per track and steps per sequence.
+ */
+class MemoryMap {
+public:
+    struct Entry {
+        const char *name;
+        uint32_t unitSize;      // size of a single instance in bytes
+        uint16_t unitCount;     // number of instances per parent component
+
+        uint32_t totalSize() const { return unitSize * unitCount; }
+    };
+
+    static int entryCount();
+    static const Entry &entry(int index);
+
+    // dump the table to the debug console
+    static void dump();
+};
@@ -0,0 +1,94 @@
+#include "Config.h"
+
+#include "MidiExport.h"
+
+#include "Project.h"
+#include "Scale.h"
+
+#include "core/math/Math.h"
+
+#include <algorithm>
+
+#include <cmath>
+
+// exported notes carry no dynamics, use a medium fixed velocity
+static constexpr uint8_t ExportVelocity = 100;
+
+static bool sequenceIsEmpty(const NoteSequence &sequence) {
+    for (int stepIndex = sequence.firstStep(); stepIndex <= sequence.lastStep(); ++stepIndex) {
+        if (sequence.step(stepIndex).gate()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint8_t midiNote(const Scale &scale, int rootNote, int note) {
+    if (scale.isChromatic()) {
+        note += rootNote;
+    }
+    // non-chromatic scales are mapped through their voltage on the 1V/Oct grid
+    return clamp(int(std::round(60.f + scale.noteToVolts(note) * 12.f)), 0, 127);
+}
+
+fs::Error MidiExport::exportNoteSequence(const Project &project, const NoteSequence &sequence, const char *path) {
+    MidiFileWriter writer(path, CONFIG_PPQN);
+    writer.beginTrack();
+    writer.writeTempo(0, project.tempo());
+    writeNoteSequence(writer, project, sequence, 0);
+    writer.endTrack();
+    return writer.finish();
+}
+
+fs::Error MidiExport::exportNoteTrack(const Project &project, const NoteTrack &track, const char *path) {
+    MidiFileWriter writer(path, CONFIG_PPQN);
+    writer.beginTrack();
+    writer.writeTempo(0, project.tempo());
+    uint32_t tick = 0;
+    for (int patternIndex = 0; patternIndex < CONFIG_PATTERN_COUNT; ++patternIndex) {
+        const auto &sequence = track.sequence(patternIndex);
+        if (sequenceIsEmpty(sequence)) {
+            continue;
+        }
+        tick = writeNoteSequence(writer, project, sequence, tick);
+    }
+    writer.endTrack();
+    return writer.finish();
+}
+
+uint32_t MidiExport::writeNoteSequence(MidiFileWriter &writer, const Project &project, const NoteSequence &sequence, uint32_t startTick) {
+    const auto &scale = sequence.selectedScale(project.scale());
+    int rootNote = sequence.selectedRootNote(project.rootNote());
+    uint32_t divisor = sequence.divisor() * (CONFIG_PPQN / CONFIG_SEQUENCE_PPQN);
+
+    // a step length never exceeds the divisor, so at most one note off is
+    // pending and events stay in tick order with a note off preceding a
+    // simultaneous note on
+    uint32_t pendingOffTick = 0;
+    uint8_t pendingOffNote = 0;
+    bool pendingOff = false;
+
+    uint32_t tick = startTick;
+    for (int stepIndex = sequence.firstStep(); stepIndex <= sequence.lastStep(); ++stepIndex, tick += divisor) {
+        const auto &step = sequence.step(stepIndex);
+        if (!step.gate()) {
+            continue;
+        }
+        if (pendingOff) {
+            writer.writeNoteOff(pendingOffTick, 0, pendingOffNote);
+            pendingOff = false;
+        }
+        uint8_t note = midiNote(scale, rootNote, step.note());
+        writer.writeNoteOn(tick, 0, note, ExportVelocity);
+        uint32_t length = (divisor * (step.length() + 1)) / NoteSequence::Length::Range;
+        pendingOffTick = tick + std::max(length, uint32_t(1));
+        pendingOffNote = note;
+        pendingOff = true;
+    }
+
+    if (pendingOff) {
+        writer.writeNoteOff(pendingOffTick, 0, pendingOffNote);
+    }
+
+    return tick;
+}
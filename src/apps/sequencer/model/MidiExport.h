@@ -0,0 +1,29 @@
+#pragma once
+
+#include "NoteSequence.h"
+#include "NoteTrack.h"
+
+#include "core/fs/FileSystem.h"
+#include "core/midi/MidiFileWriter.h"
+
+class Project;
+
+/**
+ * Standard midi file export of note sequences.
+ *
+ * Exports stream through the write-behind cache of the file writer, so they
+ * run with fixed size buffers no matter how many patterns are exported. They
+ * are meant to be queued on the file task like project saves, playback keeps
+ * running while the file is written.
+ */
+class MidiExport {
+public:
+    // export a single sequence
+    static fs::Error exportNoteSequence(const Project &project, const NoteSequence &sequence, const char *path);
+
+    // export all non-empty patterns of a track, laid out back to back
+    static fs::Error exportNoteTrack(const Project &project, const NoteTrack &track, const char *path);
+
+private:
+    static uint32_t writeNoteSequence(MidiFileWriter &writer, const Project &project, const NoteSequence &sequence, uint32_t startTick);
+};
@@ -1,11 +1,14 @@
 #pragma once
 
 #include "core/math/Math.h"
+#include "core/utils/BitSet.h"
 #include "core/utils/StringBuilder.h"
 
 #include <array>
 #include <algorithm>
-#include <bitset>
+#include <type_traits>
+
+#include <cstring>
 
 namespace ModelUtils {
 
@@ -37,42 +40,68 @@ static int clampDivisor(int divisor) {
     return clamp(divisor, 1, 768);
 }
 
+// the bulk step operations below move the packed step storage directly
+// instead of going through the step accessors, steps have to be trivially
+// copyable for this to be valid
+
 template<typename Step, size_t N>
 static void shiftSteps(std::array<Step, N> &steps, int direction) {
+    static_assert(std::is_trivially_copyable<Step>::value, "Step must be trivially copyable");
     if (direction == 1) {
-        for (int i = int(steps.size()) - 2; i >= 0; --i) {
-            std::swap(steps[i], steps[i + 1]);
-        }
+        Step last = steps[N - 1];
+        std::memmove(&steps[1], &steps[0], (N - 1) * sizeof(Step));
+        steps[0] = last;
     } else if (direction == -1) {
-        for (int i = 0; i < int(steps.size()) - 1; ++i) {
-            std::swap(steps[i], steps[i + 1]);
-        }
+        Step first = steps[0];
+        std::memmove(&steps[0], &steps[1], (N - 1) * sizeof(Step));
+        steps[N - 1] = first;
     }
 }
 
 template<typename Step, size_t N>
 static void duplicateSteps(std::array<Step, N> &steps, int firstStep, int lastStep) {
-    for (int src = firstStep; src <= lastStep; ++src) {
-        int dst = src + (lastStep - firstStep + 1);
-        if (dst < int(steps.size())) {
-            steps[dst] = steps[src];
-        }
+    static_assert(std::is_trivially_copyable<Step>::value, "Step must be trivially copyable");
+    int count = std::min(lastStep - firstStep + 1, int(N) - (lastStep + 1));
+    if (count > 0) {
+        // source and destination ranges cannot overlap
+        std::memcpy(&steps[lastStep + 1], &steps[firstStep], count * sizeof(Step));
     }
 }
 
+template<typename Step, size_t N>
+static void copyRange(const std::array<Step, N> &src, std::array<Step, N> &dst, int firstStep, int lastStep) {
+    static_assert(std::is_trivially_copyable<Step>::value, "Step must be trivially copyable");
+    int count = lastStep - firstStep + 1;
+    if (count > 0) {
+        std::memcpy(&dst[firstStep], &src[firstStep], count * sizeof(Step));
+    }
+}
+
+template<typename Step, size_t N>
+static void clearRange(std::array<Step, N> &steps, int firstStep, int lastStep) {
+    Step cleared;
+    cleared.clear();
+    std::fill(&steps[firstStep], &steps[lastStep] + 1, cleared);
+}
+
 template<typename Step, size_t N>
 static void copySteps(
-    const std::array<Step, N> &src, const std::bitset<N> &srcSelected,
-    std::array<Step, N> &dst, const std::bitset<N> &dstSelected
+    const std::array<Step, N> &src, const BitSet<N> &srcSelected,
+    std::array<Step, N> &dst, const BitSet<N> &dstSelected
 ) {
-    auto nextSelected = [] (const std::bitset<N> &selected, int index) {
+    static_assert(std::is_trivially_copyable<Step>::value, "Step must be trivially copyable");
+
+    // common case: no selection on either side -> bulk copy the whole array
+    if (srcSelected.none() && dstSelected.none()) {
+        std::memcpy(dst.data(), src.data(), sizeof(Step) * N);
+        return;
+    }
+
+    auto nextSelected = [] (const BitSet<N> &selected, int index) {
         if (selected.none()) {
             return (index + 1) % int(N);
         } else {
-            do {
-                index = (index + 1) % int(N);
-            } while (!selected[index]);
-            return index;
+            return selected.nextSetBit(index);
         }
     };
 
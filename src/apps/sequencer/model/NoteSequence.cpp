@@ -117,21 +117,20 @@ void NoteSequence::Step::setLayerValue(Layer layer, int value) {
 }
 
 void NoteSequence::Step::clear() {
-    _data0.raw = 0;
-    _data1.raw = 1;
-    setGate(false);
-    setGateProbability(GateProbability::Max);
-    setGateOffset(0);
-    setSlide(false);
-    setRetrigger(0);
-    setRetriggerProbability(RetriggerProbability::Max);
-    setLength(Length::Max / 2);
-    setLengthVariationRange(0);
-    setLengthVariationProbability(LengthVariationProbability::Max);
-    setNote(0);
-    setNoteVariationRange(0);
-    setNoteVariationProbability(NoteVariationProbability::Max);
-    setCondition(Types::Condition::Off);
+    // default values are packed into whole words at compile time and written
+    // with a single store per word instead of a read-modify-write per field
+    _data0.raw =
+        decltype(_data0.gateProbability)::pack(GateProbability::Max) |
+        decltype(_data0.length)::pack(Length::Max / 2) |
+        decltype(_data0.lengthVariationRange)::pack(-LengthVariationRange::Min) |
+        decltype(_data0.lengthVariationProbability)::pack(LengthVariationProbability::Max) |
+        decltype(_data0.note)::pack(-Note::Min) |
+        decltype(_data0.noteVariationRange)::pack(-NoteVariationRange::Min) |
+        decltype(_data0.noteVariationProbability)::pack(NoteVariationProbability::Max);
+    _data1.raw =
+        decltype(_data1.retriggerProbability)::pack(RetriggerProbability::Max) |
+        decltype(_data1.gateOffset)::pack(-GateOffset::Min) |
+        decltype(_data1.condition)::pack(int(Types::Condition::Off));
 }
 
 void NoteSequence::Step::write(WriteContext &context) const {
@@ -14,6 +14,7 @@
 #include <array>
 #include <cstdint>
 #include <initializer_list>
+#include <type_traits>
 
 class NoteSequence {
 public:
@@ -219,6 +220,15 @@ public:
         } _data1;
     };
 
+    // step storage is moved around with memcpy/memmove in bulk operations
+    static_assert(std::is_trivially_copyable<Step>::value, "Step must be trivially copyable");
+
+    // Steps are deliberately kept as one array of packed structs. Splitting
+    // the layers into separate planes (structure-of-arrays) was evaluated
+    // for the engine's field-sparse tick reads, but the Cortex-M4 has
+    // single-cycle SRAM and no data cache, so the layout does not change
+    // access cost, while the Step reference accessors and the trivially
+    // copyable bulk operations rely on the array form.
     typedef std::array<Step, CONFIG_STEP_COUNT> StepArray;
 
     //----------------------------------------
@@ -35,6 +35,7 @@ void NoteTrack::writeRouted(Routing::Target target, int intValue, float floatVal
 void NoteTrack::clear() {
     setPlayMode(Types::PlayMode::Aligned);
     setFillMode(FillMode::Gates);
+    setExtendedSteps(false);
     setCvUpdateMode(CvUpdateMode::Gate);
     setSlideTime(50);
     setOctave(0);
@@ -45,6 +46,8 @@ void NoteTrack::clear() {
     setLengthBias(0);
     setNoteProbabilityBias(0);
 
+    endSnapshot();
+
     for (auto &sequence : _sequences) {
         sequence.clear();
     }
@@ -54,6 +57,7 @@ void NoteTrack::write(WriteContext &context) const {
     auto writer = context.writer;
     writer.write(_playMode);
     writer.write(_fillMode);
+    writer.write(_extendedSteps);
     writer.write(_cvUpdateMode);
     writer.write(_slideTime.base);
     writer.write(_octave.base);
@@ -70,6 +74,7 @@ void NoteTrack::read(ReadContext &context) {
     auto reader = context.reader;
     reader.read(_playMode);
     reader.read(_fillMode);
+    reader.read(_extendedSteps, ProjectVersion::Version23);
     reader.read(_cvUpdateMode, ProjectVersion::Version4);
     reader.read(_slideTime.base);
     reader.read(_octave.base);
@@ -86,6 +86,26 @@ public:
         str(fillModeName(fillMode()));
     }
 
+    // extendedSteps
+
+    // chains each pattern with the next one into a 128 step sequence, the
+    // second page plays the partner pattern's steps using this pattern's
+    // divisor, run mode and step range, so no extra step storage is needed.
+    // random run modes do not advance the iteration and stay on the first
+    // page.
+    bool extendedSteps() const { return _extendedSteps; }
+    void setExtendedSteps(bool extendedSteps) {
+        _extendedSteps = extendedSteps;
+    }
+
+    void editExtendedSteps(int value, bool shift) {
+        setExtendedSteps(value > 0);
+    }
+
+    void printExtendedSteps(StringBuilder &str) const {
+        ModelUtils::printYesNo(str, extendedSteps());
+    }
+
     // cvUpdateMode
 
     CvUpdateMode cvUpdateMode() const { return _cvUpdateMode; }
@@ -251,7 +271,42 @@ public:
           NoteSequenceArray &sequences()       { return _sequences; }
 
     const NoteSequence &sequence(int index) const { return _sequences[index]; }
-          NoteSequence &sequence(int index)       { return _sequences[index]; }
+          NoteSequence &sequence(int index)       {
+              // an armed snapshot backs up the pattern right before its
+              // first edit, so unedited tracks never pay for the copy
+              if (int8_t(index) == _snapshotSource && !_snapshotCopied) {
+                  _sequences[SnapshotIndex] = _sequences[index];
+                  _snapshotCopied = true;
+              }
+              return _sequences[index];
+          }
+
+    //----------------------------------------
+    // Snapshot
+    //----------------------------------------
+
+    // Arms the snapshot slot as a lazy backup of the given pattern. No data
+    // is copied here, the non-const sequence() accessor copies the pattern
+    // into the slot before the first edit.
+    void startSnapshot(int pattern) {
+        _snapshotSource = pattern;
+        _snapshotCopied = false;
+    }
+
+    // Restores the pattern from the backup if it was edited since
+    // startSnapshot() and disarms the snapshot.
+    void revertSnapshot() {
+        if (_snapshotCopied) {
+            _sequences[_snapshotSource] = _sequences[SnapshotIndex];
+        }
+        endSnapshot();
+    }
+
+    // Disarms the snapshot, keeping the edits in place.
+    void endSnapshot() {
+        _snapshotSource = -1;
+        _snapshotCopied = false;
+    }
 
     //----------------------------------------
     // Routing
@@ -273,6 +328,8 @@ public:
     void read(ReadContext &context);
 
 private:
+    static constexpr int SnapshotIndex = CONFIG_PATTERN_COUNT;
+
     void setTrackIndex(int trackIndex) {
         _trackIndex = trackIndex;
         for (auto &sequence : _sequences) {
@@ -283,6 +340,7 @@ private:
     int8_t _trackIndex = -1;
     Types::PlayMode _playMode;
     FillMode _fillMode;
+    bool _extendedSteps;
     CvUpdateMode _cvUpdateMode;
     Routable<uint8_t> _slideTime;
     Routable<int8_t> _octave;
@@ -295,5 +353,8 @@ private:
 
     NoteSequenceArray _sequences;
 
+    int8_t _snapshotSource = -1;
+    bool _snapshotCopied = false;
+
     friend class Track;
 };
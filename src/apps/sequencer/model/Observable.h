@@ -33,3 +33,33 @@ private:
     std::array<Observer, MaxObservers> _observers;
     size_t _observerCount = 0;
 };
+
+// Deferred variant. Notifications are aggregated into per-event dirty bits
+// and handlers only run when flush() is called, so bulk edits (e.g. from a
+// Launchpad) trigger each handler at most once per flush instead of once per
+// change. Requires Event to be an enum with values below 32.
+template<typename Event, size_t MaxObservers>
+class DeferredObservable : private Observable<Event, MaxObservers> {
+public:
+    using Observable<Event, MaxObservers>::watch;
+
+    void notify(Event event) {
+        _pendingEvents |= 1u << int(event);
+    }
+
+    // returns true if any notifications were delivered
+    bool flush() {
+        uint32_t pendingEvents = _pendingEvents;
+        _pendingEvents = 0;
+        bool pending = pendingEvents != 0;
+        for (int event = 0; pendingEvents != 0; ++event, pendingEvents >>= 1) {
+            if (pendingEvents & 1) {
+                Observable<Event, MaxObservers>::notify(Event(event));
+            }
+        }
+        return pending;
+    }
+
+private:
+    uint32_t _pendingEvents = 0;
+};
@@ -47,6 +47,7 @@ void PlayState::muteTrack(int track, ExecuteType executeType) {
     auto &trackState = _trackStates[track];
     trackState.setRequests(TrackState::muteRequestFromExecuteType(executeType));
     trackState.setRequestedMute(true);
+    updateAggregateMasks();
     notify(executeType);
 }
 
@@ -54,6 +55,7 @@ void PlayState::unmuteTrack(int track, ExecuteType executeType) {
     auto &trackState = _trackStates[track];
     trackState.setRequests(TrackState::muteRequestFromExecuteType(executeType));
     trackState.setRequestedMute(false);
+    updateAggregateMasks();
     notify(executeType);
 }
 
@@ -87,29 +89,30 @@ void PlayState::toggleMuteTrack(int track, ExecuteType executeType) {
 }
 
 void PlayState::muteAll(ExecuteType executeType) {
-    for (int track = 0; track < CONFIG_TRACK_COUNT; ++track) {
-        muteTrack(track, executeType);
-    }
+    setMuteMask(0xff, executeType);
 }
 
 void PlayState::unmuteAll(ExecuteType executeType) {
+    setMuteMask(0, executeType);
+}
+
+void PlayState::setMuteMask(uint8_t mask, ExecuteType executeType) {
     for (int track = 0; track < CONFIG_TRACK_COUNT; ++track) {
-        unmuteTrack(track, executeType);
+        auto &trackState = _trackStates[track];
+        trackState.setRequests(TrackState::muteRequestFromExecuteType(executeType));
+        trackState.setRequestedMute(mask & (1 << track));
     }
+    updateAggregateMasks();
+    notify(executeType);
 }
 
 void PlayState::soloTrack(int track, ExecuteType executeType) {
-    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
-        if (track == trackIndex) {
-            unmuteTrack(trackIndex, executeType);
-        } else {
-            muteTrack(trackIndex, executeType);
-        }
-    }
+    setMuteMask(~(1 << track), executeType);
 }
 
 void PlayState::fillTrack(int track, bool fill, bool hold) {
     _trackStates[track].setFill(fill, hold);
+    updateAggregateMasks();
     notify(Immediate);
 }
 
@@ -149,11 +152,13 @@ void PlayState::createSnapshot() {
 
     cancelPatternRequests();
 
+    // taking a snapshot is O(1), no data is copied and playback stays on the
+    // current patterns, each track backs up its pattern into the snapshot
+    // slot right before the first edit
     for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
         int trackPatternIndex = trackState(trackIndex).pattern();
         _snapshot.lastTrackPatternIndex[trackIndex] = trackPatternIndex;
-        _project.track(trackIndex).copyPattern(trackPatternIndex, SnapshotPatternIndex);
-        selectTrackPattern(trackIndex, SnapshotPatternIndex);
+        _project.track(trackIndex).startSnapshot(trackPatternIndex);
     }
 
     _snapshot.lastSelectedPatternIndex = _project.selectedPatternIndex();
@@ -165,11 +170,18 @@ void PlayState::revertSnapshot(int targetPattern) {
         return;
     }
 
+    // restore the backups of the tracks that were edited, unedited tracks
+    // have nothing to undo and keep playing without interruption
     for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
-        selectTrackPatternUnsafe(trackIndex, targetPattern >= 0 ? targetPattern : _snapshot.lastTrackPatternIndex[trackIndex]);
+        _project.track(trackIndex).revertSnapshot();
+        if (targetPattern >= 0) {
+            selectTrackPatternUnsafe(trackIndex, targetPattern);
+        }
     }
 
-    _project.setSelectedPatternIndex(targetPattern >= 0 ? targetPattern : _snapshot.lastSelectedPatternIndex);
+    if (targetPattern >= 0) {
+        _project.setSelectedPatternIndex(targetPattern);
+    }
 
     _snapshot.active = false;
 }
@@ -180,9 +192,17 @@ void PlayState::commitSnapshot(int targetPattern) {
     }
 
     for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
-        int trackPatternIndex = targetPattern >= 0 ? targetPattern : _snapshot.lastTrackPatternIndex[trackIndex];
-        _project.track(trackIndex).copyPattern(SnapshotPatternIndex, trackPatternIndex);
-        selectTrackPatternUnsafe(trackIndex, trackPatternIndex);
+        auto &track = _project.track(trackIndex);
+        int sourcePattern = _snapshot.lastTrackPatternIndex[trackIndex];
+        if (targetPattern >= 0 && targetPattern != sourcePattern) {
+            // move the edited pattern to the target and restore the source
+            track.copyPattern(sourcePattern, targetPattern);
+            track.revertSnapshot();
+            selectTrackPatternUnsafe(trackIndex, targetPattern);
+        } else {
+            // the edits already live in the pattern itself
+            track.endSnapshot();
+        }
     }
 
     _project.setSelectedPatternIndex(targetPattern >= 0 ? targetPattern : _snapshot.lastSelectedPatternIndex);
@@ -199,6 +219,8 @@ void PlayState::cancelMuteRequests() {
 }
 
 void PlayState::cancelPatternRequests() {
+    clearPatternRequestTracks();
+
     for (int track = 0; track < CONFIG_TRACK_COUNT; ++track) {
         auto &trackState = _trackStates[track];
         trackState.clearRequests(TrackState::PatternRequests);
@@ -229,12 +251,32 @@ void PlayState::clear() {
 
     _songState.clear();
 
+    _requestedPatterns = 0;
+    clearPatternRequestTracks();
+
     _executeLatchedRequests = false;
     _hasImmediateRequests = false;
     _hasSyncedRequests = false;
     _hasLatchedRequests = false;
 
     _snapshot.active = false;
+
+    updateAggregateMasks();
+}
+
+void PlayState::updateAggregateMasks() {
+    uint8_t muteMask = 0;
+    uint8_t requestedMuteMask = 0;
+    uint8_t fillMask = 0;
+    for (int track = 0; track < CONFIG_TRACK_COUNT; ++track) {
+        const auto &trackState = _trackStates[track];
+        muteMask |= trackState.mute() ? (1 << track) : 0;
+        requestedMuteMask |= trackState.requestedMute() ? (1 << track) : 0;
+        fillMask |= trackState.fill() ? (1 << track) : 0;
+    }
+    _muteMask = muteMask;
+    _requestedMuteMask = requestedMuteMask;
+    _fillMask = fillMask;
 }
 
 void PlayState::write(WriteContext &context) const {
@@ -243,6 +285,20 @@ void PlayState::write(WriteContext &context) const {
 
 void PlayState::read(ReadContext &context) {
     readArray(context, _trackStates);
+
+    // rebuild the packed pattern request state from the track states
+    _requestedPatterns = 0;
+    clearPatternRequestTracks();
+    for (int track = 0; track < CONFIG_TRACK_COUNT; ++track) {
+        const auto &trackState = _trackStates[track];
+        _requestedPatterns |= uint64_t(trackState.requestedPattern()) << (track << 3);
+        if (trackState.hasPatternRequest()) {
+            _patternRequestTracks[Immediate] |= 1 << track;
+        }
+    }
+
+    updateAggregateMasks();
+
     notify(Immediate);
 }
 
@@ -250,6 +306,7 @@ void PlayState::selectTrackPatternUnsafe(int track, int pattern, ExecuteType exe
     auto &trackState = _trackStates[track];
     trackState.setRequests(TrackState::patternRequestFromExecuteType(executeType));
     trackState.setRequestedPattern(pattern);
+    setRequestedPatternUnsafe(track, pattern, executeType);
     notify(executeType);
 }
 
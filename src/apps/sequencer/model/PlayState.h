@@ -254,6 +254,14 @@ public:
     const SongState &songState() const { return _songState; }
           SongState &songState()       { return _songState; }
 
+    // aggregate masks, one bit per track, mirrored from the track states so
+    // group-wide mute/solo/fill checks are single AND operations instead of
+    // per-track queries
+
+    uint8_t muteMask() const { return _muteMask; }
+    uint8_t requestedMuteMask() const { return _requestedMuteMask; }
+    uint8_t fillMask() const { return _fillMask; }
+
     //----------------------------------------
     // Methods
     //----------------------------------------
@@ -269,6 +277,10 @@ public:
     void muteAll(ExecuteType executeType = Immediate);
     void unmuteAll(ExecuteType executeType = Immediate);
 
+    // requests a complete mute scene at once, bit per track, applied to all
+    // tracks from one consistent snapshot
+    void setMuteMask(uint8_t mask, ExecuteType executeType = Immediate);
+
     // solos
 
     void soloTrack(int track, ExecuteType executeType = Immediate);
@@ -284,6 +296,11 @@ public:
     void selectPattern(int pattern, ExecuteType executeType = Immediate);
 
     // snapshots
+    //
+    // Taking a snapshot is O(1): playback stays on the current patterns and
+    // each track lazily backs up its pattern into the snapshot slot right
+    // before the first edit. Reverting restores the backups of the edited
+    // tracks only, committing simply drops them.
 
     void createSnapshot();
     void revertSnapshot(int targetPattern = -1);
@@ -319,6 +336,43 @@ public:
 private:
     void selectTrackPatternUnsafe(int track, int pattern, ExecuteType executeType = Immediate);
 
+    // Pattern requests are double-buffered: in addition to the per-track
+    // request state (kept for UI feedback), requested patterns are packed
+    // into a single word (8 bits per track, byte aligned for cheap shifts)
+    // together with per execute type track masks. The
+    // engine exchanges the whole pending pattern state at the sync boundary
+    // instead of inspecting each track's request flags.
+
+    uint64_t requestedPatterns() const { return _requestedPatterns; }
+
+    void setRequestedPatternUnsafe(int track, int pattern, ExecuteType executeType) {
+        _requestedPatterns = (_requestedPatterns & ~(uint64_t(0xff) << (track << 3))) | (uint64_t(pattern & 0xff) << (track << 3));
+        _patternRequestTracks[executeType] |= 1 << track;
+    }
+
+    // consume pending pattern requests for the given execute types, returns
+    // the mask of tracks to switch
+    uint8_t takePatternRequests(bool immediate, bool synced, bool latched) {
+        uint8_t tracks = 0;
+        if (immediate) {
+            tracks |= _patternRequestTracks[Immediate];
+            _patternRequestTracks[Immediate] = 0;
+        }
+        if (synced) {
+            tracks |= _patternRequestTracks[Synced];
+            _patternRequestTracks[Synced] = 0;
+        }
+        if (latched) {
+            tracks |= _patternRequestTracks[Latched];
+            _patternRequestTracks[Latched] = 0;
+        }
+        return tracks;
+    }
+
+    void clearPatternRequestTracks() {
+        _patternRequestTracks.fill(0);
+    }
+
     void notify(ExecuteType executeType) {
         _hasImmediateRequests |= (executeType == Immediate);
         _hasSyncedRequests |= (executeType == Synced);
@@ -331,18 +385,27 @@ private:
     void clearSyncedRequests() { _hasSyncedRequests = false; }
     void clearLatchedRequests() { _hasLatchedRequests = false; _executeLatchedRequests = false; }
 
+    void updateAggregateMasks();
+
+    static_assert(CONFIG_TRACK_COUNT <= 8, "aggregate masks hold one bit per track");
+
     Project &_project;
 
     std::array<TrackState, CONFIG_TRACK_COUNT> _trackStates;
     SongState _songState;
 
+    uint8_t _muteMask;
+    uint8_t _requestedMuteMask;
+    uint8_t _fillMask;
+
+    uint64_t _requestedPatterns;
+    std::array<uint8_t, 3> _patternRequestTracks;
+
     bool _executeLatchedRequests;
     bool _hasImmediateRequests;
     bool _hasSyncedRequests;
     bool _hasLatchedRequests;
 
-    static constexpr int SnapshotPatternIndex = CONFIG_PATTERN_COUNT;
-
     struct {
         bool active;
         uint8_t lastSelectedPatternIndex;
@@ -1,8 +1,16 @@
 #include "Project.h"
 #include "ProjectVersion.h"
 
+#include "core/Debug.h"
 #include "core/fs/FileWriter.h"
 #include "core/fs/FileReader.h"
+#include "core/hash/FnvHash.h"
+#include "core/io/RleReader.h"
+#include "core/io/RleWriter.h"
+
+#include <bitset>
+
+#include <cstring>
 
 Project::Project() :
     _playState(*this),
@@ -40,6 +48,7 @@ void Project::clear() {
     setRecordMode(Types::RecordMode::Overdub);
     setCvGateInput(Types::CvGateInput::Off);
     setCurveCvInput(Types::CurveCvInput::Off);
+    setMidiThru(Types::MidiThru::Off);
 
     _clockSetup.clear();
 
@@ -64,6 +73,8 @@ void Project::clear() {
     setSelectedTrackIndex(0);
     setSelectedPatternIndex(0);
 
+    _autoSaveValid = false;
+
     // load demo project on simulator
 #if PLATFORM_SIM
     noteSequence(0, 0).setLastStep(15);
@@ -100,6 +111,35 @@ void Project::setTrackMode(int trackIndex, Track::TrackMode trackMode) {
 }
 
 void Project::write(WriteContext &context) const {
+    writeSettings(context);
+
+    writeArray(context, _tracks);
+
+    writeGlobals(context);
+
+    context.writer.writeHash();
+}
+
+bool Project::read(ReadContext &context) {
+    clear();
+
+    readSettings(context);
+
+    readArray(context, _tracks);
+
+    readGlobals(context);
+
+    bool success = context.reader.checkHash();
+    if (success) {
+        _observable.notify(ProjectRead);
+    } else {
+        clear();
+    }
+
+    return success;
+}
+
+void Project::writeSettings(WriteContext &context) const {
     auto &writer = context.writer;
     writer.write(_name, NameLength + 1);
     writer.write(_tempo.base);
@@ -111,29 +151,12 @@ void Project::write(WriteContext &context) const {
     writer.write(_recordMode);
     writer.write(_cvGateInput);
     writer.write(_curveCvInput);
+    writer.write(_midiThru);
 
     _clockSetup.write(context);
-
-    writeArray(context, _tracks);
-    writeArray(context, _cvOutputTracks);
-    writeArray(context, _gateOutputTracks);
-
-    _song.write(context);
-    _playState.write(context);
-    _routing.write(context);
-    _midiOutput.write(context);
-
-    writeArray(context, UserScale::userScales);
-
-    writer.write(_selectedTrackIndex);
-    writer.write(_selectedPatternIndex);
-
-    writer.writeHash();
 }
 
-bool Project::read(ReadContext &context) {
-    clear();
-
+void Project::readSettings(ReadContext &context) {
     auto &reader = context.reader;
     reader.read(_name, NameLength + 1, ProjectVersion::Version5);
     reader.read(_tempo.base);
@@ -147,10 +170,29 @@ bool Project::read(ReadContext &context) {
     reader.read(_recordMode);
     reader.read(_cvGateInput, ProjectVersion::Version6);
     reader.read(_curveCvInput, ProjectVersion::Version11);
+    reader.read(_midiThru, ProjectVersion::Version26);
 
     _clockSetup.read(context);
+}
 
-    readArray(context, _tracks);
+void Project::writeGlobals(WriteContext &context) const {
+    auto &writer = context.writer;
+    writeArray(context, _cvOutputTracks);
+    writeArray(context, _gateOutputTracks);
+
+    _song.write(context);
+    _playState.write(context);
+    _routing.write(context);
+    _midiOutput.write(context);
+
+    writeArray(context, UserScale::userScales);
+
+    writer.write(_selectedTrackIndex);
+    writer.write(_selectedPatternIndex);
+}
+
+void Project::readGlobals(ReadContext &context) {
+    auto &reader = context.reader;
     readArray(context, _cvOutputTracks);
     readArray(context, _gateOutputTracks);
 
@@ -165,33 +207,122 @@ bool Project::read(ReadContext &context) {
 
     reader.read(_selectedTrackIndex);
     reader.read(_selectedPatternIndex);
+}
 
-    bool success = reader.checkHash();
-    if (success) {
-        _observable.notify(ProjectRead);
+void Project::writeSection(WriteContext &context, int section) const {
+    if (section < CONFIG_TRACK_COUNT) {
+        _tracks[section].write(context);
+    } else if (section == GlobalsSection) {
+        writeGlobals(context);
     } else {
-        clear();
+        writeSettings(context);
     }
+}
 
-    return success;
+void Project::readSection(ReadContext &context, int section) {
+    if (section < CONFIG_TRACK_COUNT) {
+        _tracks[section].read(context);
+    } else if (section == GlobalsSection) {
+        readGlobals(context);
+    } else {
+        readSettings(context);
+    }
 }
 
-fs::Error Project::write(const char *path) const {
+uint32_t Project::sectionHash(int section) const {
+    FnvHash hash;
+    VersionedSerializedWriter writer(
+        [&hash] (const void *data, size_t len) { hash(data, len); },
+        ProjectVersion::Latest
+    );
+    WriteContext context = { writer };
+    writeSection(context, section);
+    return hash.result();
+}
+
+// table of contents entry of a sectioned project file
+struct SectionTocEntry {
+    uint32_t offset;
+    uint32_t length;
+} __attribute__((packed));
+
+// bounce buffer for a single serialized section, a section is snapshotted
+// into memory under the write guard and streamed to the card with the guard
+// released, the largest section (a note track) serializes to well below this
+static constexpr size_t SectionBufferSize = 12 * 1024;
+static uint8_t sectionBuffer[SectionBufferSize];
+
+fs::Error Project::write(const char *path, const WriteGuard &guard) const {
     fs::FileWriter fileWriter(path);
     if (fileWriter.error() != fs::OK) {
         return fileWriter.error();
     }
 
-    FileHeader header(FileType::Project, 0, _name);
+    FileHeader header(FileType::Project, FileVersion, _name);
     fileWriter.write(&header, sizeof(header));
 
-    VersionedSerializedWriter writer(
-        [&fileWriter] (const void *data, size_t len) { fileWriter.write(data, len); },
-        ProjectVersion::Latest
-    );
+    // the table of contents is filled in as sections are written and stored
+    // once all lengths are known, sections are individually versioned and
+    // hashed so they can be read independently
+    SectionTocEntry toc[SectionCount];
+    fileWriter.write(toc, sizeof(toc));
+
+    uint32_t offset = sizeof(FileHeader) + sizeof(toc);
+    for (int section = 0; section < SectionCount; ++section) {
+        // snapshot the section into memory, a single pass gives a consistent
+        // length and content even while the model keeps changing outside the
+        // guarded regions
+        uint32_t length = 0;
+        if (guard) {
+            guard(true);
+        }
+        VersionedSerializedWriter writer(
+            [&length] (const void *data, size_t len) {
+                if (length + len <= SectionBufferSize) {
+                    std::memcpy(&sectionBuffer[length], data, len);
+                }
+                length += len;
+            },
+            ProjectVersion::Latest
+        );
+        WriteContext context = { writer };
+        writeSection(context, section);
+        writer.writeHash();
+        if (guard) {
+            guard(false);
+        }
+
+        // compress the section on its way to the card, step data is highly
+        // repetitive and typically shrinks several-fold, cutting the transfer
+        // time accordingly. the hash is computed over the uncompressed stream
+        uint32_t compressedLength = 0;
+        RleWriter rleWriter([&fileWriter, &compressedLength] (const void *data, size_t len) {
+            fileWriter.write(data, len);
+            compressedLength += len;
+        });
+
+        if (length <= SectionBufferSize) {
+            rleWriter.write(sectionBuffer, length);
+        } else {
+            // section exceeds the snapshot buffer, stream it directly
+            ASSERT(false, "section exceeds snapshot buffer");
+            VersionedSerializedWriter streamWriter(
+                [&rleWriter] (const void *data, size_t len) { rleWriter.write(data, len); },
+                ProjectVersion::Latest
+            );
+            WriteContext streamContext = { streamWriter };
+            writeSection(streamContext, section);
+            streamWriter.writeHash();
+        }
+        rleWriter.finish();
+
+        toc[section].offset = offset;
+        toc[section].length = compressedLength;
+        offset += compressedLength;
+    }
 
-    WriteContext context = { writer };
-    write(context);
+    fileWriter.seek(sizeof(FileHeader));
+    fileWriter.write(toc, sizeof(toc));
 
     return fileWriter.finish();
 }
@@ -205,13 +336,49 @@ fs::Error Project::read(const char *path) {
     FileHeader header;
     fileReader.read(&header, sizeof(header));
 
-    VersionedSerializedReader reader(
-        [&fileReader] (void *data, size_t len) { fileReader.read(data, len); },
-        ProjectVersion::Latest
-    );
+    bool success;
 
-    ReadContext context = { reader };
-    bool success = read(context);
+    if (header.version == 0) {
+        // legacy flat stream
+        VersionedSerializedReader reader(
+            [&fileReader] (void *data, size_t len) { fileReader.read(data, len); },
+            ProjectVersion::Latest
+        );
+
+        ReadContext context = { reader };
+        success = read(context);
+    } else {
+        // sectioned container, sections are stored back to back in section
+        // order, so a full load streams them without seeking
+        SectionTocEntry toc[SectionCount];
+        fileReader.read(toc, sizeof(toc));
+
+        clear();
+
+        success = true;
+        for (int section = 0; section < SectionCount && success; ++section) {
+            // sections are individually rle compressed since file version 2,
+            // the decoder state is reset per section
+            RleReader rleReader([&fileReader] (void *data, size_t len) { fileReader.read(data, len); });
+
+            VersionedSerializedReader reader(
+                header.version >= 2 ?
+                    VersionedSerializedReader::Reader([&rleReader] (void *data, size_t len) { rleReader.read(data, len); }) :
+                    VersionedSerializedReader::Reader([&fileReader] (void *data, size_t len) { fileReader.read(data, len); }),
+                ProjectVersion::Latest
+            );
+
+            ReadContext context = { reader };
+            readSection(context, section);
+            success = reader.checkHash();
+        }
+
+        if (success) {
+            _observable.notify(ProjectRead);
+        } else {
+            clear();
+        }
+    }
 
     // TODO at some point we should remove this because name is also stored with data as of version 5
     if (success) {
@@ -225,3 +392,165 @@ fs::Error Project::read(const char *path) {
 
     return error;
 }
+
+fs::Error Project::readTrack(const char *path, int trackIndex, int targetTrackIndex) {
+    fs::File file(path, fs::File::Read, true);
+
+    FileHeader header;
+    size_t lenRead;
+    auto error = file.read(&header, sizeof(header), &lenRead);
+    if (error != fs::OK) {
+        return error;
+    }
+    if (lenRead != sizeof(header) || header.type != FileType::Project || header.version < 1) {
+        return fs::INVALID_CHECKSUM;
+    }
+
+    SectionTocEntry toc[SectionCount];
+    error = file.read(toc, sizeof(toc), &lenRead);
+    if (error != fs::OK) {
+        return error;
+    }
+    if (lenRead != sizeof(toc)) {
+        return fs::INVALID_CHECKSUM;
+    }
+
+    error = file.seek(toc[trackIndex].offset);
+    if (error != fs::OK) {
+        return error;
+    }
+
+    RleReader rleReader([&file] (void *data, size_t len) { size_t lenRead; file.read(data, len, &lenRead); });
+
+    VersionedSerializedReader reader(
+        header.version >= 2 ?
+            VersionedSerializedReader::Reader([&rleReader] (void *data, size_t len) { rleReader.read(data, len); }) :
+            VersionedSerializedReader::Reader([&file] (void *data, size_t len) { size_t lenRead; file.read(data, len, &lenRead); }),
+        ProjectVersion::Latest
+    );
+
+    ReadContext context = { reader };
+    _tracks[targetTrackIndex].read(context);
+
+    if (!reader.checkHash()) {
+        return fs::INVALID_CHECKSUM;
+    }
+
+    _observable.notify(TrackModeChanged);
+
+    return fs::OK;
+}
+
+fs::Error Project::autoSave(const char *path) {
+    // detect changed sections by hashing the serialized content, the model
+    // has no central mutation funnel so hashing is the only way to reliably
+    // catch every edit (including live recording writing steps directly)
+    std::array<uint32_t, SectionCount> hashes;
+    for (int section = 0; section < SectionCount; ++section) {
+        hashes[section] = sectionHash(section);
+    }
+
+    bool full = !_autoSaveValid || _autoSaveRecords >= MaxAutoSaveRecords || !fs::exists(path);
+
+    if (!full) {
+        bool dirty = false;
+        for (int section = 0; section < SectionCount; ++section) {
+            dirty |= hashes[section] != _sectionHashes[section];
+        }
+        if (!dirty) {
+            return fs::OK;
+        }
+    }
+
+    fs::FileWriter fileWriter(path, full ? fs::File::Write : fs::File::Append);
+    if (fileWriter.error() != fs::OK) {
+        _autoSaveValid = false;
+        return fileWriter.error();
+    }
+
+    if (full) {
+        FileHeader header(FileType::Project, 0, _name);
+        fileWriter.write(&header, sizeof(header));
+        _autoSaveRecords = 0;
+    }
+
+    // append a journal record for every changed section, each record is
+    // individually versioned and hashed so a truncated tail record is
+    // detected and discarded on read
+    for (int section = 0; section < SectionCount; ++section) {
+        if (full || hashes[section] != _sectionHashes[section]) {
+            uint8_t sectionByte = section;
+            fileWriter.write(&sectionByte, sizeof(sectionByte));
+
+            VersionedSerializedWriter writer(
+                [&fileWriter] (const void *data, size_t len) { fileWriter.write(data, len); },
+                ProjectVersion::Latest
+            );
+
+            WriteContext context = { writer };
+            writeSection(context, section);
+            writer.writeHash();
+
+            ++_autoSaveRecords;
+        }
+    }
+
+    auto error = fileWriter.finish();
+    if (error == fs::OK) {
+        _sectionHashes = hashes;
+        _autoSaveValid = true;
+    } else {
+        _autoSaveValid = false;
+    }
+
+    return error;
+}
+
+fs::Error Project::readAutoSave(const char *path) {
+    fs::FileReader fileReader(path);
+    if (fileReader.error() != fs::OK) {
+        return fileReader.error();
+    }
+
+    FileHeader header;
+    fileReader.read(&header, sizeof(header));
+
+    clear();
+
+    // replay journal records in order, later records override earlier ones
+    std::bitset<SectionCount> validSections;
+
+    while (true) {
+        uint8_t section;
+        if (fileReader.read(&section, sizeof(section)) != fs::OK || section >= SectionCount) {
+            // end of journal
+            break;
+        }
+
+        VersionedSerializedReader reader(
+            [&fileReader] (void *data, size_t len) { fileReader.read(data, len); },
+            ProjectVersion::Latest
+        );
+
+        ReadContext context = { reader };
+        readSection(context, section);
+
+        if (!reader.checkHash()) {
+            // truncated or corrupted tail record, keep the state replayed so far
+            break;
+        }
+
+        validSections.set(section);
+    }
+
+    fileReader.finish();
+
+    if (!validSections.all()) {
+        clear();
+        return fs::INVALID_CHECKSUM;
+    }
+
+    _observable.notify(ProjectRead);
+
+    return fs::OK;
+}
@@ -15,6 +15,7 @@
 #include "FileDefs.h"
 
 #include "core/math/Math.h"
+#include "core/utils/FixedFunction.h"
 #include "core/utils/StringBuilder.h"
 #include "core/utils/StringUtils.h"
 
@@ -200,6 +201,21 @@ public:
 
     // curveMidiInput
 
+    // midiThru
+
+    Types::MidiThru midiThru() const { return _midiThru; }
+    void setMidiThru(Types::MidiThru midiThru) {
+        _midiThru = ModelUtils::clampedEnum(midiThru);
+    }
+
+    void editMidiThru(int value, bool shift) {
+        _midiThru = ModelUtils::adjustedEnum(_midiThru, value);
+    }
+
+    void printMidiThru(StringBuilder &str) const {
+        str(Types::midiThruName(_midiThru));
+    }
+
     // clockSetup
 
     const ClockSetup &clockSetup() const { return _clockSetup; }
@@ -284,7 +300,7 @@ public:
     // selectedPatternIndex
 
     int selectedPatternIndex() const {
-        return _playState.snapshotActive() ? PlayState::SnapshotPatternIndex : _selectedPatternIndex;
+        return _selectedPatternIndex;
     }
 
     void setSelectedPatternIndex(int index) {
@@ -357,6 +373,12 @@ public:
         _observable.watch(handler);
     }
 
+    // deliver pending notifications, called once per UI update, returns
+    // true if any notifications were delivered
+    bool flushEvents() {
+        return _observable.flush();
+    }
+
     //----------------------------------------
     // Methods
     //----------------------------------------
@@ -369,10 +391,48 @@ public:
     void write(WriteContext &context) const;
     bool read(ReadContext &context);
 
-    fs::Error write(const char *path) const;
+    // guard held while a section is snapshotted into memory during write(),
+    // allowing the caller to briefly pause the engine per section instead of
+    // locking it for the whole file write
+    typedef FixedFunction<void(bool locked)> WriteGuard;
+
+    fs::Error write(const char *path, const WriteGuard &guard = WriteGuard()) const;
     fs::Error read(const char *path);
 
+    // import a single track from a project file into the given track of this
+    // project, only supported for sectioned project files
+    fs::Error readTrack(const char *path, int trackIndex, int targetTrackIndex);
+
+    // Incremental autosave. The project is split into serialization sections
+    // (one per track plus one for all global state). autoSave() only appends
+    // journal records for sections whose serialized content changed since the
+    // last save, so persisting edits in the background usually writes a few
+    // hundred bytes instead of the whole project.
+    fs::Error autoSave(const char *path);
+    fs::Error readAutoSave(const char *path);
+
 private:
+    // project files are written as a sectioned container since file version 1:
+    // a table of contents after the file header locates one serialization
+    // stream per section, so readers can seek to a single section (e.g. track
+    // import) without streaming the entire file. since version 2 each section
+    // stream is rle compressed on the card
+    static constexpr uint8_t FileVersion = 2;
+
+    static constexpr int GlobalsSection = CONFIG_TRACK_COUNT;
+    static constexpr int SettingsSection = CONFIG_TRACK_COUNT + 1;
+    static constexpr int SectionCount = CONFIG_TRACK_COUNT + 2;
+    // journal records appended before the journal is compacted again
+    static constexpr int MaxAutoSaveRecords = 8 * SectionCount;
+
+    void writeSettings(WriteContext &context) const;
+    void readSettings(ReadContext &context);
+    void writeGlobals(WriteContext &context) const;
+    void readGlobals(ReadContext &context);
+
+    void writeSection(WriteContext &context, int section) const;
+    void readSection(ReadContext &context, int section);
+    uint32_t sectionHash(int section) const;
     uint8_t _slot = uint8_t(-1);
     char _name[NameLength + 1];
     Routable<float> _tempo;
@@ -384,6 +444,7 @@ private:
     Types::RecordMode _recordMode;
     Types::CvGateInput _cvGateInput;
     Types::CurveCvInput _curveCvInput;
+    Types::MidiThru _midiThru;
 
     ClockSetup _clockSetup;
     TrackArray _tracks;
@@ -399,5 +460,10 @@ private:
     NoteSequence::Layer _selectedNoteSequenceLayer = NoteSequence::Layer(0);
     CurveSequence::Layer _selectedCurveSequenceLayer = CurveSequence::Layer(0);
 
-    Observable<Event, 2> _observable;
+    // per-section content hashes at the time of the last autosave
+    std::array<uint32_t, SectionCount> _sectionHashes;
+    uint8_t _autoSaveRecords = 0;
+    bool _autoSaveValid = false;
+
+    DeferredObservable<Event, 2> _observable;
 };
@@ -60,6 +60,25 @@ enum ProjectVersion {
     // added MidiCvTrack::transpose
     Version21 = 21,
 
+    // added ClockSetup::ppqn
+    Version22 = 22,
+
+    // added NoteTrack::extendedSteps
+    // added CurveTrack::extendedSteps
+    Version23 = 23,
+
+    // added CurveTrack::cvUpdateMode
+    Version24 = 24,
+
+    // added Routing::Route::smoothing
+    Version25 = 25,
+
+    // added Project::midiThru
+    Version26 = 26,
+
+    // added CurveTrack::shapeMorph
+    Version27 = 27,
+
     // automatically derive latest version
     Last,
     Latest = Last - 1,
@@ -76,6 +76,7 @@ void Routing::Route::clear() {
     _tracks = 0;
     _min = 0.f;
     _max = 1.f;
+    _smoothing = 0;
     _source = Source::None;
     _cvSource.clear();
     _midiSource.clear();
@@ -87,6 +88,7 @@ void Routing::Route::write(WriteContext &context) const {
     writer.write(_tracks);
     writer.write(_min);
     writer.write(_max);
+    writer.write(_smoothing);
     writer.write(_source);
     if (isCvSource(_source)) {
         _cvSource.write(context);
@@ -102,6 +104,7 @@ void Routing::Route::read(ReadContext &context) {
     reader.read(_tracks);
     reader.read(_min);
     reader.read(_max);
+    reader.read(_smoothing, ProjectVersion::Version25);
     reader.read(_source);
     if (isCvSource(_source)) {
         _cvSource.read(context);
@@ -117,6 +120,7 @@ bool Routing::Route::operator==(const Route &other) const {
         _tracks == other._tracks &&
         _min == other._min &&
         _max == other._max &&
+        _smoothing == other._smoothing &&
         _source == other._source &&
         (!isCvSource(_source) || _cvSource == other._cvSource) &&
         (!isMidiSource(_source) || _midiSource == other._midiSource)
@@ -127,9 +131,28 @@ bool Routing::Route::operator==(const Route &other) const {
 // Routing
 //----------------------------------------
 
+std::array<Routing::TargetWriter, size_t(Routing::Target::Last)> Routing::_targetWriters;
+
 Routing::Routing(Project &project) :
     _project(project)
-{}
+{
+    // compile the target dispatch into a jump table, target categories are
+    // static so this only has to run once
+    for (size_t i = 0; i < _targetWriters.size(); ++i) {
+        auto target = Target(i);
+        if (isProjectTarget(target)) {
+            _targetWriters[i] = &Routing::writeProjectTarget;
+        } else if (isPlayStateTarget(target)) {
+            _targetWriters[i] = &Routing::writePlayStateTarget;
+        } else if (isTrackTarget(target)) {
+            _targetWriters[i] = &Routing::writeTrackTarget;
+        } else if (isSequenceTarget(target)) {
+            _targetWriters[i] = &Routing::writeSequenceTarget;
+        } else {
+            _targetWriters[i] = nullptr;
+        }
+    }
+}
 
 void Routing::clear() {
     for (auto &route : _routes) {
@@ -177,41 +200,59 @@ void Routing::writeTarget(Target target, uint8_t tracks, float normalized) {
     float floatValue = denormalizeTargetValue(target, normalized);
     int intValue = std::round(floatValue);
 
-    if (isProjectTarget(target)) {
-        _project.writeRouted(target, intValue, floatValue);
-    } else if (isPlayStateTarget(target)) {
-        _project.playState().writeRouted(target, tracks, intValue, floatValue);
-    } else if (isTrackTarget(target) || isSequenceTarget(target)) {
-        for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
-            if (tracks & (1<<trackIndex)) {
-                auto &track = _project.track(trackIndex);
-                switch (track.trackMode()) {
-                case Track::TrackMode::Note:
-                    if (isTrackTarget(target)) {
-                        track.noteTrack().writeRouted(target, intValue, floatValue);
-                    } else {
-                        for (int patternIndex = 0; patternIndex < CONFIG_PATTERN_COUNT; ++patternIndex) {
-                            track.noteTrack().sequence(patternIndex).writeRouted(target, intValue, floatValue);
-                        }
-                    }
-                    break;
-                case Track::TrackMode::Curve:
-                    if (isTrackTarget(target)) {
-                        track.curveTrack().writeRouted(target, intValue, floatValue);
-                    } else {
-                        for (int patternIndex = 0; patternIndex < CONFIG_PATTERN_COUNT; ++patternIndex) {
-                            track.curveTrack().sequence(patternIndex).writeRouted(target, intValue, floatValue);
-                        }
-                    }
-                    break;
-                case Track::TrackMode::MidiCv:
-                    if (isTrackTarget(target)) {
-                        track.midiCvTrack().writeRouted(target, intValue, floatValue);
-                    }
-                    break;
-                case Track::TrackMode::Last:
-                    break;
+    auto writer = _targetWriters[size_t(target)];
+    if (writer) {
+        (this->*writer)(target, tracks, intValue, floatValue);
+    }
+}
+
+void Routing::writeProjectTarget(Target target, uint8_t tracks, int intValue, float floatValue) {
+    _project.writeRouted(target, intValue, floatValue);
+}
+
+void Routing::writePlayStateTarget(Target target, uint8_t tracks, int intValue, float floatValue) {
+    _project.playState().writeRouted(target, tracks, intValue, floatValue);
+}
+
+void Routing::writeTrackTarget(Target target, uint8_t tracks, int intValue, float floatValue) {
+    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        if (tracks & (1<<trackIndex)) {
+            auto &track = _project.track(trackIndex);
+            switch (track.trackMode()) {
+            case Track::TrackMode::Note:
+                track.noteTrack().writeRouted(target, intValue, floatValue);
+                break;
+            case Track::TrackMode::Curve:
+                track.curveTrack().writeRouted(target, intValue, floatValue);
+                break;
+            case Track::TrackMode::MidiCv:
+                track.midiCvTrack().writeRouted(target, intValue, floatValue);
+                break;
+            case Track::TrackMode::Last:
+                break;
+            }
+        }
+    }
+}
+
+void Routing::writeSequenceTarget(Target target, uint8_t tracks, int intValue, float floatValue) {
+    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        if (tracks & (1<<trackIndex)) {
+            auto &track = _project.track(trackIndex);
+            switch (track.trackMode()) {
+            case Track::TrackMode::Note:
+                for (int patternIndex = 0; patternIndex < CONFIG_PATTERN_COUNT; ++patternIndex) {
+                    track.noteTrack().sequence(patternIndex).writeRouted(target, intValue, floatValue);
+                }
+                break;
+            case Track::TrackMode::Curve:
+                for (int patternIndex = 0; patternIndex < CONFIG_PATTERN_COUNT; ++patternIndex) {
+                    track.curveTrack().sequence(patternIndex).writeRouted(target, intValue, floatValue);
                 }
+                break;
+            case Track::TrackMode::MidiCv:
+            case Track::TrackMode::Last:
+                break;
             }
         }
     }
@@ -290,6 +331,7 @@ const TargetInfo targetInfos[int(Routing::Target::Last)] = {
     [int(Routing::Target::LengthBias)]                      = { -8,     8,      -8,     8       },
     [int(Routing::Target::NoteProbabilityBias)]             = { -8,     8,      -8,     8       },
     [int(Routing::Target::ShapeProbabilityBias)]            = { -8,     8,      -8,     8       },
+    [int(Routing::Target::ShapeMorph)]                      = { 0,      100,    0,      100     },
     // Sequence targets
     [int(Routing::Target::Divisor)]                         = { 1,      768,    6,      24      },
     [int(Routing::Target::RunMode)]                         = { 0,      5,      0,      5       },
@@ -59,7 +59,8 @@ public:
         LengthBias,
         NoteProbabilityBias,
         ShapeProbabilityBias,
-        TrackLast = ShapeProbabilityBias,
+        ShapeMorph,
+        TrackLast = ShapeMorph,
 
         // Sequence targets
         SequenceFirst,
@@ -97,6 +98,7 @@ public:
         case Target::LengthBias:                return "Length Bias";
         case Target::NoteProbabilityBias:       return "Note P. Bias";
         case Target::ShapeProbabilityBias:      return "Shape P. Bias";
+        case Target::ShapeMorph:                return "Shape Morph";
 
         case Target::Divisor:                   return "Divisor";
         case Target::RunMode:                   return "Run Mode";
@@ -137,6 +139,8 @@ public:
 
         case Target::ShapeProbabilityBias:      return 22;
 
+        case Target::ShapeMorph:                return 23;
+
         case Target::Last:                      break;
         }
         return 0;
@@ -441,6 +445,27 @@ public:
             Routing::printTargetValue(_target, _max, str);
         }
 
+        // smoothing
+
+        // time constant of the one-pole smoother applied to the routed value
+        // in 10 ms units, 0 disables smoothing
+        int smoothing() const { return _smoothing; }
+        void setSmoothing(int smoothing) {
+            _smoothing = clamp(smoothing, 0, 100);
+        }
+
+        void editSmoothing(int value, bool shift) {
+            setSmoothing(ModelUtils::adjustedByStep(smoothing(), value, 5, !shift));
+        }
+
+        void printSmoothing(StringBuilder &str) const {
+            if (smoothing() == 0) {
+                str("Off");
+            } else {
+                str("%dms", smoothing() * 10);
+            }
+        }
+
         // source
 
         Source source() const { return _source; }
@@ -485,6 +510,7 @@ public:
         int8_t _tracks;
         float _min; // TODO make these int16_t
         float _max;
+        uint8_t _smoothing;
         Source _source;
         CvSource _cvSource;
         MidiSource _midiSource;
@@ -538,6 +564,19 @@ private:
     static float targetValueStep(Target target);
     static void printTargetValue(Target target, float normalized, StringBuilder &str);
 
+    // routed value writers by target category, dispatched through the jump
+    // table below
+    void writeProjectTarget(Target target, uint8_t tracks, int intValue, float floatValue);
+    void writePlayStateTarget(Target target, uint8_t tracks, int intValue, float floatValue);
+    void writeTrackTarget(Target target, uint8_t tracks, int intValue, float floatValue);
+    void writeSequenceTarget(Target target, uint8_t tracks, int intValue, float floatValue);
+
+    // per-target jump table resolving the target category once at
+    // construction, so applying a routed value is a single indirect call
+    // instead of a cascade of category range tests
+    typedef void (Routing::*TargetWriter)(Target target, uint8_t tracks, int intValue, float floatValue);
+    static std::array<TargetWriter, size_t(Target::Last)> _targetWriters;
+
     Project &_project;
     RouteArray _routes;
     bool _dirty;
@@ -0,0 +1,127 @@
+#include "SdCardBenchmark.h"
+
+#include "core/utils/Random.h"
+
+#include "drivers/HighResolutionTimer.h"
+#include "drivers/SdCard.h"
+
+#include <algorithm>
+
+#include <cstring>
+
+SdCardBenchmark::Result SdCardBenchmark::_result;
+
+// benchmark transfers run in autosave-sized chunks
+static constexpr uint32_t ChunkSectors = 4;
+static constexpr uint32_t ChunkBytes = ChunkSectors * 512;
+static constexpr uint32_t ChunkCount = 16;
+static constexpr uint32_t TestSectors = ChunkSectors * ChunkCount;
+
+static uint8_t chunkBuffer[ChunkBytes];
+static uint8_t backupBuffer[ChunkBytes];
+
+static uint32_t toKbps(uint32_t bytes, uint32_t totalUs) {
+    if (totalUs == 0) {
+        return 0;
+    }
+    return uint32_t((uint64_t(bytes) * 1000000) / (uint64_t(totalUs) * 1024));
+}
+
+fs::Error SdCardBenchmark::run() {
+    auto &sdcard = fs::volume().sdcard();
+
+    _result = Result();
+
+    if (!sdcard.available() || sdcard.sectorSize() != 512 || sdcard.sectorCount() < TestSectors) {
+        return fs::DISK_ERR;
+    }
+
+    // test region at the end of the card, aligned to the chunk size
+    uint32_t firstSector = uint32_t((sdcard.sectorCount() - TestSectors) / ChunkSectors) * ChunkSectors;
+
+    Random rng(0x5dca4d);
+
+    uint32_t totalUs;
+    uint32_t worstUs;
+    uint32_t elapsedUs;
+
+    // sequential read
+    totalUs = 0;
+    worstUs = 0;
+    for (uint32_t chunk = 0; chunk < ChunkCount; ++chunk) {
+        uint32_t startUs = HighResolutionTimer::us();
+        if (!sdcard.read(chunkBuffer, firstSector + chunk * ChunkSectors, ChunkSectors)) {
+            return fs::DISK_ERR;
+        }
+        elapsedUs = HighResolutionTimer::us() - startUs;
+        totalUs += elapsedUs;
+        worstUs = std::max(worstUs, elapsedUs);
+    }
+    _result.seqReadKbps = toKbps(ChunkCount * ChunkBytes, totalUs);
+    _result.worstReadUs = worstUs;
+
+    // random read
+    totalUs = 0;
+    for (uint32_t i = 0; i < ChunkCount; ++i) {
+        uint32_t chunk = rng.next() % ChunkCount;
+        uint32_t startUs = HighResolutionTimer::us();
+        if (!sdcard.read(chunkBuffer, firstSector + chunk * ChunkSectors, ChunkSectors)) {
+            return fs::DISK_ERR;
+        }
+        elapsedUs = HighResolutionTimer::us() - startUs;
+        totalUs += elapsedUs;
+        _result.worstReadUs = std::max(_result.worstReadUs, elapsedUs);
+    }
+    _result.randReadKbps = toKbps(ChunkCount * ChunkBytes, totalUs);
+
+    // sequential write, backing up and restoring each chunk
+    totalUs = 0;
+    worstUs = 0;
+    for (uint32_t chunk = 0; chunk < ChunkCount; ++chunk) {
+        uint32_t sector = firstSector + chunk * ChunkSectors;
+        if (!sdcard.read(backupBuffer, sector, ChunkSectors)) {
+            return fs::DISK_ERR;
+        }
+        for (uint32_t i = 0; i < ChunkBytes; ++i) {
+            chunkBuffer[i] = (rng.next() >> (i % 24)) & 0xff;
+        }
+        uint32_t startUs = HighResolutionTimer::us();
+        if (!sdcard.write(chunkBuffer, sector, ChunkSectors)) {
+            return fs::DISK_ERR;
+        }
+        elapsedUs = HighResolutionTimer::us() - startUs;
+        totalUs += elapsedUs;
+        worstUs = std::max(worstUs, elapsedUs);
+        if (!sdcard.write(backupBuffer, sector, ChunkSectors)) {
+            return fs::DISK_ERR;
+        }
+    }
+    _result.seqWriteKbps = toKbps(ChunkCount * ChunkBytes, totalUs);
+    _result.worstWriteUs = worstUs;
+
+    // random write, backing up and restoring each chunk
+    totalUs = 0;
+    for (uint32_t i = 0; i < ChunkCount; ++i) {
+        uint32_t sector = firstSector + (rng.next() % ChunkCount) * ChunkSectors;
+        if (!sdcard.read(backupBuffer, sector, ChunkSectors)) {
+            return fs::DISK_ERR;
+        }
+        uint32_t startUs = HighResolutionTimer::us();
+        if (!sdcard.write(chunkBuffer, sector, ChunkSectors)) {
+            return fs::DISK_ERR;
+        }
+        elapsedUs = HighResolutionTimer::us() - startUs;
+        totalUs += elapsedUs;
+        _result.worstWriteUs = std::max(_result.worstWriteUs, elapsedUs);
+        if (!sdcard.write(backupBuffer, sector, ChunkSectors)) {
+            return fs::DISK_ERR;
+        }
+    }
+    _result.randWriteKbps = toKbps(ChunkCount * ChunkBytes, totalUs);
+
+    sdcard.sync();
+
+    _result.valid = true;
+
+    return fs::OK;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "core/fs/FileSystem.h"
+
+#include <cstdint>
+
+// Raw sd card throughput and latency benchmark, runnable from the system page.
+//
+// Measures sequential and random read/write throughput and the worst-case
+// per-command latency using raw sector access in autosave-sized chunks. The
+// write test backs up and restores every sector it touches, so it is
+// non-destructive as long as it runs to completion. Results are kept for the
+// session and compared against the minimum figures autosave needs to run
+// without audible hitches, so a cheap card is flagged before it ruins a set.
+class SdCardBenchmark {
+public:
+    struct Result {
+        bool valid = false;
+        uint32_t seqReadKbps = 0;
+        uint32_t seqWriteKbps = 0;
+        uint32_t randReadKbps = 0;
+        uint32_t randWriteKbps = 0;
+        uint32_t worstReadUs = 0;
+        uint32_t worstWriteUs = 0;
+    };
+
+    // minimum write throughput and maximum single-command stall tolerated by
+    // autosave before project saves become noticeable on the UI
+    static constexpr uint32_t AutosaveMinWriteKbps = 256;
+    static constexpr uint32_t AutosaveMaxWriteStallUs = 250000;
+
+    static const Result &result() { return _result; }
+
+    static bool cardUnderperforms() {
+        return _result.valid && (
+            _result.randWriteKbps < AutosaveMinWriteKbps ||
+            _result.worstWriteUs > AutosaveMaxWriteStallUs
+        );
+    }
+
+    // Runs the benchmark, must be called from the file task.
+    static fs::Error run();
+
+private:
+    static Result _result;
+};
@@ -97,11 +97,83 @@ bool Settings::read(FlashReader &flashReader) {
 }
 
 void Settings::writeToFlash() const {
-    FlashWriter flashWriter(CONFIG_SETTINGS_FLASH_ADDR, CONFIG_SETTINGS_FLASH_SECTOR);
-    write(flashWriter);
+    // measure the serialized payload
+    uint32_t length = 0;
+    {
+        VersionedSerializedWriter writer(
+            [&length] (const void *data, size_t len) { length += len; },
+            Version
+        );
+        WriteContext context = { writer };
+        write(context);
+    }
+    // records are word aligned
+    length = (length + 3) & ~uint32_t(3);
+
+    // find the end of the journal
+    uint32_t offset = 0;
+    uint32_t sequence = 0;
+    FlashRecordHeader header;
+    while (readFlashRecordHeader(offset, header)) {
+        sequence = header.sequence + 1;
+        offset += sizeof(FlashRecordHeader) + header.length;
+    }
+
+    if (offset + sizeof(FlashRecordHeader) + length > CONFIG_SETTINGS_FLASH_SIZE) {
+        // journal is full, erase the sector and restart it
+        FlashWriter flashWriter(CONFIG_SETTINGS_FLASH_ADDR, CONFIG_SETTINGS_FLASH_SECTOR);
+        writeFlashRecord(flashWriter, sequence, length);
+    } else {
+        // append a record, program-only operation
+        FlashWriter flashWriter(CONFIG_SETTINGS_FLASH_ADDR + offset);
+        writeFlashRecord(flashWriter, sequence, length);
+    }
 }
 
 bool Settings::readFromFlash() {
-    FlashReader flashReader(CONFIG_SETTINGS_FLASH_ADDR);
-    return read(flashReader);
+    bool success = false;
+
+    // scan the journal and restore the latest record that passes the hash check
+    uint32_t offset = 0;
+    FlashRecordHeader header;
+    while (readFlashRecordHeader(offset, header)) {
+        FlashReader flashReader(CONFIG_SETTINGS_FLASH_ADDR + offset + sizeof(FlashRecordHeader));
+        Settings record;
+        if (record.read(flashReader)) {
+            _calibration = record._calibration;
+            success = true;
+        }
+        offset += sizeof(FlashRecordHeader) + header.length;
+    }
+
+    if (!success) {
+        // fall back to the previous format storing a single raw record
+        FlashReader flashReader(CONFIG_SETTINGS_FLASH_ADDR);
+        success = read(flashReader);
+    }
+
+    return success;
+}
+
+bool Settings::readFlashRecordHeader(uint32_t offset, FlashRecordHeader &header) const {
+    if (offset + sizeof(FlashRecordHeader) > CONFIG_SETTINGS_FLASH_SIZE) {
+        return false;
+    }
+
+    header.sequence = FlashRecordFree;
+    header.length = 0;
+
+    FlashReader flashReader(CONFIG_SETTINGS_FLASH_ADDR + offset);
+    flashReader.read(&header, sizeof(header));
+
+    return
+        header.sequence != FlashRecordFree &&
+        header.length > 0 && header.length % 4 == 0 &&
+        offset + sizeof(FlashRecordHeader) + header.length <= CONFIG_SETTINGS_FLASH_SIZE;
+}
+
+void Settings::writeFlashRecord(FlashWriter &flashWriter, uint32_t sequence, uint32_t length) const {
+    FlashRecordHeader header = { sequence, length };
+    flashWriter.write(&header, sizeof(header));
+    write(flashWriter);
 }
@@ -32,5 +32,20 @@ public:
     bool readFromFlash();
 
 private:
+    // Settings are stored in the flash sector as an append-only journal of
+    // records, each prefixed with a sequence number and payload length.
+    // Saving appends a record into the erased remainder of the sector, which
+    // is a program-only operation. The sector is only erased once the journal
+    // is full, spreading wear across the whole sector.
+    struct FlashRecordHeader {
+        uint32_t sequence;
+        uint32_t length;
+    };
+
+    static constexpr uint32_t FlashRecordFree = 0xffffffff;
+
+    bool readFlashRecordHeader(uint32_t offset, FlashRecordHeader &header) const;
+    void writeFlashRecord(FlashWriter &flashWriter, uint32_t sequence, uint32_t length) const;
+
     Calibration _calibration;
 };
@@ -35,6 +35,8 @@ void Song::chainPattern(int pattern) {
             ++_slotCount;
         }
     }
+
+    compile();
 }
 
 void Song::insertSlot(int slotIndex) {
@@ -45,6 +47,8 @@ void Song::insertSlot(int slotIndex) {
         slot(slotIndex).clear();
         ++_slotCount;
     }
+
+    compile();
 }
 
 void Song::removeSlot(int slotIndex) {
@@ -55,6 +59,8 @@ void Song::removeSlot(int slotIndex) {
         slot(_slots.size() - 1).clear();
         --_slotCount;
     }
+
+    compile();
 }
 
 void Song::duplicateSlot(int slotIndex) {
@@ -62,42 +68,56 @@ void Song::duplicateSlot(int slotIndex) {
         insertSlot(slotIndex + 1);
         _slots[slotIndex + 1] = _slots[slotIndex];
     }
+
+    compile();
 }
 
 void Song::swapSlot(int fromIndex, int toIndex) {
     if (fromIndex >= 0 && fromIndex < _slotCount && toIndex >= 0 && toIndex < _slotCount) {
         std::swap(slot(fromIndex), slot(toIndex));
     }
+
+    compile();
 }
 
 void Song::setPattern(int slotIndex, int pattern) {
     if (isActiveSlot(slotIndex)) {
         slot(slotIndex).setPattern(pattern);
     }
+
+    compile();
 }
 
 void Song::setPattern(int slotIndex, int trackIndex, int pattern) {
     if (isActiveSlot(slotIndex)) {
         slot(slotIndex).setPattern(trackIndex, pattern);
     }
+
+    compile();
 }
 
 void Song::editPattern(int slotIndex, int trackIndex, int value) {
     if (isActiveSlot(slotIndex)) {
         slot(slotIndex).setPattern(trackIndex, slot(slotIndex).pattern(trackIndex) + value);
     }
+
+    compile();
 }
 
 void Song::setRepeats(int slotIndex, int repeats) {
     if (isActiveSlot(slotIndex)) {
         slot(slotIndex).setRepeats(repeats);
     }
+
+    compile();
 }
 
 void Song::editRepeats(int slotIndex, int value) {
     if (isActiveSlot(slotIndex)) {
         slot(slotIndex).setRepeats(slot(slotIndex).repeats() + value);
     }
+
+    compile();
 }
 
 void Song::clear() {
@@ -105,6 +125,8 @@ void Song::clear() {
         slot.clear();
     }
     _slotCount = 0;
+
+    compile();
 }
 
 void Song::write(WriteContext &context) const {
@@ -125,4 +147,18 @@ void Song::read(ReadContext &context) {
     }
 
     reader.read(_slotCount);
+
+    compile();
+}
+
+void Song::compile() {
+    ++_version;
+    for (size_t slotIndex = 0; slotIndex < _slots.size(); ++slotIndex) {
+        const auto &slot = _slots[slotIndex];
+        auto &entry = _playlist[slotIndex];
+        for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+            entry._patterns[trackIndex] = slot.pattern(trackIndex);
+        }
+        entry._repeats = slot.repeats();
+    }
 }
@@ -59,6 +59,21 @@ public:
         friend class Song;
     };
 
+    // Compiled flat view of the song, regenerated on every edit. Song
+    // playback in the engine indexes the precomputed schedule instead of
+    // unpacking slots under the engine lock.
+    class PlaylistEntry {
+    public:
+        int pattern(int trackIndex) const { return _patterns[trackIndex]; }
+        int repeats() const { return _repeats; }
+
+    private:
+        std::array<uint8_t, CONFIG_TRACK_COUNT> _patterns;
+        uint8_t _repeats;
+
+        friend class Song;
+    };
+
     //----------------------------------------
     // Properties
     //----------------------------------------
@@ -72,6 +87,17 @@ public:
     bool isFull() const { return _slotCount >= _slots.size(); }
     bool isActiveSlot(int slotIndex) const { return slotIndex >= 0 && slotIndex < _slotCount; }
 
+    // playlist
+
+    const PlaylistEntry &playlistEntry(int index) const { return _playlist[index]; }
+    int playlistLength() const { return _slotCount; }
+
+    // edit version
+
+    // incremented on every edit, allows consumers (e.g. the song page) to
+    // cache derived data and only rebuild it when the song has changed
+    uint32_t version() const { return _version; }
+
     //----------------------------------------
     // Methods
     //----------------------------------------
@@ -94,6 +120,11 @@ public:
     void read(ReadContext &context);
 
 private:
+    void compile();
+
     std::array<Slot, CONFIG_SONG_SLOT_COUNT> _slots;
     uint8_t _slotCount;
+
+    std::array<PlaylistEntry, CONFIG_SONG_SLOT_COUNT> _playlist;
+    uint32_t _version = 0;
 };
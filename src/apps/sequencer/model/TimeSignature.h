@@ -69,12 +69,12 @@ public:
         str("%d/%d", beats(), note());
     }
 
-    uint32_t noteDivisor() const {
-        return (CONFIG_PPQN * 4) / note();
+    uint32_t noteDivisor(uint32_t ppqn = CONFIG_PPQN) const {
+        return (ppqn * 4) / note();
     }
 
-    uint32_t measureDivisor() const {
-        return beats() * noteDivisor();
+    uint32_t measureDivisor(uint32_t ppqn = CONFIG_PPQN) const {
+        return beats() * noteDivisor(ppqn);
     }
 
     void write(WriteContext &context) const {
@@ -24,12 +24,59 @@ void Track::clearPattern(int patternIndex) {
 }
 
 void Track::copyPattern(int src, int dst) {
+    // read the source through const access, copying a pattern out must not
+    // count as an edit to it (an armed snapshot would back it up)
     switch (_trackMode) {
     case TrackMode::Note:
-        _track.note->sequence(dst) = _track.note->sequence(src);
+        _track.note->sequence(dst) = const_cast<const NoteTrack *>(_track.note)->sequence(src);
         break;
     case TrackMode::Curve:
-        _track.curve->sequence(dst) = _track.curve->sequence(src);
+        _track.curve->sequence(dst) = const_cast<const CurveTrack *>(_track.curve)->sequence(src);
+        break;
+    case TrackMode::MidiCv:
+        break;
+    case TrackMode::Last:
+        break;
+    }
+}
+
+void Track::startSnapshot(int patternIndex) {
+    switch (_trackMode) {
+    case TrackMode::Note:
+        _track.note->startSnapshot(patternIndex);
+        break;
+    case TrackMode::Curve:
+        _track.curve->startSnapshot(patternIndex);
+        break;
+    case TrackMode::MidiCv:
+        break;
+    case TrackMode::Last:
+        break;
+    }
+}
+
+void Track::revertSnapshot() {
+    switch (_trackMode) {
+    case TrackMode::Note:
+        _track.note->revertSnapshot();
+        break;
+    case TrackMode::Curve:
+        _track.curve->revertSnapshot();
+        break;
+    case TrackMode::MidiCv:
+        break;
+    case TrackMode::Last:
+        break;
+    }
+}
+
+void Track::endSnapshot() {
+    switch (_trackMode) {
+    case TrackMode::Note:
+        _track.note->endSnapshot();
+        break;
+    case TrackMode::Curve:
+        _track.curve->endSnapshot();
         break;
     case TrackMode::MidiCv:
         break;
@@ -121,6 +121,10 @@ public:
     void clearPattern(int patternIndex);
     void copyPattern(int src, int dst);
 
+    void startSnapshot(int patternIndex);
+    void revertSnapshot();
+    void endSnapshot();
+
     void gateOutputName(int index, StringBuilder &str) const;
     void cvOutputName(int index, StringBuilder &str) const;
 
@@ -11,14 +11,14 @@ const Types::ConditionInfo Types::conditionInfos[] = {
 };
 
 const Types::VoltageRangeInfo Types::voltageRangeInfos[] = {
-    [int(Types::VoltageRange::Unipolar1V)]  = { 0.f, 1.f },
-    [int(Types::VoltageRange::Unipolar2V)]  = { 0.f, 2.f },
-    [int(Types::VoltageRange::Unipolar3V)]  = { 0.f, 3.f },
-    [int(Types::VoltageRange::Unipolar4V)]  = { 0.f, 4.f },
-    [int(Types::VoltageRange::Unipolar5V)]  = { 0.f, 5.f },
-    [int(Types::VoltageRange::Bipolar1V)]   = { -1.f, 1.f },
-    [int(Types::VoltageRange::Bipolar2V)]   = { -2.f, 2.f },
-    [int(Types::VoltageRange::Bipolar3V)]   = { -3.f, 3.f },
-    [int(Types::VoltageRange::Bipolar4V)]   = { -4.f, 4.f },
-    [int(Types::VoltageRange::Bipolar5V)]   = { -5.f, 5.f },
+    [int(Types::VoltageRange::Unipolar1V)]  = { 0.f, 1.f, 0, 65536 },
+    [int(Types::VoltageRange::Unipolar2V)]  = { 0.f, 2.f, 0, 32768 },
+    [int(Types::VoltageRange::Unipolar3V)]  = { 0.f, 3.f, 0, 21845 },
+    [int(Types::VoltageRange::Unipolar4V)]  = { 0.f, 4.f, 0, 16384 },
+    [int(Types::VoltageRange::Unipolar5V)]  = { 0.f, 5.f, 0, 13107 },
+    [int(Types::VoltageRange::Bipolar1V)]   = { -1.f, 1.f, -1 * 65536, 32768 },
+    [int(Types::VoltageRange::Bipolar2V)]   = { -2.f, 2.f, -2 * 65536, 16384 },
+    [int(Types::VoltageRange::Bipolar3V)]   = { -3.f, 3.f, -3 * 65536, 10923 },
+    [int(Types::VoltageRange::Bipolar4V)]   = { -4.f, 4.f, -4 * 65536, 8192 },
+    [int(Types::VoltageRange::Bipolar5V)]   = { -5.f, 5.f, -5 * 65536, 6554 },
 };
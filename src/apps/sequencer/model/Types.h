@@ -19,13 +19,9 @@ public:
     };
 
     static const char *recordModeName(RecordMode recordMode) {
-        switch (recordMode) {
-        case RecordMode::Overdub:   return "Overdub";
-        case RecordMode::Overwrite: return "Overwrite";
-        case RecordMode::StepRecord:return "Step Record";
-        case RecordMode::Last:      break;
-        }
-        return nullptr;
+        static const char *const names[] = { "Overdub", "Overwrite", "Step Record" };
+        static_assert(sizeof(names) / sizeof(names[0]) == size_t(RecordMode::Last), "names table incomplete");
+        return recordMode < RecordMode::Last ? names[size_t(recordMode)] : nullptr;
     }
 
     // CvGateInput
@@ -38,13 +34,9 @@ public:
     };
 
     static const char *cvGateInputName(CvGateInput cvGateInput) {
-        switch (cvGateInput) {
-        case CvGateInput::Off:      return "Off";
-        case CvGateInput::Cv1Cv2:   return "CV1/CV2";
-        case CvGateInput::Cv3Cv4:   return "CV3/CV4";
-        case CvGateInput::Last:     break;
-        }
-        return nullptr;
+        static const char *const names[] = { "Off", "CV1/CV2", "CV3/CV4" };
+        static_assert(sizeof(names) / sizeof(names[0]) == size_t(CvGateInput::Last), "names table incomplete");
+        return cvGateInput < CvGateInput::Last ? names[size_t(cvGateInput)] : nullptr;
     }
 
     enum class CurveCvInput : uint8_t {
@@ -57,15 +49,24 @@ public:
     };
 
     static const char *curveCvInput(CurveCvInput curveCvInput) {
-        switch (curveCvInput) {
-        case CurveCvInput::Off:     return "Off";
-        case CurveCvInput::Cv1:     return "CV1";
-        case CurveCvInput::Cv2:     return "CV2";
-        case CurveCvInput::Cv3:     return "CV3";
-        case CurveCvInput::Cv4:     return "CV4";
-        case CurveCvInput::Last:    break;
-        }
-        return nullptr;
+        static const char *const names[] = { "Off", "CV1", "CV2", "CV3", "CV4" };
+        static_assert(sizeof(names) / sizeof(names[0]) == size_t(CurveCvInput::Last), "names table incomplete");
+        return curveCvInput < CurveCvInput::Last ? names[size_t(curveCvInput)] : nullptr;
+    }
+
+    // MidiThru
+
+    enum class MidiThru : uint8_t {
+        Off,
+        All,
+        NonClock,
+        Last
+    };
+
+    static const char *midiThruName(MidiThru midiThru) {
+        static const char *const names[] = { "Off", "All", "No Clock" };
+        static_assert(sizeof(names) / sizeof(names[0]) == size_t(MidiThru::Last), "names table incomplete");
+        return midiThru < MidiThru::Last ? names[size_t(midiThru)] : nullptr;
     }
 
     // PlayMode
@@ -77,12 +78,9 @@ public:
     };
 
     static const char *playModeName(PlayMode playMode) {
-        switch (playMode) {
-        case PlayMode::Aligned: return "Aligned";
-        case PlayMode::Free:    return "Free";
-        case PlayMode::Last:    break;
-        }
-        return nullptr;
+        static const char *const names[] = { "Aligned", "Free" };
+        static_assert(sizeof(names) / sizeof(names[0]) == size_t(PlayMode::Last), "names table incomplete");
+        return playMode < PlayMode::Last ? names[size_t(playMode)] : nullptr;
     }
 
     // RunMode
@@ -98,16 +96,9 @@ public:
     };
 
     static const char *runModeName(RunMode runMode) {
-        switch (runMode) {
-        case RunMode::Forward:      return "Forward";
-        case RunMode::Backward:     return "Backward";
-        case RunMode::Pendulum:     return "Pendulum";
-        case RunMode::PingPong:     return "PingPong";
-        case RunMode::Random:       return "Random";
-        case RunMode::RandomWalk:   return "Random Walk";
-        case RunMode::Last:         break;
-        }
-        return nullptr;
+        static const char *const names[] = { "Forward", "Backward", "Pendulum", "PingPong", "Random", "Random Walk" };
+        static_assert(sizeof(names) / sizeof(names[0]) == size_t(RunMode::Last), "names table incomplete");
+        return runMode < RunMode::Last ? names[size_t(runMode)] : nullptr;
     }
 
     // Condition
@@ -196,30 +187,32 @@ public:
     };
 
     static const char *voltageRangeName(VoltageRange voltageRange) {
-        switch (voltageRange) {
-        case VoltageRange::Unipolar1V:  return "1V Unipolar";
-        case VoltageRange::Unipolar2V:  return "2V Unipolar";
-        case VoltageRange::Unipolar3V:  return "3V Unipolar";
-        case VoltageRange::Unipolar4V:  return "4V Unipolar";
-        case VoltageRange::Unipolar5V:  return "5V Unipolar";
-        case VoltageRange::Bipolar1V:   return "1V Bipolar";
-        case VoltageRange::Bipolar2V:   return "2V Bipolar";
-        case VoltageRange::Bipolar3V:   return "3V Bipolar";
-        case VoltageRange::Bipolar4V:   return "4V Bipolar";
-        case VoltageRange::Bipolar5V:   return "5V Bipolar";
-        case VoltageRange::Last:        break;
-        }
-        return nullptr;
+        static const char *const names[] = {
+            "1V Unipolar", "2V Unipolar", "3V Unipolar", "4V Unipolar", "5V Unipolar",
+            "1V Bipolar", "2V Bipolar", "3V Bipolar", "4V Bipolar", "5V Bipolar",
+        };
+        static_assert(sizeof(names) / sizeof(names[0]) == size_t(VoltageRange::Last), "names table incomplete");
+        return voltageRange < VoltageRange::Last ? names[size_t(voltageRange)] : nullptr;
     }
 
     struct VoltageRangeInfo {
         float lo;
         float hi;
+        // Q16.16 lower bound and range reciprocal, for normalizing fixed
+        // point CV input values without touching the FPU
+        int32_t loFixed;
+        int32_t rcpRangeFixed;
 
         float normalize(float value) const {
             return clamp((value - lo) / (hi - lo), 0.f, 1.f);
         }
 
+        // Q16.16 volts -> Q16.16 normalized value, integer only
+        int32_t normalizeFixed(int32_t volts) const {
+            int32_t value = int32_t((int64_t(volts - loFixed) * rcpRangeFixed) >> 16);
+            return clamp(value, int32_t(0), int32_t(65536));
+        }
+
         float denormalize(float value) const {
             return clamp(value, 0.f, 1.f) * (hi - lo) + lo;
         }
@@ -238,12 +231,9 @@ public:
     };
 
     static const char *midiPortName(MidiPort midiPort) {
-        switch (midiPort) {
-        case MidiPort::Midi:    return "MIDI";
-        case MidiPort::UsbMidi: return "USB";
-        case MidiPort::Last:    break;
-        }
-        return nullptr;
+        static const char *const names[] = { "MIDI", "USB" };
+        static_assert(sizeof(names) / sizeof(names[0]) == size_t(MidiPort::Last), "names table incomplete");
+        return midiPort < MidiPort::Last ? names[size_t(midiPort)] : nullptr;
     }
 
     // Misc types
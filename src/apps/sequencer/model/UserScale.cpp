@@ -3,6 +3,8 @@
 
 UserScale::Array UserScale::userScales;
 
+Observable<const UserScale &, 2> UserScale::_observable;
+
 UserScale::UserScale() :
     Scale("")
 {
@@ -21,6 +23,8 @@ void UserScale::clearItems() {
     if (_mode == Mode::Voltage) {
         _items[1] = 1000;
     }
+    updateItemsSorted();
+    notifyChanged();
 }
 
 void UserScale::write(WriteContext &context) const {
@@ -55,6 +59,9 @@ bool UserScale::read(ReadContext &context) {
         clear();
     }
 
+    updateItemsSorted();
+    notifyChanged();
+
     return success;
 }
 
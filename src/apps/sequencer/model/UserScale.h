@@ -7,6 +7,7 @@
 #include "ModelUtils.h"
 #include "Types.h"
 #include "FileDefs.h"
+#include "Observable.h"
 
 #include "core/math/Math.h"
 #include "core/utils/StringUtils.h"
@@ -60,6 +61,7 @@ public:
         if (mode != _mode) {
             _mode = mode;
             clearItems();
+            notifyChanged();
         }
     }
 
@@ -76,6 +78,8 @@ public:
     int size() const { return _size; }
     void setSize(int size) {
         _size = clamp(size, _mode == Mode::Chromatic ? 1 : 2, CONFIG_USER_SCALE_SIZE);
+        updateItemsSorted();
+        notifyChanged();
     }
 
     void editSize(int value, bool shift) {
@@ -103,6 +107,8 @@ public:
         case Mode::Last:
             break;
         }
+        updateItemsSorted();
+        notifyChanged();
     }
 
     void editItem(int index, int value, int shift) {
@@ -131,6 +137,15 @@ public:
         }
     }
 
+    //----------------------------------------
+    // Observable
+    //----------------------------------------
+
+    // watch for edits to any of the user scales
+    static void watch(std::function<void(const UserScale &)> handler) {
+        _observable.watch(handler);
+    }
+
     //----------------------------------------
     // Methods
     //----------------------------------------
@@ -237,13 +252,7 @@ private:
         int octave = roundDownDivide(semiNotes, 12);
         semiNotes -= octave * 12;
 
-        int index = -1;
-        for (int i = 0; i < _size; ++i) {
-            if (semiNotes < _items[i]) {
-                break;
-            }
-            index = i;
-        }
+        int index = findItem(semiNotes);
 
         if (index == -1) {
             index = _size -1;
@@ -259,28 +268,79 @@ private:
         volts -= octave * octaveRange;
         int itemValue = int(std::floor(volts * 1000.f));
 
+        int index = findItem(itemValue);
+
+        if (index == -1) {
+            index = _size -1;
+            --octave;
+        }
+
+        return octave * (_size - 1) + index;
+    }
+
+    // index of the last item not above value, -1 when value lies below the
+    // first item; binary searched with a last-hit shortcut when the items
+    // are in ascending order, linearly scanned otherwise
+    int findItem(int value) const {
+        if (_itemsSorted) {
+            // quantized inputs usually move slowly, check the last hit and
+            // its upper neighbor before searching
+            int last = _lastItemIndex;
+            if (last >= 0 && last < _size && value >= _items[last] &&
+                (last + 1 >= _size || value < _items[last + 1])) {
+                return last;
+            }
+
+            // binary search for the first item above value
+            int lo = 0;
+            int hi = _size;
+            while (lo < hi) {
+                int mid = (lo + hi) / 2;
+                if (value < _items[mid]) {
+                    hi = mid;
+                } else {
+                    lo = mid + 1;
+                }
+            }
+            _lastItemIndex = int8_t(lo - 1);
+            return lo - 1;
+        }
+
         int index = -1;
         for (int i = 0; i < _size; ++i) {
-            if (itemValue < _items[i]) {
+            if (value < _items[i]) {
                 break;
             }
             index = i;
         }
+        return index;
+    }
 
-        if (index == -1) {
-            index = _size -1;
-            --octave;
+    void updateItemsSorted() {
+        _itemsSorted = true;
+        for (int i = 1; i < _size; ++i) {
+            if (_items[i] < _items[i - 1]) {
+                _itemsSorted = false;
+                break;
+            }
         }
-
-        return octave * (_size - 1) + index;
+        _lastItemIndex = -1;
     }
 
     float octaveRangeVolts() const {
         return (_items[_size - 1] - _items[0]) * (1.f / 1000.f);
     }
 
+    void notifyChanged() {
+        _observable.notify(*this);
+    }
+
     char _name[NameLength + 1];
     Mode _mode;
     uint8_t _size;
     ItemArray _items;
+    bool _itemsSorted = true;
+    mutable int8_t _lastItemIndex = -1;
+
+    static Observable<const UserScale &, 2> _observable;
 };
@@ -2,6 +2,7 @@
 #include "model/Model.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
 
 namespace py = pybind11;
 
@@ -273,6 +274,7 @@ void register_sequencer(py::module &m) {
         .def_property("slideTime", &CurveTrack::slideTime, &CurveTrack::setSlideTime)
         .def_property("rotate", &CurveTrack::rotate, &CurveTrack::setRotate)
         .def_property("shapeProbabilityBias", &CurveTrack::shapeProbabilityBias, &CurveTrack::setShapeProbabilityBias)
+        .def_property("shapeMorph", &CurveTrack::shapeMorph, &CurveTrack::setShapeMorph)
         .def_property("gateProbabilityBias", &CurveTrack::gateProbabilityBias, &CurveTrack::setGateProbabilityBias)
         .def_property_readonly("sequences", [] (CurveTrack &curveTrack) {
             py::list result;
@@ -377,10 +379,39 @@ void register_sequencer(py::module &m) {
             }
             return result;
         })
+        .def("layerValues", [] (NoteSequence &noteSequence, NoteSequence::Layer layer) {
+            py::list result;
+            for (int i = 0; i < CONFIG_STEP_COUNT; ++i) {
+                result.append(noteSequence.step(i).layerValue(layer));
+            }
+            return result;
+        })
+        .def("setLayerValues", [] (NoteSequence &noteSequence, NoteSequence::Layer layer, py::sequence values) {
+            int count = int(py::len(values));
+            if (count > CONFIG_STEP_COUNT) {
+                count = CONFIG_STEP_COUNT;
+            }
+            for (int i = 0; i < count; ++i) {
+                noteSequence.step(i).setLayerValue(layer, py::cast<int>(values[i]));
+            }
+        })
         .def("clear", &NoteSequence::clear)
         .def("clearSteps", &NoteSequence::clearSteps)
         .def("shiftSteps", &NoteSequence::shiftSteps)
         .def("duplicateSteps", &NoteSequence::duplicateSteps)
+        // zero-copy numpy view (steps x bytes) of the packed step storage,
+        // passing the owning object as base keeps the sequence alive; bulk
+        // sequence comparisons run at memcpy speed instead of going through
+        // per-step accessor round trips
+        .def_property_readonly("stepData", [] (py::object &obj) {
+            auto &noteSequence = obj.cast<NoteSequence &>();
+            return py::array_t<uint8_t>(
+                { size_t(CONFIG_STEP_COUNT), sizeof(NoteSequence::Step) },
+                { sizeof(NoteSequence::Step), size_t(1) },
+                reinterpret_cast<uint8_t *>(noteSequence.steps().data()),
+                obj
+            );
+        })
     ;
 
     py::enum_<NoteSequence::Layer>(noteSequence, "Layer")
@@ -437,6 +468,22 @@ void register_sequencer(py::module &m) {
             }
             return result;
         })
+        .def("layerValues", [] (CurveSequence &curveSequence, CurveSequence::Layer layer) {
+            py::list result;
+            for (int i = 0; i < CONFIG_STEP_COUNT; ++i) {
+                result.append(curveSequence.step(i).layerValue(layer));
+            }
+            return result;
+        })
+        .def("setLayerValues", [] (CurveSequence &curveSequence, CurveSequence::Layer layer, py::sequence values) {
+            int count = int(py::len(values));
+            if (count > CONFIG_STEP_COUNT) {
+                count = CONFIG_STEP_COUNT;
+            }
+            for (int i = 0; i < count; ++i) {
+                curveSequence.step(i).setLayerValue(layer, py::cast<int>(values[i]));
+            }
+        })
         .def("clear", &CurveSequence::clear)
         .def("clearSteps", &CurveSequence::clearSteps)
         .def("shiftSteps", &CurveSequence::shiftSteps)
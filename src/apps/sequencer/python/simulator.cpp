@@ -1,6 +1,7 @@
 #include "sim/Simulator.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
 
 namespace py = pybind11;
 
@@ -22,6 +23,18 @@ void register_simulator(py::module &m) {
         .def("sendMidi", &Simulator::sendMidi)
         .def("screenshot", &Simulator::screenshot)
         .def_property_readonly("targetState", &Simulator::targetState, py::return_value_policy::reference)
+        // zero-copy numpy view (height x width) of the emulated framebuffer,
+        // passing the owning object as base keeps the simulator alive and
+        // avoids the element-wise pixel copy for screenshot diffing
+        .def_property_readonly("framebuffer", [] (py::object &obj) {
+            auto &simulator = obj.cast<Simulator &>();
+            return py::array_t<uint8_t>(
+                { size_t(TargetConfig::LcdHeight), size_t(TargetConfig::LcdWidth) },
+                { size_t(TargetConfig::LcdWidth), size_t(1) },
+                simulator.targetState().lcd.state.data(),
+                obj
+            );
+        })
     ;
 
     // ------------------------------------------------------------------------
@@ -1,11 +1,91 @@
+"""Sharded test runner.
+
+Each test process hosts a single simulator instance (FileManager, Profiler
+and Debug are static), so the suite is parallelized across processes instead:
+the discovered tests are split into N shards and every shard runs in its own
+subprocess with a private working directory and sd card image
+(SIM_SDCARD_IMAGE), so shards never contend on shared files. A prebuilt
+fixture image is copied into each shard instead of every shard formatting its
+own card.
+"""
+
+import argparse
+import multiprocessing
 import os
+import shutil
+import subprocess
+import sys
+import tempfile
 import unittest
 
-if __name__ == "__main__":
+TESTS_DIR = os.path.dirname(os.path.abspath(__file__))
+
+
+def collect_test_ids():
+    ids = []
+
+    def collect(suite):
+        for test in suite:
+            if isinstance(test, unittest.TestSuite):
+                collect(test)
+            else:
+                ids.append(test.id())
+
+    collect(unittest.TestLoader().discover(TESTS_DIR, "*.py"))
+    return ids
+
+
+def run_tests(test_ids):
+    sys.path.insert(0, TESTS_DIR)
     loader = unittest.TestLoader()
-    tests = loader.discover(os.path.dirname(__file__), "*.py")
-    # print(tests)
+    suite = unittest.TestSuite(loader.loadTestsFromName(name) for name in test_ids)
     runner = unittest.runner.TextTestRunner(verbosity=2)
-    result = runner.run(tests)
-    # print(loader)
-    # unittest.main(testLoader=loader)
+    result = runner.run(suite)
+    return 0 if result.wasSuccessful() else 1
+
+
+def run_shard(index, test_ids, fixture_image):
+    workdir = tempfile.mkdtemp(prefix="sequencer-test-shard%d-" % index)
+    env = dict(os.environ)
+    image = os.path.join(workdir, "sdcard.iso")
+    if fixture_image and os.path.exists(fixture_image):
+        shutil.copyfile(fixture_image, image)
+    env["SIM_SDCARD_IMAGE"] = image
+    return subprocess.Popen(
+        [sys.executable, os.path.abspath(__file__), "--run"] + test_ids,
+        cwd=workdir,
+        env=env,
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(description="run the ui/engine test suite")
+    parser.add_argument("--jobs", type=int, default=multiprocessing.cpu_count(),
+                        help="number of parallel shards")
+    parser.add_argument("--fixture-image", default=os.path.join(TESTS_DIR, "sdcard.iso"),
+                        help="prebuilt sd card image copied into every shard")
+    parser.add_argument("--run", nargs="+", help=argparse.SUPPRESS)
+    args = parser.parse_args()
+
+    # shard subprocess entry point
+    if args.run:
+        sys.exit(run_tests(args.run))
+
+    test_ids = collect_test_ids()
+    jobs = max(1, min(args.jobs, len(test_ids)))
+
+    if jobs == 1:
+        sys.exit(run_tests(test_ids))
+
+    # round robin distribution, neighbouring tests tend to have similar cost
+    shards = [test_ids[i::jobs] for i in range(jobs)]
+    processes = [run_shard(i, shard, args.fixture_image) for i, shard in enumerate(shards)]
+
+    exitcode = 0
+    for process in processes:
+        exitcode |= process.wait()
+    sys.exit(exitcode)
+
+
+if __name__ == "__main__":
+    main()
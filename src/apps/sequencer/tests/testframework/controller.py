@@ -143,3 +143,8 @@ class Controller:
         filename = os.path.join(self._screenshotDir, name + ".png")
         self._simulator.screenshot(filename)
         return self
+
+    def framebuffer(self):
+        # zero-copy numpy view (height x width) of the current framebuffer,
+        # suitable for fast screenshot diffing without writing png files
+        return self._simulator.framebuffer
@@ -14,6 +14,7 @@ void MessageManager::showMessage(const char *text, uint32_t duration) {
     os::LockGuard lock(_mutex);
 
     StringUtils::copy(_text, text, sizeof(_text));
+    _staticText = nullptr;
     _timeout = os::ticks() + os::time::ms(duration);
 }
 
@@ -36,5 +37,5 @@ void MessageManager::draw(Canvas &canvas) {
 
     canvas.setFont(Font::Tiny);
     canvas.setColor(0xf);
-    canvas.drawTextCentered(16, 16, 224, 32, _text);
+    canvas.drawTextCentered(16, 16, 224, 32, _staticText ? _staticText : _text);
 }
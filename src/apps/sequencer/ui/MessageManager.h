@@ -1,6 +1,7 @@
 #pragma once
 
 #include "os/os.h"
+#include "os/LockGuard.h"
 
 #include "core/gfx/Canvas.h"
 
@@ -10,14 +11,32 @@ class MessageManager {
 public:
     MessageManager();
 
+    // shows a message, the text is copied
     void showMessage(const char *text, uint32_t duration = 1000);
 
+    // overload for string literals (and other character arrays with static
+    // storage duration), the text is referenced instead of copied so posting
+    // a message amounts to a pointer store
+    template<size_t N>
+    void showMessage(const char (&text)[N], uint32_t duration = 1000) {
+        os::LockGuard lock(_mutex);
+
+        _staticText = text;
+        _timeout = os::ticks() + os::time::ms(duration);
+    }
+
     void update();
 
     void draw(Canvas &canvas);
 
+    bool visible() {
+        os::LockGuard lock(_mutex);
+        return _timeout != 0;
+    }
+
 private:
     char _text[64];
+    const char *_staticText = nullptr;
     uint32_t _timeout = 0;
 
     os::Mutex _mutex;
@@ -23,6 +23,18 @@ public:
 
     virtual bool isModal() const { return false; }
 
+    // Overlay pages cover only part of the screen. While an overlay is the
+    // top page, the page manager draws the pages underneath once, saves the
+    // covered framebuffer region and composites the overlay over the saved
+    // background on subsequent frames, see PageManager::draw().
+    virtual bool isOverlay() const { return false; }
+    virtual void overlayRect(int &x, int &y, int &w, int &h) const {
+        x = 0;
+        y = 0;
+        w = Width;
+        h = Height;
+    }
+
     // Event handlers
     virtual void keyDown(KeyEvent &event) {}
     virtual void keyUp(KeyEvent &event) {}
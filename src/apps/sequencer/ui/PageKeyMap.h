@@ -3,7 +3,7 @@
 #include "Key.h"
 
 //  Project     Layout      Routing     MidiOutput  UserScale   -       -       System
-//  SequenceEdt Sequence    Track       Song        -           -       -       Monitor
+//  SequenceEdt Sequence    Track       Song        -           -       Tasks   Monitor
 
 namespace PageKeyMap {
 
@@ -25,35 +25,36 @@ namespace PageKeyMap {
         Song            = Key::Step3,
 
         System          = Key::Track7,
+        Tasks           = Key::Step6,
         Monitor         = Key::Step7,
     };
 
-    static bool isPageKey(int code) {
-        switch (code) {
-        case Clock:
-        case Pattern:
-        case Performer:
-        case Overview:
-
-        case Project:
-        case Layout:
-        case Routing:
-        case MidiOutput:
-        case UserScale:
-
-        case SequenceEdit:
-        case Sequence:
-        case Track:
-        case Song:
-
-        case System:
-        case Monitor:
-            return true;
-        default:
-            break;
-        }
-
-        return false;
+    // page keys as a bitmask over the key codes (all codes are < 64), so
+    // classifying a key is a single shift and mask instead of a switch on
+    // the hot led and key dispatch paths
+    static constexpr uint64_t PageKeyMask =
+        (uint64_t(1) << Clock) |
+        (uint64_t(1) << Pattern) |
+        (uint64_t(1) << Performer) |
+        (uint64_t(1) << Overview) |
+
+        (uint64_t(1) << Project) |
+        (uint64_t(1) << Layout) |
+        (uint64_t(1) << Routing) |
+        (uint64_t(1) << MidiOutput) |
+        (uint64_t(1) << UserScale) |
+
+        (uint64_t(1) << SequenceEdit) |
+        (uint64_t(1) << Sequence) |
+        (uint64_t(1) << Track) |
+        (uint64_t(1) << Song) |
+
+        (uint64_t(1) << System) |
+        (uint64_t(1) << Tasks) |
+        (uint64_t(1) << Monitor);
+
+    static constexpr bool isPageKey(int code) {
+        return code >= 0 && code < 64 && ((PageKeyMask >> code) & 1) != 0;
     }
 
 } // namespace PageKeyMap
@@ -50,6 +50,35 @@ void PageManager::replace(int index, Page *page) {
 }
 
 void PageManager::draw(Canvas &canvas) {
+#if CONFIG_ENABLE_PROFILER
+    Profiler::Scope scope(_drawInterval);
+#endif
+    _frameScratch.reset();
+
+    // composite an overlay on top of a saved background, so the pages
+    // underneath only draw once while the overlay is up
+    Page *topPage = top();
+    if (topPage->isOverlay() && _pageStackPos > 0) {
+        int x, y, w, h;
+        topPage->overlayRect(x, y, w, h);
+        if (w * h <= int(_overlayBackground.size())) {
+            if (_overlayBackgroundPage != topPage) {
+                // first frame: draw the pages underneath and save the
+                // region the overlay is about to cover
+                for (int i = 0; i < _pageStackPos; ++i) {
+                    _pageStack[i]->draw(canvas);
+                }
+                canvas.saveRect(x, y, w, h, _overlayBackground.data());
+                _overlayBackgroundPage = topPage;
+            } else {
+                canvas.restoreRect(x, y, w, h, _overlayBackground.data());
+            }
+            topPage->draw(canvas);
+            return;
+        }
+    }
+    _overlayBackgroundPage = nullptr;
+
     // draw bottom to top
     for (int i = 0; i <= _pageStackPos; ++i) {
         _pageStack[i]->draw(canvas);
@@ -6,6 +6,8 @@
 #include "Leds.h"
 
 #include "core/gfx/Canvas.h"
+#include "core/profiler/Profiler.h"
+#include "core/utils/BumpAllocator.h"
 
 #include <array>
 #include <functional>
@@ -33,8 +35,21 @@ public:
     void draw(Canvas &canvas);
     void updateLeds(Leds &leds);
 
+    // force redrawing the pages underneath an overlay on the next frame,
+    // used when something outside the page stack painted over the canvas
+    void invalidateOverlayBackground() { _overlayBackgroundPage = nullptr; }
+
+    // scratch arena for temporary strings and layout data built during
+    // draw, reset before the page stack is drawn each frame
+    BumpAllocator<1024> &frameScratch() { return _frameScratch; }
+
     int fps() const;
 
+#if CONFIG_ENABLE_PROFILER
+    // smoothed time spent drawing the page stack per frame
+    uint32_t drawTimeUs() const { return _drawInterval.avgUs(); }
+#endif
+
     void dispatchEvent(Event &event);
 
     void setPageSwitchHandler(PageSwitchHandler pageSwitchHandler) {
@@ -49,8 +64,18 @@ private:
     }
 
     Pages &_pages;
+    BumpAllocator<1024> _frameScratch;
     static const int PageStackSize = 8;
     std::array<Page *, PageStackSize> _pageStack;
     int _pageStackPos = -1;
     PageSwitchHandler _pageSwitchHandler;
+
+    // saved background region for overlay compositing, sized for the
+    // tallest overlay (full width, 16 rows)
+    static const int OverlayBackgroundRows = 16;
+    std::array<uint8_t, CONFIG_LCD_WIDTH * OverlayBackgroundRows> _overlayBackground;
+    Page *_overlayBackgroundPage = nullptr;
+#if CONFIG_ENABLE_PROFILER
+    Profiler::Interval _drawInterval{"page.draw"};
+#endif
 };
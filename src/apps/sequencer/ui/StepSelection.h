@@ -2,7 +2,8 @@
 
 #include "Key.h"
 
-#include <bitset>
+#include "core/utils/BitSet.h"
+
 #include <functional>
 
 #include <cstdint>
@@ -86,8 +87,14 @@ public:
             if (otherStep >= 0) {
                 int firstIndex = stepOffset + otherStep;
                 int interval = stepIndex - firstIndex;
-                for (int i = firstIndex; i >= 0 && i < int(_selected.size()); i += interval) {
-                    _selected.set(i);
+                if (interval == 1) {
+                    _selected.setRange(firstIndex, int(_selected.size()) - 1);
+                } else if (interval == -1) {
+                    _selected.setRange(0, firstIndex);
+                } else {
+                    for (int i = firstIndex; i >= 0 && i < int(_selected.size()); i += interval) {
+                        _selected.set(i);
+                    }
                 }
                 event.consume();
             } else {
@@ -146,12 +153,19 @@ public:
         return _selected.count();
     }
 
-    const std::bitset<N> &selected() const { return _selected; }
+    const BitSet<N> &selected() const { return _selected; }
 
     bool operator[](int index) const {
         return _selected[index];
     }
 
+    // calls func(stepIndex) for each selected step, scanning a word of
+    // steps at a time
+    template<typename Func>
+    void forEach(Func func) const {
+        _selected.forEachSetBit(func);
+    }
+
 private:
     int otherPressedStepKey(const KeyState &keyState, int step) const {
         bool found = false;
@@ -170,12 +184,7 @@ private:
     }
 
     int firstSetIndex() const {
-        for (size_t i = 0; i < _selected.size(); ++i) {
-            if (_selected[i]) {
-                return i;
-            }
-        }
-        return -1;
+        return _selected.firstSetBit();
     }
 
     enum class Mode : uint8_t {
@@ -184,7 +193,7 @@ private:
     };
 
     Mode _mode = Mode::Immediate;
-    std::bitset<N> _selected;
+    BitSet<N> _selected;
     int _first = -1;
     int8_t _lastPressedIndex;
     std::function<bool(int, int)> _stepCompare;
@@ -9,6 +9,10 @@
 
 #include "model/Model.h"
 
+// time without input, model changes or engine activity after which the UI
+// falls back to the idle frame rate
+static constexpr uint32_t IdleTimeoutMs = 1000;
+
 Ui::Ui(Model &model, Engine &engine, Lcd &lcd, ButtonLedMatrix &blm, Encoder &encoder) :
     _model(model),
     _engine(engine),
@@ -27,6 +31,7 @@ Ui::Ui(Model &model, Engine &engine, Lcd &lcd, ButtonLedMatrix &blm, Encoder &en
 void Ui::init() {
     _pageKeyState.reset();
     _globalKeyState.reset();
+    _ledState.fill({ 0, 0 });
 
     _pageManager.setPageSwitchHandler([this] (Page *page) {
         _pageKeyState.reset();
@@ -48,21 +53,8 @@ void Ui::init() {
         return port == MidiPort::UsbMidi && _controllerManager.isConnected();
     });
 
-    _engine.setUsbMidiConnectHandler([this] (uint16_t vendorId, uint16_t productId) {
-        _messageManager.showMessage("USB MIDI DEVICE CONNECTED");
-        _controllerManager.connect(vendorId, productId);
-    });
-
-    _engine.setUsbMidiDisconnectHandler([this] () {
-        _messageManager.showMessage("USB MIDI DEVICE DISCONNECTED");
-        _controllerManager.disconnect();
-    });
-
-    _engine.setMessageHandler([this] (const char *text, uint32_t duration) {
-        _messageManager.showMessage(text, duration);
-    });
-
     _lastFrameBufferUpdateTicks = os::ticks();
+    _lastActivityTicks = os::ticks();
     _lastControllerUpdateTicks = os::ticks();
 }
 
@@ -70,24 +62,74 @@ void Ui::update() {
     handleKeys();
     handleEncoder();
     handleMidi();
+    handleEvents();
 
     // abort if track engines are not consistent with model
     if (!_engine.trackEnginesConsistent()) {
         return;
     }
 
-    _leds.clear();
-    _pageManager.updateLeds(_leds);
-    _blm.setLeds(_leds.array());
+    // deliver model notifications batched since the last update
+    if (_model.project().flushEvents()) {
+        markActivity();
+    }
+
+    // pages display clock dependent state, keep rendering at full rate
+    // while the engine is running
+    if (_engine.clockRunning()) {
+        markActivity();
+    }
 
-    // update display at target fps
+    // update display at target fps, falling back to a low idle rate when
+    // nothing is going on
     uint32_t currentTicks = os::ticks();
-    uint32_t intervalTicks = os::time::ms(1000 / _pageManager.fps());
+    bool idle = currentTicks - _lastActivityTicks >= os::time::ms(IdleTimeoutMs);
+    int fps = idle ? CONFIG_IDLE_UI_FPS : _pageManager.fps();
+    uint32_t intervalTicks = os::time::ms(1000 / fps);
     if (currentTicks - _lastFrameBufferUpdateTicks >= intervalTicks) {
-        _pageManager.draw(_canvas);
+        // don't accumulate a frame debt when switching back from the idle rate
+        if (currentTicks - _lastFrameBufferUpdateTicks >= 2 * intervalTicks) {
+            _lastFrameBufferUpdateTicks = currentTicks - intervalTicks;
+        }
+        // recompose the led frame at the display rate instead of on every
+        // update and only push it to the driver when it changed. led updates
+        // are shed while the engine update overruns its budget, the leds keep
+        // their last state and gate/cv timing recovers first
+        if (!_engine.updateOverloaded()) {
+            _leds.clear();
+            _pageManager.updateLeds(_leds);
+            if (_leds.array() != _ledState) {
+                _ledState = _leds.array();
+                _blm.setLeds(_ledState);
+            }
+        }
         _messageManager.update();
+        // a message paints outside the overlay region, keep the page stack
+        // redrawing underneath overlays while it shows and one frame after
+        // to wipe it off the canvas
+        bool messageVisible = _messageManager.visible();
+        if (messageVisible || _messageWasVisible) {
+            _pageManager.invalidateOverlayBackground();
+        }
+        _messageWasVisible = messageVisible;
+        _pageManager.draw(_canvas);
         _messageManager.draw(_canvas);
-        _lcd.draw(_frameBuffer.data());
+#if CONFIG_ENABLE_PROFILER
+        // overlay showing page draw time and frame budget utilization
+        {
+            uint32_t drawTimeUs = _pageManager.drawTimeUs();
+            FixedStringBuilder<16> str("%luUS %lu%%", drawTimeUs, (drawTimeUs * fps) / 10000);
+            _canvas.setFont(Font::Tiny);
+            _canvas.setBlendMode(BlendMode::Set);
+            _canvas.setColor(0xf);
+            _canvas.drawText(CONFIG_LCD_WIDTH - _canvas.textWidth(str) - 1, 6, str);
+        }
+#endif
+        // only transfer the part of the frame buffer that was drawn to
+        if (_canvas.dirty()) {
+            _lcd.draw(_frameBuffer.data(), _canvas.dirtyX(), _canvas.dirtyY(), _canvas.dirtyW(), _canvas.dirtyH());
+            _canvas.clearDirty();
+        }
         _lastFrameBufferUpdateTicks += intervalTicks;
     }
 
@@ -121,9 +163,14 @@ void Ui::showAssert(const char *filename, int line, const char *msg) {
     _lcd.draw(_frameBuffer.data());
 }
 
+void Ui::markActivity() {
+    _lastActivityTicks = os::ticks();
+}
+
 void Ui::handleKeys() {
     ButtonLedMatrix::Event event;
     while (_blm.nextEvent(event)) {
+        markActivity();
         bool isDown = event.action() == ButtonLedMatrix::Event::KeyDown;
         _pageKeyState[event.value()] = isDown;
         _globalKeyState[event.value()] = isDown;
@@ -140,10 +187,20 @@ void Ui::handleKeys() {
 void Ui::handleEncoder() {
     Encoder::Event event;
     while (_encoder.nextEvent(event)) {
+        markActivity();
         switch (event) {
         case Encoder::Left:
         case Encoder::Right: {
-            EncoderEvent encoderEvent(event == Encoder::Left ? -1 : 1, _pageKeyState[Key::Encoder]);
+            int value = event == Encoder::Left ? -1 : 1;
+            // coalesce buffered steps in the same direction into one event,
+            // fast spins scrub by the full step count instead of getting
+            // throttled to one step per frame
+            Encoder::Event bufferedEvent;
+            while (_encoder.peekEvent(bufferedEvent) && bufferedEvent == event) {
+                _encoder.nextEvent(bufferedEvent);
+                value += value < 0 ? -1 : 1;
+            }
+            EncoderEvent encoderEvent(value, _pageKeyState[Key::Encoder]);
             _pageManager.dispatchEvent(encoderEvent);
             break;
         }
@@ -165,8 +222,37 @@ void Ui::handleEncoder() {
     }
 }
 
+void Ui::handleEvents() {
+    Engine::Event event;
+    while (_engine.nextEvent(event)) {
+        switch (event.type) {
+        case Engine::Event::Message: {
+            // force the copying overload, the event payload is transient
+            const char *text = event.message.text;
+            _messageManager.showMessage(text, event.message.duration);
+            markActivity();
+            break;
+        }
+        case Engine::Event::UsbMidiConnect:
+            _messageManager.showMessage("USB MIDI DEVICE CONNECTED");
+            _controllerManager.connect(event.usbMidi.vendorId, event.usbMidi.productId);
+            markActivity();
+            break;
+        case Engine::Event::UsbMidiDisconnect:
+            _messageManager.showMessage("USB MIDI DEVICE DISCONNECTED");
+            _controllerManager.disconnect();
+            markActivity();
+            break;
+        case Engine::Event::MidiLearn:
+            _engine.midiLearn().dispatchResult(event.midiLearn);
+            break;
+        }
+    }
+}
+
 void Ui::handleMidi() {
     while (_midiMessages.readable()) {
+        markActivity();
         auto item = _midiMessages.read();
         if (!_controllerManager.recvMidi(item.first, item.second)) {
             MidiEvent midiEvent(item.first, item.second);
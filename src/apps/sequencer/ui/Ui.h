@@ -39,6 +39,9 @@ private:
     void handleKeys();
     void handleEncoder();
     void handleMidi();
+    void handleEvents();
+
+    void markActivity();
 
     Model &_model;
     Engine &_engine;
@@ -52,13 +55,20 @@ private:
     FrameBuffer8bit _frameBuffer;
     Canvas _canvas;
     uint32_t _lastFrameBufferUpdateTicks;
+    uint32_t _lastActivityTicks;
 
     KeyState _pageKeyState;
     KeyState _globalKeyState;
     KeyPressEventTracker _keyPressEventTracker;
     Leds _leds;
+    // last led frame pushed to the driver, recomposed frames that match are
+    // not pushed again
+    Leds::LedArray _ledState;
 
     MessageManager _messageManager;
+    // whether a message was drawn last frame, used to invalidate the
+    // overlay background once after it disappears
+    bool _messageWasVisible = false;
 
     PageManager _pageManager;
     PageContext _pageContext;
@@ -111,6 +111,7 @@ LaunchpadController::LaunchpadController(ControllerManager &manager, Model &mode
 
     _device->setButtonHandler([this] (int row, int col, bool state) {
         // DBG("button %d/%d - %d", row, col, state);
+        _buttonActivity = true;
         if (state) {
             buttonDown(row, col);
         } else {
@@ -126,6 +127,17 @@ LaunchpadController::~LaunchpadController() {
 }
 
 void LaunchpadController::update() {
+    // the grid only animates while the clock is running, when idle a
+    // reduced refresh rate still picks up edits made on the main ui
+    // within 100ms
+    uint32_t currentTicks = os::ticks();
+    bool idle = !_engine.clockRunning() && !_buttonActivity;
+    if (idle && currentTicks - _lastRedrawTicks < os::time::ms(100)) {
+        return;
+    }
+    _lastRedrawTicks = currentTicks;
+    _buttonActivity = false;
+
     _device->clearLeds();
 
     CALL_MODE_FUNCTION(_mode, Draw)
@@ -161,6 +161,9 @@ private:
     LaunchpadDevice *_device;
     Mode _mode = Mode::Sequence;
 
+    uint32_t _lastRedrawTicks = 0;
+    bool _buttonActivity = false;
+
     struct {
         Navigation navigation = { 0, 0, 0, 7, 0, 0 };
     } _sequence;
@@ -51,34 +51,17 @@ void LaunchpadDevice::recvMidi(const MidiMessage &message) {
 
 void LaunchpadDevice::syncLeds() {
     // grid
-    for (int row = 0; row < Rows; ++row) {
-        for (int col = 0; col < Cols; ++col) {
-            int index = row * Cols + col;
-            if (_deviceLedState[index] != _ledState[index]) {
-                if (sendMidi(MidiMessage::makeNoteOn(0, row * 16 + col, _ledState[index]))) {
-                    _deviceLedState[index] = _ledState[index];
-                }
-            }
-        }
-    }
+    syncLedRange(0, Rows * Cols, [] (int i, uint8_t state) {
+        return MidiMessage::makeNoteOn(0, (i / Cols) * 16 + (i % Cols), state);
+    });
 
     // scene
-    for (int col = 0; col < Cols; ++col) {
-        int index = SceneRow * Cols + col;
-        if (_deviceLedState[index] != _ledState[index]) {
-            if (sendMidi(MidiMessage::makeNoteOn(0, col * 16 + 8, _ledState[index]))) {
-                _deviceLedState[index] = _ledState[index];
-            }
-        }
-    }
+    syncLedRange(SceneRow * Cols, Cols, [] (int col, uint8_t state) {
+        return MidiMessage::makeNoteOn(0, col * 16 + 8, state);
+    });
 
     // function
-    for (int col = 0; col < Cols; ++col) {
-        int index = FunctionRow * Cols + col;
-        if (_deviceLedState[index] != _ledState[index]) {
-            if (sendMidi(MidiMessage::makeControlChange(0, 104 + col, _ledState[index]))) {
-                _deviceLedState[index] = _ledState[index];
-            }
-        }
-    }
+    syncLedRange(FunctionRow * Cols, Cols, [] (int col, uint8_t state) {
+        return MidiMessage::makeControlChange(0, 104 + col, state);
+    });
 }
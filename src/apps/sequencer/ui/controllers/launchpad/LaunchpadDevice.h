@@ -85,6 +85,31 @@ protected:
         }
     }
 
+    // Send updates for the leds in [first, first + count) whose state differs
+    // from the state known to be on the device. The scan compares word-wise,
+    // so unchanged ranges (the common case between cursor movements) are
+    // skipped quickly. first and count have to be multiples of 4. makeMessage
+    // is called with the led index relative to first and the new state and
+    // has to return the midi message updating that led.
+    template<typename MakeMessage>
+    void syncLedRange(int first, int count, MakeMessage makeMessage) {
+        const uint32_t *current = reinterpret_cast<const uint32_t *>(&_ledState[first]);
+        const uint32_t *device = reinterpret_cast<const uint32_t *>(&_deviceLedState[first]);
+        for (int word = 0; word < count / 4; ++word) {
+            if (current[word] == device[word]) {
+                continue;
+            }
+            for (int i = word * 4; i < word * 4 + 4; ++i) {
+                int index = first + i;
+                if (_deviceLedState[index] != _ledState[index]) {
+                    if (sendMidi(makeMessage(i, _ledState[index]))) {
+                        _deviceLedState[index] = _ledState[index];
+                    }
+                }
+            }
+        }
+    }
+
     SendMidiHandler _sendMidiHandler;
     ButtonHandler _buttonHandler;
     std::bitset<ButtonCount> _buttonState;
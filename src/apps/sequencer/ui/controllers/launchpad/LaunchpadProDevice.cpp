@@ -52,34 +52,17 @@ void LaunchpadProDevice::recvMidi(const MidiMessage &message) {
 
 void LaunchpadProDevice::syncLeds() {
     // grid
-    for (int row = 0; row < Rows; ++row) {
-        for (int col = 0; col < Cols; ++col) {
-            int index = row * Cols + col;
-            if (_deviceLedState[index] != _ledState[index]) {
-                if (sendMidi(MidiMessage::makeNoteOn(0, 11 + 10 * (7 - row) + col, _ledState[index]))) {
-                    _deviceLedState[index] = _ledState[index];
-                }
-            }
-        }
-    }
+    syncLedRange(0, Rows * Cols, [] (int i, uint8_t state) {
+        return MidiMessage::makeNoteOn(0, 11 + 10 * (7 - i / Cols) + i % Cols, state);
+    });
 
     // scene
-    for (int col = 0; col < Cols; ++col) {
-        int index = SceneRow * Cols + col;
-        if (_deviceLedState[index] != _ledState[index]) {
-            if (sendMidi(MidiMessage::makeControlChange(0, 11 + 10 * (7 - col) + 8, _ledState[index]))) {
-                _deviceLedState[index] = _ledState[index];
-            }
-        }
-    }
+    syncLedRange(SceneRow * Cols, Cols, [] (int col, uint8_t state) {
+        return MidiMessage::makeControlChange(0, 11 + 10 * (7 - col) + 8, state);
+    });
 
     // function
-    for (int col = 0; col < Cols; ++col) {
-        int index = FunctionRow * Cols + col;
-        if (_deviceLedState[index] != _ledState[index]) {
-            if (sendMidi(MidiMessage::makeControlChange(0, 91 + col, _ledState[index]))) {
-                _deviceLedState[index] = _ledState[index];
-            }
-        }
-    }
+    syncLedRange(FunctionRow * Cols, Cols, [] (int col, uint8_t state) {
+        return MidiMessage::makeControlChange(0, 91 + col, state);
+    });
 }
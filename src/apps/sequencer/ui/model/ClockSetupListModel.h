@@ -36,6 +36,7 @@ private:
     enum Item {
         Mode,
         ShiftMode,
+        Ppqn,
         ClockInputDivisor,
         ClockInputMode,
         ClockOutputDivisor,
@@ -53,6 +54,7 @@ private:
         switch (item) {
         case Mode:              return "Mode";
         case ShiftMode:         return "Shift Mode";
+        case Ppqn:              return "PPQN";
         case ClockInputDivisor: return "Input Divisor";
         case ClockInputMode:    return "Input Mode";
         case ClockOutputDivisor:return "Output Divisor";
@@ -80,6 +82,9 @@ private:
         case ShiftMode:
             _clockSetup.printShiftMode(str);
             break;
+        case Ppqn:
+            _clockSetup.printPpqn(str);
+            break;
         case ClockInputDivisor:
             _clockSetup.printClockInputDivisor(str);
             break;
@@ -123,6 +128,9 @@ private:
         case ShiftMode:
             _clockSetup.editShiftMode(value, shift);
             break;
+        case Ppqn:
+            _clockSetup.editPpqn(value, shift);
+            break;
         case ClockInputDivisor:
             _clockSetup.editClockInputDivisor(value, shift);
             break;
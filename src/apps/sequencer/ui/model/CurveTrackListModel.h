@@ -42,6 +42,8 @@ public:
             return Routing::Target::Rotate;
         case ShapeProbabilityBias:
             return Routing::Target::ShapeProbabilityBias;
+        case ShapeMorph:
+            return Routing::Target::ShapeMorph;
         case GateProbabilityBias:
             return Routing::Target::GateProbabilityBias;
         default:
@@ -53,9 +55,12 @@ private:
     enum Item {
         PlayMode,
         FillMode,
+        ExtendedSteps,
+        CvUpdateMode,
         SlideTime,
         Rotate,
         ShapeProbabilityBias,
+        ShapeMorph,
         GateProbabilityBias,
         Last
     };
@@ -64,9 +69,12 @@ private:
         switch (item) {
         case PlayMode:              return "Play Mode";
         case FillMode:              return "Fill Mode";
+        case ExtendedSteps:         return "128 Steps";
+        case CvUpdateMode:          return "CV Update Mode";
         case SlideTime:             return "Slide Time";
         case Rotate:                return "Rotate";
         case ShapeProbabilityBias:  return "Shape P. Bias";
+        case ShapeMorph:            return "Shape Morph";
         case GateProbabilityBias:   return "Gate P. Bias";
         case Last:                  break;
         }
@@ -85,6 +93,12 @@ private:
         case FillMode:
             _track->printFillMode(str);
             break;
+        case ExtendedSteps:
+            _track->printExtendedSteps(str);
+            break;
+        case CvUpdateMode:
+            _track->printCvUpdateMode(str);
+            break;
         case SlideTime:
             _track->printSlideTime(str);
             break;
@@ -94,6 +108,9 @@ private:
         case ShapeProbabilityBias:
             _track->printShapeProbabilityBias(str);
             break;
+        case ShapeMorph:
+            _track->printShapeMorph(str);
+            break;
         case GateProbabilityBias:
             _track->printGateProbabilityBias(str);
             break;
@@ -110,6 +127,12 @@ private:
         case FillMode:
             _track->editFillMode(value, shift);
             break;
+        case ExtendedSteps:
+            _track->editExtendedSteps(value, shift);
+            break;
+        case CvUpdateMode:
+            _track->editCvUpdateMode(value, shift);
+            break;
         case SlideTime:
             _track->editSlideTime(value, shift);
             break;
@@ -119,6 +142,9 @@ private:
         case ShapeProbabilityBias:
             _track->editShapeProbabilityBias(value, shift);
             break;
+        case ShapeMorph:
+            _track->editShapeMorph(value, shift);
+            break;
         case GateProbabilityBias:
             _track->editGateProbabilityBias(value, shift);
             break;
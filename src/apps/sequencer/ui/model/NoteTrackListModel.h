@@ -61,6 +61,7 @@ private:
     enum Item {
         PlayMode,
         FillMode,
+        ExtendedSteps,
         CvUpdateMode,
         SlideTime,
         Octave,
@@ -77,6 +78,7 @@ private:
         switch (item) {
         case PlayMode:  return "Play Mode";
         case FillMode:  return "Fill Mode";
+        case ExtendedSteps: return "128 Steps";
         case CvUpdateMode:  return "CV Update Mode";
         case SlideTime: return "Slide Time";
         case Octave:    return "Octave";
@@ -103,6 +105,9 @@ private:
         case FillMode:
             _track->printFillMode(str);
             break;
+        case ExtendedSteps:
+            _track->printExtendedSteps(str);
+            break;
         case CvUpdateMode:
             _track->printCvUpdateMode(str);
             break;
@@ -143,6 +148,9 @@ private:
         case FillMode:
             _track->editFillMode(value, shift);
             break;
+        case ExtendedSteps:
+            _track->editExtendedSteps(value, shift);
+            break;
         case CvUpdateMode:
             _track->editCvUpdateMode(value, shift);
             break;
@@ -57,6 +57,7 @@ private:
         RecordMode,
         CvGateInput,
         CurveCvInput,
+        MidiThru,
         Last
     };
 
@@ -72,6 +73,7 @@ private:
         case RecordMode:        return "Record Mode";
         case CvGateInput:       return "CV/Gate Input";
         case CurveCvInput:      return "Curve CV Input";
+        case MidiThru:          return "MIDI Thru";
         case Last:              break;
         }
         return nullptr;
@@ -113,6 +115,9 @@ private:
         case CurveCvInput:
             _project.printCurveCvInput(str);
             break;
+        case MidiThru:
+            _project.printMidiThru(str);
+            break;
         case Last:
             break;
         }
@@ -149,6 +154,9 @@ private:
         case CurveCvInput:
             _project.editCurveCvInput(value, shift);
             break;
+        case MidiThru:
+            _project.editMidiThru(value, shift);
+            break;
         case Last:
             break;
         }
@@ -13,6 +13,7 @@ public:
         Min,
         Max,
         Tracks,
+        Smoothing,
         Source,
         FirstSource,
         CvRange = FirstSource,
@@ -71,6 +72,7 @@ private:
         case Min:           return "Min";
         case Max:           return "Max";
         case Tracks:        return "Tracks";
+        case Smoothing:     return "Smoothing";
         case Source:        return "Source";
         // case CvRange:
         case MidiSource:    return Routing::isCvSource(_route.source()) ? "Range" : "MIDI Source";
@@ -102,6 +104,9 @@ private:
         case Tracks:
             _route.printTracks(str);
             break;
+        case Smoothing:
+            _route.printSmoothing(str);
+            break;
         case Source:
             _route.printSource(str);
             break;
@@ -146,6 +151,9 @@ private:
         case Tracks:
             // handled in RoutePage
             break;
+        case Smoothing:
+            _route.editSmoothing(value, shift);
+            break;
         case Source:
             _route.editSource(value, shift);
             break;
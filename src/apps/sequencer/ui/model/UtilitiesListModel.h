@@ -6,6 +6,7 @@ class UtilitiesListModel : public ListModel {
 public:
     enum Item {
         FormatSdCard,
+        BenchmarkSdCard,
         Last
     };
 
@@ -31,6 +32,7 @@ private:
     static const char *itemName(Item item) {
         switch (item) {
         case FormatSdCard:      return "Format SD card";
+        case BenchmarkSdCard:   return "Benchmark SD card";
         case Last:              break;
         }
         return nullptr;
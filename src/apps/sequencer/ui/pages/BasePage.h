@@ -28,6 +28,13 @@ public:
 
 protected:
     void showMessage(const char *text, uint32_t duration = 1000);
+
+    // preserves the literal-ness of the text so MessageManager can reference
+    // it instead of copying
+    template<size_t N>
+    void showMessage(const char (&text)[N], uint32_t duration = 1000) {
+        _context.messageManager.showMessage(text, duration);
+    }
     void showContextMenu(const ContextMenu &contextMenu);
 
     const KeyState &pageKeyState() const { return _context.pageKeyState; }
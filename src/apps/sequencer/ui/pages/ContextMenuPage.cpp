@@ -18,8 +18,6 @@ void ContextMenuPage::draw(Canvas &canvas) {
     canvas.setFont(Font::Tiny);
     canvas.setBlendMode(BlendMode::Set);
 
-    const int BarHeight = 12;
-
     canvas.setColor(0x0);
     canvas.fillRect(0, Height - BarHeight - 1, Width, BarHeight + 1);
 
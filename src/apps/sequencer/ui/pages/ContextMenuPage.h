@@ -17,11 +17,24 @@ public:
 
     virtual bool isModal() const override { return true; }
 
+    // the menu only covers the function key bar, let the page manager
+    // composite it over the saved background instead of redrawing the
+    // whole page underneath every frame
+    virtual bool isOverlay() const override { return true; }
+    virtual void overlayRect(int &x, int &y, int &w, int &h) const override {
+        x = 0;
+        y = Height - BarHeight - 1;
+        w = Width;
+        h = BarHeight + 1;
+    }
+
     virtual void keyUp(KeyEvent &event) override;
     virtual void keyPress(KeyPressEvent &event) override;
     virtual void encoder(EncoderEvent &event) override;
 
 protected:
+    static constexpr int BarHeight = 12;
+
     void closeAndCallback(int index);
 
     ContextMenuModel *_contextMenuModel;
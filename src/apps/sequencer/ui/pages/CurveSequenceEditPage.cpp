@@ -47,22 +47,40 @@ static const CurveSequenceListModel::Item quickEditItems[8] = {
     CurveSequenceListModel::Item::Last
 };
 
-static void drawCurve(Canvas &canvas, int x, int y, int w, int h, float &lastY, const Curve::Function function, float min, float max) {
-    const int Step = 1;
+// Cached curve preview polylines. Evaluating the curve function for every
+// column each frame made this the most expensive page to draw, so the column
+// values are cached per visible step (shape and shape variation) and only
+// recomputed when the curve or range changes.
+struct CurvePreview {
+    Curve::Function function = nullptr;
+    float min;
+    float max;
+    float y[CONFIG_LCD_WIDTH / 16 + 1];
+};
+
+// must match StepCount and stepWidth in draw()
+static CurvePreview curvePreviews[16][2];
 
-    auto eval = [=] (float x) {
-        return (1.f - (function(x) * (max - min) + min)) * h;
-    };
+static void drawCurve(Canvas &canvas, int x, int y, int w, int h, float &lastY, const Curve::Function function, float min, float max, CurvePreview &preview) {
+    // recompute the polyline only when the curve or range has changed
+    if (preview.function != function || preview.min != min || preview.max != max) {
+        for (int i = 0; i <= w; ++i) {
+            preview.y[i] = (1.f - (function(float(i) / w) * (max - min) + min)) * h;
+        }
+        preview.function = function;
+        preview.min = min;
+        preview.max = max;
+    }
 
-    float fy0 = y + eval(0.f);
+    float fy0 = y + preview.y[0];
 
     if (lastY >= 0.f && lastY != fy0) {
         canvas.line(x, lastY, x, fy0);
     }
 
-    for (int i = 0; i < w; i += Step) {
-        float fy1 = y + eval((float(i) + Step) / w);
-        canvas.line(x + i, fy0, x + i + Step, fy1);
+    for (int i = 0; i < w; ++i) {
+        float fy1 = y + preview.y[i + 1];
+        canvas.line(x + i, fy0, x + i + 1, fy1);
         fy0 = fy1;
     }
 
@@ -163,7 +181,8 @@ void CurveSequenceEditPage::draw(Canvas &canvas) {
         // step index
         {
             canvas.setColor(_stepSelection[stepIndex] ? 0xf : 0x7);
-            FixedStringBuilder<8> str("%d", stepIndex + 1);
+            FixedStringBuilder<8> str;
+            str.appendInt(stepIndex + 1);
             canvas.drawText(x + (stepWidth - canvas.textWidth(str) + 1) / 2, y - 2, str);
         }
 
@@ -174,7 +193,7 @@ void CurveSequenceEditPage::draw(Canvas &canvas) {
             canvas.setColor(drawShapeVariation ? 0x5 : 0xf);
             canvas.setBlendMode(BlendMode::Add);
 
-            drawCurve(canvas, x, curveY, stepWidth, curveHeight, lastY, function, min, max);
+            drawCurve(canvas, x, curveY, stepWidth, curveHeight, lastY, function, min, max, curvePreviews[i][0]);
         }
 
         if (drawShapeVariation) {
@@ -183,7 +202,7 @@ void CurveSequenceEditPage::draw(Canvas &canvas) {
             canvas.setColor(0xf);
             canvas.setBlendMode(BlendMode::Add);
 
-            drawCurve(canvas, x, curveY, stepWidth, curveHeight, lastYVariation, function, min, max);
+            drawCurve(canvas, x, curveY, stepWidth, curveHeight, lastYVariation, function, min, max, curvePreviews[i][1]);
         }
 
         switch (layer()) {
@@ -341,50 +360,48 @@ void CurveSequenceEditPage::encoder(EncoderEvent &event) {
         return;
     }
 
-    for (size_t stepIndex = 0; stepIndex < sequence.steps().size(); ++stepIndex) {
-        if (_stepSelection[stepIndex]) {
-            auto &step = sequence.step(stepIndex);
-            bool shift = globalKeyState()[Key::Shift];
-            switch (layer()) {
-            case Layer::Shape:
-                step.setShape(step.shape() + event.value());
-                break;
-            case Layer::ShapeVariation:
-                step.setShapeVariation(step.shapeVariation() + event.value());
-                break;
-            case Layer::ShapeVariationProbability:
-                step.setShapeVariationProbability(step.shapeVariationProbability() + event.value());
-                break;
-            case Layer::Min:
-            case Layer::Max: {
-                bool functionPressed = globalKeyState()[MatrixMap::fromFunction(activeFunctionKey())];
-                int offset = event.value() * ((shift || event.pressed()) ? 1 : 8);
-                if (functionPressed) {
-                    // adjust both min and max
-                    offset = clamp(offset, -step.min(), CurveSequence::Max::max() - step.max());
+    bool shift = globalKeyState()[Key::Shift];
+    _stepSelection.forEach([&] (int stepIndex) {
+        auto &step = sequence.step(stepIndex);
+        switch (layer()) {
+        case Layer::Shape:
+            step.setShape(step.shape() + event.value());
+            break;
+        case Layer::ShapeVariation:
+            step.setShapeVariation(step.shapeVariation() + event.value());
+            break;
+        case Layer::ShapeVariationProbability:
+            step.setShapeVariationProbability(step.shapeVariationProbability() + event.value());
+            break;
+        case Layer::Min:
+        case Layer::Max: {
+            bool functionPressed = globalKeyState()[MatrixMap::fromFunction(activeFunctionKey())];
+            int offset = event.value() * ((shift || event.pressed()) ? 1 : 8);
+            if (functionPressed) {
+                // adjust both min and max
+                offset = clamp(offset, -step.min(), CurveSequence::Max::max() - step.max());
+                step.setMin(step.min() + offset);
+                step.setMax(step.max() + offset);
+            } else {
+                // adjust min or max
+                if (layer() == Layer::Min) {
                     step.setMin(step.min() + offset);
-                    step.setMax(step.max() + offset);
                 } else {
-                    // adjust min or max
-                    if (layer() == Layer::Min) {
-                        step.setMin(step.min() + offset);
-                    } else {
-                        step.setMax(step.max() + offset);
-                    }
+                    step.setMax(step.max() + offset);
                 }
-                break;
-            }
-            case Layer::Gate:
-                step.setGate(step.gate() + event.value());
-                break;
-            case Layer::GateProbability:
-                step.setGateProbability(step.gateProbability() + event.value());
-                break;
-            case Layer::Last:
-                break;
             }
+            break;
         }
-    }
+        case Layer::Gate:
+            step.setGate(step.gate() + event.value());
+            break;
+        case Layer::GateProbability:
+            step.setGateProbability(step.gateProbability() + event.value());
+            break;
+        case Layer::Last:
+            break;
+        }
+    });
 
     event.consume();
 }
@@ -5,6 +5,8 @@
 
 #include "core/math/Math.h"
 
+#include <cstring>
+
 ListPage::ListPage(PageManager &manager, PageContext &context, ListModel &listModel) :
     BasePage(manager, context)
 {
@@ -15,6 +17,7 @@ void ListPage::setListModel(ListModel &listModel) {
     _listModel = &listModel;
     setSelectedRow(0);
     _edit = false;
+    invalidateCellCache();
 }
 
 void ListPage::show() {
@@ -23,6 +26,7 @@ void ListPage::show() {
 
 void ListPage::enter() {
     scrollTo(_selectedRow);
+    invalidateCellCache();
 }
 
 void ListPage::exit() {
@@ -34,6 +38,10 @@ void ListPage::draw(Canvas &canvas) {
         displayRow = std::max(0, _listModel->rows() - LineCount);
     }
 
+    // confine the cells to the list area, overlong cell text is cut off at
+    // the clip boundary instead of bleeding into the scrollbar
+    canvas.pushClipRect(0, 12, Width - 10, LineCount * LineHeight);
+
     for (int i = 0; i < LineCount; ++i) {
         int row = displayRow + i;
         if (row < _listModel->rows()) {
@@ -42,7 +50,13 @@ void ListPage::draw(Canvas &canvas) {
         }
     }
 
+    canvas.popClipRect();
+
     WindowPainter::drawScrollbar(canvas, Width - 8, 12, 4, LineCount * LineHeight, _listModel->rows(), LineCount, displayRow);
+
+    // revalidate one cached cell per frame, picking up values changed
+    // outside of edit() (e.g. routed parameters)
+    _cellRefreshIndex = (_cellRefreshIndex + 1) % (LineCount * 2);
 }
 
 void ListPage::updateLeds(Leds &leds) {
@@ -58,6 +72,7 @@ void ListPage::keyPress(KeyPressEvent &event) {
     if (key.isLeft()) {
         if (_edit) {
             _listModel->edit(_selectedRow, 1, -1, globalKeyState()[Key::Shift]);
+            invalidateCellCache();
         } else {
             setSelectedRow(selectedRow() - 1);
         }
@@ -66,6 +81,7 @@ void ListPage::keyPress(KeyPressEvent &event) {
     else if (key.isRight()) {
         if (_edit) {
             _listModel->edit(_selectedRow, 1, 1, globalKeyState()[Key::Shift]);
+            invalidateCellCache();
         } else {
             setSelectedRow(selectedRow() + 1);
         }
@@ -79,6 +95,7 @@ void ListPage::keyPress(KeyPressEvent &event) {
 void ListPage::encoder(EncoderEvent &event) {
     if (_edit) {
         _listModel->edit(_selectedRow, 1, event.value(), event.pressed() | globalKeyState()[Key::Shift]);
+        invalidateCellCache();
     } else {
         setSelectedRow(selectedRow() + event.value());
     }
@@ -97,12 +114,28 @@ void ListPage::setTopRow(int row) {
 }
 
 void ListPage::drawCell(Canvas &canvas, int row, int column, int x, int y, int w, int h) {
-    FixedStringBuilder<32> str;
-    _listModel->cell(row, column, str);
+    // LineCount consecutive rows map to distinct slots, so scrolling simply
+    // repopulates the affected entries
+    auto &entry = _cellCache[(row % LineCount) * 2 + column];
+    if (entry.row != row || entry.column != column || &entry - _cellCache.data() == _cellRefreshIndex) {
+        FixedStringBuilder<CellTextLength> str;
+        _listModel->cell(row, column, str);
+        entry.row = row;
+        entry.column = column;
+        std::strncpy(entry.text, str, CellTextLength);
+        entry.text[CellTextLength - 1] = '\0';
+    }
+
     canvas.setFont(Font::Small);
     canvas.setBlendMode(BlendMode::Set);
     canvas.setColor(column == int(_edit) && row == _selectedRow ? 0xf : 0x7);
-    canvas.drawText(x, y + 7, str);
+    canvas.drawText(x, y + 7, entry.text);
+}
+
+void ListPage::invalidateCellCache() {
+    for (auto &entry : _cellCache) {
+        entry.row = -1;
+    }
 }
 
 void ListPage::scrollTo(int row) {
@@ -4,6 +4,8 @@
 
 #include "ui/model/ListModel.h"
 
+#include <array>
+
 class ListPage : public BasePage {
 public:
     ListPage(PageManager &manager, PageContext &context, ListModel &listModel);
@@ -32,14 +34,31 @@ public:
 protected:
     virtual void drawCell(Canvas &canvas, int row, int column, int x, int y, int w, int h);
 
+    // drops the cached cell text, to be called when the underlying model
+    // changes outside of edit()
+    void invalidateCellCache();
+
 private:
     void scrollTo(int row);
 
     static constexpr int LineHeight = 10;
     static constexpr int LineCount = 4;
+    static constexpr size_t CellTextLength = 32;
+
+    // visible cell text is cached and only reformatted when the cell is
+    // edited or when its round-robin refresh turn comes up, so the steady
+    // state draw cost is a single formatted cell per frame
+    struct CellCacheEntry {
+        int16_t row;
+        int8_t column;
+        char text[CellTextLength];
+    };
 
     ListModel *_listModel;
     int _selectedRow = 0;
     int _displayRow = 0;
     bool _edit = false;
+
+    std::array<CellCacheEntry, LineCount * 2> _cellCache;
+    uint8_t _cellRefreshIndex = 0;
 };
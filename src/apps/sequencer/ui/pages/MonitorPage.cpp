@@ -12,9 +12,10 @@ enum class Function {
     CvOut   = 1,
     Midi    = 2,
     Stats   = 3,
+    Perf    = 4,
 };
 
-static const char *functionNames[] = { "CV IN", "CV OUT", "MIDI", "STATS", nullptr };
+static const char *functionNames[] = { "CV IN", "CV OUT", "MIDI", "STATS", "PERF", nullptr };
 
 static void formatMidiMessage(StringBuilder &eventStr, StringBuilder &dataStr, const MidiMessage &msg) {
     if (msg.isChannelMessage()) {
@@ -107,6 +108,9 @@ void MonitorPage::draw(Canvas &canvas) {
     case Mode::Stats:
         drawStats(canvas);
         break;
+    case Mode::Perf:
+        drawPerf(canvas);
+        break;
     }
 }
 
@@ -134,6 +138,13 @@ void MonitorPage::keyPress(KeyPressEvent &event) {
         case Function::Stats:
             _mode = Mode::Stats;
             break;
+        case Function::Perf:
+            // reset measurements when re-selecting
+            if (_mode == Mode::Perf) {
+                _engine.performanceMonitor().reset();
+            }
+            _mode = Mode::Perf;
+            break;
         }
     }
 }
@@ -190,8 +201,11 @@ void MonitorPage::drawCvOut(Canvas &canvas) {
 void MonitorPage::drawMidi(Canvas &canvas) {
 
     if (os::ticks() - _lastMidiMessageTicks < os::time::ms(1000)) {
-        FixedStringBuilder<32> eventStr;
-        FixedStringBuilder<32> dataStr;
+        // build the event strings in the frame scratch arena instead of on
+        // the ui task stack
+        auto &scratch = _manager.frameScratch();
+        StringBuilder eventStr(scratch.allocate<char>(32), 32);
+        StringBuilder dataStr(scratch.allocate<char>(32), 32);
         formatMidiMessage(eventStr, dataStr, _lastMidiMessage);
         canvas.drawTextCentered(0, 24 - 8, Width, 16, midiPortName(_lastMidiMessagePort));
         canvas.drawTextCentered(0, 32 - 8, Width, 16, eventStr);
@@ -199,6 +213,45 @@ void MonitorPage::drawMidi(Canvas &canvas) {
     }
 }
 
+void MonitorPage::drawPerf(Canvas &canvas) {
+    const auto &monitor = _engine.performanceMonitor();
+
+    FixedStringBuilder<32> str;
+
+    canvas.drawText(8, 16, "TICK AVG/MAX");
+    canvas.drawText(100, 16, "UPDATE AVG/MAX");
+
+    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        int y = 24 + trackIndex * 6;
+
+        const auto &tickTiming = monitor.trackTickTiming(trackIndex);
+        const auto &updateTiming = monitor.trackUpdateTiming(trackIndex);
+
+        str.reset();
+        str("T%d", trackIndex + 1);
+        canvas.drawText(0, y, str);
+
+        str.reset();
+        str("%d/%dus", tickTiming.avgUs(), tickTiming.maxUs());
+        canvas.drawText(8, y, str);
+
+        str.reset();
+        str("%d/%dus", updateTiming.avgUs(), updateTiming.maxUs());
+        canvas.drawText(100, y, str);
+    }
+
+    // tick latency histogram (power-of-two us bins)
+    const auto &histogram = monitor.tickLatencyHistogram();
+    uint32_t maxCount = 1;
+    for (auto count : histogram) {
+        maxCount = std::max(maxCount, count);
+    }
+    for (int bin = 0; bin < PerformanceMonitor::HistogramBins; ++bin) {
+        int h = (histogram[bin] * 16) / maxCount;
+        canvas.fillRect(180 + bin * 4, 40 - h, 3, h);
+    }
+}
+
 void MonitorPage::drawStats(Canvas &canvas) {
     auto stats = _engine.stats();
 
@@ -225,4 +278,9 @@ void MonitorPage::drawStats(Canvas &canvas) {
         drawValue(2, "USBMIDI OVF:", str);
     }
 
+    {
+        FixedStringBuilder<16> str("%d", stats.updateOverload);
+        drawValue(3, "ENGINE OVL:", str);
+    }
+
 }
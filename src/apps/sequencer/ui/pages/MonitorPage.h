@@ -25,12 +25,14 @@ private:
     void drawCvOut(Canvas &canvas);
     void drawMidi(Canvas &canvas);
     void drawStats(Canvas &canvas);
+    void drawPerf(Canvas &canvas);
 
     enum class Mode : uint8_t {
         CvIn,
         CvOut,
         Midi,
         Stats,
+        Perf,
     };
 
     Mode _mode = Mode::CvIn;
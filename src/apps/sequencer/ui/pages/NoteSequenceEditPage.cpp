@@ -55,7 +55,7 @@ NoteSequenceEditPage::NoteSequenceEditPage(PageManager &manager, PageContext &co
 {
     _stepSelection.setStepCompare([this] (int a, int b) {
         auto layer = _project.selectedNoteSequenceLayer();
-        const auto &sequence = _project.selectedNoteSequence();
+        const auto &sequence = editSequence();
         return sequence.step(a).layerValue(layer) == sequence.step(b).layerValue(layer);
     });
 }
@@ -69,28 +69,66 @@ void NoteSequenceEditPage::enter() {
 void NoteSequenceEditPage::exit() {
 }
 
+int NoteSequenceEditPage::sectionCount() const {
+    // an extended (128 step) sequence exposes the partner pattern's steps as
+    // four additional sections
+    return _project.selectedTrack().noteTrack().extendedSteps() ? 2 * SectionsPerPage : SectionsPerPage;
+}
+
+void NoteSequenceEditPage::setSection(int section) {
+    section = std::max(0, std::min(sectionCount() - 1, section));
+    if (section / SectionsPerPage != editPage()) {
+        // the step selection is local to the edited page
+        _stepSelection.clear();
+    }
+    _section = section;
+}
+
+const NoteSequence &NoteSequenceEditPage::editSequence() const {
+    if (editPage() > 0) {
+        // the second page of an extended sequence lives in the partner pattern
+        return _project.selectedTrack().noteTrack().sequence(std::min(_project.selectedPatternIndex() + 1, CONFIG_PATTERN_COUNT - 1));
+    }
+    return _project.selectedNoteSequence();
+}
+
+NoteSequence &NoteSequenceEditPage::editSequence() {
+    if (editPage() > 0) {
+        return _project.selectedTrack().noteTrack().sequence(std::min(_project.selectedPatternIndex() + 1, CONFIG_PATTERN_COUNT - 1));
+    }
+    return _project.selectedNoteSequence();
+}
+
 void NoteSequenceEditPage::draw(Canvas &canvas) {
     WindowPainter::clear(canvas);
     WindowPainter::drawHeader(canvas, _model, _engine, "STEPS");
     WindowPainter::drawActiveFunction(canvas, NoteSequence::layerName(layer()));
     WindowPainter::drawFooter(canvas, functionNames, pageKeyState(), activeFunctionKey());
 
+    // the extended mode can be switched off while a high section is selected
+    _section = std::min(_section, sectionCount() - 1);
+
     const auto &trackEngine = _engine.selectedTrackEngine().as<NoteTrackEngine>();
-    const auto &sequence = _project.selectedNoteSequence();
+    const auto &baseSequence = _project.selectedNoteSequence();
+    const auto &sequence = editSequence();
     const auto &scale = sequence.selectedScale(_project.scale());
-    int currentStep = trackEngine.isActiveSequence(sequence) ? trackEngine.currentStep() : -1;
-    int currentRecordStep = trackEngine.isActiveSequence(sequence) ? trackEngine.currentRecordStep() : -1;
+    // the engine reports extended step indices relative to the base sequence
+    int currentStep = trackEngine.isActiveSequence(baseSequence) ? trackEngine.currentStep() - editPage() * CONFIG_STEP_COUNT : -1;
+    int currentRecordStep = trackEngine.isActiveSequence(baseSequence) && editPage() == 0 ? trackEngine.currentRecordStep() : -1;
 
     const int stepWidth = Width / StepCount;
     const int stepOffset = this->stepOffset();
 
+    updateStepLabels(canvas, sequence, scale, sequence.selectedRootNote(_model.project().rootNote()));
+
     const int loopY = 16;
 
-    // draw loop points
+    // draw loop points, in extended mode the base sequence's step range
+    // applies to both pages
     canvas.setBlendMode(BlendMode::Set);
     canvas.setColor(0xf);
-    SequencePainter::drawLoopStart(canvas, (sequence.firstStep() - stepOffset) * stepWidth + 1, loopY, stepWidth - 2);
-    SequencePainter::drawLoopEnd(canvas, (sequence.lastStep() - stepOffset) * stepWidth + 1, loopY, stepWidth - 2);
+    SequencePainter::drawLoopStart(canvas, (baseSequence.firstStep() - stepOffset) * stepWidth + 1, loopY, stepWidth - 2);
+    SequencePainter::drawLoopEnd(canvas, (baseSequence.lastStep() - stepOffset) * stepWidth + 1, loopY, stepWidth - 2);
 
     for (int i = 0; i < StepCount; ++i) {
         int stepIndex = stepOffset + i;
@@ -100,7 +138,7 @@ void NoteSequenceEditPage::draw(Canvas &canvas) {
         int y = 20;
 
         // loop
-        if (stepIndex > sequence.firstStep() && stepIndex <= sequence.lastStep()) {
+        if (stepIndex > baseSequence.firstStep() && stepIndex <= baseSequence.lastStep()) {
             canvas.setColor(0xf);
             canvas.point(x, loopY);
         }
@@ -108,7 +146,8 @@ void NoteSequenceEditPage::draw(Canvas &canvas) {
         // step index
         {
             canvas.setColor(_stepSelection[stepIndex] ? 0xf : 0x7);
-            FixedStringBuilder<8> str("%d", stepIndex + 1);
+            FixedStringBuilder<8> str;
+            str.appendInt(stepIndex + 1 + editPage() * CONFIG_STEP_COUNT);
             canvas.drawText(x + (stepWidth - canvas.textWidth(str) + 1) / 2, y - 2, str);
         }
 
@@ -185,20 +224,16 @@ void NoteSequenceEditPage::draw(Canvas &canvas) {
             );
             break;
         case Layer::Note: {
-            int rootNote = sequence.selectedRootNote(_model.project().rootNote());
+            const auto &label = _stepLabels[i];
             canvas.setColor(0xf);
-            FixedStringBuilder<8> str;
-            scale.noteName(str, step.note() + rootNote, Scale::Short1);
-            canvas.drawText(x + (stepWidth - canvas.textWidth(str) + 1) / 2, y + 20, str);
-            str.reset();
-            scale.noteName(str, step.note() + rootNote, Scale::Short2);
-            canvas.drawText(x + (stepWidth - canvas.textWidth(str) + 1) / 2, y + 27, str);
+            canvas.drawText(x + label.offset1, y + 20, label.line1);
+            canvas.drawText(x + label.offset2, y + 27, label.line2);
             break;
         }
         case Layer::NoteVariationRange: {
+            const auto &label = _stepLabels[i];
             canvas.setColor(0xf);
-            FixedStringBuilder<8> str("%d", step.noteVariationRange());
-            canvas.drawText(x + (stepWidth - canvas.textWidth(str) + 1) / 2, y + 20, str);
+            canvas.drawText(x + label.offset1, y + 20, label.line1);
             break;
         }
         case Layer::NoteVariationProbability:
@@ -216,13 +251,10 @@ void NoteSequenceEditPage::draw(Canvas &canvas) {
             );
             break;
         case Layer::Condition: {
+            const auto &label = _stepLabels[i];
             canvas.setColor(0xf);
-            FixedStringBuilder<8> str;
-            Types::printCondition(str, step.condition(), Types::ConditionFormat::Short1);
-            canvas.drawText(x + (stepWidth - canvas.textWidth(str) + 1) / 2, y + 20, str);
-            str.reset();
-            Types::printCondition(str, step.condition(), Types::ConditionFormat::Short2);
-            canvas.drawText(x + (stepWidth - canvas.textWidth(str) + 1) / 2, y + 27, str);
+            canvas.drawText(x + label.offset1, y + 20, label.line1);
+            canvas.drawText(x + label.offset2, y + 27, label.line2);
             break;
         }
         case Layer::Last:
@@ -248,8 +280,8 @@ void NoteSequenceEditPage::draw(Canvas &canvas) {
 
 void NoteSequenceEditPage::updateLeds(Leds &leds) {
     const auto &trackEngine = _engine.selectedTrackEngine().as<NoteTrackEngine>();
-    const auto &sequence = _project.selectedNoteSequence();
-    int currentStep = trackEngine.isActiveSequence(sequence) ? trackEngine.currentStep() : -1;
+    const auto &sequence = editSequence();
+    int currentStep = trackEngine.isActiveSequence(_project.selectedNoteSequence()) ? trackEngine.currentStep() - editPage() * CONFIG_STEP_COUNT : -1;
 
     for (int i = 0; i < 16; ++i) {
         int stepIndex = stepOffset() + i;
@@ -258,7 +290,7 @@ void NoteSequenceEditPage::updateLeds(Leds &leds) {
         leds.set(MatrixMap::fromStep(i), red, green);
     }
 
-    LedPainter::drawSelectedSequenceSection(leds, _section);
+    LedPainter::drawSelectedSequenceSection(leds, _section % SectionsPerPage);
 
     // show quick edit keys
     if (globalKeyState()[Key::Page] && !globalKeyState()[Key::Shift]) {
@@ -283,7 +315,7 @@ void NoteSequenceEditPage::keyUp(KeyEvent &event) {
 
 void NoteSequenceEditPage::keyPress(KeyPressEvent &event) {
     const auto &key = event.key();
-    auto &sequence = _project.selectedNoteSequence();
+    auto &sequence = editSequence();
 
     if (key.isContextMenu()) {
         contextShow();
@@ -333,7 +365,7 @@ void NoteSequenceEditPage::keyPress(KeyPressEvent &event) {
         if (key.shiftModifier()) {
             sequence.shiftSteps(-1);
         } else {
-            _section = std::max(0, _section - 1);
+            setSection(_section - 1);
         }
         event.consume();
     }
@@ -341,14 +373,14 @@ void NoteSequenceEditPage::keyPress(KeyPressEvent &event) {
         if (key.shiftModifier()) {
             sequence.shiftSteps(1);
         } else {
-            _section = std::min(3, _section + 1);
+            setSection(_section + 1);
         }
         event.consume();
     }
 }
 
 void NoteSequenceEditPage::encoder(EncoderEvent &event) {
-    auto &sequence = _project.selectedNoteSequence();
+    auto &sequence = editSequence();
     const auto &scale = sequence.selectedScale(_project.scale());
 
     if (_stepSelection.any()) {
@@ -358,57 +390,55 @@ void NoteSequenceEditPage::encoder(EncoderEvent &event) {
         return;
     }
 
-    for (size_t stepIndex = 0; stepIndex < sequence.steps().size(); ++stepIndex) {
-        if (_stepSelection[stepIndex]) {
-            auto &step = sequence.step(stepIndex);
-            bool shift = globalKeyState()[Key::Shift];
-            switch (layer()) {
-            case Layer::Gate:
-                step.setGate(event.value() > 0);
-                break;
-            case Layer::GateProbability:
-                step.setGateProbability(step.gateProbability() + event.value());
-                break;
-            case Layer::GateOffset:
-                step.setGateOffset(step.gateOffset() + event.value());
-                break;
-            case Layer::Retrigger:
-                step.setRetrigger(step.retrigger() + event.value());
-                break;
-            case Layer::RetriggerProbability:
-                step.setRetriggerProbability(step.retriggerProbability() + event.value());
-                break;
-            case Layer::Length:
-                step.setLength(step.length() + event.value());
-                break;
-            case Layer::LengthVariationRange:
-                step.setLengthVariationRange(step.lengthVariationRange() + event.value());
-                break;
-            case Layer::LengthVariationProbability:
-                step.setLengthVariationProbability(step.lengthVariationProbability() + event.value());
-                break;
-            case Layer::Note:
-                step.setNote(step.note() + event.value() * ((shift && scale.isChromatic()) ? scale.notesPerOctave() : 1));
-                updateMonitorStep();
-                break;
-            case Layer::NoteVariationRange:
-                step.setNoteVariationRange(step.noteVariationRange() + event.value() * ((shift && scale.isChromatic()) ? scale.notesPerOctave() : 1));
-                updateMonitorStep();
-                break;
-            case Layer::NoteVariationProbability:
-                step.setNoteVariationProbability(step.noteVariationProbability() + event.value());
-                break;
-            case Layer::Slide:
-                step.setSlide(event.value() > 0);
-                break;
-            case Layer::Condition:
-                step.setCondition(ModelUtils::adjustedEnum(step.condition(), event.value()));
-                break;
-            case Layer::Last:
-                break;
-            }
+    bool shift = globalKeyState()[Key::Shift];
+    _stepSelection.forEach([&] (int stepIndex) {
+        auto &step = sequence.step(stepIndex);
+        switch (layer()) {
+        case Layer::Gate:
+            step.setGate(event.value() > 0);
+            break;
+        case Layer::GateProbability:
+            step.setGateProbability(step.gateProbability() + event.value());
+            break;
+        case Layer::GateOffset:
+            step.setGateOffset(step.gateOffset() + event.value());
+            break;
+        case Layer::Retrigger:
+            step.setRetrigger(step.retrigger() + event.value());
+            break;
+        case Layer::RetriggerProbability:
+            step.setRetriggerProbability(step.retriggerProbability() + event.value());
+            break;
+        case Layer::Length:
+            step.setLength(step.length() + event.value());
+            break;
+        case Layer::LengthVariationRange:
+            step.setLengthVariationRange(step.lengthVariationRange() + event.value());
+            break;
+        case Layer::LengthVariationProbability:
+            step.setLengthVariationProbability(step.lengthVariationProbability() + event.value());
+            break;
+        case Layer::Note:
+            step.setNote(step.note() + event.value() * ((shift && scale.isChromatic()) ? scale.notesPerOctave() : 1));
+            updateMonitorStep();
+            break;
+        case Layer::NoteVariationRange:
+            step.setNoteVariationRange(step.noteVariationRange() + event.value() * ((shift && scale.isChromatic()) ? scale.notesPerOctave() : 1));
+            updateMonitorStep();
+            break;
+        case Layer::NoteVariationProbability:
+            step.setNoteVariationProbability(step.noteVariationProbability() + event.value());
+            break;
+        case Layer::Slide:
+            step.setSlide(event.value() > 0);
+            break;
+        case Layer::Condition:
+            step.setCondition(ModelUtils::adjustedEnum(step.condition(), event.value()));
+            break;
+        case Layer::Last:
+            break;
         }
-    }
+    });
 
     event.consume();
 }
@@ -416,7 +446,7 @@ void NoteSequenceEditPage::encoder(EncoderEvent &event) {
 void NoteSequenceEditPage::midi(MidiEvent &event) {
     if (!_engine.recording() && layer() == Layer::Note && _stepSelection.any()) {
         auto &trackEngine = _engine.selectedTrackEngine().as<NoteTrackEngine>();
-        auto &sequence = _project.selectedNoteSequence();
+        auto &sequence = editSequence();
         const auto &scale = sequence.selectedScale(_project.scale());
         const auto &message = event.message();
 
@@ -424,15 +454,13 @@ void NoteSequenceEditPage::midi(MidiEvent &event) {
             float volts = (message.note() - 60) * (1.f / 12.f);
             int note = scale.noteFromVolts(volts);
 
-            for (size_t stepIndex = 0; stepIndex < sequence.steps().size(); ++stepIndex) {
-                if (_stepSelection[stepIndex]) {
-                    auto &step = sequence.step(stepIndex);
-                    step.setNote(note);
-                    step.setGate(true);
-                }
-            }
+            _stepSelection.forEach([&] (int stepIndex) {
+                auto &step = sequence.step(stepIndex);
+                step.setNote(note);
+                step.setGate(true);
+            });
 
-            trackEngine.setMonitorStep(_stepSelection.first());
+            trackEngine.setMonitorStep(_stepSelection.first() + editPage() * CONFIG_STEP_COUNT);
             updateMonitorStep();
         }
     }
@@ -551,15 +579,66 @@ void NoteSequenceEditPage::updateMonitorStep() {
 
     // TODO should we monitor an all layers not just note?
     if (layer() == Layer::Note && !_stepSelection.isPersisted() && _stepSelection.any()) {
-        trackEngine.setMonitorStep(_stepSelection.first());
+        trackEngine.setMonitorStep(_stepSelection.first() + editPage() * CONFIG_STEP_COUNT);
     } else {
         trackEngine.setMonitorStep(-1);
     }
 }
 
+void NoteSequenceEditPage::updateStepLabels(Canvas &canvas, const NoteSequence &sequence, const Scale &scale, int rootNote) {
+    auto layer = this->layer();
+
+    if (layer != Layer::Note && layer != Layer::NoteVariationRange && layer != Layer::Condition) {
+        _stepLabelLayer = -1;
+        return;
+    }
+
+    const int stepWidth = Width / StepCount;
+    const int stepOffset = this->stepOffset();
+
+    // invalidate all cells when the label context changed
+    bool valid = int8_t(layer) == _stepLabelLayer && &scale == _stepLabelScale && rootNote == _stepLabelRootNote;
+    _stepLabelLayer = int8_t(layer);
+    _stepLabelScale = &scale;
+    _stepLabelRootNote = rootNote;
+
+    for (int i = 0; i < StepCount; ++i) {
+        const auto &step = sequence.step(stepOffset + i);
+        int16_t value = step.layerValue(layer);
+        if (valid && value == _stepLabelValues[i]) {
+            // cell content unchanged, keep the cached label
+            continue;
+        }
+        _stepLabelValues[i] = value;
+
+        auto &label = _stepLabels[i];
+        StringBuilder line1(label.line1, sizeof(label.line1));
+        StringBuilder line2(label.line2, sizeof(label.line2));
+
+        switch (layer) {
+        case Layer::Note:
+            scale.noteName(line1, value + rootNote, Scale::Short1);
+            scale.noteName(line2, value + rootNote, Scale::Short2);
+            break;
+        case Layer::NoteVariationRange:
+            line1("%d", value);
+            break;
+        case Layer::Condition:
+            Types::printCondition(line1, Types::Condition(value), Types::ConditionFormat::Short1);
+            Types::printCondition(line2, Types::Condition(value), Types::ConditionFormat::Short2);
+            break;
+        default:
+            break;
+        }
+
+        label.offset1 = (stepWidth - canvas.textWidth(label.line1) + 1) / 2;
+        label.offset2 = (stepWidth - canvas.textWidth(label.line2) + 1) / 2;
+    }
+}
+
 void NoteSequenceEditPage::drawDetail(Canvas &canvas, const NoteSequence::Step &step) {
 
-    const auto &sequence = _project.selectedNoteSequence();
+    const auto &sequence = editSequence();
     const auto &scale = sequence.selectedScale(_project.scale());
 
     FixedStringBuilder<16> str;
@@ -571,7 +650,7 @@ void NoteSequenceEditPage::drawDetail(Canvas &canvas, const NoteSequence::Step &
     canvas.vline(64 + 32, 16, 32);
 
     canvas.setFont(Font::Small);
-    str("%d", _stepSelection.first() + 1);
+    str("%d", _stepSelection.first() + 1 + editPage() * CONFIG_STEP_COUNT);
     if (_stepSelection.count() > 1) {
         str("*");
     }
@@ -735,29 +814,29 @@ bool NoteSequenceEditPage::contextActionEnabled(int index) const {
 }
 
 void NoteSequenceEditPage::initSequence() {
-    _project.selectedNoteSequence().clearSteps();
+    editSequence().clearSteps();
     showMessage("STEPS INITIALIZED");
 }
 
 void NoteSequenceEditPage::copySequence() {
-    _model.clipBoard().copyNoteSequenceSteps(_project.selectedNoteSequence(), _stepSelection.selected());
+    _model.clipBoard().copyNoteSequenceSteps(editSequence(), _stepSelection.selected());
     showMessage("STEPS COPIED");
 }
 
 void NoteSequenceEditPage::pasteSequence() {
-    _model.clipBoard().pasteNoteSequenceSteps(_project.selectedNoteSequence(), _stepSelection.selected());
+    _model.clipBoard().pasteNoteSequenceSteps(editSequence(), _stepSelection.selected());
     showMessage("STEPS PASTED");
 }
 
 void NoteSequenceEditPage::duplicateSequence() {
-    _project.selectedNoteSequence().duplicateSteps();
+    editSequence().duplicateSteps();
     showMessage("STEPS DUPLICATED");
 }
 
 void NoteSequenceEditPage::generateSequence() {
     _manager.pages().generatorSelect.show([this] (bool success, Generator::Mode mode) {
         if (success) {
-            auto builder = _builderContainer.create<NoteSequenceBuilder>(_project.selectedNoteSequence(), layer());
+            auto builder = _builderContainer.create<NoteSequenceBuilder>(editSequence(), layer());
             auto generator = Generator::create(mode, *builder);
             _manager.pages().generator.show(generator);
         }
@@ -765,14 +844,14 @@ void NoteSequenceEditPage::generateSequence() {
 }
 
 void NoteSequenceEditPage::quickEdit(int index) {
-    _listModel.setSequence(&_project.selectedNoteSequence());
+    _listModel.setSequence(&editSequence());
     if (quickEditItems[index] != NoteSequenceListModel::Item::Last) {
         _manager.pages().quickEdit.show(_listModel, int(quickEditItems[index]));
     }
 }
 
 bool NoteSequenceEditPage::allSelectedStepsActive() const {
-    const auto &sequence = _project.selectedNoteSequence();
+    const auto &sequence = editSequence();
     for (size_t stepIndex = 0; stepIndex < _stepSelection.size(); ++stepIndex) {
         if (_stepSelection[stepIndex] && !sequence.step(stepIndex).gate()) {
             return false;
@@ -782,10 +861,8 @@ bool NoteSequenceEditPage::allSelectedStepsActive() const {
 }
 
 void NoteSequenceEditPage::setSelectedStepsGate(bool gate) {
-    auto &sequence = _project.selectedNoteSequence();
-    for (size_t stepIndex = 0; stepIndex < _stepSelection.size(); ++stepIndex) {
-        if (_stepSelection[stepIndex]) {
-            sequence.step(stepIndex).setGate(gate);
-        }
-    }
+    auto &sequence = editSequence();
+    _stepSelection.forEach([&] (int stepIndex) {
+        sequence.step(stepIndex).setGate(gate);
+    });
 }
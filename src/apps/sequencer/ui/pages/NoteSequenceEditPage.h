@@ -29,13 +29,23 @@ private:
     typedef NoteSequence::Layer Layer;
 
     static const int StepCount = 16;
+    static const int SectionsPerPage = CONFIG_STEP_COUNT / StepCount;
 
-    int stepOffset() const { return _section * StepCount; }
+    int stepOffset() const { return (_section % SectionsPerPage) * StepCount; }
+    // page of the edited sequence, sections above the first page edit the
+    // partner pattern of an extended (128 step) sequence
+    int editPage() const { return _section / SectionsPerPage; }
+    int sectionCount() const;
+    void setSection(int section);
+
+    const NoteSequence &editSequence() const;
+          NoteSequence &editSequence();
 
     void switchLayer(int functionKey, bool shift);
     int activeFunctionKey();
 
     void updateMonitorStep();
+    void updateStepLabels(Canvas &canvas, const NoteSequence &sequence, const Scale &scale, int rootNote);
     void drawDetail(Canvas &canvas, const NoteSequence::Step &step);
 
     void contextShow();
@@ -60,6 +70,23 @@ private:
     bool _showDetail;
     uint32_t _showDetailTicks;
 
+    // cached text strip for the text based layers (note, note range,
+    // condition): labels are keyed on the cell's layer value, so scrolling
+    // or editing only re-formats the cells whose content actually changed
+    // and steady-state frames just blit the cached strings
+    struct StepLabel {
+        char line1[8];
+        char line2[8];
+        int8_t offset1;
+        int8_t offset2;
+    };
+
+    std::array<StepLabel, StepCount> _stepLabels;
+    std::array<int16_t, StepCount> _stepLabelValues;
+    int8_t _stepLabelLayer = -1; // layer the cached labels belong to, -1 when invalid
+    const Scale *_stepLabelScale = nullptr;
+    int8_t _stepLabelRootNote = 0;
+
     NoteSequenceListModel _listModel;
 
     StepSelection<CONFIG_STEP_COUNT> _stepSelection;
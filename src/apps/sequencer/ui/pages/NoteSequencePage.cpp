@@ -5,6 +5,9 @@
 #include "ui/LedPainter.h"
 #include "ui/painters/WindowPainter.h"
 
+#include "model/FileManager.h"
+#include "model/MidiExport.h"
+
 #include "core/utils/StringBuilder.h"
 
 enum class ContextAction {
@@ -13,6 +16,7 @@ enum class ContextAction {
     Paste,
     Duplicate,
     Route,
+    ExportMidi,
     Last
 };
 
@@ -22,6 +26,7 @@ static const ContextMenuModel::Item contextMenuItems[] = {
     { "PASTE" },
     { "DUPL" },
     { "ROUTE" },
+    { "EXPORT" },
 };
 
 
@@ -94,6 +99,9 @@ void NoteSequencePage::contextAction(int index) {
     case ContextAction::Route:
         initRoute();
         break;
+    case ContextAction::ExportMidi:
+        exportMidiSequences();
+        break;
     case ContextAction::Last:
         break;
     }
@@ -105,6 +113,8 @@ bool NoteSequencePage::contextActionEnabled(int index) const {
         return _model.clipBoard().canPasteNoteSequence();
     case ContextAction::Route:
         return _listModel.routingTarget(selectedRow()) != Routing::Target::None;
+    case ContextAction::ExportMidi:
+        return FileManager::volumeMounted();
     default:
         return true;
     }
@@ -134,3 +144,21 @@ void NoteSequencePage::duplicateSequence() {
 void NoteSequencePage::initRoute() {
     _manager.pages().top.editRoute(_listModel.routingTarget(selectedRow()), _project.selectedTrackIndex());
 }
+
+void NoteSequencePage::exportMidiSequences() {
+    _manager.pages().busy.show("EXPORTING ...");
+
+    // exported at low priority, a multi-pattern export streams on the file
+    // task behind queued saves and playback keeps running
+    FileManager::task([this] () {
+        FixedStringBuilder<16> path("TRACK%d.MID", _project.selectedTrackIndex() + 1);
+        return MidiExport::exportNoteTrack(_project, _project.selectedTrack().noteTrack(), path);
+    }, [this] (fs::Error result) {
+        if (result == fs::OK) {
+            showMessage("SEQUENCES EXPORTED");
+        } else {
+            showMessage(FixedStringBuilder<32>("FAILED (%s)", fs::errorToString(result)));
+        }
+        _manager.pages().busy.close();
+    });
+}
@@ -26,6 +26,7 @@ private:
     void pasteSequence();
     void duplicateSequence();
     void initRoute();
+    void exportMidiSequences();
 
     NoteSequenceListModel _listModel;
 };
@@ -25,6 +25,7 @@
 #include "SongPage.h"
 #include "StartupPage.h"
 #include "SystemPage.h"
+#include "TaskMonitorPage.h"
 #include "TempoPage.h"
 #include "TextInputPage.h"
 #include "TopPage.h"
@@ -60,6 +61,7 @@ struct Pages {
     TempoPage tempo;
     ClockSetupPage clockSetup;
     MonitorPage monitor;
+    TaskMonitorPage taskMonitor;
     FileSelectPage fileSelect;
     ContextMenuPage contextMenu;
     QuickEditPage quickEdit;
@@ -101,6 +103,7 @@ struct Pages {
         tempo(manager, context),
         clockSetup(manager, context),
         monitor(manager, context),
+        taskMonitor(manager, context),
         fileSelect(manager, context),
         contextMenu(manager, context),
         quickEdit(manager, context),
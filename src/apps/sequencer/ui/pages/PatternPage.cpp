@@ -40,6 +40,7 @@ PatternPage::PatternPage(PageManager &manager, PageContext &context) :
 void PatternPage::enter() {
     _latching = false;
     _syncing = false;
+    updatePatternCache();
 }
 
 void PatternPage::exit() {
@@ -62,14 +63,14 @@ void PatternPage::draw(Canvas &canvas) {
     WindowPainter::drawHeader(canvas, _model, _engine, "PATTERN");
     WindowPainter::drawFooter(canvas, functionNames, pageKeyState());
 
-    bool hasRequested = false;
+    updatePatternCache();
 
     canvas.setFont(Font::Tiny);
     canvas.setBlendMode(BlendMode::Set);
 
     for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
         const auto &trackEngine = _engine.trackEngine(trackIndex);
-        const auto &trackState = playState.trackState(trackIndex);
+        const auto &patternState = _patternState[trackIndex];
         bool trackSelected = pageKeyState()[MatrixMap::fromTrack(trackIndex)];
 
         int x = trackIndex * 32;
@@ -91,10 +92,10 @@ void PatternPage::draw(Canvas &canvas) {
         for (int p = 0; p < 16; ++p) {
             int px = x + (p % 8) * 3 + 2;
             int py = y + (p / 8) * 3 + 2;
-            if (p == trackState.pattern()) {
+            if (p == patternState.pattern) {
                 canvas.setColor(0xf);
                 canvas.fillRect(px, py, 3, 3);
-            } else if (trackState.hasPatternRequest() && p == trackState.requestedPattern()) {
+            } else if (p == patternState.requestedPattern) {
                 canvas.setColor(0x7);
                 canvas.fillRect(px, py, 3, 3);
             } else {
@@ -106,14 +107,10 @@ void PatternPage::draw(Canvas &canvas) {
         y += 5;
 
         canvas.setColor(trackSelected ? 0xf : 0x7);
-        canvas.drawTextCentered(x, y + 10, w, 8, snapshotActive ? "S" : FixedStringBuilder<8>("P%d", trackState.pattern() + 1));
-
-        if (trackState.hasPatternRequest() && trackState.pattern() != trackState.requestedPattern()) {
-            hasRequested = true;
-        }
+        canvas.drawTextCentered(x, y + 10, w, 8, snapshotActive ? "S" : FixedStringBuilder<8>("P%d", patternState.pattern + 1));
     }
 
-    if (playState.hasSyncedRequests() && hasRequested) {
+    if (playState.hasSyncedRequests() && _hasRequested) {
         canvas.setColor(0xf);
         canvas.hline(0, 10, _engine.syncFraction() * Width);
     }
@@ -127,32 +124,51 @@ void PatternPage::updateLeds(Leds &leds) {
     } else if (globalKeyState()[Key::Shift]) {
         LedPainter::drawSelectedPattern(leds, _project.selectedPatternIndex(), _project.selectedPatternIndex());
     } else {
-        uint16_t allActivePatterns = 0;
-        uint16_t allRequestedPatterns = 0;
+        // reuse the pattern state cached by draw() instead of traversing the
+        // play state again
         uint16_t selectedActivePatterns = 0;
         uint16_t selectedRequestedPatterns = 0;
 
         for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
-            const auto &trackState = playState.trackState(trackIndex);
-            bool hasPatternRequest = trackState.hasPatternRequest();
-            int pattern = trackState.pattern();
-            int requestedPattern = trackState.requestedPattern();
-            allActivePatterns |= (pattern < 16) ? (1<<pattern) : 0;
-            allRequestedPatterns |= (hasPatternRequest && requestedPattern < 16) ? (1<<requestedPattern) : 0;
             if (pageKeyState()[MatrixMap::fromTrack(trackIndex)]) {
-                selectedActivePatterns |= (pattern < 16) ? (1<<pattern) : 0;
-                selectedRequestedPatterns |= (hasPatternRequest && requestedPattern < 16) ? (1<<requestedPattern) : 0;
+                const auto &patternState = _patternState[trackIndex];
+                selectedActivePatterns |= (patternState.pattern < 16) ? (1 << patternState.pattern) : 0;
+                selectedRequestedPatterns |= (patternState.requestedPattern >= 0 && patternState.requestedPattern < 16) ? (1 << patternState.requestedPattern) : 0;
             }
         }
 
         if (selectedActivePatterns || selectedRequestedPatterns) {
             LedPainter::drawSelectedPatterns(leds, selectedActivePatterns, selectedRequestedPatterns);
         } else {
-            LedPainter::drawSelectedPatterns(leds, allActivePatterns, allRequestedPatterns);
+            LedPainter::drawSelectedPatterns(leds, _activePatterns, _requestedPatterns);
         }
     }
 }
 
+void PatternPage::updatePatternCache() {
+    const auto &playState = _project.playState();
+
+    uint16_t activePatterns = 0;
+    uint16_t requestedPatterns = 0;
+    bool hasRequested = false;
+
+    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        const auto &trackState = playState.trackState(trackIndex);
+        auto &patternState = _patternState[trackIndex];
+        patternState.pattern = trackState.pattern();
+        patternState.requestedPattern = trackState.hasPatternRequest() ? trackState.requestedPattern() : -1;
+        activePatterns |= (patternState.pattern < 16) ? (1 << patternState.pattern) : 0;
+        if (patternState.requestedPattern >= 0) {
+            requestedPatterns |= (patternState.requestedPattern < 16) ? (1 << patternState.requestedPattern) : 0;
+            hasRequested |= patternState.requestedPattern != patternState.pattern;
+        }
+    }
+
+    _activePatterns = activePatterns;
+    _requestedPatterns = requestedPatterns;
+    _hasRequested = hasRequested;
+}
+
 void PatternPage::keyDown(KeyEvent &event) {
     const auto &key = event.key();
 
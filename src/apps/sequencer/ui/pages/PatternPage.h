@@ -22,6 +22,8 @@ public:
     virtual void encoder(EncoderEvent &event) override;
 
 private:
+    void updatePatternCache();
+
     void contextShow();
     void contextAction(int index);
     bool contextActionEnabled(int index) const;
@@ -35,4 +37,17 @@ private:
     bool _latching = false;
     bool _syncing = false;
     int8_t _snapshotTargetPattern = -1;
+
+    // compact per-track pattern state, derived from the play state once per
+    // frame in draw() and shared with updateLeds(), so both consumers work
+    // off a single model traversal
+    struct TrackPatternState {
+        uint8_t pattern;
+        int8_t requestedPattern; // -1 when no request is pending
+    };
+
+    std::array<TrackPatternState, CONFIG_TRACK_COUNT> _patternState;
+    uint16_t _activePatterns = 0;       // bitmask of patterns active on any track
+    uint16_t _requestedPatterns = 0;    // bitmask of patterns requested on any track
+    bool _hasRequested = false;
 };
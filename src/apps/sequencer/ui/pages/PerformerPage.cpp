@@ -80,11 +80,9 @@ void PerformerPage::draw(Canvas &canvas) {
         // draw sequence progress
         SequencePainter::drawSequenceProgress(canvas, x, y + h + 2, w, 2, trackEngine.sequenceProgress());
 
-        // draw fill & fill amount amount
-        canvas.setColor(trackState.fill() ? 0x7 : 0x3);
-        canvas.fillRect(x, y + h + 6, w, 4);
+        // draw fill & fill amount
         canvas.setColor(trackState.fill() ? 0xf : 0x7);
-        canvas.fillRect(x, y + h + 6, (trackState.fillAmount() * w) / 100, 4);
+        canvas.drawHGauge(x, y + h + 6, w, 4, trackState.fillAmount() / 100.f, trackState.fill() ? 0x7 : 0x3);
     }
 
     if (playState.hasSyncedRequests() && hasRequested) {
@@ -98,14 +96,8 @@ void PerformerPage::updateLeds(Leds &leds) {
 
     LedPainter::drawTrackGates(leds, _engine, _project.playState());
 
-    uint8_t activeFills = 0;
-    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
-        const auto &trackState = playState.trackState(trackIndex);
-        activeFills |= trackState.fill() ? (1<<trackIndex) : 0;
-    }
-
     LedPainter::drawMutes(leds, 0, 0);
-    LedPainter::drawFills(leds, activeFills);
+    LedPainter::drawFills(leds, playState.fillMask());
 }
 
 void PerformerPage::keyDown(KeyEvent &event) {
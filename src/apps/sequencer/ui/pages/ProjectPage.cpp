@@ -180,11 +180,18 @@ void ProjectPage::initRoute() {
 }
 
 void ProjectPage::saveProjectToSlot(int slot) {
-    _engine.lock();
     _manager.pages().busy.show("SAVING PROJECT ...");
 
     FileManager::task([this, slot] () {
-        return FileManager::saveProject(_project, slot);
+        // the engine is only paused while a section is snapshotted into
+        // memory, playback keeps running while the file is written
+        return FileManager::saveProject(_project, slot, [this] (bool locked) {
+            if (locked) {
+                _engine.lock();
+            } else {
+                _engine.unlock();
+            }
+        });
     }, [this] (fs::Error result) {
         if (result == fs::OK) {
             showMessage("PROJECT SAVED");
@@ -193,8 +200,7 @@ void ProjectPage::saveProjectToSlot(int slot) {
         }
         // TODO lock ui mutex
         _manager.pages().busy.close();
-        _engine.unlock();
-    });
+    }, FileManager::TaskPriority::High);
 }
 
 void ProjectPage::loadProjectFromSlot(int slot) {
@@ -117,6 +117,7 @@ void RoutingPage::showRoute(int routeIndex, const Routing::Route *initialValue)
 
     setSelectedRow(0);
     setEdit(false);
+    invalidateCellCache();
 }
 
 void RoutingPage::drawCell(Canvas &canvas, int row, int column, int x, int y, int w, int h) {
@@ -179,4 +180,5 @@ void RoutingPage::assignMidiLearn(const MidiLearn::Result &result) {
     setSelectedRow(int(RouteListModel::MidiSource));
     setTopRow(int(RouteListModel::MidiSource));
     setEdit(false);
+    invalidateCellCache();
 }
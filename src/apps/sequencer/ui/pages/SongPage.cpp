@@ -88,11 +88,11 @@ void SongPage::draw(Canvas &canvas) {
         y += rowHeight;
     }
 
-    // draw table entries
+    // draw table entries from the cached cell text
+    updateGridCache();
+
     for (int rowIndex = 0; rowIndex < RowCount; ++rowIndex) {
         int slotIndex = _displayRow + rowIndex;
-        const auto &slot = song.slot(slotIndex);
-        bool slotActive = slotIndex < song.slotCount();
 
         int x = tableOriginX;
 
@@ -103,26 +103,9 @@ void SongPage::draw(Canvas &canvas) {
         }
 
         // draw table cells
-        for (int colIndex = 0; colIndex < 10; ++colIndex) {
+        for (int colIndex = 0; colIndex < ColumnCount; ++colIndex) {
             canvas.setColor(slotIndex == _selectedSlot && isHighlighted(colIndex) ? 0xf : 0x7);
-            FixedStringBuilder<8> str;
-            if (colIndex == 0) {
-                str("%d", slotIndex + 1);
-            } else if (colIndex == 1) {
-                if (slotActive) {
-                    str("%d", slot.repeats());
-                } else {
-                    str("-");
-                }
-            } else {
-                if (slotActive) {
-                    int trackIndex = colIndex - 2;
-                    str("P%d", slot.pattern(trackIndex) + 1);
-                } else {
-                    str("-");
-                }
-            }
-            canvas.drawTextCentered(x, y, colWidth[colIndex], rowHeight, str);
+            canvas.drawTextCentered(x, y, colWidth[colIndex], rowHeight, _gridCellText[rowIndex][colIndex]);
             x += colWidth[colIndex];
         }
         y += rowHeight;
@@ -330,6 +313,43 @@ void SongPage::encoder(EncoderEvent &event) {
     event.consume();
 }
 
+void SongPage::updateGridCache() {
+    const auto &song = _project.song();
+
+    if (song.version() == _cachedSongVersion && _displayRow == _cachedDisplayRow) {
+        return;
+    }
+
+    for (int rowIndex = 0; rowIndex < RowCount; ++rowIndex) {
+        int slotIndex = _displayRow + rowIndex;
+        const auto &slot = song.slot(slotIndex);
+        bool slotActive = slotIndex < song.slotCount();
+
+        for (int colIndex = 0; colIndex < ColumnCount; ++colIndex) {
+            StringBuilder str(_gridCellText[rowIndex][colIndex], sizeof(_gridCellText[rowIndex][colIndex]));
+            if (colIndex == 0) {
+                str("%d", slotIndex + 1);
+            } else if (colIndex == 1) {
+                if (slotActive) {
+                    str("%d", slot.repeats());
+                } else {
+                    str("-");
+                }
+            } else {
+                if (slotActive) {
+                    int trackIndex = colIndex - 2;
+                    str("P%d", slot.pattern(trackIndex) + 1);
+                } else {
+                    str("-");
+                }
+            }
+        }
+    }
+
+    _cachedSongVersion = song.version();
+    _cachedDisplayRow = _displayRow;
+}
+
 void SongPage::setSelectedSlot(int slot) {
     int slotCount = _project.song().slotCount();
     _selectedSlot = slotCount > 0 ? clamp(slot, 0, slotCount - 1) : -1;
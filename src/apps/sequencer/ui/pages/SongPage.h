@@ -22,6 +22,9 @@ public:
 private:
     static const int SlotCount = CONFIG_SONG_SLOT_COUNT;
     static const int RowCount = 4;
+    static const int ColumnCount = 10;
+
+    void updateGridCache();
 
     void setSelectedSlot(int slot);
     void moveSelectedSlot(int offset, bool moveSlot);
@@ -43,4 +46,11 @@ private:
     Mode _mode;
     int _selectedSlot = -1;
     int _displayRow = 0;
+
+    // cached cell text of the visible slot grid, rebuilt from the model only
+    // when the song was edited or the view was scrolled, so steady-state
+    // redraws skip the per-cell formatting
+    char _gridCellText[RowCount][ColumnCount][4];
+    uint32_t _cachedSongVersion = uint32_t(-1);
+    int _cachedDisplayRow = -1;
 };
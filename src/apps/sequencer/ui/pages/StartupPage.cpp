@@ -6,6 +6,8 @@
 
 #include "os/os.h"
 
+#include <algorithm>
+
 StartupPage::StartupPage(PageManager &manager, PageContext &context) :
     BasePage(manager, context)
 {
@@ -15,11 +17,15 @@ StartupPage::StartupPage(PageManager &manager, PageContext &context) :
 void StartupPage::draw(Canvas &canvas) {
     if (_state == State::Initial) {
         _state = State::Loading;
-        _engine.lock();
         FileManager::task([this] () {
-            return FileManager::loadLastProject(_model.project());
-        }, [this] (fs::Error result) {
+            // lock the engine only while the model is actually mutated, not
+            // while waiting for the volume to be mounted, so it is free to
+            // respond to external clock and transport right away
+            _engine.lock();
+            auto result = FileManager::loadLastProject(_model.project());
             _engine.unlock();
+            return result;
+        }, [this] (fs::Error result) {
             _state = State::Ready;
         });
     }
@@ -39,7 +45,8 @@ void StartupPage::draw(Canvas &canvas) {
     canvas.setFont(Font::Tiny);
     canvas.drawTextCentered(0, 32, Width, 32, "LOADING ...");
 
-    int w = std::floor(relTime() * Width);
+    // bar stays full while a slow load is still pending
+    int w = std::floor(std::min(1.f, relTime()) * Width);
     canvas.fillRect(0, 32 - 2, w, 4);
 }
 
@@ -21,7 +21,9 @@ private:
     float time() const;
     float relTime() const { return time() / LoadTime; }
 
-    static constexpr int LoadTime = 2;
+    // minimum splash time, the page closes as soon as this has elapsed and
+    // the project has finished loading
+    static constexpr int LoadTime = 1;
 
     uint32_t _startTicks;
     State _state = State::Initial;
@@ -1,5 +1,11 @@
 #include "SystemPage.h"
 
+#include "StartupProfiler.h"
+
+#include "model/FileManager.h"
+#include "model/MemoryMap.h"
+#include "model/SdCardBenchmark.h"
+
 #include "ui/pages/Pages.h"
 #include "ui/painters/WindowPainter.h"
 
@@ -11,11 +17,12 @@
 
 enum Function {
     Calibration = 0,
+    Memory      = 1,
     Utilities   = 3,
     Update      = 4,
 };
 
-static const char *functionNames[] = { "CAL", nullptr, nullptr, "UTILS", "UPDATE" };
+static const char *functionNames[] = { "CAL", "MEM", nullptr, "UTILS", "UPDATE" };
 
 enum CalibrationEditFunction {
     Auto        = 0,
@@ -80,10 +87,45 @@ void SystemPage::draw(Canvas &canvas) {
         ListPage::draw(canvas);
         break;
     }
+    case Mode::Memory: {
+        WindowPainter::drawActiveFunction(canvas, "MEMORY");
+        WindowPainter::drawFooter(canvas, functionNames, pageKeyState(), int(_mode));
+        canvas.setBlendMode(BlendMode::Set);
+        canvas.setFont(Font::Tiny);
+        canvas.setColor(0xf);
+        // two columns of name, unit size x count and total bytes
+        int rows = (MemoryMap::entryCount() + 1) / 2;
+        for (int i = 0; i < MemoryMap::entryCount(); ++i) {
+            const auto &entry = MemoryMap::entry(i);
+            int x = (i / rows) * 128;
+            int y = 16 + (i % rows) * 6;
+            canvas.drawText(x + 4, y, entry.name);
+            FixedStringBuilder<16> sizeStr("%lux%u", entry.unitSize, entry.unitCount);
+            canvas.drawText(x + 52, y, sizeStr);
+            FixedStringBuilder<16> totalStr("%lu", entry.totalSize());
+            canvas.drawText(x + 96, y, totalStr);
+        }
+        break;
+    }
     case Mode::Utilities: {
         WindowPainter::drawActiveFunction(canvas, "UTILITIES");
         WindowPainter::drawFooter(canvas, functionNames, pageKeyState(), int(_mode));
         ListPage::draw(canvas);
+        const auto &benchmark = SdCardBenchmark::result();
+        if (benchmark.valid) {
+            canvas.setBlendMode(BlendMode::Set);
+            canvas.setFont(Font::Tiny);
+            canvas.setColor(0xf);
+            FixedStringBuilder<32> readStr("READ  SEQ %lu RND %lu KB/S", benchmark.seqReadKbps, benchmark.randReadKbps);
+            canvas.drawText(130, 24, readStr);
+            FixedStringBuilder<32> writeStr("WRITE SEQ %lu RND %lu KB/S", benchmark.seqWriteKbps, benchmark.randWriteKbps);
+            canvas.drawText(130, 32, writeStr);
+            FixedStringBuilder<32> worstStr("WORST R %lu W %lu MS", benchmark.worstReadUs / 1000, benchmark.worstWriteUs / 1000);
+            canvas.drawText(130, 40, worstStr);
+            if (SdCardBenchmark::cardUnderperforms()) {
+                canvas.drawText(130, 48, "TOO SLOW FOR AUTOSAVE!");
+            }
+        }
         break;
     }
     case Mode::Update: {
@@ -94,7 +136,20 @@ void SystemPage::draw(Canvas &canvas) {
         canvas.drawText(4, 24, "CURRENT VERSION:");
         FixedStringBuilder<16> str("%d.%d.%d", CONFIG_VERSION_MAJOR, CONFIG_VERSION_MINOR, CONFIG_VERSION_REVISION);
         canvas.drawText(100, 24, str);
-        canvas.drawText(4, 40, "PRESS AND HOLD ENCODER TO RESET TO BOOTLOADER");
+        canvas.drawText(4, 32, "BOOT TIME:");
+        FixedStringBuilder<16> bootStr("%lu MS", StartupProfiler::totalUs() / 1000);
+        canvas.drawText(100, 32, bootStr);
+        canvas.drawText(4, 40, "SD CARD:");
+        size_t total, free;
+        if (FileManager::volumeStats(total, free)) {
+            FixedStringBuilder<32> cardStr("%zu OF %zu MB FREE", free / 1024, total / 1024);
+            canvas.drawText(100, 40, cardStr);
+        } else {
+            // cached in the background after mounting, querying it here
+            // would stall the file task for seconds on large cards
+            canvas.drawText(100, 40, FileManager::volumeMounted() ? "SCANNING ..." : "NOT MOUNTED");
+        }
+        canvas.drawText(4, 48, "PRESS AND HOLD ENCODER TO RESET TO BOOTLOADER");
 
 #ifdef PLATFORM_STM32
         if (_encoderDownTicks != 0 && os::ticks() - _encoderDownTicks > os::time::ms(2000)) {
@@ -169,6 +224,9 @@ void SystemPage::keyPress(KeyPressEvent &event) {
             case Function::Calibration:
                 setMode(Mode::Calibration);
                 break;
+            case Function::Memory:
+                setMode(Mode::Memory);
+                break;
             case Function::Utilities:
                 setMode(Mode::Utilities);
                 break;
@@ -197,6 +255,7 @@ void SystemPage::keyPress(KeyPressEvent &event) {
             ListPage::keyPress(event);
         }
         break;
+    case Mode::Memory:
     case Mode::Update:
         break;
     }
@@ -211,6 +270,7 @@ void SystemPage::encoder(EncoderEvent &event) {
     case Mode::Utilities:
         ListPage::encoder(event);
         break;
+    case Mode::Memory:
     case Mode::Update:
         break;
     }
@@ -247,6 +307,9 @@ void SystemPage::executeUtilityItem(UtilitiesListModel::Item item) {
     case UtilitiesListModel::FormatSdCard:
         formatSdCard();
         break;
+    case UtilitiesListModel::BenchmarkSdCard:
+        benchmarkSdCard();
+        break;
     case UtilitiesListModel::Last:
         break;
     }
@@ -380,6 +443,33 @@ void SystemPage::restoreSettingsFromFile() {
     });
 }
 
+void SystemPage::benchmarkSdCard() {
+    if (!FileManager::volumeAvailable()) {
+        showMessage("NO SD CARD DETECTED!");
+        return;
+    }
+
+    _engine.lock();
+    _manager.pages().busy.show("BENCHMARKING SD CARD ...");
+
+    FileManager::task([] () {
+        return SdCardBenchmark::run();
+    }, [this] (fs::Error result) {
+        if (result == fs::OK) {
+            if (SdCardBenchmark::cardUnderperforms()) {
+                showMessage("SD CARD TOO SLOW FOR AUTOSAVE!");
+            } else {
+                showMessage("SD CARD OK");
+            }
+        } else {
+            showMessage(FixedStringBuilder<32>("FAILED (%s)", fs::errorToString(result)));
+        }
+        // TODO lock ui mutex
+        _manager.pages().busy.close();
+        _engine.unlock();
+    });
+}
+
 void SystemPage::formatSdCard() {
     if (!FileManager::volumeAvailable()) {
         showMessage("NO SD CARD DETECTED!");
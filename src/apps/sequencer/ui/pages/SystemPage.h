@@ -25,6 +25,7 @@ public:
 private:
     enum class Mode : uint8_t {
         Calibration = 0,
+        Memory      = 1,
         Utilities   = 3,
         Update      = 4,
     };
@@ -44,6 +45,7 @@ private:
     void backupSettings();
     void restoreSettings();
     void formatSdCard();
+    void benchmarkSdCard();
 
     void saveSettingsToFlash();
     void backupSettingsToFile();
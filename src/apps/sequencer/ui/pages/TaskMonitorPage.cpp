@@ -0,0 +1,81 @@
+#include "TaskMonitorPage.h"
+
+#include "ui/painters/WindowPainter.h"
+
+#include "core/utils/StringBuilder.h"
+
+TaskMonitorPage::TaskMonitorPage(PageManager &manager, PageContext &context) :
+    BasePage(manager, context)
+{}
+
+void TaskMonitorPage::enter() {
+    captureStats();
+}
+
+void TaskMonitorPage::exit() {
+}
+
+void TaskMonitorPage::draw(Canvas &canvas) {
+    WindowPainter::clear(canvas);
+    WindowPainter::drawHeader(canvas, _model, _engine, "TASKS");
+
+    if (os::ticks() - _lastCaptureTicks > os::time::ms(1000)) {
+        captureStats();
+    }
+
+    canvas.setBlendMode(BlendMode::Set);
+    canvas.setFont(Font::Tiny);
+    canvas.setColor(0xf);
+
+    FixedStringBuilder<32> str;
+
+    canvas.drawText(0, 16, "TASK");
+    canvas.drawText(48, 16, "STACK");
+    canvas.drawText(104, 16, "CPU");
+
+    for (size_t i = 0; i < _taskCount; ++i) {
+        const auto &stats = _taskStats[i];
+        int y = 22 + i * 6;
+
+        canvas.drawText(0, y, stats.name);
+
+        str.reset();
+        str("%lu/%lu", stats.stackUsage, stats.stackSize);
+        canvas.drawText(48, y, str);
+
+        str.reset();
+        str("%lu%%", stats.cpuUsage);
+        canvas.drawText(104, y, str);
+    }
+
+    if (_taskCount == 0) {
+        canvas.drawText(0, 22, "NOT AVAILABLE");
+    }
+
+    canvas.drawText(136, 16, "MEMORY");
+
+    str.reset();
+    str("RAM %lu/%luK", (_memoryStats.ramUsed + 1023) / 1024, _memoryStats.ramTotal / 1024);
+    canvas.drawText(136, 22, str);
+
+    str.reset();
+    str("CCM %lu/%luK", (_memoryStats.ccmUsed + 1023) / 1024, _memoryStats.ccmTotal / 1024);
+    canvas.drawText(136, 28, str);
+}
+
+void TaskMonitorPage::updateLeds(Leds &leds) {
+}
+
+void TaskMonitorPage::keyPress(KeyPressEvent &event) {
+    event.consume();
+}
+
+void TaskMonitorPage::encoder(EncoderEvent &event) {
+    event.consume();
+}
+
+void TaskMonitorPage::captureStats() {
+    _taskCount = os::TaskProfiler::captureTaskStats(_taskStats, MaxTasks);
+    os::TaskProfiler::captureMemoryStats(_memoryStats);
+    _lastCaptureTicks = os::ticks();
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "BasePage.h"
+
+#include "os/os.h"
+
+class TaskMonitorPage : public BasePage {
+public:
+    TaskMonitorPage(PageManager &manager, PageContext &context);
+
+    virtual void enter() override;
+    virtual void exit() override;
+
+    virtual void draw(Canvas &canvas) override;
+    virtual void updateLeds(Leds &leds) override;
+
+    virtual void keyPress(KeyPressEvent &event) override;
+    virtual void encoder(EncoderEvent &event) override;
+
+private:
+    static constexpr size_t MaxTasks = 8;
+
+    void captureStats();
+
+    os::TaskProfiler::TaskStats _taskStats[MaxTasks];
+    os::TaskProfiler::MemoryStats _memoryStats;
+    size_t _taskCount = 0;
+    uint32_t _lastCaptureTicks = 0;
+};
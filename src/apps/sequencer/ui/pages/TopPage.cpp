@@ -63,7 +63,8 @@ void TopPage::editRoute(Routing::Target target, int trackIndex) {
 }
 
 void TopPage::updateLeds(Leds &leds) {
-    bool clockTick = _engine.clockRunning() && _engine.tick() % CONFIG_PPQN < (CONFIG_PPQN / 8);
+    uint32_t ppqn = _engine.ppqn();
+    bool clockTick = _engine.clockRunning() && _engine.tick() % ppqn < (ppqn / 8);
 
     leds.set(
         Key::Play,
@@ -181,6 +182,9 @@ void TopPage::setMode(Mode mode) {
     case Mode::UserScale:
         setMainPage(pages.userScale);
         break;
+    case Mode::Tasks:
+        setMainPage(pages.taskMonitor);
+        break;
     case Mode::Monitor:
         setMainPage(pages.monitor);
         break;
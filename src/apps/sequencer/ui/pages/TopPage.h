@@ -39,6 +39,7 @@ private:
 
         // aux modes
         UserScale       = PageKeyMap::UserScale,
+        Tasks           = PageKeyMap::Tasks,
         Monitor         = PageKeyMap::Monitor,
         System          = PageKeyMap::System,
 
@@ -182,7 +182,7 @@ void UserScalePage::saveUserScaleToSlot(int slot) {
         // TODO lock ui mutex
         _manager.pages().busy.close();
         _engine.unlock();
-    });
+    }, FileManager::TaskPriority::High);
 }
 
 void UserScalePage::loadUserScaleFromSlot(int slot) {
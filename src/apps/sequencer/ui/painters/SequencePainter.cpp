@@ -45,13 +45,8 @@ void SequencePainter::drawRetrigger(Canvas &canvas, int x, int y, int w, int h,
 void SequencePainter::drawProbability(Canvas &canvas, int x, int y, int w, int h, int probability, int maxProbability) {
     canvas.setBlendMode(BlendMode::Set);
 
-    int pw = (w * probability) / maxProbability;
-
     canvas.setColor(0xf);
-    canvas.fillRect(x, y, pw, h);
-
-    canvas.setColor(0x7);
-    canvas.fillRect(x + pw, y, w - pw, h);
+    canvas.drawHGauge(x, y, w, h, float(probability) / maxProbability, 0x7);
 }
 
 void SequencePainter::drawLength(Canvas &canvas, int x, int y, int w, int h, int length, int maxLength) {
@@ -4,6 +4,8 @@
 
 #include "core/utils/StringBuilder.h"
 
+#include <cstring>
+
 static void drawInvertedText(Canvas &canvas, int x, int y, const char *text, bool inverted = true) {
     canvas.setFont(Font::Tiny);
     canvas.setBlendMode(BlendMode::Set);
@@ -31,6 +33,16 @@ void WindowPainter::drawFrame(Canvas &canvas, int x, int y, int w, int h) {
     canvas.drawRect(x, y, w, h);
 }
 
+// cached footer label layout, function key names are string literals, so
+// comparing pointers is enough to detect a page or function change and the
+// label centering is only measured when a label actually changed
+struct FunctionKeyLayout {
+    const char *names[CONFIG_FUNCTION_KEY_COUNT] = {};
+    uint8_t textX[CONFIG_FUNCTION_KEY_COUNT] = {};
+};
+
+static FunctionKeyLayout functionKeyLayout;
+
 void WindowPainter::drawFunctionKeys(Canvas &canvas, const char *names[], const KeyState &keyState, int highlight) {
     canvas.setBlendMode(BlendMode::Set);
     canvas.setColor(0x7);
@@ -65,7 +77,12 @@ void WindowPainter::drawFunctionKeys(Canvas &canvas, const char *names[], const
                 canvas.setBlendMode(BlendMode::Sub);
             }
 
-            canvas.drawText(x0 + (w - canvas.textWidth(names[i])) / 2, PageHeight - 3, names[i]);
+            if (names[i] != functionKeyLayout.names[i]) {
+                functionKeyLayout.names[i] = names[i];
+                functionKeyLayout.textX[i] = x0 + (w - canvas.textWidth(names[i])) / 2;
+            }
+
+            canvas.drawText(functionKeyLayout.textX[i], PageHeight - 3, names[i]);
         }
     }
 }
@@ -76,27 +93,61 @@ void WindowPainter::drawClock(Canvas &canvas, const Engine &engine) {
 
     drawInvertedText(canvas, 2, 8 - 2, name);
 
+    // only re-format the tempo display when the tempo changed
+    static float lastTempo = -1.f;
+    static char tempoText[8];
+    float tempo = engine.tempo();
+    if (tempo != lastTempo) {
+        lastTempo = tempo;
+        FixedStringBuilder<8> str("%.1f", tempo);
+        std::strcpy(tempoText, str);
+    }
+
     canvas.setBlendMode(BlendMode::Set);
     canvas.setColor(0xf);
-    canvas.drawText(10, 8 - 2, FixedStringBuilder<8>("%.1f", engine.tempo()));
+    canvas.drawText(10, 8 - 2, tempoText);
 }
 
 void WindowPainter::drawActiveState(Canvas &canvas, int track, int playPattern, int editPattern, bool snapshotActive, bool songActive) {
+    // cached header state labels, re-formatted only when the displayed
+    // values change
+    static struct {
+        int8_t track = -1;
+        int8_t playPattern = -1;
+        int8_t editPattern = -1;
+        char trackText[4];
+        char playText[4];
+        char editText[4];
+    } labels;
+
+    if (track != labels.track) {
+        labels.track = track;
+        StringBuilder(labels.trackText, sizeof(labels.trackText))("T%d", track + 1);
+    }
+    if (playPattern != labels.playPattern) {
+        labels.playPattern = playPattern;
+        StringBuilder(labels.playText, sizeof(labels.playText))("P%d", playPattern + 1);
+    }
+    if (editPattern != labels.editPattern) {
+        labels.editPattern = editPattern;
+        StringBuilder(labels.editText, sizeof(labels.editText))("E%d", editPattern + 1);
+    }
+
     canvas.setFont(Font::Tiny);
     canvas.setBlendMode(BlendMode::Set);
     canvas.setColor(0xf);
 
     // draw selected track
-    canvas.drawText(40, 8 - 2, FixedStringBuilder<8>("T%d", track + 1));
+    canvas.drawText(40, 8 - 2, labels.trackText);
 
     if (snapshotActive) {
         drawInvertedText(canvas, 56, 8 - 2, "SNAP", true);
     } else {
         // draw active pattern
-        drawInvertedText(canvas, 56, 8 - 2, FixedStringBuilder<8>("P%d", playPattern + 1), songActive);
+        drawInvertedText(canvas, 56, 8 - 2, labels.playText, songActive);
 
         // draw edit pattern
-        drawInvertedText(canvas, 75, 8 - 2, FixedStringBuilder<8>("E%d", editPattern + 1), playPattern == editPattern);
+        drawInvertedText(canvas, 75, 8 - 2, labels.editText, playPattern == editPattern);
     }
 }
 
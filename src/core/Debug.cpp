@@ -41,6 +41,7 @@ void dbg_assert(bool cond, const char *filename, int line, const char *fmt, ...)
             stbsp_vsnprintf(msg, sizeof(msg), fmt, va);
             assert_handler(filename, line, msg);
         }
+        Console::flush();
         __builtin_trap();
         while (1) {}
     }
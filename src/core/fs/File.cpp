@@ -5,11 +5,100 @@
 #include "os/os.h"
 #include "os/LockGuard.h"
 
+#include <algorithm>
+
+#include <cstring>
+
 namespace fs {
 
 static ObjectPool<FIL, 2> filePool;
 static os::Mutex filePoolMutex;
 
+struct IoBuffer {
+    uint32_t data[IoBufferSize / 4];
+};
+
+static ObjectPool<IoBuffer, 2> ioBufferPool;
+static os::Mutex ioBufferPoolMutex;
+
+uint32_t *allocateIoBuffer() {
+    os::LockGuard lock(ioBufferPoolMutex);
+    IoBuffer *buffer = ioBufferPool.allocate();
+    ASSERT(buffer, "no free io buffers");
+    return buffer->data;
+}
+
+void releaseIoBuffer(uint32_t *buffer) {
+    os::LockGuard lock(ioBufferPoolMutex);
+    ioBufferPool.release(reinterpret_cast<IoBuffer *>(buffer));
+}
+
+Error File::cachedWrite(const void *buf, size_t len, size_t *lenWritten) {
+    const uint8_t *src = static_cast<const uint8_t *>(buf);
+    uint8_t *cache = reinterpret_cast<uint8_t *>(_cache);
+    size_t written = 0;
+
+    _error = OK;
+    while (_error == OK && written < len) {
+        size_t chunk = std::min(len - written, IoBufferSize - _cachePos);
+        std::memcpy(&cache[_cachePos], &src[written], chunk);
+        _cachePos += chunk;
+        written += chunk;
+        if (_cachePos == IoBufferSize) {
+            flushCache();
+        }
+    }
+
+    if (lenWritten) {
+        *lenWritten = written;
+    }
+    return _error;
+}
+
+Error File::cachedRead(void *buf, size_t len, size_t *lenRead) {
+    uint8_t *dst = static_cast<uint8_t *>(buf);
+    const uint8_t *cache = reinterpret_cast<const uint8_t *>(_cache);
+    size_t read = 0;
+
+    _error = OK;
+    while (_error == OK && read < len) {
+        if (_cachePos >= _cacheFill) {
+            // read ahead a full buffer
+            _cacheOffset = f_tell(_file);
+            _cachePos = 0;
+            _cacheFill = 0;
+            UINT br;
+            _error = Error(f_read(_file, _cache, IoBufferSize, &br));
+            if (_error != OK || br == 0) {
+                break;
+            }
+            _cacheFill = br;
+        }
+        size_t chunk = std::min(len - read, _cacheFill - _cachePos);
+        std::memcpy(&dst[read], &cache[_cachePos], chunk);
+        _cachePos += chunk;
+        read += chunk;
+    }
+
+    if (lenRead) {
+        *lenRead = read;
+    }
+    return _error;
+}
+
+Error File::flushCache() {
+    if (_cachePos > 0) {
+        UINT bw;
+        _error = Error(f_write(_file, _cache, _cachePos, &bw));
+        if (_error == OK && bw != _cachePos) {
+            _error = DISK_FULL;
+        }
+        _cachePos = 0;
+        return _error;
+    }
+    return OK;
+}
+
 FIL *File::allocateFile() {
     os::LockGuard lock(filePoolMutex);
     FIL *file = filePool.allocate();
@@ -9,6 +9,14 @@
 
 namespace fs {
 
+// Shared sector-aligned staging buffers for cached file I/O, allocated from a
+// static pool to keep them off the task stacks. Sized to span multiple
+// sectors so buffered I/O maps onto multi-block SD card transfers.
+static constexpr size_t IoBufferSize = 4096;
+
+uint32_t *allocateIoBuffer();
+void releaseIoBuffer(uint32_t *buffer);
+
 class File {
 public:
     enum Mode {
@@ -19,16 +27,29 @@ public:
 
     File() = default;
 
-    File(const char *path, Mode mode) {
-        open(path, mode);
+    File(const char *path, Mode mode, bool cached = false) {
+        open(path, mode, cached);
     }
 
     ~File() {
         close();
     }
 
-    Error open(const char *path, Mode mode) {
+    // Opening a file in cached mode attaches one of the pooled staging
+    // buffers: writes are collected and flushed in buffer sized chunks
+    // (write-behind), reads fetch a full buffer ahead and serve sequential
+    // access from memory (read-ahead). Cached mode does not support mixing
+    // reads and writes on the same file.
+    Error open(const char *path, Mode mode, bool cached = false) {
         _file = allocateFile();
+        _mode = mode;
+
+        if (cached) {
+            _cache = allocateIoBuffer();
+            _cacheOffset = 0;
+            _cachePos = 0;
+            _cacheFill = 0;
+        }
 
         switch (mode) {
         case Read:      _error = Error(f_open(_file, path, FA_READ)); break;
@@ -41,7 +62,18 @@ public:
 
     Error close() {
         if (_file) {
+            Error flushError = OK;
+            if (_cache) {
+                if (_mode != Read) {
+                    flushError = flushCache();
+                }
+                releaseIoBuffer(_cache);
+                _cache = nullptr;
+            }
             _error = Error(f_close(_file));
+            if (_error == OK) {
+                _error = flushError;
+            }
             releaseFile(_file);
             _file = nullptr;
             return _error;
@@ -50,6 +82,9 @@ public:
     }
 
     Error write(const void *buf, size_t len, size_t *lenWritten = nullptr) {
+        if (_cache && _mode != Read) {
+            return cachedWrite(buf, len, lenWritten);
+        }
         UINT bw;
         _error = Error(f_write(_file, buf, len, &bw));
         if (lenWritten) {
@@ -68,6 +103,9 @@ public:
     }
 
     Error read(void *buf, size_t len, size_t *lenRead = nullptr) {
+        if (_cache && _mode == Read) {
+            return cachedRead(buf, len, lenRead);
+        }
         UINT br;
         _error = Error(f_read(_file, buf, len, &br));
         if (lenRead) {
@@ -77,6 +115,9 @@ public:
     }
 
     bool eof() {
+        if (_cache && _mode == Read) {
+            return tell() >= size();
+        }
         return f_eof(_file);
     }
 
@@ -85,20 +126,53 @@ public:
     }
 
     size_t tell() const {
+        if (_cache) {
+            return _mode == Read ? _cacheOffset + _cachePos : f_tell(_file) + _cachePos;
+        }
         return f_tell(_file);
     }
 
     Error seek(size_t offset) {
+        if (_cache) {
+            if (_mode == Read) {
+                // serve seeks within the cached range from memory
+                if (offset >= _cacheOffset && offset < _cacheOffset + _cacheFill) {
+                    _cachePos = offset - _cacheOffset;
+                    _error = OK;
+                    return _error;
+                }
+                _cacheOffset = offset;
+                _cachePos = 0;
+                _cacheFill = 0;
+            } else {
+                _error = flushCache();
+                if (_error != OK) {
+                    return _error;
+                }
+            }
+        }
         _error = Error(f_lseek(_file, offset));
         return _error;
     }
 
     Error truncate() {
+        if (_cache && _mode != Read) {
+            _error = flushCache();
+            if (_error != OK) {
+                return _error;
+            }
+        }
         _error = Error(f_truncate(_file));
         return _error;
     }
 
     Error sync() {
+        if (_cache && _mode != Read) {
+            _error = flushCache();
+            if (_error != OK) {
+                return _error;
+            }
+        }
         _error = Error(f_sync(_file));
         return _error;
     }
@@ -108,11 +182,21 @@ public:
     }
 
 private:
+    Error cachedWrite(const void *buf, size_t len, size_t *lenWritten);
+    Error cachedRead(void *buf, size_t len, size_t *lenRead);
+    Error flushCache();
+
     static FIL *allocateFile();
     static void releaseFile(FIL *file);
 
     FIL *_file = nullptr;
+    Mode _mode = Read;
     Error _error = OK;
+
+    uint32_t *_cache = nullptr;
+    size_t _cacheOffset = 0;
+    size_t _cachePos = 0;
+    size_t _cacheFill = 0;
 };
 
 } // namespace fs
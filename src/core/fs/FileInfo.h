@@ -2,6 +2,8 @@
 
 #include "ff/ff.h"
 
+#include <cstdint>
+
 namespace fs {
 
 class FileInfo {
@@ -10,6 +12,9 @@ public:
 
     size_t size() const { return _info.fsize; }
 
+    // packed FAT modification date & time
+    uint32_t mtime() const { return (uint32_t(_info.fdate) << 16) | _info.ftime; }
+
 private:
     FILINFO _info;
 
@@ -1,8 +1,29 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace blit {
+    // Word-wide horizontal span fill with head/tail handling. Pixels are
+    // stored as one byte each, so four pixels are written per 32-bit store.
+    inline void fillSpan(uint8_t *dst, size_t len, uint8_t color) {
+        while (len > 0 && (reinterpret_cast<uintptr_t>(dst) & 3) != 0) {
+            *dst++ = color;
+            --len;
+        }
+        uint32_t word = uint32_t(color) * 0x01010101u;
+        uint32_t *dst32 = reinterpret_cast<uint32_t *>(dst);
+        while (len >= 4) {
+            *dst32++ = word;
+            len -= 4;
+        }
+        dst = reinterpret_cast<uint8_t *>(dst32);
+        while (len > 0) {
+            *dst++ = color;
+            --len;
+        }
+    }
+
     struct set {
         void operator()(FrameBuffer8bit &frameBuffer, int x, int y, uint8_t color) {
             frameBuffer(x, y) = color;
@@ -1,6 +1,8 @@
 #include "Canvas.h"
 #include "Blit.h"
 
+#include <cstring>
+
 #include <stdio.h>
 
 // Font definitions
@@ -31,9 +33,47 @@ static const int bitmapFontOffset(Font font) {
     }
 }
 
+// Precomputed per-font metrics for the text fast paths. The fonts are
+// checked-in generated headers, so the tables are derived once at startup
+// instead of by the font generator.
+struct FontMetrics {
+    // xAdvance per character code, zero outside the font's extents
+    uint8_t advance[256];
+
+    FontMetrics(const BitmapFont &font) {
+        for (int c = 0; c < 256; ++c) {
+            advance[c] = (c >= font.first && c <= font.last) ? font.glyphs[c - font.first].xAdvance : 0;
+        }
+    }
+};
+
+static const FontMetrics &fontMetrics(Font font) {
+    static const FontMetrics tinyMetrics(tiny5x5);
+    static const FontMetrics smallMetrics(ati8x8);
+    switch (font) {
+    case Font::Tiny: return tinyMetrics;
+    case Font::Small: return smallMetrics;
+    default: return tinyMetrics;
+    }
+}
+
+// expands a nibble of 1bpp pixels into a per-byte mask (bit N -> byte N,
+// pixels are stored little-endian)
+static const uint32_t nibbleMask[16] = {
+    0x00000000, 0x000000ff, 0x0000ff00, 0x0000ffff,
+    0x00ff0000, 0x00ff00ff, 0x00ffff00, 0x00ffffff,
+    0xff000000, 0xff0000ff, 0xff00ff00, 0xff00ffff,
+    0xffff0000, 0xffff00ff, 0xffffff00, 0xffffffff,
+};
+
 
 void Canvas::fill() {
-    _frameBuffer.fill(_color);
+    if (_clipDepth == 0) {
+        markDirty(0, 0, _right, _bottom);
+        _frameBuffer.fill(_color);
+    } else {
+        fillRectSet(_clip.x0, _clip.y0, _clip.x1 - _clip.x0 + 1, _clip.y1 - _clip.y0 + 1);
+    }
 }
 
 void Canvas::point(int x, int y) {
@@ -44,9 +84,101 @@ void Canvas::point(int x, int y) {
     }
 }
 
+void Canvas::hlineSet(int x, int y, int w) {
+    if (vinside(y)) {
+        int x0 = std::max(x, int(_clip.x0));
+        int x1 = std::min(x + w - 1, int(_clip.x1));
+        if (x0 <= x1) {
+            markDirty(x0, y, x1, y);
+            blit::fillSpan(&_frameBuffer(x0, y), x1 - x0 + 1, _color);
+        }
+    }
+}
+
+void Canvas::fillRectSet(int x, int y, int w, int h) {
+    int x0 = std::max(x, int(_clip.x0));
+    int y0 = std::max(y, int(_clip.y0));
+    int x1 = std::min(x + w - 1, int(_clip.x1));
+    int y1 = std::min(y + h - 1, int(_clip.y1));
+    if (x0 <= x1 && y0 <= y1) {
+        markDirty(x0, y0, x1, y1);
+        for (int y = y0; y <= y1; ++y) {
+            blit::fillSpan(&_frameBuffer(x0, y), x1 - x0 + 1, _color);
+        }
+    }
+}
+
+void Canvas::drawHGaugeSet(int x, int y, int w, int h, int fillWidth, uint8_t backgroundColor) {
+    int x0 = std::max(x, int(_clip.x0));
+    int y0 = std::max(y, int(_clip.y0));
+    int x1 = std::min(x + w - 1, int(_clip.x1));
+    int y1 = std::min(y + h - 1, int(_clip.y1));
+    if (x0 <= x1 && y0 <= y1) {
+        markDirty(x0, y0, x1, y1);
+        // first background pixel, clamped into the clipped span
+        int split = std::max(x0, std::min(x1 + 1, x + fillWidth));
+        for (int py = y0; py <= y1; ++py) {
+            if (split > x0) {
+                blit::fillSpan(&_frameBuffer(x0, py), split - x0, _color);
+            }
+            if (split <= x1) {
+                blit::fillSpan(&_frameBuffer(split, py), x1 - split + 1, backgroundColor);
+            }
+        }
+    }
+}
+
+void Canvas::drawVGaugeSet(int x, int y, int w, int h, int fillHeight, uint8_t backgroundColor) {
+    int x0 = std::max(x, int(_clip.x0));
+    int y0 = std::max(y, int(_clip.y0));
+    int x1 = std::min(x + w - 1, int(_clip.x1));
+    int y1 = std::min(y + h - 1, int(_clip.y1));
+    if (x0 <= x1 && y0 <= y1) {
+        markDirty(x0, y0, x1, y1);
+        // the gauge fills from the bottom, rows at and below the split are lit
+        int split = y + h - fillHeight;
+        for (int py = y0; py <= y1; ++py) {
+            blit::fillSpan(&_frameBuffer(x0, py), x1 - x0 + 1, py >= split ? _color : backgroundColor);
+        }
+    }
+}
+
+void Canvas::drawGlyph1bitSet(int x, int y, int w, int h, const uint8_t *rows) {
+    markDirty(x, y, x + w - 1, y + h - 1);
+    uint32_t colorWord = uint32_t(_color) * 0x01010101u;
+    for (int row = 0; row < h; ++row) {
+        // one byte per row, aligned by the font generator
+        uint32_t bits = rows[row];
+        // opaque set blend, off pixels clear the background just like the
+        // generic bitmap path does
+        uint8_t *dst = &_frameBuffer(x, y + row);
+        int len = w;
+        while (len >= 4) {
+            uint32_t word = colorWord & nibbleMask[bits & 0xf];
+            std::memcpy(dst, &word, 4);
+            bits >>= 4;
+            dst += 4;
+            len -= 4;
+        }
+        while (len > 0) {
+            *dst++ = (bits & 1) ? _color : 0;
+            bits >>= 1;
+            --len;
+        }
+    }
+}
+
+void Canvas::drawGlyph1bit(int x, int y, int w, int h, const uint8_t *rows) {
+    switch (_blendMode) {
+    case BlendMode::Set: drawGlyph1bit<blit::set>(x, y, w, h, rows); break;
+    case BlendMode::Add: drawGlyph1bit<blit::add>(x, y, w, h, rows); break;
+    case BlendMode::Sub: drawGlyph1bit<blit::sub>(x, y, w, h, rows); break;
+    }
+}
+
 void Canvas::hline(int x, int y, int w) {
     switch (_blendMode) {
-    case BlendMode::Set: hline<blit::set>(x, y, w); break;
+    case BlendMode::Set: hlineSet(x, y, w); break;
     case BlendMode::Add: hline<blit::add>(x, y, w); break;
     case BlendMode::Sub: hline<blit::sub>(x, y, w); break;
     }
@@ -78,15 +210,91 @@ void Canvas::drawRect(int x, int y, int w, int h) {
 
 void Canvas::fillRect(int x, int y, int w, int h) {
     switch (_blendMode) {
-    case BlendMode::Set: fillRect<blit::set>(x, y, w, h); break;
+    case BlendMode::Set: fillRectSet(x, y, w, h); break;
     case BlendMode::Add: fillRect<blit::add>(x, y, w, h); break;
     case BlendMode::Sub: fillRect<blit::sub>(x, y, w, h); break;
     }
 }
 
+void Canvas::drawHGauge(int x, int y, int w, int h, float value, uint8_t backgroundColor) {
+    int fillWidth = std::max(0, std::min(w, int(value * w + 0.5f)));
+    if (_blendMode == BlendMode::Set) {
+        drawHGaugeSet(x, y, w, h, fillWidth, backgroundColor);
+    } else {
+        // compose from rectangles for the blended modes
+        uint8_t color = _color;
+        setColor(backgroundColor);
+        fillRect(x + fillWidth, y, w - fillWidth, h);
+        setColor(color);
+        fillRect(x, y, fillWidth, h);
+    }
+}
+
+void Canvas::drawVGauge(int x, int y, int w, int h, float value, uint8_t backgroundColor) {
+    int fillHeight = std::max(0, std::min(h, int(value * h + 0.5f)));
+    if (_blendMode == BlendMode::Set) {
+        drawVGaugeSet(x, y, w, h, fillHeight, backgroundColor);
+    } else {
+        // compose from rectangles for the blended modes
+        uint8_t color = _color;
+        setColor(backgroundColor);
+        fillRect(x, y, w, h - fillHeight);
+        setColor(color);
+        fillRect(x, y + h - fillHeight, w, fillHeight);
+    }
+}
+
+void Canvas::drawBitmap1bitSet(int x, int y, int w, int h, const uint8_t *bitmap) {
+    int x0 = std::max(x, int(_clip.x0));
+    int y0 = std::max(y, int(_clip.y0));
+    int x1 = std::min(x + w - 1, int(_clip.x1));
+    int y1 = std::min(y + h - 1, int(_clip.y1));
+    if (x0 > x1 || y0 > y1) {
+        return;
+    }
+
+    markDirty(x0, y0, x1, y1);
+
+    uint32_t colorWord = uint32_t(_color) * 0x01010101u;
+    for (int py = y0; py <= y1; ++py) {
+        // rows are packed back to back without alignment, so feed the pixel
+        // stream through a small bit reservoir
+        int index = (py - y) * w + (x0 - x);
+        const uint8_t *src = &bitmap[index >> 3];
+        uint32_t bits = *src++ >> (index & 7);
+        int avail = 8 - (index & 7);
+        uint8_t *dst = &_frameBuffer(x0, py);
+        int len = x1 - x0 + 1;
+        while (len >= 4) {
+            if (avail < 4) {
+                bits |= uint32_t(*src++) << avail;
+                avail += 8;
+            }
+            uint32_t word = colorWord & nibbleMask[bits & 0xf];
+            std::memcpy(dst, &word, 4);
+            bits >>= 4;
+            avail -= 4;
+            dst += 4;
+            len -= 4;
+        }
+        while (len > 0) {
+            if (avail == 0) {
+                bits = *src++;
+                avail = 8;
+            }
+            // opaque set blend, off pixels clear the background just like
+            // the generic path does
+            *dst++ = (bits & 1) ? _color : 0;
+            bits >>= 1;
+            --avail;
+            --len;
+        }
+    }
+}
+
 void Canvas::drawBitmap1bit(int x, int y, int w, int h, const uint8_t *bitmap) {
     switch (_blendMode) {
-    case BlendMode::Set: drawBitmap<blit::set, 1>(x, y, w, h, bitmap); break;
+    case BlendMode::Set: drawBitmap1bitSet(x, y, w, h, bitmap); break;
     case BlendMode::Add: drawBitmap<blit::add, 1>(x, y, w, h, bitmap); break;
     case BlendMode::Sub: drawBitmap<blit::sub, 1>(x, y, w, h, bitmap); break;
     }
@@ -102,6 +310,8 @@ void Canvas::drawBitmap4bit(int x, int y, int w, int h, const uint8_t *bitmap) {
 
 void Canvas::drawText(int x, int y, const char *str) {
     const auto &font = bitmapFont(_font);
+    // fontpack only emits 1bpp row aligned fonts
+    bool fastPath = _blendMode == BlendMode::Set;
 
     int ox = x;
     while (*str != '\0') {
@@ -116,9 +326,12 @@ void Canvas::drawText(int x, int y, const char *str) {
         }
         const auto &g = font.glyphs[c - font.first];
         const uint8_t *bitmap = &font.bitmap[g.offset];
-        switch (font.bpp) {
-        case 1: drawBitmap1bit(x + g.xOffset, y + g.yOffset, g.width, g.height, bitmap); break;
-        case 4: drawBitmap4bit(x + g.xOffset, y + g.yOffset, g.width, g.height, bitmap); break;
+        int gx = x + g.xOffset;
+        int gy = y + g.yOffset;
+        if (fastPath && gx >= _clip.x0 && gy >= _clip.y0 && gx + g.width <= _clip.x1 + 1 && gy + g.height <= _clip.y1 + 1) {
+            drawGlyph1bitSet(gx, gy, g.width, g.height, bitmap);
+        } else {
+            drawGlyph1bit(gx, gy, g.width, g.height, bitmap);
         }
         x += g.xAdvance;
     }
@@ -159,6 +372,8 @@ void Canvas::drawTextAligned(int x, int y, int w, int h, HorizontalAlign horizon
 
 void Canvas::drawTextMultiline(int x, int y, int w, const char *str) {
     const auto &font = bitmapFont(_font);
+    // fontpack only emits 1bpp row aligned fonts
+    bool fastPath = _blendMode == BlendMode::Set;
 
     int ox = x;
     while (*str != '\0') {
@@ -179,25 +394,23 @@ void Canvas::drawTextMultiline(int x, int y, int w, const char *str) {
             continue;
         }
         const uint8_t *bitmap = &font.bitmap[g.offset];
-        switch (font.bpp) {
-        case 1: drawBitmap1bit(x + g.xOffset, y + g.yOffset, g.width, g.height, bitmap); break;
-        case 4: drawBitmap4bit(x + g.xOffset, y + g.yOffset, g.width, g.height, bitmap); break;
+        int gx = x + g.xOffset;
+        int gy = y + g.yOffset;
+        if (fastPath && gx >= _clip.x0 && gy >= _clip.y0 && gx + g.width <= _clip.x1 + 1 && gy + g.height <= _clip.y1 + 1) {
+            drawGlyph1bitSet(gx, gy, g.width, g.height, bitmap);
+        } else {
+            drawGlyph1bit(gx, gy, g.width, g.height, bitmap);
         }
         x += g.xAdvance;
     }
 }
 
 int Canvas::textWidth(const char *str) {
-    const auto &font = bitmapFont(_font);
+    const auto &metrics = fontMetrics(_font);
     int width = 0;
 
     while (*str != '\0') {
-        auto c = *str++;
-        if (c < font.first || c > font.last) {
-            continue;
-        }
-        const auto &g = font.glyphs[c - font.first];
-        width += g.xAdvance;
+        width += metrics.advance[uint8_t(*str++)];
     }
 
     return width;
@@ -217,3 +430,16 @@ int Canvas::textHeight(const char *str) {
     return height;
 }
 
+void Canvas::saveRect(int x, int y, int w, int h, uint8_t *buffer) const {
+    for (int row = 0; row < h; ++row) {
+        std::memcpy(&buffer[row * w], &_frameBuffer(x, y + row), w);
+    }
+}
+
+void Canvas::restoreRect(int x, int y, int w, int h, const uint8_t *buffer) {
+    markDirty(x, y, x + w - 1, y + h - 1);
+    for (int row = 0; row < h; ++row) {
+        std::memcpy(&_frameBuffer(x, y + row), &buffer[row * w], w);
+    }
+}
+
@@ -38,6 +38,14 @@ public:
         _right(frameBuffer.width() - 1),
         _bottom(frameBuffer.height() - 1)
     {
+        // start with a full dirty rectangle so the first flush covers the
+        // whole display
+        _dirtyX0 = 0;
+        _dirtyY0 = 0;
+        _dirtyX1 = _right;
+        _dirtyY1 = _bottom;
+
+        _clip = { 0, 0, int16_t(_right), int16_t(_bottom) };
     }
 
     uint8_t color() const { return _color; }
@@ -61,6 +69,12 @@ public:
     void drawRect(int x, int y, int w, int h);
     void fillRect(int x, int y, int w, int h);
 
+    // gauges/meters: the part of the rectangle up to value (0..1) is filled
+    // with the current color, the remainder with backgroundColor; horizontal
+    // gauges fill from the left, vertical gauges from the bottom
+    void drawHGauge(int x, int y, int w, int h, float value, uint8_t backgroundColor);
+    void drawVGauge(int x, int y, int w, int h, float value, uint8_t backgroundColor);
+
     void drawBitmap1bit(int x, int y, int w, int h, const uint8_t *bitmap);
     void drawBitmap4bit(int x, int y, int w, int h, const uint8_t *bitmap);
 
@@ -72,14 +86,104 @@ public:
     int textWidth(const char *str);
     int textHeight(const char *str);
 
+    // copy a framebuffer region to/from an external buffer (w * h bytes,
+    // row major), used for compositing overlays over a saved background
+    void saveRect(int x, int y, int w, int h, uint8_t *buffer) const;
+    void restoreRect(int x, int y, int w, int h, const uint8_t *buffer);
+
+    // dirty rectangle covering all pixels touched since the last clearDirty()
+
+    bool dirty() const { return _dirtyX0 <= _dirtyX1 && _dirtyY0 <= _dirtyY1; }
+    int dirtyX() const { return _dirtyX0; }
+    int dirtyY() const { return _dirtyY0; }
+    int dirtyW() const { return _dirtyX1 - _dirtyX0 + 1; }
+    int dirtyH() const { return _dirtyY1 - _dirtyY0 + 1; }
+
+    void clearDirty() {
+        _dirtyX0 = _frameBuffer.width();
+        _dirtyY0 = _frameBuffer.height();
+        _dirtyX1 = -1;
+        _dirtyY1 = -1;
+    }
+
+    // clip rectangle stack: primitives are clipped against the intersection
+    // of the framebuffer and all pushed rectangles, and primitives fully
+    // outside that region are rejected before rasterization, so callers can
+    // declare a drawing region and skip offscreen content entirely
+
+    void pushClipRect(int x, int y, int w, int h) {
+        if (_clipDepth < MaxClipDepth) {
+            _clipStack[_clipDepth++] = _clip;
+            _clip.x0 = std::max(_clip.x0, int16_t(x));
+            _clip.y0 = std::max(_clip.y0, int16_t(y));
+            _clip.x1 = std::min(_clip.x1, int16_t(x + w - 1));
+            _clip.y1 = std::min(_clip.y1, int16_t(y + h - 1));
+        }
+    }
+
+    void popClipRect() {
+        if (_clipDepth > 0) {
+            _clip = _clipStack[--_clipDepth];
+        }
+    }
 
 private:
+    // word-wide fast paths for opaque fills
+    void hlineSet(int x, int y, int w);
+    void fillRectSet(int x, int y, int w, int h);
+
+    // one-pass gauge fills, each framebuffer pixel is written exactly once
+    void drawHGaugeSet(int x, int y, int w, int h, int fillWidth, uint8_t backgroundColor);
+    void drawVGaugeSet(int x, int y, int w, int h, int fillHeight, uint8_t backgroundColor);
+
+    // word-wide fast path for opaque 1bpp glyphs that lie fully inside the
+    // canvas
+    void drawGlyph1bitSet(int x, int y, int w, int h, const uint8_t *rows);
+
+    // word-wide fast path for opaque 1bpp bitmaps, the packed pixel stream
+    // is expanded four pixels at a time
+    void drawBitmap1bitSet(int x, int y, int w, int h, const uint8_t *bitmap);
+
+    // clipped/blended path for 1bpp glyphs
+    void drawGlyph1bit(int x, int y, int w, int h, const uint8_t *rows);
+
+    template<typename Blit>
+    void drawGlyph1bit(int x, int y, int w, int h, const uint8_t *rows) {
+        Blit blit;
+        int x0 = std::max(x, int(_clip.x0));
+        int y0 = std::max(y, int(_clip.y0));
+        int x1 = std::min(x + w - 1, int(_clip.x1));
+        int y1 = std::min(y + h - 1, int(_clip.y1));
+        if (x0 > x1 || y0 > y1) {
+            return;
+        }
+
+        markDirty(x0, y0, x1, y1);
+
+        for (int py = y0; py <= y1; ++py) {
+            uint8_t bits = rows[py - y] >> (x0 - x);
+            for (int px = x0; px <= x1; ++px) {
+                blit(_frameBuffer, px, py, (bits & 1) * _color);
+                bits >>= 1;
+            }
+        }
+    }
+
+    void markDirty(int x0, int y0, int x1, int y1) {
+        if (x0 > x1 || y0 > y1) {
+            return;
+        }
+        _dirtyX0 = std::min(_dirtyX0, x0);
+        _dirtyY0 = std::min(_dirtyY0, y0);
+        _dirtyX1 = std::max(_dirtyX1, x1);
+        _dirtyY1 = std::max(_dirtyY1, y1);
+    }
     void hclip(int &x) {
-        x = std::max(0, std::min(_right, x));
+        x = std::max(int(_clip.x0), std::min(int(_clip.x1), x));
     }
 
     void vclip(int &y) {
-        y = std::max(0, std::min(_bottom, y));
+        y = std::max(int(_clip.y0), std::min(int(_clip.y1), y));
     }
 
     void clip(int &x, int &y) {
@@ -88,11 +192,11 @@ private:
     }
 
     bool hinside(int x) {
-        return x >= 0 && x <= _right;
+        return x >= _clip.x0 && x <= _clip.x1;
     }
 
     bool vinside(int y) {
-        return y >= 0 && y <= _bottom;
+        return y >= _clip.y0 && y <= _clip.y1;
     }
 
     bool inside(int x, int y) {
@@ -103,6 +207,7 @@ private:
     void point(int x, int y) {
         Blit blit;
         if (inside(x, y)) {
+            markDirty(x, y, x, y);
             blit(_frameBuffer, x, y, _color);
         }
     }
@@ -111,9 +216,12 @@ private:
     void hline(int x, int y, int w) {
         Blit blit;
         if (vinside(y)) {
-            int x0 = x, x1 = x + w - 1;
-            hclip(x0);
-            hclip(x1);
+            int x0 = std::max(x, int(_clip.x0));
+            int x1 = std::min(x + w - 1, int(_clip.x1));
+            if (x0 > x1) {
+                return;
+            }
+            markDirty(x0, y, x1, y);
             for (int x = x0; x <= x1; ++x) {
                 blit(_frameBuffer, x, y, _color);
             }
@@ -124,9 +232,12 @@ private:
     void vline(int x, int y, int h) {
         Blit blit;
         if (hinside(x)) {
-            int y0 = y, y1 = y + h - 1;
-            vclip(y0);
-            vclip(y1);
+            int y0 = std::max(y, int(_clip.y0));
+            int y1 = std::min(y + h - 1, int(_clip.y1));
+            if (y0 > y1) {
+                return;
+            }
+            markDirty(x, y0, x, y1);
             for (int y = y0; y <= y1; ++y) {
                 blit(_frameBuffer, x, y, _color);
             }
@@ -137,59 +248,78 @@ private:
     void line(float x0, float y0, float x1, float y1) {
         Blit blit;
 
-        auto plot = [&] (int x, int y, float c) {
+        // conservatively mark the bounding box of the anti-aliased line
+        {
+            int bx0 = int(std::floor(std::min(x0, x1))) - 1;
+            int by0 = int(std::floor(std::min(y0, y1))) - 1;
+            int bx1 = int(std::ceil(std::max(x0, x1))) + 1;
+            int by1 = int(std::ceil(std::max(y0, y1))) + 1;
+            clip(bx0, by0);
+            clip(bx1, by1);
+            markDirty(bx0, by0, bx1, by1);
+        }
+
+        // Wu's algorithm in 16.16 fixed point, the main loop steps with a
+        // single integer add per column instead of float math
+
+        auto plot = [&] (int x, int y, int32_t c) {
             if (inside(x, y)) {
-                blit(_frameBuffer, x, y, _color * c);
+                blit(_frameBuffer, x, y, (_color * c) >> 16);
             }
         };
 
-        auto ipart = [] (float x) { return std::floor(x); };
-        auto round = [] (float x) { return std::floor(x + 0.5f); };
-        auto fpart = [] (float x) { return x - std::floor(x); };
-        auto rfpart = [] (float x) { return 1.f - (x - std::floor(x)); };
+        auto ipart = [] (int32_t v) { return v >> 16; };
+        auto round = [] (int32_t v) { return (v + 0x8000) >> 16; };
+        auto fpart = [] (int32_t v) { return v & 0xffff; };
+        auto rfpart = [] (int32_t v) { return 0x10000 - (v & 0xffff); };
+
+        int32_t fx0 = int32_t(x0 * 65536.f);
+        int32_t fy0 = int32_t(y0 * 65536.f);
+        int32_t fx1 = int32_t(x1 * 65536.f);
+        int32_t fy1 = int32_t(y1 * 65536.f);
 
-        bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+        bool steep = std::abs(fy1 - fy0) > std::abs(fx1 - fx0);
 
         if (steep) {
-            std::swap(x0, y0);
-            std::swap(x1, y1);
+            std::swap(fx0, fy0);
+            std::swap(fx1, fy1);
         }
-        if (x0 > x1) {
-            std::swap(x0, x1);
-            std::swap(y0, y1);
+        if (fx0 > fx1) {
+            std::swap(fx0, fx1);
+            std::swap(fy0, fy1);
         }
 
-        float dx = x1 - x0;
-        float dy = y1 - y0;
-        float gradient = dx == 0.f ? 1.f : dy / dx;
+        int32_t dx = fx1 - fx0;
+        int32_t dy = fy1 - fy0;
+        int32_t gradient = dx == 0 ? 0x10000 : int32_t((int64_t(dy) << 16) / dx);
 
         // first endpoint
-        int xend = round(x0);
-        float yend = y0 + gradient * (xend - x0);
-        float xgap = rfpart(x0 + 0.5f);
-        int xpxl1 = xend;
+        int32_t xend = round(fx0) << 16;
+        int32_t yend = fy0 + int32_t((int64_t(gradient) * (xend - fx0)) >> 16);
+        int32_t xgap = rfpart(fx0 + 0x8000);
+        int xpxl1 = xend >> 16;
         int ypxl1 = ipart(yend);
         if (steep) {
-            plot(ypxl1,     xpxl1, rfpart(yend) * xgap);
-            plot(ypxl1 + 1, xpxl1,  fpart(yend) * xgap);
+            plot(ypxl1,     xpxl1, int32_t((int64_t(rfpart(yend)) * xgap) >> 16));
+            plot(ypxl1 + 1, xpxl1, int32_t((int64_t( fpart(yend)) * xgap) >> 16));
         } else {
-            plot(xpxl1, ypxl1,     rfpart(yend) * xgap);
-            plot(xpxl1, ypxl1 + 1,  fpart(yend) * xgap);
+            plot(xpxl1, ypxl1,     int32_t((int64_t(rfpart(yend)) * xgap) >> 16));
+            plot(xpxl1, ypxl1 + 1, int32_t((int64_t( fpart(yend)) * xgap) >> 16));
         }
-        float intery = yend + gradient;
+        int32_t intery = yend + gradient;
 
         // second endpoint
-        xend = round(x1);
-        yend = y1 + gradient * (xend - x1);
-        xgap = fpart(x1 + 0.5f);
-        int xpxl2 = xend;
+        xend = round(fx1) << 16;
+        yend = fy1 + int32_t((int64_t(gradient) * (xend - fx1)) >> 16);
+        xgap = fpart(fx1 + 0x8000);
+        int xpxl2 = xend >> 16;
         int ypxl2 = ipart(yend);
         if (steep) {
-            plot(ypxl2,     xpxl2, rfpart(yend) * xgap);
-            plot(ypxl2 + 1, xpxl2,  fpart(yend) * xgap);
+            plot(ypxl2,     xpxl2, int32_t((int64_t(rfpart(yend)) * xgap) >> 16));
+            plot(ypxl2 + 1, xpxl2, int32_t((int64_t( fpart(yend)) * xgap) >> 16));
         } else {
-            plot(xpxl2, ypxl2,    rfpart(yend) * xgap);
-            plot(xpxl2, ypxl2 + 1, fpart(yend) * xgap);
+            plot(xpxl2, ypxl2,     int32_t((int64_t(rfpart(yend)) * xgap) >> 16));
+            plot(xpxl2, ypxl2 + 1, int32_t((int64_t( fpart(yend)) * xgap) >> 16));
         }
 
         // main loop
@@ -197,13 +327,13 @@ private:
             for (int x = xpxl1 + 1; x < xpxl2; ++x) {
                 plot(ipart(intery),     x, rfpart(intery));
                 plot(ipart(intery) + 1, x,  fpart(intery));
-                intery = intery + gradient;
+                intery += gradient;
             }
         } else {
             for (int x = xpxl1 + 1; x < xpxl2; ++x) {
                 plot(x, ipart(intery),    rfpart(intery));
                 plot(x, ipart(intery) + 1, fpart(intery));
-                intery = intery + gradient;
+                intery += gradient;
             }
         }
     }
@@ -219,10 +349,14 @@ private:
     template<typename Blit>
     void fillRect(int x, int y, int w, int h) {
         Blit blit;
-        int x0 = x, x1 = x + w - 1;
-        int y0 = y, y1 = y + h - 1;
-        clip(x0, y0);
-        clip(x1, y1);
+        int x0 = std::max(x, int(_clip.x0));
+        int y0 = std::max(y, int(_clip.y0));
+        int x1 = std::min(x + w - 1, int(_clip.x1));
+        int y1 = std::min(y + h - 1, int(_clip.y1));
+        if (x0 > x1 || y0 > y1) {
+            return;
+        }
+        markDirty(x0, y0, x1, y1);
         for (int y = y0; y <= y1; ++y) {
             for (int x = x0; x <= x1; ++x) {
                 blit(_frameBuffer, x, y, _color);
@@ -233,33 +367,53 @@ private:
     template<typename Blit, size_t Bpp>
     void drawBitmap(int x, int y, int w, int h, const uint8_t *bitmap) {
         Blit blit;
-        int x0 = x, x1 = x + w - 1;
-        int y0 = y, y1 = y + h - 1;
-        if (x0 > _right || x1 < 0 || y0 > _bottom || y1 < 0) {
+        // clip once and index the packed pixel stream per row instead of
+        // walking (and testing) every pixel of the unclipped rectangle
+        int x0 = std::max(x, int(_clip.x0));
+        int y0 = std::max(y, int(_clip.y0));
+        int x1 = std::min(x + w - 1, int(_clip.x1));
+        int y1 = std::min(y + h - 1, int(_clip.y1));
+        if (x0 > x1 || y0 > y1) {
             return;
         }
 
+        markDirty(x0, y0, x1, y1);
+
         const uint8_t mask = (1 << Bpp) - 1;
-        int shift = 0;
-        for (int y = y0; y <= y1; ++y) {
-            for (int x = x0; x <= x1; ++x) {
-                // uint8_t pixel = ((*bitmap >> shift) & mask) << (8 - Bpp);
-                uint8_t pixel = ((*bitmap >> shift) & mask) * _color;
+        const int pixelsPerByte = 8 / Bpp;
+        for (int py = y0; py <= y1; ++py) {
+            int index = (py - y) * w + (x0 - x);
+            const uint8_t *src = &bitmap[index / pixelsPerByte];
+            int shift = (index % pixelsPerByte) * Bpp;
+            for (int px = x0; px <= x1; ++px) {
+                // uint8_t pixel = ((*src >> shift) & mask) << (8 - Bpp);
+                uint8_t pixel = ((*src >> shift) & mask) * _color;
                 shift += Bpp;
                 if (shift >= 8) {
-                    ++bitmap;
+                    ++src;
                     shift = 0;
                 }
-                if (inside(x, y)) {
-                    blit(_frameBuffer, x, y, pixel);
-                }
+                blit(_frameBuffer, px, py, pixel);
             }
         }
     }
 
+    static const int MaxClipDepth = 4;
+
+    struct ClipRect {
+        int16_t x0, y0, x1, y1;
+    };
+
     FrameBuffer8bit &_frameBuffer;
     int _right;
     int _bottom;
+    ClipRect _clip;
+    ClipRect _clipStack[MaxClipDepth];
+    int _clipDepth = 0;
+    int _dirtyX0;
+    int _dirtyY0;
+    int _dirtyX1;
+    int _dirtyY1;
     uint8_t _color = 0xf;
     BlendMode _blendMode = BlendMode::Set;
     Font _font = Font::Default;
@@ -12,9 +12,12 @@ typedef struct {
 } BitmapFontGlyph;
 
 // Font data
+// Headers in this directory are generated by the fontpack tool (see
+// src/tools/fontpack), which aligns glyph bitmaps to one byte per row
+// (bit 0 = leftmost pixel) for the canvas glyph blitter.
 typedef struct {
     uint8_t bpp;                // Bits per pixel
-    uint8_t *bitmap;            // Glyph bitmaps, concatenated
+    uint8_t *bitmap;            // Glyph bitmaps, one byte per row
     BitmapFontGlyph *glyphs;    // Glyph array
     uint8_t first, last;        // ASCII extents
     uint8_t yAdvance;           // Newline distance (y axis)
@@ -1,162 +1,169 @@
+// Generated by fontpack from src/tools/fontpack/fonts/ati8x8.h - do not edit!
+// Glyph rows are stored one byte per row (bit 0 = leftmost pixel).
+
 #ifndef __ATI8X8_H__
 #define __ATI8X8_H__
 
 #include "BitmapFont.h"
 
 static uint8_t ati8x8_bitmap[] = {
-    0x61, 0xbc, 0xff, 0x46, 0x00, 0x10, 0xfb, 0xef, 0x31, 0x04, 0x8c, 0xf7, 0x33, 0xbf, 0xc7, 0x00, 
-    0xf3, 0x3c, 0xcf, 0x33, 0x30, 0x03, 0xfe, 0xdb, 0xde, 0xdc, 0xd8, 0xd8, 0xd8, 0x3c, 0x33, 0xc7, 
-    0x66, 0xe3, 0xcc, 0x3c, 0xff, 0xff, 0x1f, 0x8c, 0xf7, 0x33, 0xbf, 0xc7, 0xfc, 0x8c, 0xf7, 0x33, 
-    0x0c, 0xc3, 0x00, 0x0c, 0xc3, 0x30, 0xbf, 0xc7, 0x00, 0x18, 0xdc, 0x1f, 0x87, 0x01, 0x0c, 0xc7, 
-    0xdf, 0xc1, 0x00, 0x83, 0xc1, 0xe0, 0x0f, 0x24, 0x66, 0xff, 0x66, 0x24, 0x08, 0x8e, 0xcf, 0xf7, 
-    0x07, 0x7f, 0x9f, 0x8f, 0x83, 0x00, 0xf6, 0x6f, 0x06, 0x06, 0x7b, 0x6f, 0x36, 0xdb, 0xdf, 0xf6, 
-    0xb7, 0xd9, 0x00, 0x18, 0xff, 0xc0, 0x07, 0xfe, 0x61, 0x00, 0x63, 0x18, 0x86, 0x61, 0x18, 0x03, 
-    0x1c, 0x1b, 0xc7, 0x3d, 0x9b, 0xb9, 0x01, 0xf6, 0x00, 0x6c, 0x33, 0x63, 0x0c, 0x63, 0xcc, 0x6c, 
-    0x03, 0x77, 0xdf, 0xdf, 0x77, 0x07, 0x0c, 0xf3, 0x33, 0x0c, 0xf6, 0x00, 0x7f, 0x3f, 0x60, 0x18, 
-    0x86, 0x61, 0x18, 0x04, 0x00, 0xbe, 0xf1, 0x7c, 0xff, 0x3e, 0xfb, 0x00, 0xcc, 0xc3, 0x30, 0x0c, 
-    0xf3, 0x03, 0xbe, 0x31, 0x0c, 0xc3, 0x30, 0xff, 0x01, 0xbe, 0x31, 0x98, 0x07, 0x1e, 0xfb, 0x00, 
-    0x30, 0x1c, 0xcf, 0xf6, 0x87, 0xc1, 0x00, 0xff, 0xc1, 0x0f, 0x0c, 0x1e, 0xfb, 0x00, 0xbe, 0xf1, 
-    0xe0, 0x37, 0x1e, 0xfb, 0x00, 0xff, 0x31, 0x18, 0x86, 0xc1, 0x60, 0x00, 0xbe, 0xf1, 0xd8, 0x37, 
-    0x1e, 0xfb, 0x00, 0xbe, 0xf1, 0xd8, 0x0f, 0x1e, 0xfb, 0x00, 0x3f, 0xf0, 0x03, 0x36, 0x60, 0x0f, 
-    0x98, 0x99, 0x61, 0x18, 0x06, 0x7f, 0x00, 0xe0, 0x0f, 0xc3, 0x30, 0xcc, 0xcc, 0x00, 0xbe, 0x31, 
-    0x18, 0x86, 0x01, 0x60, 0x00, 0xbe, 0xf1, 0x78, 0xbf, 0x1b, 0xf8, 0x01, 0x1c, 0xdb, 0x78, 0xfc, 
-    0x1f, 0x8f, 0x01, 0x3f, 0xb3, 0xd9, 0x67, 0x36, 0xff, 0x00, 0x3c, 0xf3, 0x60, 0x30, 0x30, 0xf3, 
-    0x00, 0x1f, 0x9b, 0xd9, 0x6c, 0xb6, 0x7d, 0x00, 0xff, 0xe1, 0xe0, 0x33, 0x18, 0xfe, 0x01, 0x7f, 
-    0xa3, 0xc1, 0x67, 0x30, 0x3c, 0x00, 0xbe, 0xf1, 0x60, 0xb0, 0x1f, 0xfb, 0x00, 0xe3, 0xf1, 0xf8, 
-    0x3f, 0x1e, 0x8f, 0x01, 0x6f, 0x66, 0x66, 0x0f, 0x3c, 0x86, 0x61, 0xdb, 0xe6, 0x00, 0xe3, 0xd9, 
-    0xe6, 0xb1, 0x99, 0x8d, 0x01, 0x0f, 0x83, 0xc1, 0x60, 0x30, 0xfe, 0x01, 0xe3, 0xfb, 0x7f, 0xbd, 
-    0x1e, 0x8f, 0x01, 0xe3, 0xf3, 0xf9, 0xbd, 0x9f, 0x8f, 0x01, 0xbe, 0xf1, 0x78, 0x3c, 0x1e, 0xfb, 
-    0x00, 0x3f, 0xb3, 0xd9, 0x67, 0x30, 0x3c, 0x00, 0xbe, 0xf1, 0x78, 0x3c, 0x5e, 0xfb, 0xc0, 0xbf, 
-    0xf1, 0xf8, 0xb7, 0x99, 0x8d, 0x01, 0xbe, 0xf1, 0xc0, 0x07, 0x1e, 0xfb, 0x00, 0x7f, 0xcb, 0x30, 
-    0x0c, 0xe3, 0x01, 0xe3, 0xf1, 0x78, 0x3c, 0x1e, 0xfb, 0x00, 0xe3, 0xf1, 0x78, 0x6c, 0xe3, 0x20, 
-    0x00, 0xe3, 0xf1, 0x7a, 0xfd, 0xbf, 0x8f, 0x01, 0x63, 0x1b, 0x87, 0xc3, 0xb1, 0x8d, 0x01, 0xf3, 
-    0x3c, 0x7b, 0x0c, 0xe3, 0x01, 0xff, 0x30, 0x0c, 0xc3, 0x30, 0xfe, 0x01, 0x7f, 0x8c, 0x31, 0xc6, 
-    0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x1f, 0x63, 0x8c, 0xf1, 0x07, 0x08, 0x8e, 0x6d, 
-    0x0c, 0xff, 0x9b, 0x01, 0x1e, 0x98, 0x6f, 0xe6, 0x07, 0x07, 0x83, 0xcf, 0x6c, 0x36, 0xff, 0x00, 
-    0xbe, 0xf1, 0x60, 0xec, 0x03, 0x38, 0x98, 0x6f, 0x36, 0x9b, 0xf9, 0x01, 0xbe, 0xf1, 0x7f, 0xe0, 
-    0x03, 0x38, 0x36, 0xe3, 0xc7, 0x60, 0x78, 0x00, 0xee, 0xf9, 0xd8, 0x0f, 0xf6, 0x01, 0x07, 0x83, 
-    0xcf, 0x6c, 0x36, 0x9f, 0x01, 0x06, 0x67, 0x66, 0x0f, 0x30, 0x80, 0xc3, 0x30, 0x3c, 0x7b, 0x07, 
-    0x83, 0xd9, 0xe6, 0xb1, 0x9d, 0x01, 0xdb, 0xb6, 0x1d, 0xb6, 0xff, 0x7a, 0x3d, 0x06, 0x3b, 0xb3, 
-    0xd9, 0x6c, 0x06, 0xbe, 0xf1, 0x78, 0xec, 0x03, 0x3b, 0xb3, 0xd9, 0x67, 0x78, 0x00, 0xee, 0xd9, 
-    0xcc, 0x07, 0xc3, 0x03, 0x3b, 0xb3, 0xc1, 0xf0, 0x00, 0xbe, 0x81, 0x0f, 0xec, 0x03, 0x0c, 0xc6, 
-    0x8f, 0xc1, 0x60, 0xe3, 0x00, 0xb3, 0xd9, 0x6c, 0xe6, 0x06, 0xe3, 0xb1, 0x8d, 0x83, 0x00, 0xe3, 
-    0xf1, 0xfa, 0x6f, 0x03, 0x63, 0x1b, 0xc7, 0x36, 0x06, 0xe3, 0xf1, 0xdc, 0x0d, 0xf6, 0x01, 0x7f, 
-    0xc6, 0x98, 0x3f, 0x38, 0xc3, 0x1c, 0x0c, 0x83, 0x03, 0x3f, 0x3f, 0x07, 0xc3, 0xe0, 0x0c, 0x73, 
-    0x00, 0xee, 0x1d
+    0x01, 0x03, 0x0f, 0x1f, 0x0f, 0x03, 0x01, 0x10, 0x18, 0x1e, 0x1f, 0x1e, 0x18, 0x10, 0x0c, 0x1e,
+    0x3f, 0x0c, 0x3f, 0x1e, 0x0c, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x33, 0xfe, 0xdb, 0xde, 0xdc,
+    0xd8, 0xd8, 0xd8, 0x3c, 0x66, 0x1c, 0x36, 0x36, 0x1c, 0x33, 0x1e, 0x7f, 0x7f, 0x7f, 0x0c, 0x1e,
+    0x3f, 0x0c, 0x3f, 0x1e, 0x0c, 0x3f, 0x0c, 0x1e, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x3f, 0x1e, 0x0c, 0x18, 0x38, 0x7f, 0x38, 0x18, 0x0c, 0x0e, 0x7f, 0x0e, 0x0c, 0x03, 0x03,
+    0x03, 0x7f, 0x24, 0x66, 0xff, 0x66, 0x24, 0x08, 0x1c, 0x3e, 0x3e, 0x7f, 0x7f, 0x3e, 0x3e, 0x1c,
+    0x08, 0x06, 0x0f, 0x0f, 0x06, 0x06, 0x00, 0x06, 0x1b, 0x1b, 0x1b, 0x36, 0x36, 0x7f, 0x36, 0x7f,
+    0x36, 0x36, 0x18, 0x7e, 0x03, 0x3e, 0x60, 0x3f, 0x18, 0x63, 0x30, 0x18, 0x0c, 0x06, 0x63, 0x1c,
+    0x36, 0x1c, 0x6e, 0x33, 0x33, 0x6e, 0x06, 0x06, 0x03, 0x0c, 0x06, 0x03, 0x03, 0x03, 0x06, 0x0c,
+    0x03, 0x06, 0x0c, 0x0c, 0x0c, 0x06, 0x03, 0x77, 0x3e, 0x7f, 0x3e, 0x77, 0x0c, 0x0c, 0x3f, 0x0c,
+    0x0c, 0x06, 0x06, 0x03, 0x7f, 0x07, 0x07, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x3e, 0x63,
+    0x73, 0x7b, 0x6f, 0x67, 0x3e, 0x0c, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x3f, 0x3e, 0x63, 0x30, 0x18,
+    0x0c, 0x66, 0x7f, 0x3e, 0x63, 0x60, 0x3c, 0x60, 0x63, 0x3e, 0x30, 0x38, 0x3c, 0x36, 0x7f, 0x30,
+    0x30, 0x7f, 0x03, 0x3f, 0x60, 0x60, 0x63, 0x3e, 0x3e, 0x63, 0x03, 0x3f, 0x63, 0x63, 0x3e, 0x7f,
+    0x63, 0x60, 0x30, 0x18, 0x18, 0x18, 0x3e, 0x63, 0x63, 0x3e, 0x63, 0x63, 0x3e, 0x3e, 0x63, 0x63,
+    0x7e, 0x60, 0x63, 0x3e, 0x07, 0x07, 0x00, 0x00, 0x07, 0x07, 0x06, 0x06, 0x00, 0x00, 0x06, 0x06,
+    0x03, 0x18, 0x0c, 0x06, 0x03, 0x06, 0x0c, 0x18, 0x7f, 0x00, 0x00, 0x7f, 0x03, 0x06, 0x0c, 0x18,
+    0x0c, 0x06, 0x03, 0x3e, 0x63, 0x60, 0x30, 0x18, 0x00, 0x18, 0x3e, 0x63, 0x63, 0x7b, 0x3b, 0x03,
+    0x7e, 0x1c, 0x36, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x3f, 0x66, 0x66, 0x3e, 0x66, 0x66, 0x3f, 0x3c,
+    0x66, 0x03, 0x03, 0x03, 0x66, 0x3c, 0x1f, 0x36, 0x66, 0x66, 0x66, 0x36, 0x1f, 0x7f, 0x43, 0x03,
+    0x1f, 0x03, 0x43, 0x7f, 0x7f, 0x46, 0x06, 0x3e, 0x06, 0x06, 0x0f, 0x3e, 0x63, 0x03, 0x03, 0x7b,
+    0x63, 0x3e, 0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x0f, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0f,
+    0x3c, 0x18, 0x18, 0x18, 0x1b, 0x1b, 0x0e, 0x63, 0x33, 0x1b, 0x0f, 0x1b, 0x33, 0x63, 0x0f, 0x06,
+    0x06, 0x06, 0x06, 0x46, 0x7f, 0x63, 0x77, 0x7f, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x67, 0x67, 0x6f,
+    0x7b, 0x73, 0x63, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x3f, 0x66, 0x66, 0x3e, 0x06, 0x06,
+    0x0f, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x6b, 0x3e, 0x60, 0x3f, 0x63, 0x63, 0x3f, 0x1b, 0x33, 0x63,
+    0x3e, 0x63, 0x03, 0x3e, 0x60, 0x63, 0x3e, 0x3f, 0x2d, 0x0c, 0x0c, 0x0c, 0x0c, 0x1e, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x3e, 0x63, 0x63, 0x63, 0x63, 0x36, 0x1c, 0x08, 0x63, 0x63, 0x6b, 0x6b,
+    0x7f, 0x77, 0x63, 0x63, 0x36, 0x1c, 0x1c, 0x1c, 0x36, 0x63, 0x33, 0x33, 0x33, 0x1e, 0x0c, 0x0c,
+    0x1e, 0x7f, 0x61, 0x30, 0x18, 0x0c, 0x46, 0x7f, 0x1f, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1f, 0x03,
+    0x06, 0x0c, 0x18, 0x30, 0x60, 0x40, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x08, 0x1c, 0x36,
+    0x63, 0xff, 0x03, 0x03, 0x06, 0x1e, 0x30, 0x3e, 0x33, 0x7e, 0x07, 0x06, 0x3e, 0x66, 0x66, 0x66,
+    0x3f, 0x3e, 0x63, 0x03, 0x63, 0x3e, 0x38, 0x30, 0x3e, 0x33, 0x33, 0x33, 0x7e, 0x3e, 0x63, 0x7f,
+    0x03, 0x3e, 0x38, 0x6c, 0x0c, 0x3f, 0x0c, 0x0c, 0x1e, 0x6e, 0x73, 0x63, 0x7e, 0x60, 0x3e, 0x07,
+    0x06, 0x3e, 0x66, 0x66, 0x66, 0x67, 0x06, 0x00, 0x07, 0x06, 0x06, 0x06, 0x0f, 0x30, 0x00, 0x38,
+    0x30, 0x30, 0x30, 0x33, 0x1e, 0x07, 0x06, 0x66, 0x36, 0x1e, 0x36, 0x67, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x07, 0x36, 0x7f, 0x6b, 0x6b, 0x63, 0x3b, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x63, 0x63,
+    0x63, 0x3e, 0x3b, 0x66, 0x66, 0x3e, 0x06, 0x0f, 0x6e, 0x33, 0x33, 0x3e, 0x30, 0x78, 0x3b, 0x66,
+    0x06, 0x06, 0x0f, 0x3e, 0x03, 0x3e, 0x60, 0x3e, 0x0c, 0x0c, 0x3f, 0x0c, 0x0c, 0x6c, 0x38, 0x33,
+    0x33, 0x33, 0x33, 0x6e, 0x63, 0x63, 0x36, 0x1c, 0x08, 0x63, 0x63, 0x6b, 0x7f, 0x36, 0x63, 0x36,
+    0x1c, 0x36, 0x63, 0x63, 0x63, 0x73, 0x6e, 0x60, 0x3e, 0x3f, 0x19, 0x0c, 0x26, 0x3f, 0x38, 0x0c,
+    0x0c, 0x07, 0x0c, 0x0c, 0x38, 0x03, 0x03, 0x03, 0x00, 0x03, 0x03, 0x03, 0x07, 0x0c, 0x0c, 0x38,
+    0x0c, 0x0c, 0x07, 0x6e, 0x3b,
 };
 
 static BitmapFontGlyph ati8x8_glyphs[] = {
     { 0, 5, 7, 8, 0, -6 },
-    { 5, 5, 7, 8, 2, -6 },
-    { 10, 6, 7, 8, 1, -6 },
-    { 16, 6, 7, 8, 1, -6 },
-    { 22, 8, 7, 8, 0, -6 },
-    { 29, 7, 8, 8, 0, -6 },
-    { 36, 7, 3, 8, 0, -2 },
-    { 39, 6, 8, 8, 1, -6 },
-    { 45, 6, 7, 8, 1, -6 },
-    { 51, 6, 7, 8, 1, -6 },
-    { 57, 7, 5, 8, 0, -5 },
-    { 62, 7, 5, 8, 0, -5 },
-    { 67, 7, 4, 8, 0, -4 },
-    { 71, 8, 5, 8, 0, -5 },
-    { 76, 7, 5, 8, 0, -5 },
-    { 81, 7, 5, 8, 0, -5 },
-    { 86, 0, 0, 8, 0, 1 },
-    { 86, 4, 7, 8, 2, -6 },
-    { 90, 5, 3, 8, 1, -6 },
-    { 92, 7, 7, 8, 0, -6 },
-    { 99, 7, 7, 8, 0, -6 },
-    { 106, 7, 6, 8, 0, -5 },
-    { 112, 7, 7, 8, 0, -6 },
-    { 119, 3, 3, 8, 2, -6 },
-    { 121, 4, 7, 8, 1, -6 },
-    { 125, 4, 7, 8, 1, -6 },
-    { 129, 7, 5, 8, 0, -5 },
-    { 134, 6, 5, 8, 1, -5 },
-    { 138, 3, 3, 8, 2, -2 },
-    { 140, 7, 1, 8, 0, -3 },
-    { 141, 3, 2, 8, 2, -1 },
-    { 142, 7, 7, 8, 0, -6 },
-    { 149, 7, 7, 8, 0, -6 },
-    { 156, 6, 7, 8, 1, -6 },
-    { 162, 7, 7, 8, 0, -6 },
-    { 169, 7, 7, 8, 0, -6 },
-    { 176, 7, 7, 8, 0, -6 },
-    { 183, 7, 7, 8, 0, -6 },
-    { 190, 7, 7, 8, 0, -6 },
-    { 197, 7, 7, 8, 0, -6 },
-    { 204, 7, 7, 8, 0, -6 },
-    { 211, 7, 7, 8, 0, -6 },
-    { 218, 3, 6, 8, 3, -5 },
-    { 221, 3, 7, 8, 2, -5 },
-    { 224, 5, 7, 8, 1, -6 },
-    { 229, 7, 4, 8, 0, -4 },
-    { 233, 5, 7, 8, 1, -6 },
-    { 238, 7, 7, 8, 0, -6 },
-    { 245, 7, 7, 8, 0, -6 },
-    { 252, 7, 7, 8, 0, -6 },
-    { 259, 7, 7, 8, 0, -6 },
-    { 266, 7, 7, 8, 0, -6 },
-    { 273, 7, 7, 8, 0, -6 },
-    { 280, 7, 7, 8, 0, -6 },
-    { 287, 7, 7, 8, 0, -6 },
-    { 294, 7, 7, 8, 0, -6 },
-    { 301, 7, 7, 8, 0, -6 },
-    { 308, 4, 7, 8, 2, -6 },
-    { 312, 6, 7, 8, 0, -6 },
-    { 318, 7, 7, 8, 0, -6 },
-    { 325, 7, 7, 8, 0, -6 },
-    { 332, 7, 7, 8, 0, -6 },
-    { 339, 7, 7, 8, 0, -6 },
-    { 346, 7, 7, 8, 0, -6 },
-    { 353, 7, 7, 8, 0, -6 },
-    { 360, 7, 8, 8, 0, -6 },
-    { 367, 7, 7, 8, 0, -6 },
-    { 374, 7, 7, 8, 0, -6 },
-    { 381, 6, 7, 8, 1, -6 },
-    { 387, 7, 7, 8, 0, -6 },
-    { 394, 7, 7, 8, 0, -6 },
-    { 401, 7, 7, 8, 0, -6 },
-    { 408, 7, 7, 8, 0, -6 },
-    { 415, 6, 7, 8, 1, -6 },
-    { 421, 7, 7, 8, 0, -6 },
-    { 428, 5, 7, 8, 1, -6 },
-    { 433, 7, 7, 8, 0, -6 },
-    { 440, 5, 7, 8, 1, -6 },
-    { 445, 7, 4, 8, 0, -6 },
-    { 449, 8, 1, 8, 0, 1 },
-    { 450, 3, 3, 8, 2, -6 },
-    { 452, 7, 5, 8, 0, -4 },
-    { 457, 7, 7, 8, 0, -6 },
-    { 464, 7, 5, 8, 0, -4 },
-    { 469, 7, 7, 8, 0, -6 },
-    { 476, 7, 5, 8, 0, -4 },
-    { 481, 7, 7, 8, 0, -6 },
-    { 488, 7, 6, 8, 0, -4 },
-    { 494, 7, 7, 8, 0, -6 },
-    { 501, 4, 7, 8, 2, -6 },
-    { 505, 6, 8, 8, 0, -6 },
-    { 511, 7, 7, 8, 0, -6 },
-    { 518, 3, 7, 8, 3, -6 },
-    { 521, 7, 5, 8, 0, -4 },
-    { 526, 7, 5, 8, 0, -4 },
-    { 531, 7, 5, 8, 0, -4 },
-    { 536, 7, 6, 8, 0, -4 },
-    { 542, 7, 6, 8, 0, -4 },
-    { 548, 7, 5, 8, 0, -4 },
-    { 553, 7, 5, 8, 0, -4 },
-    { 558, 7, 7, 8, 0, -6 },
-    { 565, 7, 5, 8, 0, -4 },
-    { 570, 7, 5, 8, 0, -4 },
-    { 575, 7, 5, 8, 0, -4 },
-    { 580, 7, 5, 8, 0, -4 },
-    { 585, 7, 6, 8, 0, -4 },
-    { 591, 6, 5, 8, 0, -4 },
-    { 595, 6, 7, 8, 1, -6 },
-    { 601, 2, 7, 8, 3, -6 },
-    { 603, 6, 7, 8, 1, -6 },
-    { 609, 7, 2, 8, 0, -6 },
+    { 7, 5, 7, 8, 2, -6 },
+    { 14, 6, 7, 8, 1, -6 },
+    { 21, 6, 7, 8, 1, -6 },
+    { 28, 8, 7, 8, 0, -6 },
+    { 35, 7, 8, 8, 0, -6 },
+    { 43, 7, 3, 8, 0, -2 },
+    { 46, 6, 8, 8, 1, -6 },
+    { 54, 6, 7, 8, 1, -6 },
+    { 61, 6, 7, 8, 1, -6 },
+    { 68, 7, 5, 8, 0, -5 },
+    { 73, 7, 5, 8, 0, -5 },
+    { 78, 7, 4, 8, 0, -4 },
+    { 82, 8, 5, 8, 0, -5 },
+    { 87, 7, 5, 8, 0, -5 },
+    { 92, 7, 5, 8, 0, -5 },
+    { 97, 0, 0, 8, 0, 1 }, // ' '
+    { 97, 4, 7, 8, 2, -6 }, // '!'
+    { 104, 5, 3, 8, 1, -6 }, // '"'
+    { 107, 7, 7, 8, 0, -6 }, // '#'
+    { 114, 7, 7, 8, 0, -6 }, // '$'
+    { 121, 7, 6, 8, 0, -5 }, // '%'
+    { 127, 7, 7, 8, 0, -6 }, // '&'
+    { 134, 3, 3, 8, 2, -6 }, // '''
+    { 137, 4, 7, 8, 1, -6 }, // '('
+    { 144, 4, 7, 8, 1, -6 }, // ')'
+    { 151, 7, 5, 8, 0, -5 }, // '*'
+    { 156, 6, 5, 8, 1, -5 }, // '+'
+    { 161, 3, 3, 8, 2, -2 }, // ','
+    { 164, 7, 1, 8, 0, -3 }, // '-'
+    { 165, 3, 2, 8, 2, -1 }, // '.'
+    { 167, 7, 7, 8, 0, -6 }, // '/'
+    { 174, 7, 7, 8, 0, -6 }, // '0'
+    { 181, 6, 7, 8, 1, -6 }, // '1'
+    { 188, 7, 7, 8, 0, -6 }, // '2'
+    { 195, 7, 7, 8, 0, -6 }, // '3'
+    { 202, 7, 7, 8, 0, -6 }, // '4'
+    { 209, 7, 7, 8, 0, -6 }, // '5'
+    { 216, 7, 7, 8, 0, -6 }, // '6'
+    { 223, 7, 7, 8, 0, -6 }, // '7'
+    { 230, 7, 7, 8, 0, -6 }, // '8'
+    { 237, 7, 7, 8, 0, -6 }, // '9'
+    { 244, 3, 6, 8, 3, -5 }, // ':'
+    { 250, 3, 7, 8, 2, -5 }, // ';'
+    { 257, 5, 7, 8, 1, -6 }, // '<'
+    { 264, 7, 4, 8, 0, -4 }, // '='
+    { 268, 5, 7, 8, 1, -6 }, // '>'
+    { 275, 7, 7, 8, 0, -6 }, // '?'
+    { 282, 7, 7, 8, 0, -6 }, // '@'
+    { 289, 7, 7, 8, 0, -6 }, // 'A'
+    { 296, 7, 7, 8, 0, -6 }, // 'B'
+    { 303, 7, 7, 8, 0, -6 }, // 'C'
+    { 310, 7, 7, 8, 0, -6 }, // 'D'
+    { 317, 7, 7, 8, 0, -6 }, // 'E'
+    { 324, 7, 7, 8, 0, -6 }, // 'F'
+    { 331, 7, 7, 8, 0, -6 }, // 'G'
+    { 338, 7, 7, 8, 0, -6 }, // 'H'
+    { 345, 4, 7, 8, 2, -6 }, // 'I'
+    { 352, 6, 7, 8, 0, -6 }, // 'J'
+    { 359, 7, 7, 8, 0, -6 }, // 'K'
+    { 366, 7, 7, 8, 0, -6 }, // 'L'
+    { 373, 7, 7, 8, 0, -6 }, // 'M'
+    { 380, 7, 7, 8, 0, -6 }, // 'N'
+    { 387, 7, 7, 8, 0, -6 }, // 'O'
+    { 394, 7, 7, 8, 0, -6 }, // 'P'
+    { 401, 7, 8, 8, 0, -6 }, // 'Q'
+    { 409, 7, 7, 8, 0, -6 }, // 'R'
+    { 416, 7, 7, 8, 0, -6 }, // 'S'
+    { 423, 6, 7, 8, 1, -6 }, // 'T'
+    { 430, 7, 7, 8, 0, -6 }, // 'U'
+    { 437, 7, 7, 8, 0, -6 }, // 'V'
+    { 444, 7, 7, 8, 0, -6 }, // 'W'
+    { 451, 7, 7, 8, 0, -6 }, // 'X'
+    { 458, 6, 7, 8, 1, -6 }, // 'Y'
+    { 465, 7, 7, 8, 0, -6 }, // 'Z'
+    { 472, 5, 7, 8, 1, -6 }, // '['
+    { 479, 7, 7, 8, 0, -6 }, // '\'
+    { 486, 5, 7, 8, 1, -6 }, // ']'
+    { 493, 7, 4, 8, 0, -6 }, // '^'
+    { 497, 8, 1, 8, 0, 1 }, // '_'
+    { 498, 3, 3, 8, 2, -6 }, // '`'
+    { 501, 7, 5, 8, 0, -4 }, // 'a'
+    { 506, 7, 7, 8, 0, -6 }, // 'b'
+    { 513, 7, 5, 8, 0, -4 }, // 'c'
+    { 518, 7, 7, 8, 0, -6 }, // 'd'
+    { 525, 7, 5, 8, 0, -4 }, // 'e'
+    { 530, 7, 7, 8, 0, -6 }, // 'f'
+    { 537, 7, 6, 8, 0, -4 }, // 'g'
+    { 543, 7, 7, 8, 0, -6 }, // 'h'
+    { 550, 4, 7, 8, 2, -6 }, // 'i'
+    { 557, 6, 8, 8, 0, -6 }, // 'j'
+    { 565, 7, 7, 8, 0, -6 }, // 'k'
+    { 572, 3, 7, 8, 3, -6 }, // 'l'
+    { 579, 7, 5, 8, 0, -4 }, // 'm'
+    { 584, 7, 5, 8, 0, -4 }, // 'n'
+    { 589, 7, 5, 8, 0, -4 }, // 'o'
+    { 594, 7, 6, 8, 0, -4 }, // 'p'
+    { 600, 7, 6, 8, 0, -4 }, // 'q'
+    { 606, 7, 5, 8, 0, -4 }, // 'r'
+    { 611, 7, 5, 8, 0, -4 }, // 's'
+    { 616, 7, 7, 8, 0, -6 }, // 't'
+    { 623, 7, 5, 8, 0, -4 }, // 'u'
+    { 628, 7, 5, 8, 0, -4 }, // 'v'
+    { 633, 7, 5, 8, 0, -4 }, // 'w'
+    { 638, 7, 5, 8, 0, -4 }, // 'x'
+    { 643, 7, 6, 8, 0, -4 }, // 'y'
+    { 649, 6, 5, 8, 0, -4 }, // 'z'
+    { 654, 6, 7, 8, 1, -6 }, // '{'
+    { 661, 2, 7, 8, 3, -6 }, // '|'
+    { 668, 6, 7, 8, 1, -6 }, // '}'
+    { 675, 7, 2, 8, 0, -6 }, // '~'
 };
 
 static BitmapFont ati8x8 = {
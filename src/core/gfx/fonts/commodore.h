@@ -1,137 +1,147 @@
+// Generated by fontpack from src/tools/fontpack/fonts/commodore.h - do not edit!
+// Glyph rows are stored one byte per row (bit 0 = leftmost pixel).
+
 #ifndef __COMMODORE_H__
 #define __COMMODORE_H__
 
 #include "BitmapFont.h"
 
 static uint8_t commodore_bitmap[] = {
-    0xff, 0x33, 0xf3, 0x0c, 0x66, 0x66, 0xff, 0x66, 0xff, 0x66, 0x66, 0x8c, 0x3f, 0x78, 0xf0, 0xc7, 
-    0x00, 0xe3, 0x8c, 0x31, 0xc6, 0x1c, 0x03, 0x9e, 0x99, 0xc7, 0x31, 0x9f, 0xf9, 0x01, 0x6c, 0x03, 
-    0x6c, 0x33, 0x63, 0x0c, 0x63, 0xcc, 0x6c, 0x03, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x0c, 0xf3, 0x33, 
-    0x0c, 0xf6, 0x00, 0x3f, 0x0f, 0x60, 0x18, 0x86, 0x61, 0x18, 0x00, 0xde, 0xbc, 0xdf, 0xf3, 0xec, 
-    0x01, 0x0c, 0xe3, 0x30, 0x0c, 0xf3, 0x03, 0xde, 0x0c, 0x63, 0xc6, 0xf0, 0x03, 0xde, 0x0c, 0x73, 
-    0xf0, 0xec, 0x01, 0x30, 0x1c, 0x6f, 0xf6, 0x87, 0xc1, 0x00, 0xff, 0xf0, 0xc1, 0xf0, 0xec, 0x01, 
-    0xde, 0x3c, 0x7c, 0xf3, 0xec, 0x01, 0xff, 0x8c, 0x31, 0x0c, 0xc3, 0x00, 0xde, 0x3c, 0x7b, 0xf3, 
-    0xec, 0x01, 0xde, 0x3c, 0xfb, 0xf0, 0xec, 0x01, 0x0f, 0x3c, 0x36, 0x00, 0x7b, 0x38, 0x63, 0x0c, 
-    0x06, 0x83, 0x03, 0x3f, 0xf0, 0x03, 0x07, 0x83, 0xc1, 0x18, 0x73, 0x00, 0xde, 0x0c, 0x63, 0x0c, 
-    0xc0, 0x00, 0xde, 0xbc, 0xef, 0xc3, 0xe8, 0x01, 0x8c, 0x37, 0xff, 0xf3, 0x3c, 0x03, 0xdf, 0x3c, 
-    0x7f, 0xf3, 0xfc, 0x01, 0xde, 0x3c, 0x0c, 0xc3, 0xec, 0x01, 0xcf, 0x36, 0xcf, 0xf3, 0xf6, 0x00, 
-    0xff, 0x30, 0x3c, 0xc3, 0xf0, 0x03, 0xff, 0x30, 0x3c, 0xc3, 0x30, 0x00, 0xde, 0x3c, 0xec, 0xf3, 
-    0xec, 0x01, 0xf3, 0x3c, 0xff, 0xf3, 0x3c, 0x03, 0x6f, 0x66, 0x66, 0x0f, 0x3c, 0x86, 0x61, 0xd8, 
-    0xe6, 0x00, 0xf3, 0xf6, 0x1c, 0xcf, 0x36, 0x03, 0xc3, 0x30, 0x0c, 0xc3, 0xf0, 0x03, 0xe3, 0xfb, 
-    0x7f, 0x3d, 0x1e, 0x8f, 0x01, 0xf3, 0xfd, 0xff, 0xfb, 0x3c, 0x03, 0xde, 0x3c, 0xcf, 0xf3, 0xec, 
-    0x01, 0xdf, 0x3c, 0x7f, 0xc3, 0x30, 0x00, 0xde, 0x3c, 0xcf, 0xb3, 0x87, 0x03, 0xdf, 0x3c, 0x7f, 
-    0xcf, 0x36, 0x03, 0xde, 0x3c, 0x78, 0xf0, 0xec, 0x01, 0x3f, 0xc3, 0x30, 0x0c, 0xc3, 0x00, 0xf3, 
-    0x3c, 0xcf, 0xf3, 0xec, 0x01, 0xf3, 0x3c, 0xcf, 0xb3, 0xc7, 0x00, 0xe3, 0xf1, 0x78, 0xfd, 0xbf, 
-    0x8f, 0x01, 0xf3, 0xec, 0x31, 0xde, 0x3c, 0x03, 0xf3, 0x3c, 0x7b, 0x0c, 0xc3, 0x00, 0x3f, 0x8c, 
-    0x31, 0xc6, 0xf0, 0x03, 0x3f, 0x33, 0x33, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xcf, 0xcc, 
-    0xcc, 0x0f, 0x8c, 0xf7, 0x33, 0x0c, 0xc3, 0x00, 0xff, 0x63, 0x0c, 0x1e, 0xec, 0xcf, 0x3e, 0xc3, 
-    0xf0, 0xcd, 0xf3, 0x07, 0x7e, 0x8c, 0xe1, 0x01, 0x30, 0xec, 0xcf, 0xb3, 0x0f, 0xde, 0xfc, 0x0f, 
-    0x1e, 0xdc, 0x7c, 0x63, 0x0c, 0xfe, 0x3c, 0xfb, 0xf0, 0x07, 0xc3, 0xf0, 0xcd, 0xf3, 0x3c, 0x03, 
-    0x06, 0x67, 0x66, 0x0f, 0x0c, 0xcc, 0xcc, 0x07, 0xc3, 0x30, 0x6c, 0xcf, 0x36, 0x03, 0x67, 0x66, 
-    0x66, 0x0f, 0xb3, 0xff, 0x7f, 0x3d, 0x06, 0xdf, 0x3c, 0xcf, 0x33, 0xde, 0x3c, 0xcf, 0x1e, 0xdf, 
-    0x3c, 0x7f, 0xc3, 0x00, 0xfe, 0x3c, 0xfb, 0x30, 0x0c, 0xdf, 0x3c, 0x0c, 0x03, 0xfe, 0xe0, 0xc1, 
-    0x1f, 0xcc, 0xcf, 0x30, 0x0c, 0x0e, 0xf3, 0x3c, 0xcf, 0x3e, 0xf3, 0x3c, 0x7b, 0x0c, 0xe3, 0xf5, 
-    0xdf, 0x67, 0x03, 0xb3, 0xc7, 0x78, 0x33, 0xf3, 0x3c, 0xfb, 0xd8, 0x03, 0x3f, 0xc6, 0x18, 0x3f, 
-    0x38, 0xc3, 0x1c, 0x0c, 0x83, 0x03, 0xff, 0x3f, 0x07, 0xc3, 0xe0, 0x0c, 0x73, 0x00, 0xe7, 0xdf, 
-    0x01
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x03, 0x33, 0x33, 0x66, 0x66, 0xff, 0x66, 0xff, 0x66, 0x66,
+    0x0c, 0x3e, 0x03, 0x1e, 0x30, 0x1f, 0x0c, 0x23, 0x33, 0x18, 0x0c, 0x06, 0x33, 0x31, 0x1e, 0x33,
+    0x1e, 0x0e, 0x73, 0x33, 0x7e, 0x0c, 0x06, 0x03, 0x0c, 0x06, 0x03, 0x03, 0x03, 0x06, 0x0c, 0x03,
+    0x06, 0x0c, 0x0c, 0x0c, 0x06, 0x03, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x0c, 0x0c, 0x3f, 0x0c, 0x0c,
+    0x06, 0x06, 0x03, 0x3f, 0x03, 0x03, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x1e, 0x33, 0x3b, 0x37,
+    0x33, 0x33, 0x1e, 0x0c, 0x0c, 0x0e, 0x0c, 0x0c, 0x0c, 0x3f, 0x1e, 0x33, 0x30, 0x18, 0x06, 0x03,
+    0x3f, 0x1e, 0x33, 0x30, 0x1c, 0x30, 0x33, 0x1e, 0x30, 0x38, 0x3c, 0x33, 0x7f, 0x30, 0x30, 0x3f,
+    0x03, 0x1f, 0x30, 0x30, 0x33, 0x1e, 0x1e, 0x33, 0x03, 0x1f, 0x33, 0x33, 0x1e, 0x3f, 0x33, 0x18,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x1e, 0x33, 0x33, 0x1e, 0x33, 0x33, 0x1e, 0x1e, 0x33, 0x33, 0x3e, 0x30,
+    0x33, 0x1e, 0x03, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x06, 0x06, 0x00, 0x00, 0x00, 0x06, 0x06,
+    0x03, 0x38, 0x0c, 0x06, 0x03, 0x06, 0x0c, 0x38, 0x3f, 0x00, 0x3f, 0x07, 0x0c, 0x18, 0x30, 0x18,
+    0x0c, 0x07, 0x1e, 0x33, 0x30, 0x18, 0x0c, 0x00, 0x0c, 0x1e, 0x33, 0x3b, 0x3b, 0x03, 0x23, 0x1e,
+    0x0c, 0x1e, 0x33, 0x3f, 0x33, 0x33, 0x33, 0x1f, 0x33, 0x33, 0x1f, 0x33, 0x33, 0x1f, 0x1e, 0x33,
+    0x03, 0x03, 0x03, 0x33, 0x1e, 0x0f, 0x1b, 0x33, 0x33, 0x33, 0x1b, 0x0f, 0x3f, 0x03, 0x03, 0x0f,
+    0x03, 0x03, 0x3f, 0x3f, 0x03, 0x03, 0x0f, 0x03, 0x03, 0x03, 0x1e, 0x33, 0x03, 0x3b, 0x33, 0x33,
+    0x1e, 0x33, 0x33, 0x33, 0x3f, 0x33, 0x33, 0x33, 0x0f, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0f, 0x3c,
+    0x18, 0x18, 0x18, 0x18, 0x1b, 0x0e, 0x33, 0x1b, 0x0f, 0x07, 0x0f, 0x1b, 0x33, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x3f, 0x63, 0x77, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x33, 0x37, 0x3f, 0x3f, 0x3b,
+    0x33, 0x33, 0x1e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1e, 0x1f, 0x33, 0x33, 0x1f, 0x03, 0x03, 0x03,
+    0x1e, 0x33, 0x33, 0x33, 0x33, 0x1e, 0x38, 0x1f, 0x33, 0x33, 0x1f, 0x0f, 0x1b, 0x33, 0x1e, 0x33,
+    0x03, 0x1e, 0x30, 0x33, 0x1e, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x1e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1e, 0x0c, 0x63, 0x63, 0x63, 0x6b, 0x7f, 0x77,
+    0x63, 0x33, 0x33, 0x1e, 0x0c, 0x1e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1e, 0x0c, 0x0c, 0x0c, 0x3f,
+    0x30, 0x18, 0x0c, 0x06, 0x03, 0x3f, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0f, 0x03, 0x06, 0x0c,
+    0x18, 0x30, 0x60, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0c, 0x1e, 0x3f, 0x0c, 0x0c, 0x0c,
+    0x0c, 0xff, 0x03, 0x06, 0x0c, 0x1e, 0x30, 0x3e, 0x33, 0x3e, 0x03, 0x03, 0x1f, 0x33, 0x33, 0x1f,
+    0x1e, 0x03, 0x03, 0x03, 0x1e, 0x30, 0x30, 0x3e, 0x33, 0x33, 0x3e, 0x1e, 0x33, 0x3f, 0x03, 0x1e,
+    0x1c, 0x06, 0x1f, 0x06, 0x06, 0x06, 0x3e, 0x33, 0x33, 0x3e, 0x30, 0x1f, 0x03, 0x03, 0x1f, 0x33,
+    0x33, 0x33, 0x33, 0x06, 0x00, 0x07, 0x06, 0x06, 0x06, 0x0f, 0x0c, 0x00, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x07, 0x03, 0x03, 0x03, 0x1b, 0x0f, 0x1b, 0x33, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0f, 0x33,
+    0x7f, 0x7f, 0x6b, 0x63, 0x1f, 0x33, 0x33, 0x33, 0x33, 0x1e, 0x33, 0x33, 0x33, 0x1e, 0x1f, 0x33,
+    0x33, 0x1f, 0x03, 0x03, 0x3e, 0x33, 0x33, 0x3e, 0x30, 0x30, 0x1f, 0x33, 0x03, 0x03, 0x03, 0x3e,
+    0x03, 0x1e, 0x30, 0x1f, 0x0c, 0x3f, 0x0c, 0x0c, 0x0c, 0x38, 0x33, 0x33, 0x33, 0x33, 0x3e, 0x33,
+    0x33, 0x33, 0x1e, 0x0c, 0x63, 0x6b, 0x7f, 0x3e, 0x36, 0x33, 0x1e, 0x0c, 0x1e, 0x33, 0x33, 0x33,
+    0x33, 0x3e, 0x18, 0x0f, 0x3f, 0x18, 0x0c, 0x06, 0x3f, 0x38, 0x0c, 0x0c, 0x07, 0x0c, 0x0c, 0x38,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0c, 0x0c, 0x38, 0x0c, 0x0c, 0x07, 0x27, 0x3f,
+    0x1d,
 };
 
 static BitmapFontGlyph commodore_glyphs[] = {
-    { 0, 0, 0, 8, 0, 1 },
-    { 0, 2, 7, 8, 3, -6 },
-    { 2, 6, 2, 8, 1, -6 },
-    { 4, 8, 7, 8, 0, -6 },
-    { 11, 6, 7, 8, 1, -6 },
-    { 17, 6, 7, 8, 1, -6 },
-    { 23, 7, 7, 8, 1, -6 },
-    { 30, 4, 3, 8, 3, -6 },
-    { 32, 4, 7, 8, 2, -6 },
-    { 36, 4, 7, 8, 2, -6 },
-    { 40, 8, 5, 8, 0, -5 },
-    { 45, 6, 5, 8, 1, -5 },
-    { 49, 3, 3, 8, 2, -1 },
-    { 51, 6, 1, 8, 1, -3 },
-    { 52, 2, 2, 8, 3, -1 },
-    { 53, 7, 6, 8, 1, -5 },
-    { 59, 6, 7, 8, 1, -6 },
-    { 65, 6, 7, 8, 1, -6 },
-    { 71, 6, 7, 8, 1, -6 },
-    { 77, 6, 7, 8, 1, -6 },
-    { 83, 7, 7, 8, 1, -6 },
-    { 90, 6, 7, 8, 1, -6 },
-    { 96, 6, 7, 8, 1, -6 },
-    { 102, 6, 7, 8, 1, -6 },
-    { 108, 6, 7, 8, 1, -6 },
-    { 114, 6, 7, 8, 1, -6 },
-    { 120, 2, 7, 8, 3, -6 },
-    { 122, 3, 8, 8, 2, -6 },
-    { 125, 6, 7, 8, 1, -6 },
-    { 131, 6, 3, 8, 1, -4 },
-    { 134, 6, 7, 8, 1, -6 },
-    { 140, 6, 7, 8, 1, -6 },
-    { 146, 6, 7, 8, 1, -6 },
-    { 152, 6, 7, 8, 1, -6 },
-    { 158, 6, 7, 8, 1, -6 },
-    { 164, 6, 7, 8, 1, -6 },
-    { 170, 6, 7, 8, 1, -6 },
-    { 176, 6, 7, 8, 1, -6 },
-    { 182, 6, 7, 8, 1, -6 },
-    { 188, 6, 7, 8, 1, -6 },
-    { 194, 6, 7, 8, 1, -6 },
-    { 200, 4, 7, 8, 2, -6 },
-    { 204, 6, 7, 8, 1, -6 },
-    { 210, 6, 7, 8, 1, -6 },
-    { 216, 6, 7, 8, 1, -6 },
-    { 222, 7, 7, 8, 1, -6 },
-    { 229, 6, 7, 8, 1, -6 },
-    { 235, 6, 7, 8, 1, -6 },
-    { 241, 6, 7, 8, 1, -6 },
-    { 247, 6, 7, 8, 1, -6 },
-    { 253, 6, 7, 8, 1, -6 },
-    { 259, 6, 7, 8, 1, -6 },
-    { 265, 6, 7, 8, 1, -6 },
-    { 271, 6, 7, 8, 1, -6 },
-    { 277, 6, 7, 8, 1, -6 },
-    { 283, 7, 7, 8, 1, -6 },
-    { 290, 6, 7, 8, 1, -6 },
-    { 296, 6, 7, 8, 1, -6 },
-    { 302, 6, 7, 8, 1, -6 },
-    { 308, 4, 7, 8, 2, -6 },
-    { 312, 7, 6, 8, 1, -5 },
-    { 318, 4, 7, 8, 2, -6 },
-    { 322, 6, 7, 8, 1, -6 },
-    { 328, 8, 1, 8, 0, 0 },
-    { 329, 4, 3, 8, 3, -6 },
-    { 331, 6, 5, 8, 1, -4 },
-    { 335, 6, 6, 8, 1, -5 },
-    { 340, 5, 5, 8, 1, -4 },
-    { 344, 6, 6, 8, 1, -5 },
-    { 349, 6, 5, 8, 1, -4 },
-    { 353, 5, 6, 8, 2, -5 },
-    { 357, 6, 6, 8, 1, -4 },
-    { 362, 6, 7, 8, 1, -6 },
-    { 368, 4, 7, 8, 2, -6 },
-    { 372, 4, 7, 8, 2, -5 },
-    { 376, 6, 7, 8, 1, -6 },
-    { 382, 4, 7, 8, 2, -6 },
-    { 386, 7, 5, 8, 1, -4 },
-    { 391, 6, 5, 8, 1, -4 },
-    { 395, 6, 5, 8, 1, -4 },
-    { 399, 6, 6, 8, 1, -4 },
-    { 404, 6, 6, 8, 1, -4 },
-    { 409, 6, 5, 8, 1, -4 },
-    { 413, 6, 5, 8, 1, -4 },
-    { 417, 6, 6, 8, 1, -5 },
-    { 422, 6, 5, 8, 1, -4 },
-    { 426, 6, 5, 8, 1, -4 },
-    { 430, 7, 5, 8, 1, -4 },
-    { 435, 6, 5, 8, 1, -4 },
-    { 439, 6, 6, 8, 1, -4 },
-    { 444, 6, 5, 8, 1, -4 },
-    { 448, 6, 7, 8, 1, -6 },
-    { 454, 2, 7, 8, 3, -6 },
-    { 456, 6, 7, 8, 1, -6 },
-    { 462, 6, 3, 8, 1, -6 },
+    { 0, 0, 0, 8, 0, 1 }, // ' '
+    { 0, 2, 7, 8, 3, -6 }, // '!'
+    { 7, 6, 2, 8, 1, -6 }, // '"'
+    { 9, 8, 7, 8, 0, -6 }, // '#'
+    { 16, 6, 7, 8, 1, -6 }, // '$'
+    { 23, 6, 7, 8, 1, -6 }, // '%'
+    { 30, 7, 7, 8, 1, -6 }, // '&'
+    { 37, 4, 3, 8, 3, -6 }, // '''
+    { 40, 4, 7, 8, 2, -6 }, // '('
+    { 47, 4, 7, 8, 2, -6 }, // ')'
+    { 54, 8, 5, 8, 0, -5 }, // '*'
+    { 59, 6, 5, 8, 1, -5 }, // '+'
+    { 64, 3, 3, 8, 2, -1 }, // ','
+    { 67, 6, 1, 8, 1, -3 }, // '-'
+    { 68, 2, 2, 8, 3, -1 }, // '.'
+    { 70, 7, 6, 8, 1, -5 }, // '/'
+    { 76, 6, 7, 8, 1, -6 }, // '0'
+    { 83, 6, 7, 8, 1, -6 }, // '1'
+    { 90, 6, 7, 8, 1, -6 }, // '2'
+    { 97, 6, 7, 8, 1, -6 }, // '3'
+    { 104, 7, 7, 8, 1, -6 }, // '4'
+    { 111, 6, 7, 8, 1, -6 }, // '5'
+    { 118, 6, 7, 8, 1, -6 }, // '6'
+    { 125, 6, 7, 8, 1, -6 }, // '7'
+    { 132, 6, 7, 8, 1, -6 }, // '8'
+    { 139, 6, 7, 8, 1, -6 }, // '9'
+    { 146, 2, 7, 8, 3, -6 }, // ':'
+    { 153, 3, 8, 8, 2, -6 }, // ';'
+    { 161, 6, 7, 8, 1, -6 }, // '<'
+    { 168, 6, 3, 8, 1, -4 }, // '='
+    { 171, 6, 7, 8, 1, -6 }, // '>'
+    { 178, 6, 7, 8, 1, -6 }, // '?'
+    { 185, 6, 7, 8, 1, -6 }, // '@'
+    { 192, 6, 7, 8, 1, -6 }, // 'A'
+    { 199, 6, 7, 8, 1, -6 }, // 'B'
+    { 206, 6, 7, 8, 1, -6 }, // 'C'
+    { 213, 6, 7, 8, 1, -6 }, // 'D'
+    { 220, 6, 7, 8, 1, -6 }, // 'E'
+    { 227, 6, 7, 8, 1, -6 }, // 'F'
+    { 234, 6, 7, 8, 1, -6 }, // 'G'
+    { 241, 6, 7, 8, 1, -6 }, // 'H'
+    { 248, 4, 7, 8, 2, -6 }, // 'I'
+    { 255, 6, 7, 8, 1, -6 }, // 'J'
+    { 262, 6, 7, 8, 1, -6 }, // 'K'
+    { 269, 6, 7, 8, 1, -6 }, // 'L'
+    { 276, 7, 7, 8, 1, -6 }, // 'M'
+    { 283, 6, 7, 8, 1, -6 }, // 'N'
+    { 290, 6, 7, 8, 1, -6 }, // 'O'
+    { 297, 6, 7, 8, 1, -6 }, // 'P'
+    { 304, 6, 7, 8, 1, -6 }, // 'Q'
+    { 311, 6, 7, 8, 1, -6 }, // 'R'
+    { 318, 6, 7, 8, 1, -6 }, // 'S'
+    { 325, 6, 7, 8, 1, -6 }, // 'T'
+    { 332, 6, 7, 8, 1, -6 }, // 'U'
+    { 339, 6, 7, 8, 1, -6 }, // 'V'
+    { 346, 7, 7, 8, 1, -6 }, // 'W'
+    { 353, 6, 7, 8, 1, -6 }, // 'X'
+    { 360, 6, 7, 8, 1, -6 }, // 'Y'
+    { 367, 6, 7, 8, 1, -6 }, // 'Z'
+    { 374, 4, 7, 8, 2, -6 }, // '['
+    { 381, 7, 6, 8, 1, -5 }, // '\'
+    { 387, 4, 7, 8, 2, -6 }, // ']'
+    { 394, 6, 7, 8, 1, -6 }, // '^'
+    { 401, 8, 1, 8, 0, 0 }, // '_'
+    { 402, 4, 3, 8, 3, -6 }, // '`'
+    { 405, 6, 5, 8, 1, -4 }, // 'a'
+    { 410, 6, 6, 8, 1, -5 }, // 'b'
+    { 416, 5, 5, 8, 1, -4 }, // 'c'
+    { 421, 6, 6, 8, 1, -5 }, // 'd'
+    { 427, 6, 5, 8, 1, -4 }, // 'e'
+    { 432, 5, 6, 8, 2, -5 }, // 'f'
+    { 438, 6, 6, 8, 1, -4 }, // 'g'
+    { 444, 6, 7, 8, 1, -6 }, // 'h'
+    { 451, 4, 7, 8, 2, -6 }, // 'i'
+    { 458, 4, 7, 8, 2, -5 }, // 'j'
+    { 465, 6, 7, 8, 1, -6 }, // 'k'
+    { 472, 4, 7, 8, 2, -6 }, // 'l'
+    { 479, 7, 5, 8, 1, -4 }, // 'm'
+    { 484, 6, 5, 8, 1, -4 }, // 'n'
+    { 489, 6, 5, 8, 1, -4 }, // 'o'
+    { 494, 6, 6, 8, 1, -4 }, // 'p'
+    { 500, 6, 6, 8, 1, -4 }, // 'q'
+    { 506, 6, 5, 8, 1, -4 }, // 'r'
+    { 511, 6, 5, 8, 1, -4 }, // 's'
+    { 516, 6, 6, 8, 1, -5 }, // 't'
+    { 522, 6, 5, 8, 1, -4 }, // 'u'
+    { 527, 6, 5, 8, 1, -4 }, // 'v'
+    { 532, 7, 5, 8, 1, -4 }, // 'w'
+    { 537, 6, 5, 8, 1, -4 }, // 'x'
+    { 542, 6, 6, 8, 1, -4 }, // 'y'
+    { 548, 6, 5, 8, 1, -4 }, // 'z'
+    { 553, 6, 7, 8, 1, -6 }, // '{'
+    { 560, 2, 7, 8, 3, -6 }, // '|'
+    { 567, 6, 7, 8, 1, -6 }, // '}'
+    { 574, 6, 3, 8, 1, -6 }, // '~'
 };
 
 static BitmapFont commodore = {
@@ -1,126 +1,137 @@
+// Generated by fontpack from src/tools/fontpack/fonts/tiny5x5.h - do not edit!
+// Glyph rows are stored one byte per row (bit 0 = leftmost pixel).
+
 #ifndef __TINY5X5_H__
 #define __TINY5X5_H__
 
 #include "BitmapFont.h"
 
 static uint8_t tiny5x5_bitmap[] = {
-    0x17, 0x2d, 0xea, 0xab, 0xaf, 0x00, 0xbe, 0x38, 0xfa, 0x00, 0x11, 0x11, 0x11, 0x01, 0x52, 0x52,
-    0x0a, 0x06, 0x56, 0x02, 0xa9, 0x01, 0x55, 0x01, 0xba, 0x00, 0x06, 0x07, 0x01, 0x10, 0x11, 0x11,
-    0x00, 0x2e, 0xc6, 0xe8, 0x00, 0xae, 0x02, 0x96, 0x24, 0x0f, 0x87, 0x87, 0x07, 0x64, 0xf5, 0x04,
-    0x1f, 0x87, 0x07, 0x16, 0x97, 0x06, 0xa7, 0x24, 0x2e, 0xba, 0xe8, 0x00, 0x2e, 0x7a, 0xe8, 0x00,
-    0x05, 0x0d, 0x26, 0xc7, 0x01, 0x19, 0x19, 0x01, 0x1c, 0x51, 0xb2, 0x9a, 0x15, 0x31, 0x00, 0x2e,
-    0xfe, 0x18, 0x01, 0x2f, 0xbe, 0xf8, 0x00, 0x3e, 0x84, 0xe0, 0x01, 0x2f, 0xc6, 0xf8, 0x00, 0x3f,
-    0x9c, 0xf0, 0x01, 0x3f, 0x9c, 0x10, 0x00, 0x3e, 0xf4, 0xe8, 0x00, 0x31, 0xfe, 0x18, 0x01, 0x1f,
-    0x10, 0xc2, 0xe8, 0x00, 0x59, 0x53, 0x09, 0x21, 0x84, 0xf0, 0x01, 0x71, 0xd7, 0x18, 0x01, 0x71,
-    0xd6, 0x1c, 0x01, 0x2e, 0xc6, 0xe8, 0x00, 0x2f, 0xbe, 0x10, 0x00, 0x2e, 0xc6, 0xec, 0x01, 0x2f,
-    0xbe, 0x14, 0x01, 0x3e, 0x38, 0xf8, 0x00, 0x9f, 0x10, 0x42, 0x00, 0x31, 0xc6, 0xe8, 0x00, 0x31,
-    0x2a, 0x45, 0x00, 0xb5, 0x56, 0xa5, 0x00, 0x51, 0x11, 0x15, 0x01, 0x51, 0x11, 0x42, 0x00, 0x1f,
-    0x11, 0xf1, 0x01, 0x57, 0x03, 0x41, 0x10, 0x04, 0x01, 0xab, 0x03, 0x2a, 0x1f, 0x09, 0x2e, 0xfe,
-    0x18, 0x01, 0x2f, 0xbe, 0xf8, 0x00, 0x3e, 0x84, 0xe0, 0x01, 0x2f, 0xc6, 0xf8, 0x00, 0x3f, 0x9c,
-    0xf0, 0x01, 0x3f, 0x9c, 0x10, 0x00, 0x3e, 0xf4, 0xe8, 0x00, 0x31, 0xfe, 0x18, 0x01, 0x1f, 0x10,
-    0xc2, 0xe8, 0x00, 0x59, 0x53, 0x09, 0x21, 0x84, 0xf0, 0x01, 0x71, 0xd7, 0x18, 0x01, 0x71, 0xd6,
-    0x1c, 0x01, 0x2e, 0xc6, 0xe8, 0x00, 0x2f, 0xbe, 0x10, 0x00, 0x2e, 0xc6, 0xec, 0x01, 0x2f, 0xbe,
-    0x14, 0x01, 0x3e, 0x38, 0xf8, 0x00, 0x9f, 0x10, 0x42, 0x00, 0x31, 0xc6, 0xe8, 0x00, 0x31, 0x2a,
-    0x45, 0x00, 0xb5, 0x56, 0xa5, 0x00, 0x51, 0x11, 0x15, 0x01, 0x51, 0x11, 0x42, 0x00, 0x1f, 0x11,
-    0xf1, 0x01, 0x9a, 0x02, 0x1f, 0x65, 0x01, 0xd0, 0x05
+    0x01, 0x01, 0x01, 0x00, 0x01, 0x05, 0x05, 0x0a, 0x1f, 0x0a, 0x1f, 0x0a, 0x1e, 0x05, 0x0e, 0x14,
+    0x0f, 0x11, 0x08, 0x04, 0x02, 0x11, 0x02, 0x05, 0x02, 0x05, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x01,
+    0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x05, 0x02, 0x05, 0x02, 0x07, 0x02, 0x02, 0x01, 0x07,
+    0x01, 0x10, 0x08, 0x04, 0x02, 0x01, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x02, 0x03, 0x02, 0x02, 0x02,
+    0x06, 0x09, 0x04, 0x02, 0x0f, 0x07, 0x08, 0x07, 0x08, 0x07, 0x04, 0x06, 0x05, 0x0f, 0x04, 0x0f,
+    0x01, 0x07, 0x08, 0x07, 0x06, 0x01, 0x07, 0x09, 0x06, 0x07, 0x04, 0x02, 0x02, 0x02, 0x0e, 0x11,
+    0x0e, 0x11, 0x0e, 0x0e, 0x11, 0x1e, 0x10, 0x0e, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02,
+    0x01, 0x02, 0x07, 0x00, 0x07, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x01, 0x1c, 0x22, 0x49,
+    0x55, 0x59, 0x22, 0x0c, 0x0e, 0x11, 0x1f, 0x11, 0x11, 0x0f, 0x11, 0x0f, 0x11, 0x0f, 0x1e, 0x01,
+    0x01, 0x01, 0x1e, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x1f, 0x01, 0x07, 0x01, 0x1f, 0x1f, 0x01, 0x07,
+    0x01, 0x01, 0x1e, 0x01, 0x1d, 0x11, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x10, 0x10, 0x10, 0x11, 0x0e, 0x09, 0x05, 0x03, 0x05, 0x09, 0x01, 0x01, 0x01, 0x01, 0x1f,
+    0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x0f,
+    0x11, 0x0f, 0x01, 0x01, 0x0e, 0x11, 0x11, 0x19, 0x1e, 0x0f, 0x11, 0x0f, 0x09, 0x11, 0x1e, 0x01,
+    0x0e, 0x10, 0x0f, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x11, 0x11, 0x0a,
+    0x0a, 0x04, 0x15, 0x15, 0x15, 0x0a, 0x0a, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, 0x0a, 0x04, 0x04,
+    0x04, 0x1f, 0x08, 0x04, 0x02, 0x1f, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x04, 0x08, 0x10,
+    0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x05, 0x1f, 0x01, 0x02, 0x0e, 0x11, 0x1f, 0x11, 0x11, 0x0f,
+    0x11, 0x0f, 0x11, 0x0f, 0x1e, 0x01, 0x01, 0x01, 0x1e, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x1f, 0x01,
+    0x07, 0x01, 0x1f, 0x1f, 0x01, 0x07, 0x01, 0x01, 0x1e, 0x01, 0x1d, 0x11, 0x0e, 0x11, 0x11, 0x1f,
+    0x11, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x11, 0x0e, 0x09, 0x05, 0x03, 0x05,
+    0x09, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x13, 0x15, 0x19, 0x11,
+    0x0e, 0x11, 0x11, 0x11, 0x0e, 0x0f, 0x11, 0x0f, 0x01, 0x01, 0x0e, 0x11, 0x11, 0x19, 0x1e, 0x0f,
+    0x11, 0x0f, 0x09, 0x11, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x11, 0x11,
+    0x11, 0x11, 0x0e, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x15, 0x15, 0x15, 0x0a, 0x0a, 0x11, 0x0a, 0x04,
+    0x0a, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x1f, 0x08, 0x04, 0x02, 0x1f, 0x02, 0x02, 0x01, 0x02,
+    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x10, 0x0e, 0x01,
 };
 
 static BitmapFontGlyph tiny5x5_glyphs[] = {
-    { 0, 0, 0, 3, 0, 1 },
-    { 0, 1, 5, 2, 0, -4 },
-    { 1, 3, 2, 4, 0, -4 },
-    { 2, 5, 5, 6, 0, -4 },
-    { 6, 5, 5, 6, 0, -4 },
-    { 10, 5, 5, 6, 0, -4 },
-    { 14, 4, 5, 5, 0, -4 },
-    { 17, 2, 2, 3, 0, -4 },
-    { 18, 2, 5, 3, 0, -4 },
-    { 20, 2, 5, 3, 0, -4 },
-    { 22, 3, 3, 4, 0, -3 }, // *
-    { 24, 3, 3, 4, 0, -3 },
-    { 26, 2, 2, 3, 0, -1 },
-    { 27, 3, 1, 4, 0, -2 },
-    { 28, 1, 1, 2, 0, 0 },
-    { 29, 5, 5, 6, 0, -4 },
-    { 33, 5, 5, 6, 0, -4 },
-    { 37, 2, 5, 3, 0, -4 },
-    { 39, 4, 5, 5, 0, -4 },
-    { 42, 4, 5, 5, 0, -4 },
-    { 45, 4, 5, 5, 0, -4 },
-    { 48, 4, 5, 5, 0, -4 },
-    { 51, 4, 5, 5, 0, -4 },
-    { 54, 3, 5, 4, 0, -4 },
-    { 56, 5, 5, 6, 0, -4 },
-    { 60, 5, 5, 6, 0, -4 },
-    { 64, 1, 3, 2, 0, -3 },
-    { 65, 1, 4, 2, 0, -3 },
-    { 66, 2, 3, 3, 0, -3 },
-    { 67, 3, 3, 4, 0, -3 },
-    { 69, 2, 3, 3, 0, -3 },
-    { 70, 2, 5, 3, 0, -4 },
-    { 72, 7, 7, 8, 0, -6 },
-    { 79, 5, 5, 6, 0, -4 },
-    { 83, 5, 5, 6, 0, -4 },
-    { 87, 5, 5, 6, 0, -4 },
-    { 91, 5, 5, 6, 0, -4 },
-    { 95, 5, 5, 6, 0, -4 },
-    { 99, 5, 5, 6, 0, -4 },
-    { 103, 5, 5, 6, 0, -4 },
-    { 107, 5, 5, 6, 0, -4 },
-    { 111, 1, 5, 2, 0, -4 },
-    { 112, 5, 5, 6, 0, -4 },
-    { 116, 4, 5, 5, 0, -4 },
-    { 119, 5, 5, 6, 0, -4 },
-    { 123, 5, 5, 6, 0, -4 },
-    { 127, 5, 5, 6, 0, -4 },
-    { 131, 5, 5, 6, 0, -4 },
-    { 135, 5, 5, 6, 0, -4 },
-    { 139, 5, 5, 6, 0, -4 },
-    { 143, 5, 5, 6, 0, -4 },
-    { 147, 5, 5, 6, 0, -4 },
-    { 151, 5, 5, 6, 0, -4 },
-    { 155, 5, 5, 6, 0, -4 },
-    { 159, 5, 5, 6, 0, -4 },
-    { 163, 5, 5, 6, 0, -4 },
-    { 167, 5, 5, 6, 0, -4 },
-    { 171, 5, 5, 6, 0, -4 },
-    { 175, 5, 5, 6, 0, -4 },
-    { 179, 2, 5, 3, 0, -4 },
-    { 181, 5, 5, 6, 0, -4 },
-    { 185, 2, 5, 3, 0, -4 },
-    { 187, 3, 2, 4, 0, -4 },
-    { 188, 5, 1, 6, 0, 0 },
-    { 189, 2, 2, 3, 0, -4 },
-    { 190, 5, 5, 6, 0, -4 },
-    { 194, 5, 5, 6, 0, -4 },
-    { 198, 5, 5, 6, 0, -4 },
-    { 202, 5, 5, 6, 0, -4 },
-    { 206, 5, 5, 6, 0, -4 },
-    { 210, 5, 5, 6, 0, -4 },
-    { 214, 5, 5, 6, 0, -4 },
-    { 218, 5, 5, 6, 0, -4 },
-    { 222, 1, 5, 2, 0, -4 },
-    { 223, 5, 5, 6, 0, -4 },
-    { 227, 4, 5, 5, 0, -4 },
-    { 230, 5, 5, 6, 0, -4 },
-    { 234, 5, 5, 6, 0, -4 },
-    { 238, 5, 5, 6, 0, -4 },
-    { 242, 5, 5, 6, 0, -4 },
-    { 246, 5, 5, 6, 0, -4 },
-    { 250, 5, 5, 6, 0, -4 },
-    { 254, 5, 5, 6, 0, -4 },
-    { 258, 5, 5, 6, 0, -4 },
-    { 262, 5, 5, 6, 0, -4 },
-    { 266, 5, 5, 6, 0, -4 },
-    { 270, 5, 5, 6, 0, -4 },
-    { 274, 5, 5, 6, 0, -4 },
-    { 278, 5, 5, 6, 0, -4 },
-    { 282, 5, 5, 6, 0, -4 },
-    { 286, 5, 5, 6, 0, -4 },
-    { 290, 2, 5, 3, 0, -4 },
-    { 292, 1, 5, 2, 0, -4 },
-    { 293, 2, 5, 3, 0, -4 },
-    { 295, 5, 3, 6, 0, -3 },
+    { 0, 0, 0, 3, 0, 1 }, // ' '
+    { 0, 1, 5, 2, 0, -4 }, // '!'
+    { 5, 3, 2, 4, 0, -4 }, // '"'
+    { 7, 5, 5, 6, 0, -4 }, // '#'
+    { 12, 5, 5, 6, 0, -4 }, // '$'
+    { 17, 5, 5, 6, 0, -4 }, // '%'
+    { 22, 4, 5, 5, 0, -4 }, // '&'
+    { 27, 2, 2, 3, 0, -4 }, // '''
+    { 29, 2, 5, 3, 0, -4 }, // '('
+    { 34, 2, 5, 3, 0, -4 }, // ')'
+    { 39, 3, 3, 4, 0, -3 }, // '*'
+    { 42, 3, 3, 4, 0, -3 }, // '+'
+    { 45, 2, 2, 3, 0, -1 }, // ','
+    { 47, 3, 1, 4, 0, -2 }, // '-'
+    { 48, 1, 1, 2, 0, 0 }, // '.'
+    { 49, 5, 5, 6, 0, -4 }, // '/'
+    { 54, 5, 5, 6, 0, -4 }, // '0'
+    { 59, 2, 5, 3, 0, -4 }, // '1'
+    { 64, 4, 5, 5, 0, -4 }, // '2'
+    { 69, 4, 5, 5, 0, -4 }, // '3'
+    { 74, 4, 5, 5, 0, -4 }, // '4'
+    { 79, 4, 5, 5, 0, -4 }, // '5'
+    { 84, 4, 5, 5, 0, -4 }, // '6'
+    { 89, 3, 5, 4, 0, -4 }, // '7'
+    { 94, 5, 5, 6, 0, -4 }, // '8'
+    { 99, 5, 5, 6, 0, -4 }, // '9'
+    { 104, 1, 3, 2, 0, -3 }, // ':'
+    { 107, 1, 4, 2, 0, -3 }, // ';'
+    { 111, 2, 3, 3, 0, -3 }, // '<'
+    { 114, 3, 3, 4, 0, -3 }, // '='
+    { 117, 2, 3, 3, 0, -3 }, // '>'
+    { 120, 2, 5, 3, 0, -4 }, // '?'
+    { 125, 7, 7, 8, 0, -6 }, // '@'
+    { 132, 5, 5, 6, 0, -4 }, // 'A'
+    { 137, 5, 5, 6, 0, -4 }, // 'B'
+    { 142, 5, 5, 6, 0, -4 }, // 'C'
+    { 147, 5, 5, 6, 0, -4 }, // 'D'
+    { 152, 5, 5, 6, 0, -4 }, // 'E'
+    { 157, 5, 5, 6, 0, -4 }, // 'F'
+    { 162, 5, 5, 6, 0, -4 }, // 'G'
+    { 167, 5, 5, 6, 0, -4 }, // 'H'
+    { 172, 1, 5, 2, 0, -4 }, // 'I'
+    { 177, 5, 5, 6, 0, -4 }, // 'J'
+    { 182, 4, 5, 5, 0, -4 }, // 'K'
+    { 187, 5, 5, 6, 0, -4 }, // 'L'
+    { 192, 5, 5, 6, 0, -4 }, // 'M'
+    { 197, 5, 5, 6, 0, -4 }, // 'N'
+    { 202, 5, 5, 6, 0, -4 }, // 'O'
+    { 207, 5, 5, 6, 0, -4 }, // 'P'
+    { 212, 5, 5, 6, 0, -4 }, // 'Q'
+    { 217, 5, 5, 6, 0, -4 }, // 'R'
+    { 222, 5, 5, 6, 0, -4 }, // 'S'
+    { 227, 5, 5, 6, 0, -4 }, // 'T'
+    { 232, 5, 5, 6, 0, -4 }, // 'U'
+    { 237, 5, 5, 6, 0, -4 }, // 'V'
+    { 242, 5, 5, 6, 0, -4 }, // 'W'
+    { 247, 5, 5, 6, 0, -4 }, // 'X'
+    { 252, 5, 5, 6, 0, -4 }, // 'Y'
+    { 257, 5, 5, 6, 0, -4 }, // 'Z'
+    { 262, 2, 5, 3, 0, -4 }, // '['
+    { 267, 5, 5, 6, 0, -4 }, // '\'
+    { 272, 2, 5, 3, 0, -4 }, // ']'
+    { 277, 3, 2, 4, 0, -4 }, // '^'
+    { 279, 5, 1, 6, 0, 0 }, // '_'
+    { 280, 2, 2, 3, 0, -4 }, // '`'
+    { 282, 5, 5, 6, 0, -4 }, // 'a'
+    { 287, 5, 5, 6, 0, -4 }, // 'b'
+    { 292, 5, 5, 6, 0, -4 }, // 'c'
+    { 297, 5, 5, 6, 0, -4 }, // 'd'
+    { 302, 5, 5, 6, 0, -4 }, // 'e'
+    { 307, 5, 5, 6, 0, -4 }, // 'f'
+    { 312, 5, 5, 6, 0, -4 }, // 'g'
+    { 317, 5, 5, 6, 0, -4 }, // 'h'
+    { 322, 1, 5, 2, 0, -4 }, // 'i'
+    { 327, 5, 5, 6, 0, -4 }, // 'j'
+    { 332, 4, 5, 5, 0, -4 }, // 'k'
+    { 337, 5, 5, 6, 0, -4 }, // 'l'
+    { 342, 5, 5, 6, 0, -4 }, // 'm'
+    { 347, 5, 5, 6, 0, -4 }, // 'n'
+    { 352, 5, 5, 6, 0, -4 }, // 'o'
+    { 357, 5, 5, 6, 0, -4 }, // 'p'
+    { 362, 5, 5, 6, 0, -4 }, // 'q'
+    { 367, 5, 5, 6, 0, -4 }, // 'r'
+    { 372, 5, 5, 6, 0, -4 }, // 's'
+    { 377, 5, 5, 6, 0, -4 }, // 't'
+    { 382, 5, 5, 6, 0, -4 }, // 'u'
+    { 387, 5, 5, 6, 0, -4 }, // 'v'
+    { 392, 5, 5, 6, 0, -4 }, // 'w'
+    { 397, 5, 5, 6, 0, -4 }, // 'x'
+    { 402, 5, 5, 6, 0, -4 }, // 'y'
+    { 407, 5, 5, 6, 0, -4 }, // 'z'
+    { 412, 2, 5, 3, 0, -4 }, // '{'
+    { 417, 1, 5, 2, 0, -4 }, // '|'
+    { 422, 2, 5, 3, 0, -4 }, // '}'
+    { 427, 5, 3, 6, 0, -3 }, // '~'
 };
 
 static BitmapFont tiny5x5 = {
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "drivers/Crc.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Byte stream adapter for the CRC calculation unit with the same interface as
+// FnvHash. Bytes are packed into 32-bit words (little endian) and fed to the
+// unit in word granularity, a trailing partial word is zero padded. The unit
+// is claimed for the lifetime of the adapter.
+class Crc32 {
+public:
+    Crc32() {
+        Crc::claim();
+        Crc::reset();
+    }
+
+    ~Crc32() {
+        Crc::release();
+    }
+
+    void operator()(uint8_t data) {
+        _word |= uint32_t(data) << (8 * _pos);
+        if (++_pos == 4) {
+            Crc::process(_word);
+            _word = 0;
+            _pos = 0;
+        }
+    }
+
+    void operator()(const void *data, size_t len) {
+        const uint8_t *src = reinterpret_cast<const uint8_t *>(data);
+        while (len-- > 0) {
+            (*this)(*src++);
+        }
+    }
+
+    uint32_t result() {
+        if (_pos > 0) {
+            Crc::process(_word);
+            _word = 0;
+            _pos = 0;
+        }
+        return Crc::result();
+    }
+
+private:
+    uint32_t _word = 0;
+    uint32_t _pos = 0;
+};
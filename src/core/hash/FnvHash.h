@@ -2,6 +2,15 @@
 
 #include <cstdint>
 
+// compile-time FNV-1a of a zero terminated string, usable as an identity key
+// without storing or comparing the string itself, e.g. for matching file
+// extensions in directory scans. uses the same basis and prime as FnvHash
+// below, so hashing a string at compile time and its bytes at runtime gives
+// the same result.
+constexpr uint32_t fnv1a(const char *str, uint32_t hash = 0x811c9dc5) {
+    return *str ? fnv1a(str + 1, (hash ^ uint8_t(*str)) * 0x1000193) : hash;
+}
+
 class FnvHash {
 public:
     uint32_t result() const { return _hash; }
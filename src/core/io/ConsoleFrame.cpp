@@ -0,0 +1,31 @@
+#include "ConsoleFrame.h"
+
+#include "drivers/Console.h"
+
+constexpr uint8_t ConsoleFrame::Marker;
+constexpr size_t ConsoleFrame::MaxPayloadLength;
+
+void ConsoleFrame::write(Type type, const void *payload, size_t length) {
+    if (length > MaxPayloadLength) {
+        return;
+    }
+
+    const uint8_t *data = static_cast<const uint8_t *>(payload);
+
+    uint8_t header[4] = {
+        Marker,
+        uint8_t(type),
+        uint8_t(length & 0xff),
+        uint8_t(length >> 8),
+    };
+    Console::writeRaw(reinterpret_cast<const char *>(header), sizeof(header));
+
+    uint8_t checksum = header[1] + header[2] + header[3];
+    for (size_t i = 0; i < length; ++i) {
+        checksum += data[i];
+    }
+
+    Console::writeRaw(reinterpret_cast<const char *>(data), length);
+    char checksumChar = char(checksum);
+    Console::writeRaw(&checksumChar, 1);
+}
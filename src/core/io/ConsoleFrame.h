@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Length-prefixed binary frames multiplexed into the console character
+// stream. Structured data such as profiler reports transmits far more
+// compactly than formatted text and decodes unambiguously on the host.
+//
+// frame layout:
+//   0x1b marker, type, payload length (16 bit little endian), payload,
+//   8 bit checksum (sum over type, length and payload bytes)
+//
+// the marker byte never occurs in the text output, so a host reader can
+// pass plain text through and pick frames out of the same stream.
+class ConsoleFrame {
+public:
+    static constexpr uint8_t Marker = 0x1b;
+    static constexpr size_t MaxPayloadLength = 1024;
+
+    enum Type : uint8_t {
+        ProfilerReport  = 0x01,
+        TaskStats       = 0x02,
+        TraceEvents     = 0x03,
+    };
+
+    // writes a complete frame to the console
+    static void write(Type type, const void *payload, size_t length);
+
+    // Incremental frame decoder for the host side. Bytes are fed one at a
+    // time, PassThrough bytes are plain text in between frames, Frame
+    // signals that type()/payload()/length() hold a complete valid frame.
+    class Decoder {
+    public:
+        enum class Result : uint8_t {
+            PassThrough,    // byte is plain text
+            Consumed,       // byte is part of a frame
+            Frame,          // byte completed a valid frame
+            Error,          // frame was oversized or failed the checksum
+        };
+
+        Result feed(uint8_t c) {
+            switch (_state) {
+            case State::Idle:
+                if (c == Marker) {
+                    _state = State::Type;
+                    return Result::Consumed;
+                }
+                return Result::PassThrough;
+            case State::Type:
+                _type = c;
+                _checksum = c;
+                _state = State::LengthLow;
+                return Result::Consumed;
+            case State::LengthLow:
+                _length = c;
+                _checksum += c;
+                _state = State::LengthHigh;
+                return Result::Consumed;
+            case State::LengthHigh:
+                _length |= uint16_t(c) << 8;
+                _checksum += c;
+                if (_length > MaxPayloadLength) {
+                    _state = State::Idle;
+                    return Result::Error;
+                }
+                _received = 0;
+                _state = _length > 0 ? State::Payload : State::Checksum;
+                return Result::Consumed;
+            case State::Payload:
+                _payload[_received++] = c;
+                _checksum += c;
+                if (_received == _length) {
+                    _state = State::Checksum;
+                }
+                return Result::Consumed;
+            case State::Checksum:
+                _state = State::Idle;
+                return c == _checksum ? Result::Frame : Result::Error;
+            }
+            return Result::Error;
+        }
+
+        uint8_t type() const { return _type; }
+        const uint8_t *payload() const { return _payload; }
+        size_t length() const { return _length; }
+
+    private:
+        enum class State : uint8_t {
+            Idle,
+            Type,
+            LengthLow,
+            LengthHigh,
+            Payload,
+            Checksum,
+        };
+
+        State _state = State::Idle;
+        uint8_t _type = 0;
+        uint8_t _checksum = 0;
+        uint16_t _length = 0;
+        uint16_t _received = 0;
+        uint8_t _payload[MaxPayloadLength];
+    };
+};
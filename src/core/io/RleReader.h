@@ -0,0 +1,56 @@
+#pragma once
+
+#include "core/utils/FixedFunction.h"
+
+#include <algorithm>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Streaming run-length decoder for the packet format written by RleWriter.
+ * Decodes on demand from the underlying reader, no buffering beyond the
+ * current packet state.
+ */
+class RleReader {
+public:
+    typedef FixedFunction<void(void *, size_t)> Reader;
+
+    RleReader(Reader reader) :
+        _reader(reader)
+    {}
+
+    void read(void *data, size_t len) {
+        uint8_t *bytes = static_cast<uint8_t *>(data);
+        while (len > 0) {
+            if (_count == 0) {
+                uint8_t control;
+                _reader(&control, sizeof(control));
+                if (control < 128) {
+                    _count = control + 1;
+                    _literal = true;
+                } else if (control > 128) {
+                    _count = 257 - control;
+                    _literal = false;
+                    _reader(&_runByte, sizeof(_runByte));
+                }
+                continue;
+            }
+            size_t n = std::min(len, _count);
+            if (_literal) {
+                _reader(bytes, n);
+            } else {
+                std::fill(bytes, bytes + n, _runByte);
+            }
+            bytes += n;
+            len -= n;
+            _count -= n;
+        }
+    }
+
+private:
+    Reader _reader;
+    size_t _count = 0;
+    bool _literal = false;
+    uint8_t _runByte = 0;
+};
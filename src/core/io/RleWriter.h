@@ -0,0 +1,87 @@
+#pragma once
+
+#include "core/utils/FixedFunction.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Streaming run-length encoder (PackBits framing).
+ *
+ * Packets start with a control byte: 0..127 is followed by that many + 1
+ * literal bytes, 129..255 is followed by a single byte repeated 257 - control
+ * times, 128 is ignored. Runs shorter than 3 bytes are folded into literal
+ * packets. State is a fixed 128 byte literal buffer, finish() flushes any
+ * pending packet.
+ */
+class RleWriter {
+public:
+    typedef FixedFunction<void(const void *, size_t)> Writer;
+
+    RleWriter(Writer writer) :
+        _writer(writer)
+    {}
+
+    void write(const void *data, size_t len) {
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        for (size_t i = 0; i < len; ++i) {
+            put(bytes[i]);
+        }
+    }
+
+    void finish() {
+        endRun();
+        flushLiterals();
+    }
+
+private:
+    static constexpr size_t MaxPacketLength = 128;
+    static constexpr size_t MinRunLength = 3;
+
+    void put(uint8_t value) {
+        if (_runLength > 0 && value == _runByte) {
+            if (_runLength == MaxPacketLength) {
+                endRun();
+                _runByte = value;
+            }
+            ++_runLength;
+        } else {
+            endRun();
+            _runByte = value;
+            _runLength = 1;
+        }
+    }
+
+    void endRun() {
+        if (_runLength >= MinRunLength) {
+            flushLiterals();
+            uint8_t packet[2] = { uint8_t(257 - _runLength), _runByte };
+            _writer(packet, sizeof(packet));
+        } else {
+            // too short to pay for a run packet, fold into the literals
+            while (_runLength > 0) {
+                _literals[_literalLength++] = _runByte;
+                if (_literalLength == MaxPacketLength) {
+                    flushLiterals();
+                }
+                --_runLength;
+            }
+        }
+        _runLength = 0;
+    }
+
+    void flushLiterals() {
+        if (_literalLength > 0) {
+            uint8_t control = _literalLength - 1;
+            _writer(&control, sizeof(control));
+            _writer(_literals, _literalLength);
+            _literalLength = 0;
+        }
+    }
+
+    Writer _writer;
+    uint8_t _literals[MaxPacketLength];
+    size_t _literalLength = 0;
+    uint8_t _runByte = 0;
+    size_t _runLength = 0;
+};
@@ -1,14 +1,16 @@
 #pragma once
 
+#include "core/hash/Crc32.h"
 #include "core/hash/FnvHash.h"
 
+#include "core/utils/FixedFunction.h"
+
 #include <cstdlib>
 #include <cstdint>
-#include <functional>
 
 class VersionedSerializedReader {
 public:
-    typedef std::function<void(void *, size_t)> Reader;
+    typedef FixedFunction<void(void *, size_t)> Reader;
 
     VersionedSerializedReader(Reader reader, uint32_t readerVersion) :
         _reader(reader),
@@ -33,6 +35,13 @@ public:
         if (_dataVersion >= addedInVersion) {
             auto i = serialize(Enum(0));
             read(i);
+            // most serialize functions are identity mappings, in which case a
+            // single call verifies the value and the scan below only runs for
+            // values remapped in older versions
+            if (int(i) >= 0 && int(i) < int(Enum::Last) && serialize(Enum(i)) == i) {
+                e = Enum(i);
+                return;
+            }
             for (e = Enum(0); int(e) < int(Enum::Last); e = Enum(int(e) + 1)) {
                 if (serialize(e) == i) {
                     return;
@@ -55,6 +64,7 @@ public:
         if (_dataVersion >= addedInVersion) {
             _reader(data, len);
             _hash(data, len);
+            _legacyHash(data, len);
         }
     }
 
@@ -68,18 +78,22 @@ public:
             uint8_t dummy[len];
             _reader(dummy, len);
             _hash(dummy, len);
+            _legacyHash(dummy, len);
         }
     }
 
     bool checkHash() {
         uint32_t hash;
         _reader(&hash, sizeof(hash));
-        return _hash.result() == hash;
+        // also accept the legacy FNV-1a checksum for data written before the
+        // CRC unit was used
+        return _hash.result() == hash || _legacyHash.result() == hash;
     }
 
 private:
     Reader _reader;
     uint32_t _readerVersion;
     uint32_t _dataVersion;
-    FnvHash _hash;
+    Crc32 _hash;
+    FnvHash _legacyHash;
 };
@@ -1,14 +1,15 @@
 #pragma once
 
-#include "core/hash/FnvHash.h"
+#include "core/hash/Crc32.h"
+
+#include "core/utils/FixedFunction.h"
 
 #include <cstdlib>
 #include <cstdint>
-#include <functional>
 
 class VersionedSerializedWriter {
 public:
-    typedef std::function<void(const void *, size_t)> Writer;
+    typedef FixedFunction<void(const void *, size_t)> Writer;
 
     VersionedSerializedWriter(Writer writer, uint32_t writerVersion) :
         _writer(writer),
@@ -43,5 +44,5 @@ public:
 private:
     Writer _writer;
     uint32_t _writerVersion;
-    FnvHash _hash;
+    Crc32 _hash;
 };
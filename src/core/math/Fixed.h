@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstdint>
+
+// Q32.32 fixed-point number stored in a signed 64-bit raw value.
+// Used in timing critical code such as the clock core, where float division
+// is too expensive in interrupt context on the Cortex-M4 and single-precision
+// floats lack precision for long running time accumulation.
+class Fixed32_32 {
+public:
+    static constexpr int FractionalBits = 32;
+
+    constexpr Fixed32_32() : _raw(0) {}
+
+    static constexpr Fixed32_32 fromRaw(int64_t raw) {
+        return Fixed32_32(raw);
+    }
+
+    static constexpr Fixed32_32 fromInt(int32_t value) {
+        return Fixed32_32(int64_t(value) << FractionalBits);
+    }
+
+    static Fixed32_32 fromFloat(float value) {
+        return Fixed32_32(int64_t(value * float(int64_t(1) << FractionalBits)));
+    }
+
+    // num / den as fixed-point value (den has to fit 31 bits)
+    static Fixed32_32 fromRatio(int64_t num, int64_t den) {
+        int64_t quotient = num / den;
+        int64_t remainder = num % den;
+        return Fixed32_32((quotient << FractionalBits) + ((remainder << FractionalBits) / den));
+    }
+
+    // num / den as integer value (num has to fit 31 bits)
+    static int64_t idiv(int64_t num, Fixed32_32 den) {
+        return (num << FractionalBits) / den._raw;
+    }
+
+    int64_t raw() const { return _raw; }
+
+    int32_t toInt() const { return int32_t(_raw >> FractionalBits); }
+
+    float toFloat() const { return float(_raw) / float(int64_t(1) << FractionalBits); }
+
+    Fixed32_32 mulInt(int32_t value) const { return Fixed32_32(_raw * value); }
+    Fixed32_32 divInt(int32_t value) const { return Fixed32_32(_raw / value); }
+
+    Fixed32_32 operator+(Fixed32_32 other) const { return Fixed32_32(_raw + other._raw); }
+    Fixed32_32 operator-(Fixed32_32 other) const { return Fixed32_32(_raw - other._raw); }
+    Fixed32_32 operator-() const { return Fixed32_32(-_raw); }
+
+    Fixed32_32 &operator+=(Fixed32_32 other) { _raw += other._raw; return *this; }
+    Fixed32_32 &operator-=(Fixed32_32 other) { _raw -= other._raw; return *this; }
+
+    Fixed32_32 operator*(Fixed32_32 other) const {
+        // split into 32-bit halves to avoid 128-bit intermediates
+        bool negative = (_raw < 0) != (other._raw < 0);
+        uint64_t a = uint64_t(_raw < 0 ? -_raw : _raw);
+        uint64_t b = uint64_t(other._raw < 0 ? -other._raw : other._raw);
+        uint64_t ah = a >> 32, al = a & 0xffffffff;
+        uint64_t bh = b >> 32, bl = b & 0xffffffff;
+        uint64_t result = ((ah * bh) << 32) + ah * bl + al * bh + ((al * bl) >> 32);
+        return Fixed32_32(negative ? -int64_t(result) : int64_t(result));
+    }
+
+    bool operator==(Fixed32_32 other) const { return _raw == other._raw; }
+    bool operator!=(Fixed32_32 other) const { return _raw != other._raw; }
+    bool operator<(Fixed32_32 other) const { return _raw < other._raw; }
+    bool operator<=(Fixed32_32 other) const { return _raw <= other._raw; }
+    bool operator>(Fixed32_32 other) const { return _raw > other._raw; }
+    bool operator>=(Fixed32_32 other) const { return _raw >= other._raw; }
+
+private:
+    explicit constexpr Fixed32_32(int64_t raw) : _raw(raw) {}
+
+    int64_t _raw;
+};
+
+// Q16.16 fixed-point number stored in a signed 32-bit raw value.
+// General purpose type for engine code (slew, curve evaluation, swing) where
+// a 32x32->64 bit multiply is a single instruction on the Cortex-M4 and the
+// ~15 µV resolution (16 fractional bits over a 10 V range) is plenty.
+class Fixed16_16 {
+public:
+    static constexpr int FractionalBits = 16;
+
+    constexpr Fixed16_16() : _raw(0) {}
+
+    static constexpr Fixed16_16 fromRaw(int32_t raw) {
+        return Fixed16_16(raw);
+    }
+
+    static constexpr Fixed16_16 fromInt(int value) {
+        return Fixed16_16(int32_t(value) << FractionalBits);
+    }
+
+    static Fixed16_16 fromFloat(float value) {
+        return Fixed16_16(int32_t(value * float(1 << FractionalBits)));
+    }
+
+    // num / den as fixed-point value
+    static Fixed16_16 fromRatio(int32_t num, int32_t den) {
+        return Fixed16_16(int32_t((int64_t(num) << FractionalBits) / den));
+    }
+
+    int32_t raw() const { return _raw; }
+
+    int toInt() const { return _raw >> FractionalBits; }
+
+    float toFloat() const { return float(_raw) / float(1 << FractionalBits); }
+
+    Fixed16_16 operator+(Fixed16_16 other) const { return Fixed16_16(_raw + other._raw); }
+    Fixed16_16 operator-(Fixed16_16 other) const { return Fixed16_16(_raw - other._raw); }
+    Fixed16_16 operator-() const { return Fixed16_16(-_raw); }
+
+    Fixed16_16 &operator+=(Fixed16_16 other) { _raw += other._raw; return *this; }
+    Fixed16_16 &operator-=(Fixed16_16 other) { _raw -= other._raw; return *this; }
+
+    Fixed16_16 operator*(Fixed16_16 other) const {
+        return Fixed16_16(int32_t((int64_t(_raw) * int64_t(other._raw)) >> FractionalBits));
+    }
+
+    Fixed16_16 operator/(Fixed16_16 other) const {
+        return Fixed16_16(int32_t((int64_t(_raw) << FractionalBits) / other._raw));
+    }
+
+    Fixed16_16 mulInt(int value) const { return Fixed16_16(_raw * value); }
+    Fixed16_16 divInt(int value) const { return Fixed16_16(_raw / value); }
+
+    // linear interpolation between a and b, t in [0, 1]
+    static Fixed16_16 lerp(Fixed16_16 a, Fixed16_16 b, Fixed16_16 t) {
+        return a + (b - a) * t;
+    }
+
+    static Fixed16_16 clamp(Fixed16_16 value, Fixed16_16 min, Fixed16_16 max) {
+        return value < min ? min : (value > max ? max : value);
+    }
+
+    Fixed16_16 abs() const { return Fixed16_16(_raw < 0 ? -_raw : _raw); }
+
+    bool operator==(Fixed16_16 other) const { return _raw == other._raw; }
+    bool operator!=(Fixed16_16 other) const { return _raw != other._raw; }
+    bool operator<(Fixed16_16 other) const { return _raw < other._raw; }
+    bool operator<=(Fixed16_16 other) const { return _raw <= other._raw; }
+    bool operator>(Fixed16_16 other) const { return _raw > other._raw; }
+    bool operator>=(Fixed16_16 other) const { return _raw >= other._raw; }
+
+private:
+    explicit constexpr Fixed16_16(int32_t raw) : _raw(raw) {}
+
+    int32_t _raw;
+};
@@ -0,0 +1,102 @@
+#include "MidiFileWriter.h"
+
+MidiFileWriter::MidiFileWriter(const char *path, uint16_t division) :
+    _writer(path)
+{
+    // header chunk, a single track follows
+    write("MThd", 4);
+    writeU32(6);
+    writeU16(0); // format 0
+    writeU16(1); // number of tracks
+    writeU16(division);
+}
+
+void MidiFileWriter::beginTrack() {
+    write("MTrk", 4);
+    _trackLengthPosition = _position;
+    writeU32(0); // chunk length, patched in endTrack()
+    _trackTick = 0;
+}
+
+void MidiFileWriter::endTrack() {
+    // end of track meta event
+    writeDelta(_trackTick);
+    writeU8(0xff);
+    writeU8(0x2f);
+    writeVarLength(0);
+
+    // patch the track chunk length in place
+    uint32_t trackLength = _position - (_trackLengthPosition + 4);
+    uint8_t data[4] = {
+        uint8_t(trackLength >> 24),
+        uint8_t(trackLength >> 16),
+        uint8_t(trackLength >> 8),
+        uint8_t(trackLength),
+    };
+    if (_writer.seek(_trackLengthPosition) == fs::OK) {
+        _writer.write(data, sizeof(data));
+    }
+}
+
+void MidiFileWriter::writeTempo(uint32_t tick, float bpm) {
+    uint32_t usecPerQuarterNote = uint32_t(60000000.f / bpm);
+    writeDelta(tick);
+    writeU8(0xff);
+    writeU8(0x51);
+    writeVarLength(3);
+    writeU8(usecPerQuarterNote >> 16);
+    writeU8(usecPerQuarterNote >> 8);
+    writeU8(usecPerQuarterNote);
+}
+
+void MidiFileWriter::writeNoteOn(uint32_t tick, uint8_t channel, uint8_t note, uint8_t velocity) {
+    writeDelta(tick);
+    writeU8(0x90 | (channel & 0xf));
+    writeU8(note & 0x7f);
+    writeU8(velocity & 0x7f);
+}
+
+void MidiFileWriter::writeNoteOff(uint32_t tick, uint8_t channel, uint8_t note) {
+    writeDelta(tick);
+    writeU8(0x80 | (channel & 0xf));
+    writeU8(note & 0x7f);
+    writeU8(0);
+}
+
+void MidiFileWriter::writeDelta(uint32_t tick) {
+    uint32_t delta = tick > _trackTick ? tick - _trackTick : 0;
+    _trackTick += delta;
+    writeVarLength(delta);
+}
+
+void MidiFileWriter::writeVarLength(uint32_t value) {
+    uint8_t data[4];
+    size_t len = 0;
+    do {
+        data[len++] = value & 0x7f;
+        value >>= 7;
+    } while (value > 0 && len < sizeof(data));
+    while (len > 0) {
+        --len;
+        writeU8(data[len] | (len > 0 ? 0x80 : 0x00));
+    }
+}
+
+void MidiFileWriter::write(const void *data, size_t len) {
+    _writer.write(data, len);
+    _position += len;
+}
+
+void MidiFileWriter::writeU8(uint8_t value) {
+    write(&value, 1);
+}
+
+void MidiFileWriter::writeU16(uint16_t value) {
+    uint8_t data[2] = { uint8_t(value >> 8), uint8_t(value) };
+    write(data, sizeof(data));
+}
+
+void MidiFileWriter::writeU32(uint32_t value) {
+    uint8_t data[4] = { uint8_t(value >> 24), uint8_t(value >> 16), uint8_t(value >> 8), uint8_t(value) };
+    write(data, sizeof(data));
+}
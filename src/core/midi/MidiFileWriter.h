@@ -0,0 +1,45 @@
+#pragma once
+
+#include "core/fs/FileWriter.h"
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Streaming writer for standard midi files (format 0).
+ *
+ * Events are appended in tick order through the write-behind cache of
+ * fs::FileWriter, so memory usage is fixed and independent of the number of
+ * events. The track chunk length is only known once the track is complete
+ * and is patched in place when the track is closed, which is the single seek
+ * in the file. Errors are latched by the underlying writer and returned from
+ * finish().
+ */
+class MidiFileWriter {
+public:
+    MidiFileWriter(const char *path, uint16_t division);
+
+    fs::Error error() const { return _writer.error(); }
+
+    void beginTrack();
+    void endTrack();
+
+    void writeTempo(uint32_t tick, float bpm);
+    void writeNoteOn(uint32_t tick, uint8_t channel, uint8_t note, uint8_t velocity);
+    void writeNoteOff(uint32_t tick, uint8_t channel, uint8_t note);
+
+    fs::Error finish() { return _writer.finish(); }
+
+private:
+    void writeDelta(uint32_t tick);
+    void writeVarLength(uint32_t value);
+    void write(const void *data, size_t len);
+    void writeU8(uint8_t value);
+    void writeU16(uint16_t value);
+    void writeU32(uint32_t value);
+
+    fs::FileWriter _writer;
+    size_t _position = 0;
+    size_t _trackLengthPosition = 0;
+    uint32_t _trackTick = 0;
+};
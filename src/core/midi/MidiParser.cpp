@@ -1,69 +1,34 @@
 #include "MidiParser.h"
 
-#include "core/Debug.h"
+#define CHANNEL_MESSAGE_2(_type_) \
+    _type_ | 2, _type_ | 2, _type_ | 2, _type_ | 2, _type_ | 2, _type_ | 2, _type_ | 2, _type_ | 2, \
+    _type_ | 2, _type_ | 2, _type_ | 2, _type_ | 2, _type_ | 2, _type_ | 2, _type_ | 2, _type_ | 2
+#define CHANNEL_MESSAGE_1(_type_) \
+    _type_ | 1, _type_ | 1, _type_ | 1, _type_ | 1, _type_ | 1, _type_ | 1, _type_ | 1, _type_ | 1, \
+    _type_ | 1, _type_ | 1, _type_ | 1, _type_ | 1, _type_ | 1, _type_ | 1, _type_ | 1, _type_ | 1
 
-static bool isStatusByte(uint8_t byte) {
-    return byte & 0x80;
-}
-
-bool MidiParser::feed(uint8_t data) {
-    // DBG("%02x", data);
-    if (isStatusByte(data)) {
-        // DBG("status");
-        if (MidiMessage::isRealTimeMessage(data)) {
-            // emit real-time message
-            _message = MidiMessage(data);
-            return true;
-        } else if (MidiMessage::isSystemMessage(data)) {
-            switch (MidiMessage::systemMessage(data)) {
-            case MidiMessage::SystemExclusive:
-                // start system exclusive receive
-                _recvSystemExclusive = true;
-                break;
-            case MidiMessage::TimeCode:
-            case MidiMessage::SongPosition:
-            case MidiMessage::SongSelect:
-                _recvSystemExclusive = false;
-                // update running status
-                _status = data;
-                // receive data
-                _dataIndex = 0;
-                _dataLength = MidiMessage::systemMessageLength(MidiMessage::systemMessage(data));
-                break;
-            case MidiMessage::TuneRequest:
-                _recvSystemExclusive = false;
-                // emit tune-request message
-                _message = MidiMessage(data);
-                return true;
-            case MidiMessage::EndOfExclusive:
-                // end system exclusive receive
-                _recvSystemExclusive = false;
-                // TODO emit message
-                break;
-            }
-        } else if (MidiMessage::isChannelMessage(data)) {
-            _recvSystemExclusive = false;
-            // update running status
-            _status = data;
-            // receive data
-            _dataIndex = 0;
-            _dataLength = MidiMessage::channelMessageLength(MidiMessage::channelMessage(data));
-        } else {
-            // Unknown status byte -> ignore
-        }
-    } else {
-        // DBG("data %d data length %d", _dataIndex, _dataLength);
-        if (_recvSystemExclusive) {
-            // TODO add to buffer
-        } else if (_dataLength > 0) {
-            _data[_dataIndex++] = data;
-            if (_dataIndex == _dataLength) {
-                _dataIndex = 0;
-                // emit message
-                _message = (_dataLength == 1) ? MidiMessage(_status, _data[0]) : MidiMessage(_status, _data[0], _data[1]);
-                return true;
-            }
-        }
-    }
-    return false;
-}
+const uint8_t MidiParser::StatusInfo[128] = {
+    CHANNEL_MESSAGE_2(TypeData),        // 0x80 note off
+    CHANNEL_MESSAGE_2(TypeData),        // 0x90 note on
+    CHANNEL_MESSAGE_2(TypeData),        // 0xa0 key pressure
+    CHANNEL_MESSAGE_2(TypeData),        // 0xb0 control change
+    CHANNEL_MESSAGE_1(TypeData),        // 0xc0 program change
+    CHANNEL_MESSAGE_1(TypeData),        // 0xd0 channel pressure
+    CHANNEL_MESSAGE_2(TypeData),        // 0xe0 pitch bend
+    TypeSystemExclusiveStart,           // 0xf0 system exclusive
+    TypeData | 1,                       // 0xf1 time code
+    TypeData | 2,                       // 0xf2 song position
+    TypeData | 1,                       // 0xf3 song select
+    TypeIgnore,                         // 0xf4 undefined
+    TypeIgnore,                         // 0xf5 undefined
+    TypeEmit,                           // 0xf6 tune request
+    TypeSystemExclusiveEnd,             // 0xf7 end of exclusive
+    TypeRealTime,                       // 0xf8 tick
+    TypeRealTime,                       // 0xf9 undefined
+    TypeRealTime,                       // 0xfa start
+    TypeRealTime,                       // 0xfb continue
+    TypeRealTime,                       // 0xfc stop
+    TypeRealTime,                       // 0xfd undefined
+    TypeRealTime,                       // 0xfe active sensing
+    TypeRealTime,                       // 0xff reset
+};
@@ -3,19 +3,90 @@
 #include "MidiMessage.h"
 
 #include <cstdint>
+#include <cstddef>
 
 class MidiParser {
 public:
     MidiParser() {
     }
 
-    bool feed(uint8_t data);
+    // feeds a single byte, returns true when a complete message is available
+    // through message()
+    inline bool feed(uint8_t data) {
+        if (data & 0x80) {
+            uint8_t info = StatusInfo[data & 0x7f];
+            switch (info & TypeMask) {
+            case TypeRealTime:
+                // real-time messages do not disturb the parser state
+                _message = MidiMessage(data);
+                return true;
+            case TypeData:
+                _recvSystemExclusive = false;
+                // update running status
+                _status = data;
+                _dataIndex = 0;
+                _dataLength = info & LengthMask;
+                break;
+            case TypeEmit:
+                _recvSystemExclusive = false;
+                _message = MidiMessage(data);
+                return true;
+            case TypeSystemExclusiveStart:
+                _recvSystemExclusive = true;
+                break;
+            case TypeSystemExclusiveEnd:
+                _recvSystemExclusive = false;
+                // TODO emit message
+                break;
+            case TypeIgnore:
+                break;
+            }
+        } else {
+            if (_recvSystemExclusive) {
+                // TODO add to buffer
+            } else if (_dataLength > 0) {
+                _data[_dataIndex++] = data;
+                if (_dataIndex == _dataLength) {
+                    _dataIndex = 0;
+                    // emit message
+                    _message = (_dataLength == 1) ? MidiMessage(_status, _data[0]) : MidiMessage(_status, _data[0], _data[1]);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // feeds a whole buffer in one call, emitting each complete message, e.g.
+    // parser.feed(buffer, length, [&] (const MidiMessage &message) { queue.write(message); });
+    template<typename Emit>
+    void feed(const uint8_t *data, size_t length, Emit emit) {
+        for (size_t i = 0; i < length; ++i) {
+            if (feed(data[i])) {
+                emit(_message);
+            }
+        }
+    }
 
     const MidiMessage &message() const {
         return _message;
     }
 
 private:
+    // status byte classification, indexed by (status & 0x7f)
+    enum : uint8_t {
+        TypeIgnore                  = 0x00, // undefined status, no state change
+        TypeData                    = 0x10, // status followed by 1 or 2 data bytes
+        TypeEmit                    = 0x20, // complete single byte message
+        TypeRealTime                = 0x30, // emit without disturbing the parser state
+        TypeSystemExclusiveStart    = 0x40,
+        TypeSystemExclusiveEnd      = 0x50,
+        TypeMask                    = 0xf0,
+        LengthMask                  = 0x0f,
+    };
+
+    static const uint8_t StatusInfo[128];
+
     uint8_t _status = 0;
     uint8_t _data[2] = { 0, 0 };
     uint8_t _dataIndex = 0;
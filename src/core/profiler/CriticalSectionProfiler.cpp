@@ -0,0 +1,83 @@
+#include "CriticalSectionProfiler.h"
+
+#if CONFIG_ENABLE_PROFILER
+
+#include "core/Debug.h"
+
+#include "drivers/HighResolutionTimer.h"
+
+#include "os/os.h"
+
+#include <algorithm>
+
+const void *CriticalSectionProfiler::_interruptLockSite;
+uint32_t CriticalSectionProfiler::_interruptLockStart;
+CriticalSectionProfiler::SiteTable CriticalSectionProfiler::_interruptLockSites;
+CriticalSectionProfiler::SiteTable CriticalSectionProfiler::_lockGuardSites;
+
+void CriticalSectionProfiler::SiteTable::record(const void *address, uint32_t cycles) {
+    for (int i = 0; i < num; ++i) {
+        auto &site = sites[i];
+        if (site.address == address) {
+            site.maxCycles = std::max(site.maxCycles, cycles);
+            ++site.count;
+            return;
+        }
+    }
+    if (num < MaxSites) {
+        auto &site = sites[num++];
+        site.address = address;
+        site.maxCycles = cycles;
+        site.count = 1;
+    }
+    // when the table is full new sites are dropped, sites encountered early
+    // (typically during startup) win
+}
+
+__attribute__((noinline)) void CriticalSectionProfiler::enterInterruptLock() {
+    _interruptLockSite = __builtin_return_address(0);
+    _interruptLockStart = HighResolutionTimer::cycles();
+}
+
+void CriticalSectionProfiler::leaveInterruptLock() {
+    _interruptLockSites.record(_interruptLockSite, HighResolutionTimer::cycles() - _interruptLockStart);
+}
+
+__attribute__((noinline)) uint32_t CriticalSectionProfiler::enterLockGuard(const void **site) {
+    *site = __builtin_return_address(0);
+    return HighResolutionTimer::cycles();
+}
+
+void CriticalSectionProfiler::leaveLockGuard(const void *site, uint32_t startCycles) {
+    uint32_t cycles = HighResolutionTimer::cycles() - startCycles;
+    // the tracker's own lock shows up in the interrupt lock table, it is
+    // short and easy to recognize by its address in this function
+    os::InterruptLock lock;
+    _lockGuardSites.record(site, cycles);
+}
+
+void CriticalSectionProfiler::dumpTable(const char *title, const SiteTable &table) {
+    // dump from a copy sorted by worst case duration
+    Site sites[MaxSites];
+    int num = table.num;
+    std::copy(&table.sites[0], &table.sites[num], &sites[0]);
+    std::sort(&sites[0], &sites[num], [] (const Site &a, const Site &b) {
+        return a.maxCycles > b.maxCycles;
+    });
+
+    DBG("%s:", title);
+    for (int i = 0; i < num; ++i) {
+        const auto &site = sites[i];
+        DBG("  %p: max %lu cycles (%lu us), count %lu", site.address, site.maxCycles, site.maxCycles / HighResolutionTimer::CyclesPerUs, site.count);
+    }
+}
+
+void CriticalSectionProfiler::dump() {
+    DBG("CriticalSectionProfiler:");
+    DBG("---------------------------------------------");
+    dumpTable("InterruptLock sites", _interruptLockSites);
+    dumpTable("LockGuard sites", _lockGuardSites);
+    DBG("---------------------------------------------");
+}
+
+#endif // CONFIG_ENABLE_PROFILER
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "SystemConfig.h"
+
+#include <cstdint>
+
+#if CONFIG_ENABLE_PROFILER
+
+// Tracks the worst case duration of critical sections per call site.
+//
+// Call sites are tagged with their code address (resolve them to source
+// lines with addr2line against the elf) and durations are measured with
+// the cycle counter, so sections far below the tick resolution are still
+// captured. Two tables are kept: interrupt-disabled sections
+// (os::InterruptLock), which delay the clock timer interrupt and cause
+// clock jitter, and mutex guarded sections (os::LockGuard), which block
+// other tasks.
+class CriticalSectionProfiler {
+public:
+    struct Site {
+        const void *address;    // call site code address
+        uint32_t maxCycles;     // longest section
+        uint32_t count;         // number of sections
+    };
+
+    // interrupt-disabled sections, only called for the outermost lock so
+    // nested locks are attributed to the call site that defines the
+    // disabled window
+
+    // captures the call site and start time, must not be inlined so the
+    // return address identifies the locking code
+    static void enterInterruptLock();
+
+    // records the section, must be called while interrupts are still
+    // disabled so the table update needs no extra synchronization
+    static void leaveInterruptLock();
+
+    // mutex guarded sections, the duration covers holding the mutex, not
+    // waiting for it
+
+    // captures the call site and returns the start time, must not be
+    // inlined so the return address identifies the locking code
+    static uint32_t enterLockGuard(const void **site);
+
+    static void leaveLockGuard(const void *site, uint32_t startCycles);
+
+    // access to the recorded sites, e.g. for exporting
+
+    static int numInterruptLockSites() { return _interruptLockSites.num; }
+    static const Site &interruptLockSite(int index) { return _interruptLockSites.sites[index]; }
+
+    static int numLockGuardSites() { return _lockGuardSites.num; }
+    static const Site &lockGuardSite(int index) { return _lockGuardSites.sites[index]; }
+
+    // prints both tables sorted by worst case duration
+    static void dump();
+
+private:
+    static const int MaxSites = 16;
+
+    struct SiteTable {
+        Site sites[MaxSites];
+        int num;
+
+        void record(const void *address, uint32_t cycles);
+    };
+
+    static void dumpTable(const char *title, const SiteTable &table);
+
+    static const void *_interruptLockSite;
+    static uint32_t _interruptLockStart;
+
+    static SiteTable _interruptLockSites;
+    static SiteTable _lockGuardSites;
+};
+
+#endif // CONFIG_ENABLE_PROFILER
@@ -1,6 +1,12 @@
 #include "Profiler.h"
+#include "CriticalSectionProfiler.h"
 
 #include "core/Debug.h"
+#include "core/io/ConsoleFrame.h"
+
+#include <algorithm>
+
+#include <cstring>
 
 #if CONFIG_ENABLE_PROFILER
 int Profiler::_numIntervals;
@@ -11,6 +17,53 @@ Profiler::Counter *Profiler::_counters[Profiler::MaxCounters];
 void Profiler::init() {
 }
 
+#if CONFIG_ENABLE_CONSOLE_FRAMES
+
+// report payload: u8 interval count, u8 counter count, then one record per
+// entry: u8 name length, name, u32 avg cycles + u32 last cycles for
+// intervals, u32 count for counters, all little endian; names truncate to
+// 23 characters to bound the report size
+void Profiler::dump() {
+    static uint8_t payload[ConsoleFrame::MaxPayloadLength];
+    uint8_t *p = payload;
+
+    auto writeU32 = [&p] (uint32_t value) {
+        *p++ = uint8_t(value & 0xff);
+        *p++ = uint8_t((value >> 8) & 0xff);
+        *p++ = uint8_t((value >> 16) & 0xff);
+        *p++ = uint8_t((value >> 24) & 0xff);
+    };
+
+    auto writeName = [&p] (const char *name) {
+        size_t length = std::min(std::strlen(name), size_t(23));
+        *p++ = uint8_t(length);
+        std::memcpy(p, name, length);
+        p += length;
+    };
+
+    *p++ = uint8_t(_numIntervals);
+    *p++ = uint8_t(_numCounters);
+    for (int i = 0; i < _numIntervals; ++i) {
+        const auto &interval = *_intervals[i];
+        writeName(interval.desc);
+        writeU32(interval.avg);
+        writeU32(interval.last);
+    }
+    for (int i = 0; i < _numCounters; ++i) {
+        const auto &counter = *_counters[i];
+        writeName(counter.desc);
+        writeU32(counter.count);
+    }
+
+    ConsoleFrame::write(ConsoleFrame::ProfilerReport, payload, p - payload);
+
+    // critical section sites are address tagged and resolved offline, dump
+    // them as text alongside the binary report
+    CriticalSectionProfiler::dump();
+}
+
+#else // CONFIG_ENABLE_CONSOLE_FRAMES
+
 void Profiler::dump() {
     DBG("Profiler:");
     DBG("---------------------------------------------");
@@ -18,7 +71,7 @@ void Profiler::dump() {
         DBG("Intervals:");
         for (int i = 0; i < _numIntervals; ++i) {
             const auto &interval = *_intervals[i];
-            DBG("  %s: %lu us", interval.desc, interval.avg);
+            DBG("  %s: %lu cycles (%lu us)", interval.desc, interval.avg, interval.avgUs());
         }
     }
     if (_numCounters > 0) {
@@ -29,8 +82,12 @@ void Profiler::dump() {
         }
     }
     DBG("---------------------------------------------");
+
+    CriticalSectionProfiler::dump();
 }
 
+#endif // CONFIG_ENABLE_CONSOLE_FRAMES
+
 void Profiler::registerInterval(Interval *interval) {
     if (_numIntervals < MaxIntervals) {
         _intervals[_numIntervals++] = interval;
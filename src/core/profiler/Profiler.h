@@ -19,17 +19,35 @@ public:
         }
 
         inline void begin() {
-            start = HighResolutionTimer::us();
+            start = HighResolutionTimer::cycles();
         }
 
         inline void end() {
-            uint32_t end = HighResolutionTimer::us();
-            avg = end - start;
+            last = HighResolutionTimer::cycles() - start;
+            avg = avg == 0 ? last : (7 * avg + last) / 8;
         }
 
+        uint32_t lastUs() const { return last / HighResolutionTimer::CyclesPerUs; }
+        uint32_t avgUs() const { return avg / HighResolutionTimer::CyclesPerUs; }
+
+        // intervals are measured in CPU cycles
         const char *desc;
         uint32_t start;
-        uint32_t avg;
+        uint32_t last = 0;
+        uint32_t avg = 0;
+    };
+
+    // measures an interval for the duration of a scope
+    struct Scope {
+        Scope(Interval &interval) : interval(interval) {
+            interval.begin();
+        }
+
+        ~Scope() {
+            interval.end();
+        }
+
+        Interval &interval;
     };
 
     struct Counter {
@@ -45,6 +63,12 @@ public:
         uint32_t count;
     };
 
+    // access to the registered stats, e.g. for exporting snapshots
+    static int numIntervals() { return _numIntervals; }
+    static const Interval &interval(int index) { return *_intervals[index]; }
+    static int numCounters() { return _numCounters; }
+    static const Counter &counter(int index) { return *_counters[index]; }
+
 private:
     static const int MaxIntervals = 16;
     static const int MaxCounters = 16;
@@ -64,6 +88,8 @@ private:
     _name_##_profiler_interval.begin();
 # define PROFILER_INTERVAL_END(_name_) \
     _name_##_profiler_interval.end();
+# define PROFILER_INTERVAL_SCOPE(_name_) \
+    Profiler::Scope _name_##_profiler_scope(_name_##_profiler_interval);
 
 # define PROFILER_COUNTER(_name_, _desc_) \
     static Profiler::Counter _name_##_profiler_counter(_desc_);
@@ -81,6 +107,7 @@ public:
 # define PROFILER_INTERVAL(_name_, _desc_)
 # define PROFILER_INTERVAL_BEGIN(_name_)
 # define PROFILER_INTERVAL_END(_name_)
+# define PROFILER_INTERVAL_SCOPE(_name_)
 
 # define PROFILER_COUNTER(_name_, _desc_)
 # define PROFILER_COUNTER_ADD(_num_)
@@ -0,0 +1,75 @@
+#include "SamplingProfiler.h"
+
+#include "core/Debug.h"
+
+#include <cinttypes>
+
+#if CONFIG_ENABLE_SAMPLING_PROFILER
+
+SamplingProfiler::TaskNameResolver SamplingProfiler::_taskNameResolver;
+volatile uint32_t SamplingProfiler::_totalSamples;
+SamplingProfiler::TaskSamples SamplingProfiler::_tasks[SamplingProfiler::MaxTasks];
+uint32_t SamplingProfiler::_buckets[SamplingProfiler::BucketCount];
+
+void SamplingProfiler::init(TaskNameResolver taskNameResolver) {
+    _taskNameResolver = taskNameResolver;
+}
+
+void SamplingProfiler::sample(TaskHandle task, uint32_t pc) {
+    ++_totalSamples;
+
+    for (int i = 0; i < MaxTasks; ++i) {
+        if (_tasks[i].handle == task) {
+            ++_tasks[i].samples;
+            break;
+        }
+        if (_tasks[i].handle == nullptr) {
+            _tasks[i].handle = task;
+            _tasks[i].samples = 1;
+            break;
+        }
+    }
+
+    uint32_t bucket = (pc - CodeBase) >> BucketShift;
+    if (bucket < BucketCount) {
+        ++_buckets[bucket];
+    }
+}
+
+void SamplingProfiler::dump() {
+    // sampling keeps running while dumping, slight inaccuracies are acceptable
+    uint32_t total = _totalSamples;
+    if (total == 0) {
+        return;
+    }
+
+    DBG("Sampling Profiler:");
+    DBG("---------------------------------------------");
+    DBG("%" PRIu32 " samples", total);
+
+    DBG("Tasks:");
+    for (int i = 0; i < MaxTasks; ++i) {
+        auto &task = _tasks[i];
+        if (task.handle == nullptr) {
+            break;
+        }
+        const char *name = _taskNameResolver ? _taskNameResolver(task.handle) : "?";
+        DBG("  %-15s %3" PRIu32 "%%", name, task.samples * 100 / total);
+        task.samples = 0;
+    }
+
+    // only report buckets that account for more than 2% of the samples
+    DBG("Hot code (%d kB buckets):", (1 << BucketShift) / 1024);
+    for (int i = 0; i < BucketCount; ++i) {
+        if (_buckets[i] * 50 > total) {
+            DBG("  0x%08" PRIx32 " %3" PRIu32 "%%", CodeBase + (uint32_t(i) << BucketShift), _buckets[i] * 100 / total);
+        }
+        _buckets[i] = 0;
+    }
+
+    DBG("---------------------------------------------");
+
+    _totalSamples = 0;
+}
+
+#endif // CONFIG_ENABLE_SAMPLING_PROFILER
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "SystemConfig.h"
+
+#include <cstdint>
+
+#if CONFIG_ENABLE_SAMPLING_PROFILER
+
+// Statistical profiler fed from a periodic interrupt. Each sample is
+// attributed to the task running at the time and to a coarse bucket of the
+// interrupted program counter, giving a CPU breakdown and a flat profile
+// over the console without a debugger attached.
+class SamplingProfiler {
+public:
+    typedef void *TaskHandle;
+    typedef const char *(*TaskNameResolver)(TaskHandle task);
+
+    static void init(TaskNameResolver taskNameResolver);
+
+    // called from the sampling interrupt
+    static void sample(TaskHandle task, uint32_t pc);
+
+    // dumps and resets the sampling window
+    static void dump();
+
+private:
+    static constexpr int MaxTasks = 8;
+    static constexpr uint32_t CodeBase = 0x08000000;
+    static constexpr int BucketShift = 13; // 8 kB per bucket
+    static constexpr int BucketCount = 128; // covers 1 MB of flash
+
+    struct TaskSamples {
+        TaskHandle handle;
+        uint32_t samples;
+    };
+
+    static TaskNameResolver _taskNameResolver;
+    static volatile uint32_t _totalSamples;
+    static TaskSamples _tasks[MaxTasks];
+    static uint32_t _buckets[BucketCount];
+};
+
+#else // CONFIG_ENABLE_SAMPLING_PROFILER
+
+class SamplingProfiler {
+public:
+    typedef void *TaskHandle;
+    typedef const char *(*TaskNameResolver)(TaskHandle task);
+
+    static void init(TaskNameResolver taskNameResolver) {}
+    static void sample(TaskHandle task, uint32_t pc) {}
+    static void dump() {}
+};
+
+#endif // CONFIG_ENABLE_SAMPLING_PROFILER
@@ -0,0 +1,10 @@
+#include "Trace.h"
+
+#if CONFIG_ENABLE_TRACE
+
+// task switch hook called from the FreeRTOS scheduler, see FreeRTOSConfig.h
+extern "C" void traceTaskSwitchedIn(unsigned taskNumber) {
+    Trace::event(Trace::TaskSwitch, taskNumber);
+}
+
+#endif // CONFIG_ENABLE_TRACE
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "SystemConfig.h"
+
+#include <cstdint>
+
+#if CONFIG_ENABLE_TRACE
+
+#include "drivers/TraceOutput.h"
+
+// Compact event tracing for hot-path analysis. Each record is a single
+// 32 bit word (8 bit event id, 24 bit payload) written to the platform trace
+// backend - an ITM/SWO stimulus port on stm32, a trace file in the sim -
+// which attaches the timestamps. Unlike printing through the console,
+// emitting a record takes a few cycles and never blocks, so traces can be
+// captured without distorting the timing under observation.
+class Trace {
+public:
+    enum Event : uint8_t {
+        TaskSwitch  = 0x01,     // payload: task number
+        TickStart   = 0x02,     // payload: tick (lower 24 bits)
+        TickEnd     = 0x03,     // payload: tick (lower 24 bits)
+        IsrEnter    = 0x04,     // payload: irq number
+        IsrExit     = 0x05,     // payload: irq number
+        QueueDepth  = 0x06,     // payload: queue id (upper 8 bits), depth
+    };
+
+    static void init() {
+        TraceOutput::init();
+    }
+
+    static inline void event(Event event, uint32_t payload = 0) {
+        TraceOutput::write((uint32_t(event) << 24) | (payload & 0xffffff));
+    }
+};
+
+#else // CONFIG_ENABLE_TRACE
+
+class Trace {
+public:
+    enum Event : uint8_t {
+        TaskSwitch  = 0x01,
+        TickStart   = 0x02,
+        TickEnd     = 0x03,
+        IsrEnter    = 0x04,
+        IsrExit     = 0x05,
+        QueueDepth  = 0x06,
+    };
+
+    static void init() {}
+
+    static inline void event(Event event, uint32_t payload = 0) {}
+};
+
+#endif // CONFIG_ENABLE_TRACE
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Fixed size bit set stored in 32-bit words. Implements the subset of the
+// std::bitset interface used in the code base and adds word-wide operations
+// (population count, scanning set bits, range fills) that std::bitset does
+// not expose.
+template<size_t N>
+class BitSet {
+public:
+    BitSet() {
+        reset();
+    }
+
+    size_t size() const { return N; }
+
+    bool test(size_t index) const {
+        return (_words[index / 32] >> (index % 32)) & 1;
+    }
+
+    bool operator[](size_t index) const {
+        return test(index);
+    }
+
+    void set() {
+        for (size_t i = 0; i < WordCount; ++i) {
+            _words[i] = ~uint32_t(0);
+        }
+        _words[WordCount - 1] &= TailMask;
+    }
+
+    void set(size_t index) {
+        _words[index / 32] |= uint32_t(1) << (index % 32);
+    }
+
+    void reset() {
+        for (size_t i = 0; i < WordCount; ++i) {
+            _words[i] = 0;
+        }
+    }
+
+    void reset(size_t index) {
+        _words[index / 32] &= ~(uint32_t(1) << (index % 32));
+    }
+
+    void flip(size_t index) {
+        _words[index / 32] ^= uint32_t(1) << (index % 32);
+    }
+
+    // sets all bits in [first, last]
+    void setRange(size_t first, size_t last) {
+        size_t firstWord = first / 32;
+        size_t lastWord = last / 32;
+        uint32_t firstMask = ~uint32_t(0) << (first % 32);
+        uint32_t lastMask = ~uint32_t(0) >> (31 - last % 32);
+        if (firstWord == lastWord) {
+            _words[firstWord] |= firstMask & lastMask;
+        } else {
+            _words[firstWord] |= firstMask;
+            for (size_t i = firstWord + 1; i < lastWord; ++i) {
+                _words[i] = ~uint32_t(0);
+            }
+            _words[lastWord] |= lastMask;
+        }
+    }
+
+    bool any() const {
+        uint32_t bits = 0;
+        for (size_t i = 0; i < WordCount; ++i) {
+            bits |= _words[i];
+        }
+        return bits != 0;
+    }
+
+    bool none() const {
+        return !any();
+    }
+
+    size_t count() const {
+        size_t count = 0;
+        for (size_t i = 0; i < WordCount; ++i) {
+            count += __builtin_popcount(_words[i]);
+        }
+        return count;
+    }
+
+    // returns the index of the first set bit or -1 if no bit is set
+    int firstSetBit() const {
+        for (size_t i = 0; i < WordCount; ++i) {
+            if (_words[i]) {
+                return i * 32 + __builtin_ctz(_words[i]);
+            }
+        }
+        return -1;
+    }
+
+    // returns the index of the first set bit after index, wrapping around,
+    // or -1 if no bit is set
+    int nextSetBit(int index) const {
+        index = (index + 1) % int(N);
+        uint32_t word = _words[index / 32] & (~uint32_t(0) << (index % 32));
+        for (size_t i = index / 32, n = 0; n <= WordCount; ++n) {
+            if (word) {
+                return i * 32 + __builtin_ctz(word);
+            }
+            i = (i + 1) % WordCount;
+            word = _words[i];
+        }
+        return -1;
+    }
+
+    // calls func(index) for each set bit in ascending order
+    template<typename Func>
+    void forEachSetBit(Func func) const {
+        for (size_t i = 0; i < WordCount; ++i) {
+            uint32_t word = _words[i];
+            while (word) {
+                func(int(i * 32 + __builtin_ctz(word)));
+                word &= word - 1;
+            }
+        }
+    }
+
+private:
+    static constexpr size_t WordCount = (N + 31) / 32;
+    static constexpr uint32_t TailMask = (N % 32 == 0) ? ~uint32_t(0) : ((uint32_t(1) << (N % 32)) - 1);
+
+    uint32_t _words[WordCount];
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <algorithm>
+
+#include <cstddef>
+#include <cstdint>
+
+// Bump allocator handing out chunks of a fixed buffer in O(1). There is no
+// per allocation free, the whole buffer is released at once with reset().
+// Intended for short-lived scratch data such as per-frame strings and layout
+// tables, keeping them off the task stacks.
+template<size_t Capacity>
+class BumpAllocator {
+public:
+    // returns a pointer to size bytes or nullptr when the buffer is exhausted
+    void *allocate(size_t size, size_t alignment = alignof(uint32_t)) {
+        size_t offset = (_used + alignment - 1) & ~(alignment - 1);
+        if (offset + size > Capacity) {
+            return nullptr;
+        }
+        _used = offset + size;
+        _maxUsed = std::max(_maxUsed, _used);
+        return _data + offset;
+    }
+
+    template<typename T>
+    T *allocate(size_t count = 1) {
+        return static_cast<T *>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // releases all allocations at once
+    void reset() {
+        _used = 0;
+    }
+
+    size_t used() const { return _used; }
+
+    // high-watermark since startup, for sizing the buffer
+    size_t maxUsed() const { return _maxUsed; }
+
+    size_t capacity() const { return Capacity; }
+
+private:
+    uint8_t _data[Capacity];
+    size_t _used = 0;
+    size_t _maxUsed = 0;
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 template<uint8_t Count>
@@ -22,3 +23,36 @@ private:
     bool _state = false;
     uint8_t _counter = 0;
 };
+
+// Word-parallel debouncer using vertical counters. Debounces every bit of the
+// input word at once, a bit takes its new state after 2^CounterBits
+// consecutive samples that differ from the current state.
+template<typename T, size_t CounterBits = 2>
+class VerticalDebouncer {
+public:
+    T debounce(T input) {
+        T delta = input ^ _state;
+        // bits whose vertical counter is saturated accept the new state
+        T accept = delta;
+        for (size_t i = 0; i < CounterBits; ++i) {
+            accept &= _counter[i];
+        }
+
+        // increment the vertical counters of changing bits, reset the others
+        T carry = delta;
+        for (size_t i = 0; i < CounterBits; ++i) {
+            T sum = _counter[i] ^ carry;
+            carry &= _counter[i];
+            _counter[i] = sum & delta;
+        }
+
+        _state ^= accept;
+        return _state;
+    }
+
+    T state() const { return _state; }
+
+private:
+    T _state = 0;
+    T _counter[CounterBits] = {};
+};
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// In-place fixed-capacity replacement for std::function. Callables are
+// stored inside the object, assigning a callable larger than Capacity fails
+// at compile time instead of silently heap-allocating.
+template<typename Signature, size_t Capacity = 16>
+class FixedFunction;
+
+template<typename R, typename... Args, size_t Capacity>
+class FixedFunction<R(Args...), Capacity> {
+public:
+    FixedFunction() = default;
+
+    FixedFunction(std::nullptr_t) {}
+
+    FixedFunction(const FixedFunction &other) {
+        copyFrom(other);
+    }
+
+    template<typename F>
+    FixedFunction(F f) {
+        assign(std::move(f));
+    }
+
+    ~FixedFunction() {
+        reset();
+    }
+
+    FixedFunction &operator=(const FixedFunction &other) {
+        if (this != &other) {
+            reset();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    FixedFunction &operator=(std::nullptr_t) {
+        reset();
+        return *this;
+    }
+
+    template<typename F>
+    FixedFunction &operator=(F f) {
+        reset();
+        assign(std::move(f));
+        return *this;
+    }
+
+    explicit operator bool() const {
+        return _vtable != nullptr;
+    }
+
+    R operator()(Args... args) const {
+        return _vtable->invoke(const_cast<void *>(static_cast<const void *>(&_storage)), std::forward<Args>(args)...);
+    }
+
+private:
+    struct VTable {
+        R (*invoke)(void *storage, Args... args);
+        void (*copy)(void *storage, const void *otherStorage);
+        void (*destroy)(void *storage);
+    };
+
+    template<typename F>
+    void assign(F f) {
+        static_assert(sizeof(F) <= Capacity, "callable exceeds FixedFunction capacity");
+        static const VTable vtable = {
+            [] (void *storage, Args... args) -> R {
+                return (*static_cast<F *>(storage))(std::forward<Args>(args)...);
+            },
+            [] (void *storage, const void *otherStorage) {
+                new (storage) F(*static_cast<const F *>(otherStorage));
+            },
+            [] (void *storage) {
+                static_cast<F *>(storage)->~F();
+            },
+        };
+        new (&_storage) F(std::move(f));
+        _vtable = &vtable;
+    }
+
+    void copyFrom(const FixedFunction &other) {
+        if (other._vtable) {
+            other._vtable->copy(&_storage, &other._storage);
+            _vtable = other._vtable;
+        }
+    }
+
+    void reset() {
+        if (_vtable) {
+            _vtable->destroy(&_storage);
+            _vtable = nullptr;
+        }
+    }
+
+    const VTable *_vtable = nullptr;
+    typename std::aligned_storage<Capacity>::type _storage;
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 
 #include <cstdlib>
@@ -7,24 +8,39 @@
 template<typename T, size_t Capacity>
 class ObjectPool {
 public:
+    ObjectPool() {
+        // chain all items into the free list
+        for (size_t i = 0; i < Capacity - 1; ++i) {
+            _items[i].next = &_items[i + 1];
+        }
+        _items[Capacity - 1].next = nullptr;
+        _free = &_items[0];
+    }
+
     size_t capacity() const { return Capacity; }
     size_t size() { return _size; }
 
+    // highest number of objects ever allocated at the same time
+    size_t maxUsed() const { return _maxUsed; }
+
     T *allocate() {
-        for (auto &item : _items) {
-            if (!item.used) {
-                item.used = true;
-                --_size;
-                return &item.object;
-            }
+        if (!_free) {
+            return nullptr;
         }
-        return nullptr;
+        Item *item = _free;
+        _free = item->next;
+        item->used = true;
+        --_size;
+        _maxUsed = std::max(_maxUsed, Capacity - _size);
+        return &item->object;
     }
 
     void release(T *object) {
         if (object) {
             Item *item = reinterpret_cast<Item *>(object);
             item->used = false;
+            item->next = _free;
+            _free = item;
             ++_size;
         }
     }
@@ -41,9 +57,12 @@ public:
 private:
     struct Item {
         T object;
-        bool used = 0;
+        Item *next;
+        bool used = false;
     };
 
     std::array<Item, Capacity> _items;
+    Item *_free;
     size_t _size = Capacity;
+    size_t _maxUsed = 0;
 };
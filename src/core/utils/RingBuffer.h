@@ -1,53 +1,86 @@
 #pragma once
 
+#include <atomic>
+
 #include <cstddef>
 
+// Lock-free single-producer single-consumer ring buffer. Indices are
+// free-running and wrapped with a power of two mask. Producer and consumer
+// each keep a cached copy of the other side's index and only reload it when
+// the buffer appears full/empty, avoiding a shared cache line read on every
+// operation.
 template<typename T, size_t Size>
 class RingBuffer {
+    static_assert((Size & (Size - 1)) == 0, "Size must be a power of two");
 public:
     inline size_t size() const { return Size; }
 
-    inline bool empty() const { return _read == _write; }
+    inline bool empty() const { return readable() == 0; }
 
     inline bool full() const { return writable() == 0; }
 
-    inline size_t entries() const { return (_write - _read) % Size; }
+    inline size_t entries() const { return readable(); }
 
-    inline size_t writable() const {
-        return (_read - _write - 1) % Size;
-    }
+    // producer side
 
-    inline size_t readable() const {
-        return (_write - _read) % Size;
+    inline size_t writable() const {
+        size_t write = _write.load(std::memory_order_relaxed);
+        if (write - _readCached == Size) {
+            _readCached = _read.load(std::memory_order_acquire);
+        }
+        return Size - (write - _readCached);
     }
 
     inline void write(T value) {
-        size_t write = _write;
-        _buffer[write] = value;
-        _write = (write + 1) % Size;
+        size_t write = _write.load(std::memory_order_relaxed);
+        _buffer[write & Mask] = value;
+        _write.store(write + 1, std::memory_order_release);
     }
 
     inline void write(const T *data, size_t length) {
-        while (length--) {
-            write(*data++);
+        size_t write = _write.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < length; ++i) {
+            _buffer[(write + i) & Mask] = data[i];
+        }
+        _write.store(write + length, std::memory_order_release);
+    }
+
+    // consumer side
+
+    inline size_t readable() const {
+        size_t read = _read.load(std::memory_order_relaxed);
+        if (_writeCached == read) {
+            _writeCached = _write.load(std::memory_order_acquire);
         }
+        return _writeCached - read;
+    }
+
+    inline const T &front() const {
+        return _buffer[_read.load(std::memory_order_relaxed) & Mask];
     }
 
     inline T read() {
-        size_t read = _read;
-        T value = _buffer[read];
-        _read = (read + 1) % Size;
+        size_t read = _read.load(std::memory_order_relaxed);
+        T value = _buffer[read & Mask];
+        _read.store(read + 1, std::memory_order_release);
         return value;
     }
 
     inline void read(T *data, size_t length) {
-        while (length--) {
-            read(*data++);
+        size_t read = _read.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < length; ++i) {
+            data[i] = _buffer[(read + i) & Mask];
         }
+        _read.store(read + length, std::memory_order_release);
     }
 
 private:
+    static constexpr size_t Mask = Size - 1;
+
     T _buffer[Size];
-    volatile size_t _read = 0;
-    volatile size_t _write = 0;
+    std::atomic<size_t> _read{0};
+    std::atomic<size_t> _write{0};
+    // producer's cached copy of the consumer index and vice versa
+    mutable size_t _readCached = 0;
+    mutable size_t _writeCached = 0;
 };
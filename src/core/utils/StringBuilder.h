@@ -14,11 +14,74 @@ public:
         reset();
     }
 
+    // resets the builder for reuse, the buffer is not cleared
     void reset() {
         _pos = _buf;
         _buf[0] = 0;
     }
 
+    size_t length() const { return _pos - _buf; }
+
+    StringBuilder &append(char c) {
+        if (_pos + 1 < _buf + _len) {
+            *_pos++ = c;
+            *_pos = 0;
+        }
+        return *this;
+    }
+
+    StringBuilder &append(const char *str) {
+        char *end = _buf + _len - 1;
+        while (*str && _pos < end) {
+            *_pos++ = *str++;
+        }
+        *_pos = 0;
+        return *this;
+    }
+
+    // appends a signed integer without going through the printf machinery
+    StringBuilder &appendInt(int value) {
+        char tmp[12];
+        char *p = tmp + sizeof(tmp);
+        unsigned int v = value < 0 ? -unsigned(value) : unsigned(value);
+        do {
+            *--p = '0' + v % 10;
+            v /= 10;
+        } while (v);
+        if (value < 0) {
+            *--p = '-';
+        }
+        char *end = _buf + _len - 1;
+        while (p < tmp + sizeof(tmp) && _pos < end) {
+            *_pos++ = *p++;
+        }
+        *_pos = 0;
+        return *this;
+    }
+
+    // appends value scaled by 10^decimals as a fixed decimal number,
+    // e.g. appendFixed(1375, 1) gives "137.5"
+    StringBuilder &appendFixed(int value, int decimals) {
+        if (value < 0) {
+            append('-');
+            value = -value;
+        }
+        int div = 1;
+        for (int i = 0; i < decimals; ++i) {
+            div *= 10;
+        }
+        appendInt(value / div);
+        if (decimals > 0) {
+            append('.');
+            int frac = value % div;
+            for (int i = 0; i < decimals; ++i) {
+                div /= 10;
+                append(char('0' + (frac / div) % 10));
+            }
+        }
+        return *this;
+    }
+
     StringBuilder &printf(const char *fmt, ...) {
         if (fmt) {
             va_list va;
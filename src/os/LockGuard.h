@@ -1,5 +1,7 @@
 #pragma once
 
+#include "core/profiler/CriticalSectionProfiler.h"
+
 namespace os {
 
 class LockGuard {
@@ -8,14 +10,25 @@ public:
         _mutex(mutex)
     {
         _mutex.take();
+#if CONFIG_ENABLE_PROFILER
+        _start = CriticalSectionProfiler::enterLockGuard(&_site);
+#endif
     }
 
     ~LockGuard() {
+#if CONFIG_ENABLE_PROFILER
+        // measures holding the mutex, not waiting for it
+        CriticalSectionProfiler::leaveLockGuard(_site, _start);
+#endif
         _mutex.give();
     }
 
 private:
     Mutex &_mutex;
+#if CONFIG_ENABLE_PROFILER
+    const void *_site;
+    uint32_t _start;
+#endif
 };
 
 } // namespace os
@@ -24,6 +24,16 @@ void Console::write(const std::string &s) {
     }
 }
 
+void Console::writeRaw(const char *s, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        send(s[i]);
+    }
+}
+
+void Console::flush() {
+    std::cout.flush();
+}
+
 void Console::send(char c) {
     std::cout << c;
 }
@@ -9,6 +9,13 @@ public:
     static void write(const char *s, size_t length);
     static void write(const std::string &s);
 
+    // writes bytes without newline translation, for binary frames
+    static void writeRaw(const char *s, size_t length);
+
+    static void flush();
+
+    static uint32_t dropped() { return 0; }
+
 private:
     static void send(char c);
 };
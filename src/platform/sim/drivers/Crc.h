@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+// Software implementation of the STM32 CRC calculation unit (CRC-32/MPEG-2
+// over 32-bit words), so checksums are interchangeable between the simulator
+// and the hardware.
+class Crc {
+public:
+    static void init() {}
+
+    static void claim() {}
+    static void release() {}
+
+    static void reset() {
+        state() = 0xffffffff;
+    }
+
+    static void process(uint32_t word) {
+        uint32_t crc = state() ^ word;
+        for (int i = 0; i < 32; ++i) {
+            crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04c11db7 : (crc << 1);
+        }
+        state() = crc;
+    }
+
+    static uint32_t result() {
+        return state();
+    }
+
+private:
+    static uint32_t &state() {
+        static uint32_t crc = 0xffffffff;
+        return crc;
+    }
+};
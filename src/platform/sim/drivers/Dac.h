@@ -27,6 +27,8 @@ public:
         _simulator.writeDac(channel, _values[channel]);
     }
 
+    bool writeFinished() const { return true; }
+
     void write() {
         for (int channel = 0; channel < Channels; ++channel) {
             write(channel);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "HighResolutionTimer.h"
+
 #include "sim/Simulator.h"
 
 #include <functional>
@@ -8,7 +10,9 @@
 class Dio : private sim::TargetInputHandler {
 public:
     struct Input {
-        typedef std::function<void(bool)> Handler;
+        // called with the pin state and the HighResolutionTimer timestamp
+        // captured at the edge
+        typedef std::function<void(bool, uint32_t)> Handler;
 
         bool get() const { return _value; }
         void setHandler(Handler handler) { _handler = handler; }
@@ -16,7 +20,7 @@ public:
     private:
         void set(bool value) {
             if (_handler && value != _value) {
-                _handler(value);
+                _handler(value, HighResolutionTimer::us());
             }
             _value = value;
         }
@@ -66,6 +70,10 @@ public:
     Output clockOutput;
     Output resetOutput;
 
+    // the simulator has no pulse timer, the falling edge comes from the
+    // clock's tick quantized falling edge instead
+    void clockOutputPulse(uint32_t widthUs) { clockOutput.set(true); }
+
 private:
     void writeDigitalInput(int pin, bool value) override {
         switch (pin) {
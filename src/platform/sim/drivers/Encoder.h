@@ -34,6 +34,14 @@ public:
         return true;
     }
 
+    bool peekEvent(Event &event) const {
+        if (_events.empty()) {
+            return false;
+        }
+        event = _events.front();
+        return true;
+    }
+
 private:
     void writeEncoder(sim::EncoderEvent event) override {
         switch (event) {
@@ -6,12 +6,16 @@
 
 class GateOutput {
 public:
+    static constexpr int Channels = 8;
+
     GateOutput() :
         _simulator(sim::Simulator::instance())
     {}
 
     void init() {}
 
+    void process() {}
+
     void update() {
         for (int i = 0; i < 8; ++i) {
             _simulator.writeGateOutput(i, (_gates >> i) & 1);
@@ -32,6 +36,13 @@ public:
         }
     }
 
+    // the simulator has no driver task, emit scheduled gates immediately
+    void scheduleGate(int index, bool value, uint32_t timeUs) {
+        setGate(index, value);
+    }
+
+    void clearSchedule() {}
+
 private:
     sim::Simulator &_simulator;
     uint8_t _gates = 0;
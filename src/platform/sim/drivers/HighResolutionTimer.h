@@ -20,4 +20,13 @@ public:
         return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::duration<double>(current - detail::start)).count();
     }
 
+    // approximates the hardware cycle counter with nanosecond resolution
+    static uint32_t cycles() {
+        auto current = std::chrono::high_resolution_clock::now();
+
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(current - detail::start)).count();
+    }
+
+    static constexpr uint32_t CyclesPerUs = 1000;
+
 };
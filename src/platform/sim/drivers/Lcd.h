@@ -24,6 +24,11 @@ public:
         _simulator.writeLcd(_frameBuffer);
     }
 
+    // partial updates are free on the simulator, just push the full buffer
+    void draw(uint8_t *frameBuffer, int x, int y, int w, int h) {
+        draw(frameBuffer);
+    }
+
 private:
     sim::Simulator &_simulator;
     sim::FrameBuffer _frameBuffer;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "HighResolutionTimer.h"
+
 #include "core/midi/MidiMessage.h"
 
 #include "sim/Simulator.h"
@@ -12,6 +14,7 @@
 class Midi : private sim::TargetInputHandler {
 public:
     typedef std::function<bool(uint8_t)> RecvFilter;
+    typedef std::function<bool(uint8_t)> ThruFilter;
 
     Midi() :
         _simulator(sim::Simulator::instance())
@@ -26,9 +29,12 @@ public:
         return true;
     }
 
-    bool recv(MidiMessage *message) {
+    bool recv(MidiMessage *message, uint32_t *timestampUs = nullptr) {
         if (!_recvQueue.empty()) {
-            *message = _recvQueue.front();
+            *message = _recvQueue.front().message;
+            if (timestampUs) {
+                *timestampUs = _recvQueue.front().timestampUs;
+            }
             _recvQueue.pop_front();
             return true;
         }
@@ -39,18 +45,34 @@ public:
         _recvFilter = filter;
     }
 
+    void setThruFilter(ThruFilter filter) {
+        _thruFilter = filter;
+    }
+
     uint32_t rxOverflow() const { return 0; }
 
 private:
+    // received message with the time it was received
+    struct RxEvent {
+        MidiMessage message;
+        uint32_t timestampUs;
+    };
+
     void writeMidiInput(sim::MidiEvent event) {
         if (event.port == 0 && event.kind == sim::MidiEvent::Message) {
+            // the simulator exchanges whole messages, so soft-thru forwards
+            // at message granularity based on the status byte
+            if (_thruFilter && _thruFilter(event.message.status())) {
+                send(event.message);
+            }
             if (event.message.length() != 1 || !_recvFilter || !_recvFilter(event.message.status())) {
-                _recvQueue.emplace_back(event.message);
+                _recvQueue.push_back({ event.message, HighResolutionTimer::us() });
             }
         }
     }
 
     sim::Simulator &_simulator;
-    std::deque<MidiMessage> _recvQueue;
+    std::deque<RxEvent> _recvQueue;
     RecvFilter _recvFilter;
+    ThruFilter _thruFilter;
 };
@@ -2,20 +2,79 @@
 
 #include "core/Debug.h"
 
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <fstream>
 
 #include <cstring>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 
+#ifndef _WIN32
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+#endif
+
+// The sd card image is memory-mapped from the host file where possible, so
+// sector access is plain memory access backed by the host page cache instead
+// of copying the whole image on startup and writing it back on every sync.
+// Falls back to a heap buffer with explicit load/store when mapping is not
+// available.
+//
+// Sector transfers are serviced by a dedicated host I/O thread instead of
+// running on the calling thread. The caller blocks until the worker signals
+// completion, mirroring the busy-wait on the transfer in the hardware driver,
+// and the worker delays completion according to an emulated card profile
+// (fixed per-command latency plus transfer time at the profile's throughput).
+// This makes slow-card behavior (browser stalls, autosave hitches)
+// reproducible on the desktop independent of host disk speed. The profile is
+// selected with the SIM_SDCARD_PROFILE environment variable (fast, typical,
+// slow, worst); the default is fast with no added delay.
 class SdCard {
 public:
-    SdCard() :
-        _data(new uint8_t[SectorCount * SectorSize])
-    {
-        std::ifstream ifs("sdcard.iso");
-        ifs.read(reinterpret_cast<char *>(_data.get()), SectorCount * SectorSize);
+    SdCard() {
+#ifndef _WIN32
+        int fd = ::open(imagePath(), O_RDWR | O_CREAT, 0644);
+        if (fd >= 0) {
+            if (::ftruncate(fd, SectorCount * SectorSize) == 0) {
+                void *mapped = ::mmap(nullptr, SectorCount * SectorSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (mapped != MAP_FAILED) {
+                    _data = static_cast<uint8_t *>(mapped);
+                    _mapped = true;
+                }
+            }
+            ::close(fd);
+        }
+#endif
+        if (!_mapped) {
+            _buffer.reset(new uint8_t[SectorCount * SectorSize]);
+            _data = _buffer.get();
+            std::memset(_data, 0, SectorCount * SectorSize);
+            std::ifstream ifs(imagePath());
+            ifs.read(reinterpret_cast<char *>(_data), SectorCount * SectorSize);
+        }
+
+        _profile = profileFromEnv();
+        _worker = std::thread([this] () { workerLoop(); });
+    }
+
+    ~SdCard() {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _shutdown = true;
+            _requestPending.notify_all();
+        }
+        _worker.join();
+#ifndef _WIN32
+        if (_mapped) {
+            ::munmap(_data, SectorCount * SectorSize);
+        }
+#endif
     }
 
     void init() {
@@ -34,19 +93,23 @@ public:
 
     bool read(uint8_t *buf, uint32_t sector, uint8_t count) {
         ASSERT(sector >= 0 && sector + count <= SectorCount, "invalid read range");
-        memcpy(buf, &_data[sector * SectorSize], count * SectorSize);
-        return true;
+        return submitAndWait(Request::Read, buf, sector, count);
     }
 
     bool write(const uint8_t *buf, uint32_t sector, uint8_t count) {
         ASSERT(sector >= 0 && sector + count <= SectorCount, "invalid write range");
-        memcpy(&_data[sector * SectorSize], buf, count * SectorSize);
-        return true;
+        return submitAndWait(Request::Write, const_cast<uint8_t *>(buf), sector, count);
     }
 
     void sync() {
-        std::ofstream ofs("sdcard.iso");
-        ofs.write(reinterpret_cast<const char *>(_data.get()), SectorCount * SectorSize);
+#ifndef _WIN32
+        if (_mapped) {
+            ::msync(_data, SectorCount * SectorSize, MS_ASYNC);
+            return;
+        }
+#endif
+        std::ofstream ofs(imagePath());
+        ofs.write(reinterpret_cast<const char *>(_data), SectorCount * SectorSize);
         ofs.close();
     }
 
@@ -54,5 +117,102 @@ private:
     static constexpr size_t SectorCount = 1024;
     static constexpr size_t SectorSize = 512;
 
-    std::unique_ptr<uint8_t[]> _data;
+    static const char *imagePath() {
+        // overridable so multiple sim processes can run concurrently, each
+        // with its own card image
+        const char *path = std::getenv("SIM_SDCARD_IMAGE");
+        return path ? path : "sdcard.iso";
+    }
+
+    // Emulated card timing. Latency is charged once per read/write command,
+    // transfer time is derived from the payload size and the throughput.
+    struct Profile {
+        uint32_t readLatencyUs;
+        uint32_t writeLatencyUs;
+        uint32_t readBytesPerMs;
+        uint32_t writeBytesPerMs;
+    };
+
+    static Profile profileFromEnv() {
+        const char *name = std::getenv("SIM_SDCARD_PROFILE");
+        if (name) {
+            if (std::strcmp(name, "typical") == 0) {
+                // mid-range card, ~10 MB/s reads, ~5 MB/s writes
+                return Profile { 500, 1000, 10000, 5000 };
+            } else if (std::strcmp(name, "slow") == 0) {
+                // cheap card, ~2 MB/s reads, ~500 kB/s writes
+                return Profile { 2000, 10000, 2000, 500 };
+            } else if (std::strcmp(name, "worst") == 0) {
+                // pathological card, long write stalls per command
+                return Profile { 5000, 100000, 1000, 100 };
+            }
+        }
+        // fast (default): no added delay
+        return Profile { 0, 0, 0, 0 };
+    }
+
+    struct Request {
+        enum Op { Read, Write };
+        Op op;
+        uint8_t *buf;
+        uint32_t sector;
+        uint8_t count;
+        bool done;
+    };
+
+    bool submitAndWait(Request::Op op, uint8_t *buf, uint32_t sector, uint8_t count) {
+        Request request { op, buf, sector, count, false };
+        std::unique_lock<std::mutex> lock(_mutex);
+        _requests.emplace_back(&request);
+        _requestPending.notify_all();
+        _requestDone.wait(lock, [&request] () { return request.done; });
+        return true;
+    }
+
+    void workerLoop() {
+        for (;;) {
+            Request *request;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _requestPending.wait(lock, [this] () { return _shutdown || !_requests.empty(); });
+                if (_shutdown) {
+                    break;
+                }
+                request = _requests.front();
+                _requests.pop_front();
+            }
+
+            size_t bytes = size_t(request->count) * SectorSize;
+            uint32_t delayUs;
+            if (request->op == Request::Read) {
+                std::memcpy(request->buf, &_data[request->sector * SectorSize], bytes);
+                delayUs = _profile.readLatencyUs + (_profile.readBytesPerMs ? bytes * 1000 / _profile.readBytesPerMs : 0);
+            } else {
+                std::memcpy(&_data[request->sector * SectorSize], request->buf, bytes);
+                delayUs = _profile.writeLatencyUs + (_profile.writeBytesPerMs ? bytes * 1000 / _profile.writeBytesPerMs : 0);
+            }
+
+            if (delayUs > 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(delayUs));
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                request->done = true;
+                _requestDone.notify_all();
+            }
+        }
+    }
+
+    uint8_t *_data = nullptr;
+    bool _mapped = false;
+    std::unique_ptr<uint8_t[]> _buffer;
+
+    Profile _profile;
+    std::thread _worker;
+    std::mutex _mutex;
+    std::condition_variable _requestPending;
+    std::condition_variable _requestDone;
+    std::deque<Request *> _requests;
+    bool _shutdown = false;
 };
@@ -0,0 +1,27 @@
+#include "TraceOutput.h"
+
+#include "HighResolutionTimer.h"
+
+static const char *TraceFilename = "trace.bin";
+static constexpr uint32_t FlushInterval = 256;
+
+FILE *TraceOutput::_file = nullptr;
+uint32_t TraceOutput::_pending = 0;
+
+void TraceOutput::init() {
+    _file = fopen(TraceFilename, "wb");
+}
+
+void TraceOutput::write(uint32_t record) {
+    if (!_file) {
+        return;
+    }
+
+    uint32_t data[2] = { HighResolutionTimer::us(), record };
+    fwrite(data, sizeof(data), 1, _file);
+
+    if (++_pending >= FlushInterval) {
+        fflush(_file);
+        _pending = 0;
+    }
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+// Writes trace records to a file in the working directory. Each record is
+// prefixed with a microsecond timestamp, matching the information the ITM
+// timestamp packets provide on the hardware.
+class TraceOutput {
+public:
+    static void init();
+    static void write(uint32_t record);
+
+private:
+    static FILE *_file;
+    static uint32_t _pending;
+};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "HighResolutionTimer.h"
+
 #include "core/midi/MidiMessage.h"
 
 #include "sim/Simulator.h"
@@ -29,9 +31,12 @@ public:
         return true;
     }
 
-    bool recv(MidiMessage *message) {
+    bool recv(MidiMessage *message, uint32_t *timestampUs = nullptr) {
         if (!_recvQueue.empty()) {
-            *message = _recvQueue.front();
+            *message = _recvQueue.front().message;
+            if (timestampUs) {
+                *timestampUs = _recvQueue.front().timestampUs;
+            }
             _recvQueue.pop_front();
             return true;
         }
@@ -68,17 +73,23 @@ private:
                 break;
             case sim::MidiEvent::Message:
                 if (event.message.length() != 1 || !_recvFilter || !_recvFilter(event.message.status())) {
-                    _recvQueue.emplace_back(event.message);
+                    _recvQueue.push_back({ event.message, HighResolutionTimer::us() });
                 }
                 break;
             }
         }
     }
 
+    // received message with the time it was received
+    struct RxEvent {
+        MidiMessage message;
+        uint32_t timestampUs;
+    };
+
     ConnectHandler _connectHandler;
     DisconnectHandler _disconnectHandler;
     RecvFilter _recvFilter;
 
     sim::Simulator &_simulator;
-    std::deque<MidiMessage> _recvQueue;
+    std::deque<RxEvent> _recvQueue;
 };
@@ -14,6 +14,29 @@ namespace os {
 
     typedef int TaskHandle;
 
+    class TaskProfiler {
+    public:
+        struct TaskStats {
+            const char *name;
+            uint32_t stackSize;
+            uint32_t stackUsage;
+            uint32_t cpuUsage;
+        };
+
+        struct MemoryStats {
+            uint32_t ramUsed;
+            uint32_t ramTotal;
+            uint32_t ccmUsed;
+            uint32_t ccmTotal;
+        };
+
+        static void dump() {}
+
+        static size_t captureTaskStats(TaskStats *stats, size_t maxCount) { return 0; }
+
+        static void captureMemoryStats(MemoryStats &stats) { stats = MemoryStats(); }
+    };
+
     template<size_t StackSize>
     class Task {
     public:
@@ -152,6 +152,21 @@ struct Writer : public WriterBase {
     }
 };
 
+template<typename T>
+static uint32_t lastItemTime(const T &trace, uint32_t time) {
+    return trace.items().empty() ? time : std::max(time, trace.items().back().first);
+}
+
+uint32_t TargetTrace::lastInputTime() const {
+    uint32_t time = 0;
+    time = lastItemTime(button, time);
+    time = lastItemTime(adc, time);
+    time = lastItemTime(digitalInput, time);
+    time = lastItemTime(encoder, time);
+    time = lastItemTime(midiInput, time);
+    return time;
+}
+
 void TargetTrace::writeStream(std::ostream &stream) const {
     button.writeStream(stream);
     adc.writeStream(stream);
@@ -131,6 +131,9 @@ struct TargetTrace {
     MidiTrace midiInput;
     MidiTrace midiOutput;
 
+    // time of the last recorded input item, used to size replay runs
+    uint32_t lastInputTime() const;
+
     void writeStream(std::ostream &stream) const;
     void readStream(std::istream &stream);
 
@@ -54,6 +54,7 @@ int Frontend::main(int argc, char *argv[]) {
     args::ArgumentParser parser("PER|FORMER Simulator", "");
     args::HelpFlag help(parser, "help", "Display this help menu", { 'h', "help" });
     args::Flag showMidiPorts(parser, "midi", "Show available MIDI ports", { 'm', "midi" });
+    args::ValueFlag<std::string> record(parser, "file", "Record input events to a trace file", { 'r', "record" });
 
     try {
         parser.ParseCLI(argc, argv);
@@ -71,10 +72,17 @@ int Frontend::main(int argc, char *argv[]) {
         return 0;
     }
 
-
+    if (record) {
+        _recordFilename = args::get(record);
+    }
 
     run();
 
+    if (_inputRecorder) {
+        _inputTrace.saveToFile(_recordFilename);
+        std::cout << "input trace written to '" << _recordFilename << "'" << std::endl;
+    }
+
     return 0;
 }
 
@@ -167,6 +175,15 @@ void Frontend::setup() {
 
     _simulator.registerTargetInputObserver(this);
     _simulator.registerTargetOutputObserver(this);
+
+    // Record all input events (buttons, encoder, cv inputs, digital inputs,
+    // midi) with virtual timestamps, so an interactive session can be replayed
+    // headlessly (sequencer --headless --replay FILE) to reproduce UI stalls.
+    if (!_recordFilename.empty()) {
+        _inputRecorder.reset(new TargetTraceRecorder(_inputTrace));
+        _simulator.registerTargetTickObserver(_inputRecorder.get());
+        _simulator.registerTargetInputObserver(_inputRecorder.get());
+    }
 }
 
 void Frontend::setupWindow() {
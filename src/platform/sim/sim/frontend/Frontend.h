@@ -16,6 +16,8 @@
 #include "widgets/Jack.h"
 
 #include "sim/Simulator.h"
+#include "sim/TargetTrace.h"
+#include "sim/TargetTraceRecorder.h"
 
 #include <string>
 #include <vector>
@@ -83,6 +85,10 @@ private:
 
     std::unique_ptr<ClockSource> _clockSource;
 
+    std::string _recordFilename;
+    TargetTrace _inputTrace;
+    std::unique_ptr<TargetTraceRecorder> _inputRecorder;
+
     Window::Ptr _window;
     Encoder::Ptr _encoder;
     Display::Ptr _lcd;
@@ -1,9 +1,30 @@
 #include "Midi.h"
 
 #include <algorithm>
+#include <chrono>
+
+#ifndef _WIN32
+# include <pthread.h>
+#endif
 
 namespace sim {
 
+// Midi I/O runs off the main loop: RtMidi delivers incoming messages on its
+// own backend thread, which pushes them into a lock-free ring buffer drained
+// by update(), and outgoing messages go through a second ring buffer drained
+// by a dedicated send thread. The send thread requests realtime priority
+// where the host allows it, so sim-based midi latency measurements are not
+// skewed by the frame-rate-coupled main loop.
+
+static void requestRealtimePriority(std::thread &thread) {
+#ifndef _WIN32
+    sched_param param;
+    param.sched_priority = (sched_get_priority_min(SCHED_FIFO) + sched_get_priority_max(SCHED_FIFO)) / 2;
+    // fails without the proper privileges, which is fine
+    pthread_setschedparam(thread.native_handle(), SCHED_FIFO, &param);
+#endif
+}
+
 template<typename T>
 static int findPort(T &midi, const std::string &port) {
     for (size_t i = 0; i < midi.getPortCount(); ++i) {
@@ -24,20 +45,22 @@ static void errorCallback(RtMidiError::Type type, const std::string &errorText,
     port.notifyError();
 }
 
-bool Midi::Port::send(uint8_t data) {
-    if (_output.isPortOpen()) {
-        std::vector<uint8_t> message = { data };
-        _output.sendMessage(&message);
-        return true;
-    }
+Midi::Port::~Port() {
+    stopSendThread();
+}
 
-    return false;
+bool Midi::Port::send(uint8_t data) {
+    return send(&data, 1);
 }
 
 bool Midi::Port::send(const uint8_t *data, size_t length) {
-    if (_output.isPortOpen()) {
-        std::vector<uint8_t> message(data, data + length);
-        _output.sendMessage(&message);
+    if (_sendThreadRunning && length >= 1 && length <= sizeof(RawMessage::data)) {
+        if (_sendBuffer.writable() > 0) {
+            RawMessage message;
+            message.length = length;
+            std::copy(data, data + length, message.data);
+            _sendBuffer.write(message);
+        }
         return true;
     }
 
@@ -52,10 +75,9 @@ void Midi::Port::update() {
             close();
         }
 
-        std::lock_guard<std::mutex> lock(_recvQueueMutex);
-        while (!_recvQueue.empty()) {
-            _recvHandler(_recvQueue.front());
-            _recvQueue.pop_front();
+        while (_recvBuffer.readable() > 0) {
+            RawMessage message = _recvBuffer.read();
+            _recvHandler(std::vector<uint8_t>(message.data, message.data + message.length));
         }
     }
 }
@@ -65,8 +87,47 @@ void Midi::Port::notifyError() {
 }
 
 void Midi::Port::receive(const std::vector<uint8_t> &message) {
-    std::lock_guard<std::mutex> lock(_recvQueueMutex);
-    _recvQueue.emplace_back(message);
+    // called on the RtMidi backend thread; long messages (sysex) were
+    // discarded by the receive handlers before, now they are dropped here
+    if (message.size() >= 1 && message.size() <= sizeof(RawMessage::data) && _recvBuffer.writable() > 0) {
+        RawMessage raw;
+        raw.length = message.size();
+        std::copy(message.begin(), message.end(), raw.data);
+        _recvBuffer.write(raw);
+    }
+}
+
+void Midi::Port::startSendThread() {
+    if (_sendThreadRunning) {
+        return;
+    }
+    _sendThreadRunning = true;
+    _sendThread = std::thread([this] () { sendLoop(); });
+    requestRealtimePriority(_sendThread);
+}
+
+void Midi::Port::stopSendThread() {
+    if (!_sendThreadRunning) {
+        return;
+    }
+    _sendThreadRunning = false;
+    _sendThread.join();
+}
+
+void Midi::Port::sendLoop() {
+    while (_sendThreadRunning) {
+        if (_sendBuffer.readable() > 0) {
+            RawMessage raw = _sendBuffer.read();
+            std::vector<uint8_t> message(raw.data, raw.data + raw.length);
+            try {
+                _output.sendMessage(&message);
+            } catch (RtMidiError &error) {
+                notifyError();
+            }
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
 }
 
 void Midi::Port::open() {
@@ -116,6 +177,8 @@ void Midi::Port::open() {
         return;
     }
 
+    startSendThread();
+
     if (_connectHandler) {
         _connectHandler();
     }
@@ -129,6 +192,8 @@ void Midi::Port::close() {
         return;
     }
 
+    stopSendThread();
+
     _input.closePort();
     _output.closePort();
 
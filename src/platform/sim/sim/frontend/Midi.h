@@ -2,12 +2,14 @@
 
 #include "RtMidi.h"
 
+#include "core/utils/RingBuffer.h"
+
 #include <unordered_map>
 #include <string>
 #include <memory>
 #include <functional>
-#include <deque>
-#include <mutex>
+#include <atomic>
+#include <thread>
 
 #include <cstdint>
 
@@ -35,6 +37,8 @@ public:
             DisconnectHandler disconnectHandler
         ) : _portIn(portIn), _portOut(portOut), _recvHandler(recvHandler), _connectHandler(connectHandler), _disconnectHandler(disconnectHandler) {}
 
+        ~Port();
+
         bool isOpen() const { return _open; }
 
         bool send(uint8_t data);
@@ -46,9 +50,20 @@ public:
         void receive(const std::vector<uint8_t> &message);
 
     private:
+        // Short midi messages in wire format, fixed size so they can pass
+        // through the lock-free ring buffers by value.
+        struct RawMessage {
+            uint8_t length;
+            uint8_t data[3];
+        };
+
         void open();
         void close();
 
+        void startSendThread();
+        void stopSendThread();
+        void sendLoop();
+
         std::string _portIn;
         std::string _portOut;
         RecvHandler _recvHandler;
@@ -62,8 +77,13 @@ public:
         bool _firstOpenAttempt = true;
         bool _error = false;
 
-        std::deque<std::vector<uint8_t>> _recvQueue;
-        std::mutex _recvQueueMutex;
+        // RtMidi callback thread -> main loop
+        RingBuffer<RawMessage, 128> _recvBuffer;
+        // main loop -> send thread
+        RingBuffer<RawMessage, 128> _sendBuffer;
+
+        std::thread _sendThread;
+        std::atomic<bool> _sendThreadRunning{false};
     };
 
     Midi();
@@ -1,10 +1,16 @@
 #include "Synth.h"
 
+#include <algorithm>
+
 #include <cstdint>
 #include <cmath>
 
 namespace sim {
 
+// audio is rendered in blocks; control inputs are sampled once per block and
+// the per-sample loops below are branch-free so the compiler can vectorize them
+static constexpr int BlockSize = 128;
+
 static float flushDenormal(float value) {
     return ((((*(uint32_t *) &(value))) & 0x7f800000) == 0) ? 0.f : value;
 }
@@ -31,25 +37,38 @@ public:
         _increment = frequency / _sampleRate;
     }
 
-    inline float process() {
-        float result = 0.f;
+    void processBlock(float *out, int count) {
+        // unwrapped phase for the whole block, wrapped per sample so the
+        // shaping loops below stay branch-free
+        float phase = _phase;
+        for (int i = 0; i < count; ++i) {
+            out[i] = phase - std::floor(phase);
+            phase += _increment;
+        }
+        _phase = phase - std::floor(phase);
+
         switch (_waveform) {
         case Sine:
-            result = std::sin(TWO_PI * _phase);
+            for (int i = 0; i < count; ++i) {
+                out[i] = std::sin(TWO_PI * out[i]);
+            }
             break;
         case Triangle:
-            result = 1.f - std::abs(_phase * 4.f - 2.f);
+            for (int i = 0; i < count; ++i) {
+                out[i] = 1.f - std::abs(out[i] * 4.f - 2.f);
+            }
             break;
         case Sawtooth:
-            result = _phase * 2.f - 1.f;
+            for (int i = 0; i < count; ++i) {
+                out[i] = out[i] * 2.f - 1.f;
+            }
             break;
         case Square:
-            result = _phase < 0.5f ? -1.f : 1.f;
+            for (int i = 0; i < count; ++i) {
+                out[i] = out[i] < 0.5f ? -1.f : 1.f;
+            }
             break;
         }
-
-        _phase = std::fmod(_phase + _increment, 1.f);
-        return result;
     }
 
 private:
@@ -94,7 +113,9 @@ public:
         _k = 2.f - 2.f * _resonance;
     }
 
-    inline float process(float input) {
+    void processBlock(float *buffer, int count) {
+        // coefficients only depend on the control inputs, compute them once
+        // per block instead of once per sample
         float a1 = 1.f / (1.f + _g * (_g + _k));
         float a2 = _g * a1;
         float a3 = _g * a2;
@@ -114,19 +135,21 @@ public:
             break;
         }
 
-        flushDenormal(input);
-
-        float v0 = input;
-        float v3 = v0 - _ic2eq;
-        float v1 = a1 * _ic1eq + a2 * v3;
-        float v2 = _ic2eq + a2 * _ic1eq + a3 * v3;
-        _ic1eq = 2.f * v1 - _ic1eq;
-        _ic2eq = 2.f * v2 - _ic2eq;
-
-        flushDenormal(_ic1eq);
-        flushDenormal(_ic2eq);
+        float ic1eq = _ic1eq;
+        float ic2eq = _ic2eq;
+
+        for (int i = 0; i < count; ++i) {
+            float v0 = buffer[i];
+            float v3 = v0 - ic2eq;
+            float v1 = a1 * ic1eq + a2 * v3;
+            float v2 = ic2eq + a2 * ic1eq + a3 * v3;
+            ic1eq = 2.f * v1 - ic1eq;
+            ic2eq = 2.f * v2 - ic2eq;
+            buffer[i] = m0 * v0 + m1 * v1 + m2 * v2;
+        }
 
-        return m0 * v0 + m1 * v1 + m2 * v2;
+        _ic1eq = flushDenormal(ic1eq);
+        _ic2eq = flushDenormal(ic2eq);
     }
 
 private:
@@ -166,6 +189,13 @@ public:
         _gate = gate;
     }
 
+    void processBlock(float *out, int count) {
+        for (int i = 0; i < count; ++i) {
+            out[i] = process();
+        }
+    }
+
+private:
     inline float process() {
         switch (_state) {
         case Idle:
@@ -216,7 +246,6 @@ public:
         return _value;
     }
 
-private:
     float _invSampleRate;
     float _attack;
     float _decay;
@@ -256,8 +285,13 @@ public:
         _osc.setFrequency(BaseFrequency * std::exp2(cv));
     }
 
-    inline float process() {
-        return _filter.process(_osc.process()) * _envVolume.process() * _gain;
+    void processBlock(float *out, int count) {
+        _osc.processBlock(out, count);
+        _filter.processBlock(out, count);
+        _envVolume.processBlock(_env, count);
+        for (int i = 0; i < count; ++i) {
+            out[i] *= _env[i] * _gain;
+        }
     }
 
 private:
@@ -267,6 +301,7 @@ private:
     Filter _filter;
     ADSR _envVolume;
     float _gain = 0.3f;
+    float _env[BlockSize];
 };
 
 
@@ -281,12 +316,13 @@ SynthInstance::~SynthInstance() {
 }
 
 void SynthInstance::getAudio(float *aBuffer, unsigned int aSamples) {
-    for (size_t i = 0; i < aSamples; ++i) {
-        if (i % 128 == 0) {
-            _voice->setGate(_synth._gate);
-            _voice->setCv(_synth._cv);
-        }
-        aBuffer[i] = _voice->process();
+    unsigned int offset = 0;
+    while (offset < aSamples) {
+        int count = std::min(int(aSamples - offset), BlockSize);
+        _voice->setGate(_synth._gate);
+        _voice->setCv(_synth._cv);
+        _voice->processBlock(aBuffer + offset, count);
+        offset += count;
     }
 }
 
@@ -5,6 +5,7 @@
 #include "nanovg.h"
 
 #include <cstdint>
+#include <cstring>
 
 namespace sim {
 
@@ -16,8 +17,11 @@ public:
         Widget(pos, size),
         _resolution(resolution),
         _color(color),
-        _frameBuffer(new uint32_t[resolution.prod()])
+        _frameBuffer(new uint8_t[resolution.prod()]),
+        _rgbaBuffer(new uint32_t[resolution.prod()])
     {
+        std::memset(_frameBuffer.get(), 0, _resolution.prod());
+        updatePalette();
     }
 
     const Vector2i &resolution() { return _resolution; }
@@ -26,12 +30,9 @@ public:
           Color &color()       { return _color; }
 
     void draw(const uint8_t *frameBuffer) {
-        const uint8_t *src = frameBuffer;
-        uint32_t *dst = _frameBuffer.get();
-        for (int i = 0; i < _resolution.prod(); ++i) {
-            float s = std::min(uint8_t(15), *src++) * (1.f / 15.f);
-            *dst++ = Color(s * _color.r(), s * _color.g(), s * _color.b(), 1.f).rgba();
-        }
+        // called at engine rate, just latch the 4bpp frame buffer and defer
+        // palette expansion to render() where only presented frames pay for it
+        std::memcpy(_frameBuffer.get(), frameBuffer, _resolution.prod());
         _frameBufferDirty = true;
     }
 
@@ -40,18 +41,27 @@ public:
 
     virtual void render(Renderer &renderer) override {
         auto nvg = renderer.nvg();
-        const uint8_t *frameBuffer = reinterpret_cast<uint8_t *>(_frameBuffer.get());
+
+        if (_frameBufferDirty) {
+            const uint8_t *src = _frameBuffer.get();
+            uint32_t *dst = _rgbaBuffer.get();
+            for (int i = 0; i < _resolution.prod(); ++i) {
+                *dst++ = _palette[std::min(uint8_t(15), *src++)];
+            }
+        }
+
+        const uint8_t *pixels = reinterpret_cast<uint8_t *>(_rgbaBuffer.get());
 
         // update texture
         if (_image == -1) {
-            _image = nvgCreateImageRGBA(nvg, _resolution.x(), _resolution.y(), 0 /*NVG_IMAGE_NEAREST*/, frameBuffer);
+            _image = nvgCreateImageRGBA(nvg, _resolution.x(), _resolution.y(), 0 /*NVG_IMAGE_NEAREST*/, pixels);
             _pattern = nvgImagePattern(nvg, _pos.x(), _pos.y(), _size.x(), _size.y(), 0.f, _image, 1.f);;
         } else {
             if (_frameBufferDirty) {
-                nvgUpdateImage(nvg, _image, frameBuffer);
-                _frameBufferDirty = false;
+                nvgUpdateImage(nvg, _image, pixels);
             }
         }
+        _frameBufferDirty = false;
 
 		nvgBeginPath(nvg);
         nvgRect(nvg, _pos.x(), _pos.y(), _size.x(), _size.y());
@@ -63,9 +73,18 @@ public:
     }
 
 private:
+    void updatePalette() {
+        for (int i = 0; i < 16; ++i) {
+            float s = i * (1.f / 15.f);
+            _palette[i] = Color(s * _color.r(), s * _color.g(), s * _color.b(), 1.f).rgba();
+        }
+    }
+
     Vector2i _resolution;
     Color _color;
-    std::unique_ptr<uint32_t[]> _frameBuffer;
+    std::unique_ptr<uint8_t[]> _frameBuffer;
+    std::unique_ptr<uint32_t[]> _rgbaBuffer;
+    uint32_t _palette[16];
     bool _frameBufferDirty = true;
     int _image = -1;
     NVGpaint _pattern;
@@ -45,8 +45,9 @@ void vAssertCalled( const char * const pcFileName, unsigned long ulLine );
 #define configUSE_MALLOC_FAILED_HOOK            0
 
 /* Run time and task stats gathering related definitions. */
-#define configGENERATE_RUN_TIME_STATS           CONFIG_ENABLE_TASK_PROFILER
-#define configUSE_TRACE_FACILITY                CONFIG_ENABLE_TASK_PROFILER
+/* always enabled to feed the task monitor page, cost is a single timer read per context switch */
+#define configGENERATE_RUN_TIME_STATS           1
+#define configUSE_TRACE_FACILITY                1
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 
 /* Co-routine related definitions. */
@@ -81,7 +82,7 @@ void vAssertCalled( const char * const pcFileName, unsigned long ulLine );
 #define INCLUDE_xTaskGetSchedulerState          1
 #define INCLUDE_xTaskGetCurrentTaskHandle       1
 #define INCLUDE_uxTaskGetStackHighWaterMark     0
-#define INCLUDE_xTaskGetIdleTaskHandle          CONFIG_ENABLE_TASK_PROFILER
+#define INCLUDE_xTaskGetIdleTaskHandle          1
 #define INCLUDE_xTimerGetTimerDaemonTaskHandle  0
 #define INCLUDE_pcTaskGetTaskName               0
 #define INCLUDE_eTaskGetState                   0
@@ -90,6 +91,12 @@ void vAssertCalled( const char * const pcFileName, unsigned long ulLine );
 
 /* A header file that defines trace macro can be included here. */
 
+/* Task switch hook feeding the event tracing facility, see core/profiler/Trace.h */
+#if CONFIG_ENABLE_TRACE
+void traceTaskSwitchedIn(unsigned uxTaskNumber);
+#define traceTASK_SWITCHED_IN() traceTaskSwitchedIn(pxCurrentTCB->uxTCBNumber)
+#endif /* CONFIG_ENABLE_TRACE */
+
 /* Definitions that map FreeRTOS Port interrupts to libopencm3 vectors */
 /* If you need to handle these yourself, comment these out and be sure to call them */
 #define vPortSVCHandler sv_call_handler
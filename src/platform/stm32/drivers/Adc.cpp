@@ -40,12 +40,12 @@ void Adc::init() {
 
     dma_stream_reset(DMA2, DMA_STREAM0);
     dma_set_peripheral_address(DMA2, DMA_STREAM0, reinterpret_cast<uint32_t>(&ADC_DR(ADC1)));
-    dma_set_memory_address(DMA2, DMA_STREAM0, reinterpret_cast<uint32_t>(_channels));
+    dma_set_memory_address(DMA2, DMA_STREAM0, reinterpret_cast<uint32_t>(_buffer));
     dma_enable_memory_increment_mode(DMA2, DMA_STREAM0);
     dma_set_peripheral_size(DMA2, DMA_STREAM0, DMA_SxCR_PSIZE_16BIT);
     dma_set_memory_size(DMA2, DMA_STREAM0, DMA_SxCR_MSIZE_16BIT);
     dma_set_priority(DMA2, DMA_STREAM0, DMA_SxCR_PL_LOW);
-    dma_set_number_of_data(DMA2, DMA_STREAM0, Channels);
+    dma_set_number_of_data(DMA2, DMA_STREAM0, Oversample * Channels);
     dma_enable_circular_mode(DMA2, DMA_STREAM0);
     dma_set_transfer_mode(DMA2, DMA_STREAM0, DMA_SxCR_DIR_PERIPHERAL_TO_MEM);
     dma_channel_select(DMA2, DMA_STREAM0, DMA_SxCR_CHSEL_0);
@@ -8,13 +8,20 @@
 class Adc {
 public:
     static constexpr int Channels = CONFIG_ADC_CHANNELS;
+    // number of scans captured in the circular DMA buffer and averaged in
+    // channel(), the F4 has no hardware oversampling
+    static constexpr int Oversample = 8;
 
     void init();
 
     uint16_t channel(int index) const {
-        return _channels[index];
+        uint32_t sum = 0;
+        for (int i = 0; i < Oversample; ++i) {
+            sum += _buffer[i * Channels + index];
+        }
+        return sum / Oversample;
     }
 
 private:
-    uint16_t _channels[Channels];
+    uint16_t _buffer[Oversample * Channels];
 };
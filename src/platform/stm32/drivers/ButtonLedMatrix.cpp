@@ -14,6 +14,7 @@ ButtonLedMatrix::ButtonLedMatrix(ShiftRegister &shiftRegister, bool invertLeds)
 void ButtonLedMatrix::init() {
     std::memset(_buttonState, 0, sizeof(_buttonState));
     std::memset(_ledState, 0, sizeof(_ledState));
+    std::memset(_buttonRowState, 0, sizeof(_buttonRowState));
 }
 
 void ButtonLedMatrix::process() {
@@ -37,14 +38,26 @@ void ButtonLedMatrix::process() {
     if (first) {
         first = false;
     } else {
-        uint8_t scanRow = (_row + 6) % Rows;
-        for (int col = 0; col < ColsButton; ++col) {
-            int buttonIndex = col * Rows + scanRow;
-            auto &state = _buttonState[buttonIndex].state;
-            bool newState = !(buttonData & (1 << col));
-            if (newState != state) {
-                state = newState;
-                _events.write(Event(state ? Event::KeyDown : Event::KeyUp, buttonIndex));
+        // button data is picked up one scan later now that the shift
+        // register transfer runs asynchronously (row latch -> load ->
+        // dma pickup spans three scans)
+        uint8_t scanRow = (_row + 5) % Rows;
+        // debounce all columns of the row in parallel (buttons are active low)
+        uint8_t debounced = _buttonDebouncer[scanRow].debounce(uint8_t(~buttonData));
+        uint8_t changed = (debounced ^ _buttonRowState[scanRow]) & ((1 << ColsButton) - 1);
+        if (changed) {
+            _buttonRowState[scanRow] = debounced;
+            for (int col = 0; col < ColsButton; ++col) {
+                if (changed & (1 << col)) {
+                    int buttonIndex = col * Rows + scanRow;
+                    bool newState = (debounced >> col) & 1;
+                    _buttonState[buttonIndex].state = newState;
+                    // only enqueue while there is room, a full ring must not
+                    // be written to or its index invariant breaks
+                    if (_events.writable()) {
+                        _events.write(Event(newState ? Event::KeyDown : Event::KeyUp, buttonIndex));
+                    }
+                }
             }
         }
     }
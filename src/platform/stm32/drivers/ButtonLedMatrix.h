@@ -111,6 +111,11 @@ private:
     ButtonState _buttonState[Rows * ColsButton];
     LedState _ledState[Rows * ColsLed];
 
+    // each row is sampled every Rows ms, a single counter bit makes a state
+    // change take two consecutive samples which spans typical contact bounce
+    VerticalDebouncer<uint8_t, 1> _buttonDebouncer[Rows];
+    uint8_t _buttonRowState[Rows];
+
     RingBuffer<Event, 16> _events;
 
     uint8_t _row = 0;
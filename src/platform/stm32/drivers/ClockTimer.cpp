@@ -3,6 +3,7 @@
 #include "SystemConfig.h"
 
 #include "core/Debug.h"
+#include "core/profiler/Trace.h"
 
 #include "os/os.h"
 
@@ -58,10 +59,12 @@ void ClockTimer::setListener(Listener *listener) {
 }
 
 void tim5_isr() {
+    Trace::event(Trace::IsrEnter, NVIC_TIM5_IRQ);
     if (timer_get_flag(TIM5, TIM_SR_UIF)) {
         timer_clear_flag(TIM5, TIM_SR_UIF);
         if (g_listener) {
             g_listener->onClockTimerTick();
         }
     }
+    Trace::event(Trace::IsrExit, NVIC_TIM5_IRQ);
 }
@@ -3,15 +3,58 @@
 #include "SystemConfig.h"
 
 #include "os/os.h"
-#include "core/utils/RingBuffer.h"
 
 #include <libopencm3/stm32/gpio.h>
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/usart.h>
+#include <libopencm3/stm32/dma.h>
 #include <libopencm3/cm3/nvic.h>
 
 #define CONSOLE_USART USART1
 
+#define CONSOLE_DMA DMA2
+#define CONSOLE_DMA_CHANNEL DMA_SxCR_CHSEL_4
+#define CONSOLE_DMA_TX_STREAM DMA_STREAM7
+
+// transmit ring, writers never block on the usart: full buffers drop output
+// and count it instead of stalling the calling task
+static char txBuffer[1024];
+static volatile uint32_t txRead;
+static volatile uint32_t txWrite;
+static volatile uint32_t txPending;
+static volatile uint32_t txActive;
+static volatile uint32_t txDropped;
+
+// starts transmission of the contiguous span up to the write position or the
+// buffer wrap around, called with interrupts locked or from the dma interrupt
+static void startTx() {
+    uint32_t read = txRead;
+    uint32_t write = txWrite;
+    if (read == write) {
+        txActive = 0;
+        return;
+    }
+    txActive = 1;
+
+    uint32_t length = (write > read ? write : sizeof(txBuffer)) - read;
+    txPending = length;
+
+    dma_stream_reset(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM);
+    dma_set_peripheral_address(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM, reinterpret_cast<uint32_t>(&USART_DR(CONSOLE_USART)));
+    dma_set_memory_address(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM, reinterpret_cast<uint32_t>(&txBuffer[read]));
+    dma_set_number_of_data(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM, length);
+    dma_channel_select(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM, CONSOLE_DMA_CHANNEL);
+    dma_set_transfer_mode(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM, DMA_SxCR_DIR_MEM_TO_PERIPHERAL);
+    dma_set_memory_size(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM, DMA_SxCR_MSIZE_8BIT);
+    dma_set_peripheral_size(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM, DMA_SxCR_PSIZE_8BIT);
+    dma_enable_memory_increment_mode(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM);
+    dma_disable_peripheral_increment_mode(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM);
+    dma_enable_transfer_complete_interrupt(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM);
+    dma_enable_stream(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM);
+
+    usart_enable_tx_dma(CONSOLE_USART);
+}
+
 void Console::init() {
     // setup GPIO pins
     rcc_periph_clock_enable(RCC_GPIOA);
@@ -28,8 +71,12 @@ void Console::init() {
     usart_set_flow_control(CONSOLE_USART, USART_FLOWCONTROL_NONE);
     usart_enable(CONSOLE_USART);
 
-    nvic_set_priority(NVIC_USART1_IRQ, CONFIG_CONSOLE_IRQ_PRIORITY);
-    nvic_enable_irq(NVIC_USART1_IRQ);
+    // transmit through dma in buffer sized chunks instead of one interrupt
+    // per byte
+    rcc_periph_clock_enable(RCC_DMA2);
+    dma_stream_reset(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM);
+    nvic_set_priority(NVIC_DMA2_STREAM7_IRQ, CONFIG_CONSOLE_IRQ_PRIORITY);
+    nvic_enable_irq(NVIC_DMA2_STREAM7_IRQ);
 }
 
 void Console::write(char c) {
@@ -57,38 +104,49 @@ void Console::write(const std::string &s) {
     }
 }
 
-static RingBuffer<char, 128> txBuffer;
-static volatile uint32_t txActive;
+void Console::writeRaw(const char *s, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        send(s[i]);
+    }
+}
+
+void Console::flush() {
+    while (txActive) {}
+    while (!(USART_SR(CONSOLE_USART) & USART_SR_TC)) {}
+}
+
+uint32_t Console::dropped() {
+    return txDropped;
+}
 
 void Console::send(char c) {
     os::InterruptLock lock;
 
-    // block until there is space in the tx buffer
-    while (txBuffer.full()) {
-        usart_wait_send_ready(CONSOLE_USART);
-        usart_send(CONSOLE_USART, txBuffer.read());
+    uint32_t write = txWrite;
+    uint32_t next = (write + 1) % sizeof(txBuffer);
+    if (next == txRead) {
+        // never block the calling task on the usart
+        ++txDropped;
+        return;
     }
 
-    txBuffer.write(c);
+    txBuffer[write] = c;
+    txWrite = next;
 
     // start transmission if necessary
     if (!txActive) {
-        txActive = 1;
-        usart_wait_send_ready(CONSOLE_USART);
-        usart_send(CONSOLE_USART, txBuffer.read());
-        usart_enable_tx_interrupt(CONSOLE_USART);
+        startTx();
     }
 }
 
-void usart1_isr() {
-    os::InterruptLock lock;
-    if (usart_get_flag(CONSOLE_USART, USART_SR_TXE)) {
-        if (txBuffer.empty()) {
-            usart_disable_tx_interrupt(CONSOLE_USART);
-            txActive = 0;
-        } else {
-            usart_send(CONSOLE_USART, txBuffer.read());
-        }
+void dma2_stream7_isr() {
+    if (dma_get_interrupt_flag(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM, DMA_TCIF)) {
+        dma_clear_interrupt_flags(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM, DMA_TCIF);
+        dma_disable_stream(CONSOLE_DMA, CONSOLE_DMA_TX_STREAM);
+        usart_disable_tx_dma(CONSOLE_USART);
+
+        txRead = (txRead + txPending) % sizeof(txBuffer);
+        startTx();
     }
 }
 
@@ -11,6 +11,15 @@ public:
     static void write(const char *s, size_t length);
     static void write(const std::string &s);
 
+    // writes bytes without newline translation, for binary frames
+    static void writeRaw(const char *s, size_t length);
+
+    // blocks until all buffered output has been transmitted
+    static void flush();
+
+    // number of characters dropped because the transmit buffer was full
+    static uint32_t dropped();
+
 private:
     static void send(char c);
 };
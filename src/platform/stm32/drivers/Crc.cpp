@@ -0,0 +1,17 @@
+#include "Crc.h"
+
+#include "os/os.h"
+
+static os::Mutex mutex;
+
+void Crc::init() {
+    rcc_periph_clock_enable(RCC_CRC);
+}
+
+void Crc::claim() {
+    mutex.take();
+}
+
+void Crc::release() {
+    mutex.give();
+}
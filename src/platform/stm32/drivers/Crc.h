@@ -0,0 +1,29 @@
+#pragma once
+
+#include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/crc.h>
+
+#include <cstdint>
+
+// Wrapper for the CRC calculation unit (CRC-32/MPEG-2 over 32-bit words).
+// The unit holds a single computation state, so it has to be claimed for the
+// duration of a streaming computation.
+class Crc {
+public:
+    static void init();
+
+    static void claim();
+    static void release();
+
+    static void reset() {
+        crc_reset();
+    }
+
+    static void process(uint32_t word) {
+        CRC_DR = word;
+    }
+
+    static uint32_t result() {
+        return CRC_DR;
+    }
+};
@@ -4,12 +4,18 @@
 
 #include "core/Debug.h"
 
+#include <libopencm3/cm3/nvic.h>
 #include <libopencm3/stm32/gpio.h>
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/spi.h>
+#include <libopencm3/stm32/dma.h>
 
 #define DAC_SPI SPI3
 
+#define DAC_DMA DMA1
+#define DAC_DMA_CHANNEL DMA_SxCR_CHSEL_0
+#define DAC_DMA_STREAM DMA_STREAM5
+
 #define DAC_PORT GPIOB
 #define DAC_SYNC GPIO0
 
@@ -23,6 +29,36 @@
 #define RESET_POWER_ON                  7
 #define SETUP_INTERNAL_REF              8
 
+// one 32-bit command frame per channel, the DAC8568 frames on SYNC so each
+// frame is sent as an individual DMA transfer chained from the completion
+// interrupt of the previous one
+static uint8_t frameBuffer[Dac::Channels][4];
+static volatile uint32_t frameIndex;
+static volatile uint32_t writeDone = 1;
+
+static void startFrame() {
+    gpio_clear(DAC_PORT, DAC_SYNC);
+    hal::Delay::delay_ns<13>(); // t5 in timing diagram
+
+    dma_stream_reset(DAC_DMA, DAC_DMA_STREAM);
+    dma_set_peripheral_address(DAC_DMA, DAC_DMA_STREAM, reinterpret_cast<uint32_t>(&SPI_DR(DAC_SPI)));
+    dma_set_memory_address(DAC_DMA, DAC_DMA_STREAM, reinterpret_cast<uint32_t>(frameBuffer[frameIndex]));
+    dma_set_number_of_data(DAC_DMA, DAC_DMA_STREAM, sizeof(frameBuffer[0]));
+    dma_channel_select(DAC_DMA, DAC_DMA_STREAM, DAC_DMA_CHANNEL);
+    // the DAC shares the DMA controller with the LCD, CV updates must win
+    // the arbitration against a display flush
+    dma_set_priority(DAC_DMA, DAC_DMA_STREAM, DMA_SxCR_PL_VERY_HIGH);
+    dma_set_transfer_mode(DAC_DMA, DAC_DMA_STREAM, DMA_SxCR_DIR_MEM_TO_PERIPHERAL);
+    dma_set_memory_size(DAC_DMA, DAC_DMA_STREAM, DMA_SxCR_MSIZE_8BIT);
+    dma_set_peripheral_size(DAC_DMA, DAC_DMA_STREAM, DMA_SxCR_PSIZE_8BIT);
+    dma_enable_memory_increment_mode(DAC_DMA, DAC_DMA_STREAM);
+    dma_disable_peripheral_increment_mode(DAC_DMA, DAC_DMA_STREAM);
+    dma_enable_transfer_complete_interrupt(DAC_DMA, DAC_DMA_STREAM);
+    dma_enable_stream(DAC_DMA, DAC_DMA_STREAM);
+
+    spi_enable_tx_dma(DAC_SPI);
+}
+
 void Dac::init() {
 
     // init spi pins
@@ -47,6 +83,12 @@ void Dac::init() {
     spi_enable_ss_output(DAC_SPI);
     spi_enable(DAC_SPI);
 
+    // init dma
+    rcc_periph_clock_enable(RCC_DMA1);
+    dma_stream_reset(DAC_DMA, DAC_DMA_STREAM);
+    nvic_set_priority(NVIC_DMA1_STREAM5_IRQ, CONFIG_DAC_IRQ_PRIORITY);
+    nvic_enable_irq(NVIC_DMA1_STREAM5_IRQ);
+
     // init gpio
     rcc_periph_clock_enable(RCC_GPIOB);
     gpio_mode_setup(DAC_PORT, GPIO_MODE_OUTPUT, GPIO_PUPD_NONE, DAC_SYNC);
@@ -65,12 +107,36 @@ void Dac::write(int channel) {
 }
 
 void Dac::write() {
+    // wait for a previous burst to finish (normally finished long before
+    // the next call)
+    while (!writeDone) {}
+
+    // write input registers channel by channel, update all outputs with the
+    // last frame
     for (int channel = 0; channel < Channels; ++channel) {
-        writeDac(channel == 7 ? WRITE_INPUT_REGISTER_UPDATE_ALL : WRITE_INPUT_REGISTER, channel, _values[channel], 0);
+        uint8_t command = channel == Channels - 1 ? WRITE_INPUT_REGISTER_UPDATE_ALL : WRITE_INPUT_REGISTER;
+        uint16_t data = _values[channel];
+        auto frame = frameBuffer[channel];
+        frame[0] = command;
+        frame[1] = (channel << 4) | (data >> 12);
+        frame[2] = data >> 4;
+        frame[3] = (data & 0xf) << 4;
     }
+
+    frameIndex = 0;
+    writeDone = 0;
+
+    startFrame();
+}
+
+bool Dac::writeFinished() const {
+    return writeDone;
 }
 
 void Dac::writeDac(uint8_t command, uint8_t address, uint16_t data, uint8_t function) {
+    // don't interleave with an asynchronous write() burst
+    while (!writeDone) {}
+
     uint8_t b1 = command;
     uint8_t b2 = (address << 4) | (data >> 12);
     uint8_t b3 = data >> 4;
@@ -94,6 +160,27 @@ void Dac::writeDac(uint8_t command, uint8_t address, uint16_t data, uint8_t func
     hal::Delay::delay_ns<80>(); // t4 in timing diagram
 }
 
+void dma1_stream5_isr(void) {
+    if (dma_get_interrupt_flag(DAC_DMA, DAC_DMA_STREAM, DMA_TCIF)) {
+        dma_clear_interrupt_flags(DAC_DMA, DAC_DMA_STREAM, DMA_TCIF);
+        dma_disable_stream(DAC_DMA, DAC_DMA_STREAM);
+        spi_disable_tx_dma(DAC_SPI);
+
+        // wait for the last byte to be shifted out, then close the frame
+        while (SPI_SR(DAC_SPI) & SPI_SR_BSY);
+        hal::Delay::delay_ns<200>(); // t8 in timing diagram, see writeDac
+        gpio_set(DAC_PORT, DAC_SYNC);
+        hal::Delay::delay_ns<80>(); // t4 in timing diagram
+
+        frameIndex = frameIndex + 1;
+        if (frameIndex < Dac::Channels) {
+            startFrame();
+        } else {
+            writeDone = 1;
+        }
+    }
+}
+
 void Dac::reset() {
     writeDac(RESET_POWER_ON, 0, 0, 0);
     hal::Delay::delay_us(50);
@@ -18,8 +18,14 @@ public:
     }
 
     void write(int channel);
+
+    // writes all channels in one burst, returns immediately while the
+    // transfer runs in the background
     void write();
 
+    // returns true once the last write() burst has reached the DAC
+    bool writeFinished() const;
+
 private:
     void writeDac(uint8_t command, uint8_t address, uint16_t data, uint8_t function);
 
@@ -1,10 +1,16 @@
 #include "Dio.h"
 
+#include "Encoder.h"
 #include "SystemConfig.h"
 
 #include <libopencm3/cm3/nvic.h>
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/exti.h>
+#include <libopencm3/stm32/timer.h>
+
+// generates the falling edge of the clock output pulse, armed as a one-shot
+// on each rising edge
+#define PULSE_TIMER TIM3
 
 static Dio *g_dio;
 
@@ -28,6 +34,28 @@ void Dio::init() {
     exti_select_source(EXTI10 | EXTI11, GPIOB);
     exti_set_trigger(EXTI10 | EXTI11, EXTI_TRIGGER_BOTH);
     exti_enable_request(EXTI10 | EXTI11);
+
+    // clock output pulse timer, counting microseconds
+    rcc_periph_clock_enable(RCC_TIM3);
+    nvic_set_priority(NVIC_TIM3_IRQ, CONFIG_DIO_IRQ_PRIORITY);
+    nvic_enable_irq(NVIC_TIM3_IRQ);
+    rcc_periph_reset_pulse(RST_TIM3);
+
+    timer_disable_preload(PULSE_TIMER);
+    timer_one_shot_mode(PULSE_TIMER);
+    timer_set_prescaler(PULSE_TIMER, (rcc_apb1_frequency * 2) / 1000000 - 1);
+}
+
+void Dio::clockOutputPulse(uint32_t widthUs) {
+    clockOutput.set(true);
+
+    // restart the pulse timer, superseding a pulse still in flight
+    timer_disable_counter(PULSE_TIMER);
+    timer_set_period(PULSE_TIMER, widthUs - 1);
+    timer_set_counter(PULSE_TIMER, 0);
+    timer_clear_flag(PULSE_TIMER, TIM_SR_UIF);
+    timer_enable_irq(PULSE_TIMER, TIM_DIER_UIE);
+    timer_enable_counter(PULSE_TIMER);
 }
 
 void exti15_10_isr(void) {
@@ -39,4 +67,16 @@ void exti15_10_isr(void) {
         g_dio->clockInput.interrupt();
         exti_reset_request(EXTI11);
     }
+    // the encoder's quadrature inputs on PC13/PC14 share this vector
+    if (exti_get_flag_status(EXTI13 | EXTI14)) {
+        exti_reset_request(EXTI13 | EXTI14);
+        Encoder::interrupt();
+    }
+}
+
+void tim3_isr(void) {
+    if (timer_get_flag(PULSE_TIMER, TIM_SR_UIF)) {
+        timer_clear_flag(PULSE_TIMER, TIM_SR_UIF);
+        g_dio->clockOutput.set(false);
+    }
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "HighResolutionTimer.h"
+
 #include <libopencm3/stm32/gpio.h>
 
 #include <functional>
@@ -8,7 +10,9 @@ class Dio {
 public:
     template<uint32_t Port, uint32_t Pin>
     struct Input {
-        typedef std::function<void(bool)> Handler;
+        // called from interrupt context with the pin state and the
+        // HighResolutionTimer timestamp captured at the edge
+        typedef std::function<void(bool, uint32_t)> Handler;
 
         void init() {
             gpio_mode_setup(Port, GPIO_MODE_INPUT, GPIO_PUPD_NONE, Pin);
@@ -22,9 +26,10 @@ public:
         void setHandler(Handler handler) { _handler = handler; }
 
         void interrupt() {
+            uint32_t timestampUs = HighResolutionTimer::us();
             update();
             if (_handler) {
-                _handler(_state);
+                _handler(_state, timestampUs);
             }
         }
 
@@ -61,4 +66,9 @@ public:
 
     Output<GPIOB, GPIO2> clockOutput;
     Output<GPIOB, GPIO1> resetOutput;
+
+    // raises the clock output and arms a hardware one-shot timer that lowers
+    // it again after widthUs microseconds, so the pulse width stays stable no
+    // matter when the next clock interrupt gets serviced
+    void clockOutputPulse(uint32_t widthUs);
 };
@@ -1,5 +1,9 @@
 #include "Encoder.h"
 
+#include "os/os.h"
+
+#include <libopencm3/cm3/nvic.h>
+#include <libopencm3/stm32/exti.h>
 #include <libopencm3/stm32/gpio.h>
 #include <libopencm3/stm32/rcc.h>
 
@@ -31,13 +35,27 @@ static const uint8_t encoderStateTable[7][4] = {
     {   CCW2,   CCW3,   Start,  Start | CCW },  // CCW3
 };
 
+static Encoder *g_encoder = nullptr;
+
 Encoder::Encoder(bool reverse) :
     _reverse(reverse)
 {}
 
 void Encoder::init() {
+    g_encoder = this;
+
     rcc_periph_clock_enable(RCC_GPIOC);
     gpio_mode_setup(ENC_PORT, GPIO_MODE_INPUT, GPIO_PUPD_PULLUP, ENC_GPIO);
+
+    // decode quadrature transitions from edge interrupts, polling at the
+    // driver task rate misses transitions on fast spins
+    rcc_periph_clock_enable(RCC_SYSCFG);
+    exti_select_source(EXTI13 | EXTI14, ENC_PORT);
+    exti_set_trigger(EXTI13 | EXTI14, EXTI_TRIGGER_BOTH);
+    exti_enable_request(EXTI13 | EXTI14);
+    // the EXTI15_10 vector is shared with the DIN clock/reset inputs, its
+    // handler lives in Dio.cpp and the DIO driver owns the vector priority
+    nvic_enable_irq(NVIC_EXTI15_10_IRQ);
 }
 
 void Encoder::process() {
@@ -45,20 +63,36 @@ void Encoder::process() {
     bool switchState = _switchDebouncer.debounce(!gpio_get(ENC_PORT, ENC_SWITCH));
     if (switchState != _switchState) {
         _switchState = switchState;
-        _events.write(switchState ? Event::Down : Event::Up);
+        // the rotation interrupt writes to the same event queue
+        os::InterruptLock lock;
+        if (_events.writable()) {
+            _events.write(switchState ? Event::Down : Event::Up);
+        }
     }
+}
 
+void Encoder::handleIrq() {
     uint8_t encoderBits =
         ((gpio_get(ENC_PORT, ENC_A) ? 1 : 0)) |
         ((gpio_get(ENC_PORT, ENC_B) ? 1 : 0) << 1);
 
     _encoderState = encoderStateTable[_encoderState][encoderBits];
 
+    // when the ui task stalls long enough to fill the queue, drop steps
+    // instead of writing into a full ring and breaking its index invariant
     if (_encoderState & CW) {
-        _events.write(_reverse ? Event::Right : Event::Left);
+        if (_events.writable()) {
+            _events.write(_reverse ? Event::Right : Event::Left);
+        }
     } else if (_encoderState & CCW) {
-        _events.write(_reverse ? Event::Left : Event::Right);
+        if (_events.writable()) {
+            _events.write(_reverse ? Event::Left : Event::Right);
+        }
     }
 
     _encoderState &= 0xf;
 }
+
+void Encoder::interrupt() {
+    g_encoder->handleIrq();
+}
@@ -22,6 +22,10 @@ public:
 
     void process();
 
+    // edge interrupt entry, dispatched from the shared EXTI15_10 vector
+    // handler in Dio.cpp
+    static void interrupt();
+
     inline bool nextEvent(Event &event) {
         if (_events.readable() < 1) {
             return false;
@@ -30,7 +34,17 @@ public:
         return true;
     }
 
+    inline bool peekEvent(Event &event) const {
+        if (_events.readable() < 1) {
+            return false;
+        }
+        event = Event(_events.front());
+        return true;
+    }
+
 private:
+    void handleIrq();
+
     bool _reverse;
 
     RingBuffer<uint8_t, 32> _events;
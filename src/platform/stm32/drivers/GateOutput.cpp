@@ -1,4 +1,5 @@
 #include "GateOutput.h"
+#include "HighResolutionTimer.h"
 
 GateOutput::GateOutput(ShiftRegister &shiftRegister) :
     _shiftRegister(shiftRegister)
@@ -10,3 +11,44 @@ void GateOutput::init() {
 void GateOutput::update() {
     _shiftRegister.write(2, _gates);
 }
+
+void GateOutput::process() {
+    if (_clearScheduled) {
+        for (auto &queue : _scheduled) {
+            while (!queue.empty()) {
+                queue.read();
+            }
+        }
+        _clearScheduled = false;
+        return;
+    }
+
+    uint32_t timeUs = HighResolutionTimer::us();
+    uint8_t gates = _gates;
+
+    for (int i = 0; i < Channels; ++i) {
+        auto &queue = _scheduled[i];
+        while (!queue.empty() && int32_t(timeUs - queue.front().timeUs) >= 0) {
+            if (queue.read().value) {
+                gates |= (1 << i);
+            } else {
+                gates &= ~(1 << i);
+            }
+        }
+    }
+
+    if (gates != _gates) {
+        _gates = gates;
+        update();
+    }
+}
+
+void GateOutput::scheduleGate(int index, bool value, uint32_t timeUs) {
+    auto &queue = _scheduled[index];
+    if (queue.full()) {
+        // never block the engine task, emit immediately instead
+        setGate(index, value);
+        return;
+    }
+    queue.write({ timeUs, uint8_t(value) });
+}
@@ -2,16 +2,30 @@
 
 #include "ShiftRegister.h"
 
+#include "core/utils/RingBuffer.h"
+
 #include <cstdint>
 
 class GateOutput {
 public:
+    static constexpr int Channels = 8;
+
     GateOutput(ShiftRegister &shiftRegister);
 
     void init();
 
     void update();
 
+    // applies scheduled gate changes that are due, called from the driver task
+    void process();
+
+    // schedules a gate change at an absolute HighResolutionTimer timestamp,
+    // emitted from the driver task on the first scan after the timestamp
+    void scheduleGate(int index, bool value, uint32_t timeUs);
+
+    // discards all scheduled gate changes
+    void clearSchedule() { _clearScheduled = true; }
+
     inline uint8_t gates() const { return _gates; }
 
     inline void setGates(uint8_t gates) {
@@ -27,6 +41,13 @@ public:
     }
 
 private:
+    struct Edge {
+        uint32_t timeUs;
+        uint8_t value;
+    };
+
     ShiftRegister &_shiftRegister;
     uint8_t _gates = 0;
+    RingBuffer<Edge, 4> _scheduled[Channels];
+    volatile bool _clearScheduled = false;
 };
@@ -2,6 +2,12 @@
 
 #include "SystemConfig.h"
 
+#include "core/profiler/SamplingProfiler.h"
+
+#if CONFIG_ENABLE_SAMPLING_PROFILER
+# include "os/os.h"
+#endif
+
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/timer.h>
 #include <libopencm3/cm3/nvic.h>
@@ -13,6 +19,9 @@
 volatile uint32_t HighResolutionTimer::_ticks;
 
 void HighResolutionTimer::init() {
+    // enable the DWT cycle counter
+    dwt_enable_cycle_counter();
+
     rcc_periph_clock_enable(RCC_TIM2);
     nvic_set_priority(NVIC_TIM2_IRQ, CONFIG_HIGHRES_IRQ_PRIORITY);
     nvic_enable_irq(NVIC_TIM2_IRQ);
@@ -31,10 +40,31 @@ void HighResolutionTimer::init() {
     timer_enable_counter(TIMER);
 }
 
+#if CONFIG_ENABLE_SAMPLING_PROFILER
+// prime interval so samples drift through the phase of the 1 ms periodic tasks
+static constexpr uint32_t SampleIntervalUs = 997;
+static uint32_t sampleCountdown = SampleIntervalUs;
+#endif
+
 void tim2_isr() {
     if (timer_get_flag(TIMER, TIM_SR_UIF)) {
         timer_clear_flag(TIMER, TIM_SR_UIF);
         HighResolutionTimer::tick();
+#if CONFIG_ENABLE_SAMPLING_PROFILER
+        if (--sampleCountdown == 0) {
+            sampleCountdown = SampleIntervalUs;
+            // program counter of the interrupted thread from its stacked
+            // exception frame on the process stack
+            uint32_t psp;
+            asm volatile ("mrs %0, psp" : "=r" (psp));
+            uint32_t pc = reinterpret_cast<const uint32_t *>(psp)[6];
+            // only reads the current task pointer, safe from interrupt context
+            void *task = xTaskGetCurrentTaskHandle();
+            if (task) {
+                SamplingProfiler::sample(task, pc);
+            }
+        }
+#endif // CONFIG_ENABLE_SAMPLING_PROFILER
     }
 }
 
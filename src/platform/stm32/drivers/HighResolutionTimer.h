@@ -1,5 +1,9 @@
 #pragma once
 
+#include "SystemConfig.h"
+
+#include <libopencm3/cm3/dwt.h>
+
 #include <cstdint>
 
 class HighResolutionTimer {
@@ -10,6 +14,13 @@ public:
         return _ticks;
     }
 
+    // free running CPU cycle counter for timing sub-microsecond sections
+    static inline uint32_t cycles() {
+        return DWT_CYCCNT;
+    }
+
+    static constexpr uint32_t CyclesPerUs = CONFIG_CPU_FREQUENCY / 1000000;
+
     static inline void tick() {
         ++_ticks;
     }
@@ -11,6 +11,7 @@
 #include <libopencm3/stm32/dma.h>
 
 #include <cmath>
+#include <cstring>
 #include <algorithm>
 
 #define LCD_PORT GPIOB
@@ -123,39 +124,97 @@ void Lcd::init() {
     initialize();
 }
 
-void Lcd::draw(uint8_t *frameBuffer) {
+void Lcd::draw(uint8_t *frameBuffer, int x, int y, int w, int h) {
+    // clamp to the display and align the column window to the 4 pixel
+    // segment granularity of the controller
+    int x0 = std::max(0, x) & ~3;
+    int x1 = std::min(Width, ((x + w) + 3) & ~3);
+    int y0 = std::max(0, y);
+    int y1 = std::min(Height, y + h);
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    // until the display content is known, transfer the full frame once
+    bool force = !_shadowValid;
+    if (force) {
+        x0 = 0;
+        x1 = Width;
+        y0 = 0;
+        y1 = Height;
+    }
+
+    // pack the region into the shadow buffer (2 pixels per byte) and find
+    // the tightest window of 4 pixel column groups that actually changed
+    // since the last transfer (this overlaps with the previous transfer
+    // still going on in the background)
+    uint16_t *shadow = reinterpret_cast<uint16_t *>(_shadowBuffer);
+    int g0 = x1 / 4, g1 = x0 / 4 - 1;
+    int r0 = y1 - 1, r1 = y0;
+    for (int row = y0; row < y1; ++row) {
+        const uint8_t *src = &frameBuffer[row * Width + x0];
+        uint16_t *dst = &shadow[row * (Width / 4) + x0 / 4];
+        for (int group = x0 / 4; group < x1 / 4; ++group) {
+            uint16_t packed =
+                (std::min(src[1], uint8_t(15)) | (std::min(src[0], uint8_t(15)) << 4)) |
+                ((std::min(src[3], uint8_t(15)) | (std::min(src[2], uint8_t(15)) << 4)) << 8);
+            src += 4;
+            if (packed != *dst) {
+                *dst = packed;
+                g0 = std::min(g0, group);
+                g1 = std::max(g1, group);
+                r0 = std::min(r0, row);
+                r1 = std::max(r1, row);
+            }
+            ++dst;
+        }
+    }
+
+    if (force) {
+        g0 = x0 / 4;
+        g1 = x1 / 4 - 1;
+        r0 = y0;
+        r1 = y1 - 1;
+        _shadowValid = true;
+    } else if (g0 > g1) {
+        // nothing changed
+        return;
+    }
+
 #ifdef LCD_USE_DMA
     // wait until previous frame is sent
     while (!txDone) {}
     txDone = 0;
 #endif // LCD_USE_DMA
 
-    // copy buffer
-    uint8_t *src = frameBuffer;
+    // copy the changed window into a contiguous transfer buffer
+    int groupWidth = g1 - g0 + 1;
     uint8_t *dst = reinterpret_cast<uint8_t *>(_frameBuffer);
-    for (int i = 0; i < Width * Height / 2; ++i) {
-        uint8_t a = *src++;
-        uint8_t b = *src++;
-        *dst++ = std::min(b, uint8_t(15)) | (std::min(a, uint8_t(15)) << 4);
-        // *dst++ = (b >> 4) | ((a >> 4) << 4);
+    for (int row = r0; row <= r1; ++row) {
+        const uint8_t *src = reinterpret_cast<const uint8_t *>(_shadowBuffer) + row * (Width / 2) + g0 * 2;
+        std::memcpy(dst, src, groupWidth * 2);
+        dst += groupWidth * 2;
     }
 
+    size_t transferSize = groupWidth * 2 * (r1 - r0 + 1);
 
-#ifdef LCD_USE_DMA
-
-    setColAddr(0x1c,0x5b);
-    setRowAddr(0x00,0x3f);
+    setColAddr(0x1c + g0, 0x1c + g1);
+    setRowAddr(r0, r1);
     setWrite();
 
+#ifdef LCD_USE_DMA
+
     waitTxDone();
     gpio_set(LCD_PORT, LCD_DC);
 
     dma_stream_reset(LCD_DMA, LCD_DMA_STREAM);
     dma_set_peripheral_address(LCD_DMA, LCD_DMA_STREAM, reinterpret_cast<uint32_t>(&LCD_SPI_DR));
     dma_set_memory_address(LCD_DMA, LCD_DMA_STREAM, reinterpret_cast<uint32_t>(_frameBuffer));
-    dma_set_number_of_data(LCD_DMA, LCD_DMA_STREAM, sizeof(_frameBuffer));
+    dma_set_number_of_data(LCD_DMA, LCD_DMA_STREAM, transferSize);
     dma_channel_select(LCD_DMA, LCD_DMA_STREAM, LCD_DMA_CHANNEL);
-    dma_set_priority(LCD_DMA, LCD_DMA_STREAM, DMA_SxCR_PL_HIGH);
+    // display transfers yield the DMA controller to the DAC stream, a big
+    // flush must never delay a CV update
+    dma_set_priority(LCD_DMA, LCD_DMA_STREAM, DMA_SxCR_PL_LOW);
 
     dma_set_transfer_mode(LCD_DMA, LCD_DMA_STREAM, DMA_SxCR_DIR_MEM_TO_PERIPHERAL);
     dma_set_memory_size(LCD_DMA, LCD_DMA_STREAM, DMA_SxCR_MSIZE_8BIT);
@@ -172,15 +231,9 @@ void Lcd::draw(uint8_t *frameBuffer) {
 
 #else // LCD_USE_DMA
 
-    setColAddr(0x1c,0x5b);
-    setRowAddr(0x00,0x3f);
-    setWrite();
-
-    src = reinterpret_cast<uint8_t *>(_frameBuffer);
-    for (int y = 0; y < Height; y++) {
-        for (int x = 0; x < Width/2; x++) {
-            sendData(*src++);
-        }
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(_frameBuffer);
+    for (size_t i = 0; i < transferSize; ++i) {
+        sendData(*src++);
     }
 
 #endif // LCD_USE_DMA
@@ -12,7 +12,14 @@ public:
 
     void init();
 
-    void draw(uint8_t *frameBuffer);
+    void draw(uint8_t *frameBuffer) {
+        draw(frameBuffer, 0, 0, Width, Height);
+    }
+
+    // transfer only the given rectangle to the display, the column window is
+    // aligned to the 4 pixel segment granularity of the controller and
+    // further shrunk to the pixels that changed since the last transfer
+    void draw(uint8_t *frameBuffer, int x, int y, int w, int h);
 
 private:
     void sendCmd(uint8_t cmd);
@@ -25,4 +32,8 @@ private:
     void setWrite();
 
     uint32_t _frameBuffer[Width * Height / 8];
+    // packed copy of the display content used to diff frames and skip
+    // transferring unchanged pixels
+    uint32_t _shadowBuffer[Width * Height / 8];
+    bool _shadowValid = false;
 };
@@ -1,5 +1,6 @@
 #include "Midi.h"
 
+#include "HighResolutionTimer.h"
 #include "SystemConfig.h"
 
 #include "os/os.h"
@@ -7,10 +8,19 @@
 #include <libopencm3/stm32/gpio.h>
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/usart.h>
+#include <libopencm3/stm32/dma.h>
 #include <libopencm3/cm3/nvic.h>
 
 #define MIDI_USART USART6
 
+#define MIDI_DMA DMA2
+#define MIDI_DMA_CHANNEL DMA_SxCR_CHSEL_5
+#define MIDI_DMA_RX_STREAM DMA_STREAM1
+
+// circular dma reception buffer, drained on idle line and buffer high-water
+// interrupts instead of one interrupt per received byte
+static uint8_t dmaRxBuffer[64];
+
 static Midi *g_midi = nullptr;
 
 void Midi::init() {
@@ -31,13 +41,42 @@ void Midi::init() {
     usart_set_flow_control(MIDI_USART, USART_FLOWCONTROL_NONE);
     usart_enable(MIDI_USART);
 
-    usart_enable_rx_interrupt(MIDI_USART);
+    // receive into the circular dma buffer
+    rcc_periph_clock_enable(RCC_DMA2);
+    dma_stream_reset(MIDI_DMA, MIDI_DMA_RX_STREAM);
+    dma_set_peripheral_address(MIDI_DMA, MIDI_DMA_RX_STREAM, reinterpret_cast<uint32_t>(&USART_DR(MIDI_USART)));
+    dma_set_memory_address(MIDI_DMA, MIDI_DMA_RX_STREAM, reinterpret_cast<uint32_t>(dmaRxBuffer));
+    dma_set_number_of_data(MIDI_DMA, MIDI_DMA_RX_STREAM, sizeof(dmaRxBuffer));
+    dma_channel_select(MIDI_DMA, MIDI_DMA_RX_STREAM, MIDI_DMA_CHANNEL);
+    dma_set_transfer_mode(MIDI_DMA, MIDI_DMA_RX_STREAM, DMA_SxCR_DIR_PERIPHERAL_TO_MEM);
+    dma_set_memory_size(MIDI_DMA, MIDI_DMA_RX_STREAM, DMA_SxCR_MSIZE_8BIT);
+    dma_set_peripheral_size(MIDI_DMA, MIDI_DMA_RX_STREAM, DMA_SxCR_PSIZE_8BIT);
+    dma_enable_memory_increment_mode(MIDI_DMA, MIDI_DMA_RX_STREAM);
+    dma_disable_peripheral_increment_mode(MIDI_DMA, MIDI_DMA_RX_STREAM);
+    dma_enable_circular_mode(MIDI_DMA, MIDI_DMA_RX_STREAM);
+    // high-water interrupts at the half way point and on wrap around
+    dma_enable_half_transfer_interrupt(MIDI_DMA, MIDI_DMA_RX_STREAM);
+    dma_enable_transfer_complete_interrupt(MIDI_DMA, MIDI_DMA_RX_STREAM);
+    dma_enable_stream(MIDI_DMA, MIDI_DMA_RX_STREAM);
+    usart_enable_rx_dma(MIDI_USART);
+
+    // idle line interrupt flushes partially filled buffers
+    USART_CR1(MIDI_USART) |= USART_CR1_IDLEIE;
 
     nvic_set_priority(NVIC_USART6_IRQ, CONFIG_MIDI_IRQ_PRIORITY);
     nvic_enable_irq(NVIC_USART6_IRQ);
+    nvic_set_priority(NVIC_DMA2_STREAM1_IRQ, CONFIG_MIDI_IRQ_PRIORITY);
+    nvic_enable_irq(NVIC_DMA2_STREAM1_IRQ);
 }
 
 bool Midi::send(const MidiMessage &message) {
+    // single byte realtime messages go through the priority lane so clock
+    // timing does not depend on how much data is queued ahead of them
+    if (message.isRealTimeMessage()) {
+        sendRealTime(message.status());
+        return true;
+    }
+
     for (uint8_t i = 0; i < message.length(); ++i) {
         send(message.raw()[i]);
     }
@@ -45,58 +84,131 @@ bool Midi::send(const MidiMessage &message) {
     return true;
 }
 
-bool Midi::recv(MidiMessage *message) {
-    while (!_rxBuffer.empty()) {
-        if (_midiParser.feed(_rxBuffer.read())) {
-            *message = _midiParser.message();
-            return true;
-        }
+bool Midi::recv(MidiMessage *message, uint32_t *timestampUs) {
+    if (_rxBuffer.empty()) {
+        return false;
     }
-    return false;
+    auto rx = _rxBuffer.read();
+    *message = rx.message;
+    if (timestampUs) {
+        *timestampUs = rx.timestampUs;
+    }
+    return true;
 }
 
 void Midi::setRecvFilter(RecvFilter filter) {
     _recvFilter = filter;
 }
 
+void Midi::setThruFilter(ThruFilter filter) {
+    os::InterruptLock lock;
+    _thruFilter = filter;
+}
+
 void Midi::send(uint8_t data) {
     os::InterruptLock lock;
 
     // block until there is space in the tx buffer
     while (_txBuffer.full()) {
         usart_wait_send_ready(MIDI_USART);
-        usart_send(MIDI_USART, _txBuffer.read());
+        txSendNext();
     }
 
     _txBuffer.write(data);
+    txStart();
+}
+
+void Midi::sendRealTime(uint8_t data) {
+    os::InterruptLock lock;
+
+    // drop the byte when even the priority lane is backed up, blocking here
+    // would defeat its purpose
+    if (_rtTxBuffer.full()) {
+        return;
+    }
 
+    _rtTxBuffer.write(data);
+    txStart();
+}
+
+void Midi::sendThru(uint8_t data) {
+    // already called with interrupts locked from the rx drain, forward
+    // realtime bytes through the priority lane and drop everything else when
+    // the tx buffer is backed up, blocking at interrupt priority is not an
+    // option
+    if (MidiMessage::isRealTimeMessage(data)) {
+        if (!_rtTxBuffer.full()) {
+            _rtTxBuffer.write(data);
+            txStart();
+        }
+        return;
+    }
+
+    if (!_txBuffer.full()) {
+        _txBuffer.write(data);
+        txStart();
+    }
+}
+
+void Midi::txStart() {
     // start transmission if necessary
     if (!_txActive) {
         _txActive = 1;
         usart_wait_send_ready(MIDI_USART);
-        usart_send(MIDI_USART, _txBuffer.read());
+        txSendNext();
         usart_enable_tx_interrupt(MIDI_USART);
     }
 }
 
+void Midi::txSendNext() {
+    // realtime bytes preempt queued data, the spec allows inserting them in
+    // the middle of another message
+    usart_send(MIDI_USART, _rtTxBuffer.empty() ? _txBuffer.read() : _rtTxBuffer.read());
+}
+
 void Midi::handleIrq() {
     os::InterruptLock lock;
     if (usart_get_flag(MIDI_USART, USART_SR_TXE)) {
-        if (_txBuffer.empty()) {
+        if (_rtTxBuffer.empty() && _txBuffer.empty()) {
             usart_disable_tx_interrupt(MIDI_USART);
             _txActive = 0;
         } else {
-            usart_send(MIDI_USART, _txBuffer.read());
+            txSendNext();
         }
     }
-    if (usart_get_flag(MIDI_USART, USART_SR_RXNE)) {
-        uint8_t data = usart_recv(MIDI_USART);
-        if (!_recvFilter || !_recvFilter(data)) {
+    if (USART_SR(MIDI_USART) & USART_SR_IDLE) {
+        // idle flag is cleared by reading the status and data registers
+        usart_recv(MIDI_USART);
+        drainRxDma();
+    }
+}
+
+void Midi::handleDmaIrq() {
+    os::InterruptLock lock;
+    drainRxDma();
+}
+
+void Midi::drainRxDma() {
+    uint32_t timestampUs = HighResolutionTimer::us();
+    uint32_t pos = sizeof(dmaRxBuffer) - DMA_SNDTR(MIDI_DMA, MIDI_DMA_RX_STREAM);
+    while (_dmaRxPos != pos) {
+        uint8_t data = dmaRxBuffer[_dmaRxPos];
+        _dmaRxPos = (_dmaRxPos + 1) % sizeof(dmaRxBuffer);
+        // soft-thru forwards bytes straight from the rx drain, so latency is
+        // bounded by the dma drain interval instead of the engine update rate
+        if (_thruFilter && _thruFilter(data)) {
+            sendThru(data);
+        }
+        if (_recvFilter && _recvFilter(data)) {
+            continue;
+        }
+        if (_midiParser.feed(data)) {
             if (_rxBuffer.full()) {
                 // overflow
                 ++_rxOverflow;
+            } else {
+                _rxBuffer.write({ _midiParser.message(), timestampUs });
             }
-            _rxBuffer.write(data);
         }
     }
 }
@@ -104,3 +216,14 @@ void Midi::handleIrq() {
 void usart6_isr() {
     g_midi->handleIrq();
 }
+
+void dma2_stream1_isr() {
+    if (dma_get_interrupt_flag(MIDI_DMA, MIDI_DMA_RX_STREAM, DMA_HTIF)) {
+        dma_clear_interrupt_flags(MIDI_DMA, MIDI_DMA_RX_STREAM, DMA_HTIF);
+        g_midi->handleDmaIrq();
+    }
+    if (dma_get_interrupt_flag(MIDI_DMA, MIDI_DMA_RX_STREAM, DMA_TCIF)) {
+        dma_clear_interrupt_flags(MIDI_DMA, MIDI_DMA_RX_STREAM, DMA_TCIF);
+        g_midi->handleDmaIrq();
+    }
+}
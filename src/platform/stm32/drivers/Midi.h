@@ -11,25 +11,44 @@
 class Midi {
 public:
     typedef std::function<bool(uint8_t)> RecvFilter;
+    typedef std::function<bool(uint8_t)> ThruFilter;
 
     void init();
 
     bool send(const MidiMessage &message);
-    bool recv(MidiMessage *message);
+    bool recv(MidiMessage *message, uint32_t *timestampUs = nullptr);
 
     void setRecvFilter(RecvFilter filter);
+    void setThruFilter(ThruFilter filter);
 
     uint32_t rxOverflow() const { return _rxOverflow; }
 
     void handleIrq();
+    void handleDmaIrq();
 private:
     void send(uint8_t data);
+    void sendRealTime(uint8_t data);
+    void sendThru(uint8_t data);
+    void txStart();
+    void txSendNext();
+    void drainRxDma();
+
+    // parsed message with the time the dma buffer was drained
+    struct RxMessage {
+        MidiMessage message;
+        uint32_t timestampUs;
+    };
 
     RingBuffer<uint8_t, 64> _txBuffer;
-    RingBuffer<uint8_t, 64> _rxBuffer;
+    // priority lane for single byte realtime messages, transmitted ahead of
+    // whatever is queued in the tx buffer
+    RingBuffer<uint8_t, 8> _rtTxBuffer;
+    RingBuffer<RxMessage, 16> _rxBuffer;
+    uint32_t _dmaRxPos = 0;
     volatile uint32_t _rxOverflow = 0;
     volatile uint32_t _txActive = 0;
 
     RecvFilter _recvFilter;
+    ThruFilter _thruFilter;
     MidiParser _midiParser;
 };
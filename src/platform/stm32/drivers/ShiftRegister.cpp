@@ -5,9 +5,11 @@
 #include "core/profiler/Profiler.h"
 #include "core/Debug.h"
 
+#include <libopencm3/cm3/nvic.h>
 #include <libopencm3/stm32/gpio.h>
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/spi.h>
+#include <libopencm3/stm32/dma.h>
 
 #include <cstring>
 
@@ -21,12 +23,23 @@
 
 #define SR_SPI SPI1
 
+#define SR_DMA DMA2
+#define SR_DMA_CHANNEL DMA_SxCR_CHSEL_3
+#define SR_DMA_RX_STREAM DMA_STREAM2
+#define SR_DMA_TX_STREAM DMA_STREAM5
+
 #define SPI_PORT GPIOA
 #define SPI_SCK GPIO5
 #define SPI_MISO GPIO6
 #define SPI_MOSI GPIO7
 #define SPI_GPIO (SPI_SCK | SPI_MISO | SPI_MOSI)
 
+// DMA transfer buffers, the driver facing arrays stay stable while a
+// transfer is in flight
+static uint8_t txBuffer[ShiftRegister::NumRegisters];
+static uint8_t rxBuffer[ShiftRegister::NumRegisters];
+static volatile uint32_t transferDone = 1;
+
 ShiftRegister::ShiftRegister() {
     _outputs.fill(0u);
     _inputs.fill(0u);
@@ -51,6 +64,13 @@ void ShiftRegister::init() {
                     SPI_CR1_MSBFIRST);
     spi_enable(SR_SPI);
 
+    // init dma
+    rcc_periph_clock_enable(RCC_DMA2);
+    dma_stream_reset(SR_DMA, SR_DMA_RX_STREAM);
+    dma_stream_reset(SR_DMA, SR_DMA_TX_STREAM);
+    nvic_set_priority(NVIC_DMA2_STREAM2_IRQ, CONFIG_SR_IRQ_PRIORITY);
+    nvic_enable_irq(NVIC_DMA2_STREAM2_IRQ);
+
     // init control pins
     rcc_periph_clock_enable(RCC_GPIOC);
     gpio_mode_setup(SR_PORT, GPIO_MODE_OUTPUT, GPIO_PUPD_NONE, SR_GPIO);
@@ -66,16 +86,69 @@ void ShiftRegister::init() {
 }
 
 void ShiftRegister::process() {
+    // wait for the previous transfer to complete (normally finished long
+    // before the next call)
+    while (!transferDone) {}
+
+    // pick up the inputs captured during the previous transfer
+    std::memcpy(_inputs.data(), rxBuffer, NumRegisters);
+
     // trigger load line
     gpio_clear(SR_PORT, SR_LOAD);
     gpio_set(SR_PORT, SR_LOAD);
 
-    // transfer data
+    // registers are daisy chained, transfer output data in reverse order
     for (int sr = 0; sr < NumRegisters; ++sr) {
-        _inputs[sr] = spi_xfer(SR_SPI, _outputs[NumRegisters - sr - 1]);
+        txBuffer[sr] = _outputs[NumRegisters - sr - 1];
     }
 
-    // trigger latch line
-    gpio_set(SR_PORT, SR_LATCH);
-    gpio_clear(SR_PORT, SR_LATCH);
+    transferDone = 0;
+
+    // receive stream
+    dma_stream_reset(SR_DMA, SR_DMA_RX_STREAM);
+    dma_set_peripheral_address(SR_DMA, SR_DMA_RX_STREAM, reinterpret_cast<uint32_t>(&SPI_DR(SR_SPI)));
+    dma_set_memory_address(SR_DMA, SR_DMA_RX_STREAM, reinterpret_cast<uint32_t>(rxBuffer));
+    dma_set_number_of_data(SR_DMA, SR_DMA_RX_STREAM, NumRegisters);
+    dma_channel_select(SR_DMA, SR_DMA_RX_STREAM, SR_DMA_CHANNEL);
+    dma_set_transfer_mode(SR_DMA, SR_DMA_RX_STREAM, DMA_SxCR_DIR_PERIPHERAL_TO_MEM);
+    dma_set_memory_size(SR_DMA, SR_DMA_RX_STREAM, DMA_SxCR_MSIZE_8BIT);
+    dma_set_peripheral_size(SR_DMA, SR_DMA_RX_STREAM, DMA_SxCR_PSIZE_8BIT);
+    dma_enable_memory_increment_mode(SR_DMA, SR_DMA_RX_STREAM);
+    dma_disable_peripheral_increment_mode(SR_DMA, SR_DMA_RX_STREAM);
+    dma_enable_transfer_complete_interrupt(SR_DMA, SR_DMA_RX_STREAM);
+    dma_enable_stream(SR_DMA, SR_DMA_RX_STREAM);
+
+    // transmit stream
+    dma_stream_reset(SR_DMA, SR_DMA_TX_STREAM);
+    dma_set_peripheral_address(SR_DMA, SR_DMA_TX_STREAM, reinterpret_cast<uint32_t>(&SPI_DR(SR_SPI)));
+    dma_set_memory_address(SR_DMA, SR_DMA_TX_STREAM, reinterpret_cast<uint32_t>(txBuffer));
+    dma_set_number_of_data(SR_DMA, SR_DMA_TX_STREAM, NumRegisters);
+    dma_channel_select(SR_DMA, SR_DMA_TX_STREAM, SR_DMA_CHANNEL);
+    dma_set_transfer_mode(SR_DMA, SR_DMA_TX_STREAM, DMA_SxCR_DIR_MEM_TO_PERIPHERAL);
+    dma_set_memory_size(SR_DMA, SR_DMA_TX_STREAM, DMA_SxCR_MSIZE_8BIT);
+    dma_set_peripheral_size(SR_DMA, SR_DMA_TX_STREAM, DMA_SxCR_PSIZE_8BIT);
+    dma_enable_memory_increment_mode(SR_DMA, SR_DMA_TX_STREAM);
+    dma_disable_peripheral_increment_mode(SR_DMA, SR_DMA_TX_STREAM);
+    dma_enable_stream(SR_DMA, SR_DMA_TX_STREAM);
+
+    spi_enable_rx_dma(SR_SPI);
+    spi_enable_tx_dma(SR_SPI);
+}
+
+void dma2_stream2_isr(void) {
+    if (dma_get_interrupt_flag(SR_DMA, SR_DMA_RX_STREAM, DMA_TCIF)) {
+        dma_clear_interrupt_flags(SR_DMA, SR_DMA_RX_STREAM, DMA_TCIF);
+        dma_disable_stream(SR_DMA, SR_DMA_RX_STREAM);
+        dma_disable_stream(SR_DMA, SR_DMA_TX_STREAM);
+
+        spi_disable_rx_dma(SR_SPI);
+        spi_disable_tx_dma(SR_SPI);
+
+        // wait for the last byte to be shifted out, then latch the outputs
+        while (SPI_SR(SR_SPI) & SPI_SR_BSY);
+        gpio_set(SR_PORT, SR_LATCH);
+        gpio_clear(SR_PORT, SR_LATCH);
+
+        transferDone = 1;
+    }
 }
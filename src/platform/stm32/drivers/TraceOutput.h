@@ -0,0 +1,31 @@
+#pragma once
+
+#include <libopencm3/cm3/itm.h>
+#include <libopencm3/cm3/tpiu.h>
+
+#include <cstdint>
+
+// Writes 32 bit trace records to ITM stimulus port 1 (port 0 is left free
+// for console use over SWO). Records are dropped instead of waiting when the
+// stimulus FIFO is busy, so tracing never stalls the code it is observing.
+// Timestamps are attached by the ITM local timestamp packets and decoded on
+// the host.
+class TraceOutput {
+public:
+    static void init() {
+        // the ITM, TPIU and the SWO pin are configured by the debug probe,
+        // just enable local timestamping in case the probe did not
+        ITM_TCR |= ITM_TCR_TSENA;
+    }
+
+    static inline void write(uint32_t record) {
+        if ((ITM_TCR & ITM_TCR_ITMENA) && (ITM_TER[0] & (1 << Port))) {
+            if (ITM_STIM32(Port) != 0) {
+                ITM_STIM32(Port) = record;
+            }
+        }
+    }
+
+private:
+    static constexpr int Port = 1;
+};
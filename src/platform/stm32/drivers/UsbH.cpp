@@ -25,6 +25,11 @@
 
 static UsbH *g_usbh;
 
+// outgoing bulk packet, batches up to 16 usb midi events, the buffer has to
+// stay valid while the transfer is in flight
+static uint8_t midiTxPacket[64];
+static volatile bool midiTxBusy = false;
+
 static const usbh_dev_driver_t *device_drivers[] = {
 	&usbh_hub_driver,
 	&usbh_midi_driver,
@@ -52,6 +57,7 @@ struct MidiDriverHandler {
     static void disconnectHandler(int device) {
         DBG("MIDI device disconnected (id=%d)", device);
         g_usbh->midiDisconnectDevice(device);
+        midiTxBusy = false;
     }
 
     static void recvHandler(int device, uint8_t *data) {
@@ -92,18 +98,15 @@ struct MidiDriverHandler {
         }
     }
 
-    static void write(uint8_t device, MidiMessage &message) {
-        uint8_t data[4];
-
+    static void encode(uint8_t *data, const MidiMessage &message) {
         data[0] = message.status() >> 4;
         data[1] = message.status();
         data[2] = message.data0();
         data[3] = message.data1();
-
-        usbh_midi_write(device, data, 4, &writeCallback);
     }
 
     static void writeCallback(uint8_t bytes_written) {
+        midiTxBusy = false;
     }
 };
 
@@ -150,12 +153,21 @@ void UsbH::process() {
 
     usbh_poll(time_us);
 
-    // Start sending MIDI messages
-    uint8_t device;
-    MidiMessage message;
-    if (midiDequeueMessage(&device, &message)) {
-        if (midiDeviceConnected(device)) {
-            MidiDriverHandler::write(device, message);
+    // batch queued MIDI messages into one bulk packet instead of submitting
+    // one transfer per message
+    if (!midiTxBusy) {
+        uint8_t device = 0;
+        MidiMessage message;
+        uint32_t length = 0;
+        while (length + 4 <= sizeof(midiTxPacket) && midiDequeueMessage(&device, &message)) {
+            if (midiDeviceConnected(device)) {
+                MidiDriverHandler::encode(midiTxPacket + length, message);
+                length += 4;
+            }
+        }
+        if (length > 0) {
+            midiTxBusy = true;
+            usbh_midi_write(device, midiTxPacket, length, &MidiDriverHandler::writeCallback);
         }
     }
 }
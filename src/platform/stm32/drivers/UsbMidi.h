@@ -1,5 +1,7 @@
 #pragma once
 
+#include "HighResolutionTimer.h"
+
 #include "core/utils/RingBuffer.h"
 #include "core/midi/MidiMessage.h"
 
@@ -16,6 +18,15 @@ public:
     void init() {}
 
     bool send(const MidiMessage &message) {
+        // realtime messages bypass the bulk queue so they go out with the
+        // next packet ahead of buffered data
+        if (message.isRealTimeMessage()) {
+            if (_rtTxQueue.full()) {
+                return false;
+            }
+            _rtTxQueue.write(message);
+            return true;
+        }
         if (_txQueue.full()) {
             return false;
         }
@@ -23,11 +34,15 @@ public:
         return true;
     }
 
-    bool recv(MidiMessage *message) {
+    bool recv(MidiMessage *message, uint32_t *timestampUs = nullptr) {
         if (_rxQueue.empty()) {
             return false;
         }
-        *message = _rxQueue.read();
+        auto rx = _rxQueue.read();
+        *message = rx.message;
+        if (timestampUs) {
+            *timestampUs = rx.timestampUs;
+        }
         return true;
     }
 
@@ -63,7 +78,7 @@ private:
             // overflow
             ++_rxOverflow;
         }
-        _rxQueue.write(message);
+        _rxQueue.write({ message, HighResolutionTimer::us() });
     }
 
     void enqueueData(uint8_t data) {
@@ -73,6 +88,10 @@ private:
     }
 
     bool dequeueMessage(MidiMessage *message) {
+        if (!_rtTxQueue.empty()) {
+            *message = _rtTxQueue.read();
+            return true;
+        }
         if (_txQueue.empty()) {
             return false;
         }
@@ -80,12 +99,22 @@ private:
         return true;
     }
 
+    // received message with the time it was received
+    struct RxEvent {
+        MidiMessage message;
+        uint32_t timestampUs;
+    };
+
     ConnectHandler _connectHandler;
     DisconnectHandler _disconnectHandler;
     RecvFilter _recvFilter;
 
     RingBuffer<MidiMessage, 128> _txQueue;
-    RingBuffer<MidiMessage, 16> _rxQueue;
+    // priority lane for realtime messages, dequeued ahead of the bulk queue
+    RingBuffer<MidiMessage, 8> _rtTxQueue;
+    // a full speed bulk packet can carry 16 events, hold a few packets worth
+    // of messages until the engine picks them up
+    RingBuffer<RxEvent, 64> _rxQueue;
     volatile uint32_t _rxOverflow = 0;
 
     friend class UsbH;
@@ -60,6 +60,13 @@
 
 #define USBH_GP_XBOX_BUFFER		(32)
 
+// Connection settle delays in microseconds. USB 2.0 mandates 100ms of
+// attach debounce (TATTDB) and 10ms of reset recovery (TRSTRCY), the
+// driver defaults of 500ms/210ms made every (re)connect take the better
+// part of a second before enumeration even started.
+#define USBH_CONNECT_DEBOUNCE_US	(100000)
+#define USBH_RESET_RECOVERY_US		(50000)
+
 /* Sanity checks */
 #if (USBH_MAX_DEVICES > 127)
 #error USBH_MAX_DEVICES > 127
@@ -385,9 +385,8 @@ static enum USBH_POLL_STATUS poll_run(usbh_lld_stm32f4_driver_data_t *dev)
 	}
 
 	if (dev->dpstate == DEVICE_POLL_STATE_DEVCONN) {
-		// May be other condition, e.g. Debounce done,
-		// using 0.5s wait by default
-		if (dev->time_curr_us - dev->timestamp_us < 500000) {
+		// May be other condition, e.g. Debounce done
+		if (dev->time_curr_us - dev->timestamp_us < USBH_CONNECT_DEBOUNCE_US) {
 			return USBH_POLL_STATUS_NONE;
 		}
 
@@ -419,7 +418,7 @@ static enum USBH_POLL_STATUS poll_run(usbh_lld_stm32f4_driver_data_t *dev)
 	}
 
 	if (dev->dpstate == DEVICE_POLL_STATE_DEVRST) {
-		if (dev->time_curr_us - dev->timestamp_us < 210000) {
+		if (dev->time_curr_us - dev->timestamp_us < USBH_RESET_RECOVERY_US) {
 			return USBH_POLL_STATUS_NONE;
 		} else {
 			dev->dpstate = DEVICE_POLL_STATE_RUN;
@@ -4,7 +4,6 @@ namespace os {
 
 uint32_t InterruptLock::_nestedCount = 0;
 
-#if CONFIG_ENABLE_TASK_PROFILER
 TaskProfiler::TaskInfo *TaskProfiler::_taskInfos;
 TaskProfiler::TaskInfo TaskProfiler::_idleTaskInfo;
 
@@ -53,6 +52,48 @@ void TaskProfiler::dump() {
     DBG("---------------------------------------------");
 }
 
-#endif // CONFIG_ENABLE_TASK_PROFILER
+size_t TaskProfiler::captureTaskStats(TaskStats *stats, size_t maxCount) {
+    uint32_t totalRelativeRunTime = 0;
+    size_t count = 0;
+
+    enumerate([&] (TaskInfo &info) {
+        TaskStatus_t taskStatus;
+        vTaskGetInfo(info.handle, &taskStatus, pdTRUE, eRunning);
+
+        uint32_t runTimeCounter = taskStatus.ulRunTimeCounter;
+        info.relativeRunTime = runTimeCounter - info.lastRunTimeCounter;
+        info.lastRunTimeCounter = runTimeCounter;
+        totalRelativeRunTime += info.relativeRunTime;
+
+        if (count < maxCount) {
+            auto &taskStats = stats[count++];
+            taskStats.name = taskStatus.pcTaskName;
+            taskStats.stackSize = info.stackSize;
+            taskStats.stackUsage = info.stackSize - taskStatus.usStackHighWaterMark * sizeof(StackType_t);
+            taskStats.cpuUsage = info.relativeRunTime;
+        }
+    });
+
+    totalRelativeRunTime = std::max(1ul, totalRelativeRunTime / 100);
+    for (size_t i = 0; i < count; ++i) {
+        stats[i].cpuUsage /= totalRelativeRunTime;
+    }
+
+    return count;
+}
+
+// provided by the linker script
+extern "C" char _ebss;
+extern "C" char _eccmram_bss;
+extern "C" char _stack;
+
+void TaskProfiler::captureMemoryStats(MemoryStats &stats) {
+    // all allocations are static (configTOTAL_HEAP_SIZE is 0), so everything
+    // in use is accounted for by the data/bss sections ending at _ebss
+    stats.ramTotal = uint32_t(&_stack) - 0x20000000;
+    stats.ramUsed = uint32_t(&_ebss) - 0x20000000;
+    stats.ccmTotal = 64 * 1024;
+    stats.ccmUsed = uint32_t(&_eccmram_bss) - 0x10000000;
+}
 
 } // namespace os
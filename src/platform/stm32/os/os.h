@@ -3,6 +3,7 @@
 #include "SystemConfig.h"
 
 #include "core/Debug.h"
+#include "core/profiler/CriticalSectionProfiler.h"
 
 extern "C" {
 #include "FreeRTOS.h"
@@ -30,6 +31,20 @@ namespace os {
             uint32_t relativeRunTime;
         };
 
+        struct TaskStats {
+            const char *name;
+            uint32_t stackSize;     // stack size in bytes
+            uint32_t stackUsage;    // maximum stack usage in bytes
+            uint32_t cpuUsage;      // cpu usage in percent since the last capture
+        };
+
+        struct MemoryStats {
+            uint32_t ramUsed;
+            uint32_t ramTotal;
+            uint32_t ccmUsed;
+            uint32_t ccmTotal;
+        };
+
         static void registerTask(TaskInfo *taskInfo) {
             TaskInfo **tail = &_taskInfos;
             while (*tail != nullptr) {
@@ -40,6 +55,12 @@ namespace os {
 
         static void dump();
 
+        // captures statistics for all registered tasks (idle task last),
+        // returns the number of entries written
+        static size_t captureTaskStats(TaskStats *stats, size_t maxCount);
+
+        static void captureMemoryStats(MemoryStats &stats);
+
     private:
         template<typename Func>
         static void enumerate(Func func) {
@@ -48,7 +69,10 @@ namespace os {
                 func(*info);
                 info = info->next;
             }
+            // the idle task is not created through os::Task, its stack is
+            // provided by vApplicationGetIdleTaskMemory() in board.cpp
             _idleTaskInfo.handle = xTaskGetIdleTaskHandle();
+            _idleTaskInfo.stackSize = configMINIMAL_STACK_SIZE * sizeof(StackType_t);
             func(_idleTaskInfo);
         }
 
@@ -64,11 +88,9 @@ namespace os {
         {
             _handle = xTaskCreateStatic(&start, name, StackSize / sizeof(StackType_t), this, priority, _stack, &_task);
 
-#if CONFIG_ENABLE_TASK_PROFILER
             _taskInfo.handle = _handle;
             _taskInfo.stackSize = StackSize;
             TaskProfiler::registerTask(&_taskInfo);
-#endif // CONFIG_ENABLE_TASK_PROFILER
         }
 
         TaskHandle handle() const { return _handle; }
@@ -89,10 +111,7 @@ namespace os {
         StaticTask_t _task;
         StackType_t _stack[StackSize / sizeof(StackType_t)];
 
-#if CONFIG_ENABLE_TASK_PROFILER
         TaskProfiler::TaskInfo _taskInfo;
-#endif // CONFIG_ENABLE_TASK_PROFILER
-
     };
 
     inline void suspend(TaskHandle handle) { vTaskSuspend(handle); }
@@ -222,11 +241,21 @@ namespace os {
     public:
         InterruptLock() {
             cm_disable_interrupts();
-            ++_nestedCount;
+            if (++_nestedCount == 1) {
+#if CONFIG_ENABLE_PROFILER
+                CriticalSectionProfiler::enterInterruptLock();
+#endif
+            }
         }
 
         ~InterruptLock() {
             if (--_nestedCount == 0) {
+#if CONFIG_ENABLE_PROFILER
+                // interrupts are still disabled here, nested locks are
+                // attributed to the outermost call site which defines the
+                // disabled window
+                CriticalSectionProfiler::leaveInterruptLock();
+#endif
                 cm_enable_interrupts();
             }
         }
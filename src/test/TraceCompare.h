@@ -0,0 +1,63 @@
+#pragma once
+
+#include "sim/TargetTrace.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Comparison tooling for target traces captured in the headless simulator.
+// Used by timing regression tests to assert that gate/CV transitions stay
+// within a given tolerance of a reference trace or of analytically expected
+// transition times.
+
+namespace test {
+
+struct TraceCompareResult {
+    size_t itemsA = 0;
+    size_t itemsB = 0;
+    size_t stateMismatches = 0;
+    uint32_t maxTimeDelta = 0;
+
+    bool matches(uint32_t timeTolerance) const {
+        return itemsA == itemsB && stateMismatches == 0 && maxTimeDelta <= timeTolerance;
+    }
+};
+
+// compares two state traces item by item, reporting the worst timestamp
+// deviation and the number of diverging states
+template<typename Trace>
+static TraceCompareResult compareStateTrace(const Trace &a, const Trace &b) {
+    TraceCompareResult result;
+    result.itemsA = a.items().size();
+    result.itemsB = b.items().size();
+
+    size_t count = result.itemsA < result.itemsB ? result.itemsA : result.itemsB;
+    for (size_t i = 0; i < count; ++i) {
+        const auto &itemA = a.items()[i];
+        const auto &itemB = b.items()[i];
+        if (!(itemA.second == itemB.second)) {
+            ++result.stateMismatches;
+        }
+        uint32_t delta = itemA.first > itemB.first ? itemA.first - itemB.first : itemB.first - itemA.first;
+        if (delta > result.maxTimeDelta) {
+            result.maxTimeDelta = delta;
+        }
+    }
+
+    return result;
+}
+
+// calls func(time) for every item where the given gate channel goes high
+template<typename Func>
+static void forEachGateRisingEdge(const sim::GateOutputTrace &trace, int channel, Func func) {
+    bool last = false;
+    for (const auto &item : trace.items()) {
+        bool value = item.second.state.test(channel);
+        if (value && !last) {
+            func(item.first);
+        }
+        last = value;
+    }
+}
+
+} // namespace test
@@ -154,6 +154,57 @@ namespace test {
         expectEqual(a, const_cast<const char *>(b), location, msg);
     }
 
+    // Performance assertions
+    //
+    // measureDuration() calls a function a few times to warm caches and
+    // branch predictors, then measures several repetitions with the cycle
+    // counter. The assertion uses the minimum, which is the least noisy
+    // statistic on a preemptive host; min/avg/max are printed for context.
+    // Budgets are given in CPU cycles (HighResolutionTimer::CyclesPerUs maps
+    // them to wall time), so a hot path regressing by an order of magnitude
+    // fails the build on target and simulator alike.
+
+    struct DurationStats {
+        uint32_t minCycles;
+        uint32_t avgCycles;
+        uint32_t maxCycles;
+    };
+
+    template<typename Func>
+    static DurationStats measureDuration(Func func, int warmup = 3, int repeat = 10) {
+        for (int i = 0; i < warmup; ++i) {
+            func();
+        }
+
+        DurationStats stats = { uint32_t(-1), 0, 0 };
+        uint64_t totalCycles = 0;
+        for (int i = 0; i < repeat; ++i) {
+            uint32_t startCycles = HighResolutionTimer::cycles();
+            func();
+            uint32_t elapsedCycles = HighResolutionTimer::cycles() - startCycles;
+            if (elapsedCycles < stats.minCycles) {
+                stats.minCycles = elapsedCycles;
+            }
+            if (elapsedCycles > stats.maxCycles) {
+                stats.maxCycles = elapsedCycles;
+            }
+            totalCycles += elapsedCycles;
+        }
+        stats.avgCycles = uint32_t(totalCycles / repeat);
+
+        return stats;
+    }
+
+    template<typename Func>
+    static void expectDurationLt(Func func, uint32_t budgetCycles, const Location &location, const char *msg = nullptr) {
+        DurationStats stats = measureDuration(func);
+        UNIT_TEST_PRINTF("Duration: min %u avg %u max %u cycles, budget %u cycles\n",
+            unsigned(stats.minCycles), unsigned(stats.avgCycles), unsigned(stats.maxCycles), unsigned(budgetCycles));
+        assert(stats.minCycles < budgetCycles, location, msg, [&] () {
+            UNIT_TEST_PRINTF("%u cycles is not less than %u cycles\n", unsigned(stats.minCycles), unsigned(budgetCycles));
+        });
+    }
+
 } // namespace test
 
 
@@ -163,6 +214,7 @@ namespace test {
 #define expectTrue(_condition_, ...) test::expectTrue(_condition_, UNIT_TEST_LOCATION, ##__VA_ARGS__)
 #define expectFalse(_condition_, ...) test::expectFalse(_condition_, UNIT_TEST_LOCATION, ##__VA_ARGS__)
 #define expectEqual(_a_, _b_, ...) test::expectEqual(_a_, _b_, UNIT_TEST_LOCATION, ##__VA_ARGS__)
+#define expectDurationLt(_func_, _budgetCycles_, ...) test::expectDurationLt(_func_, _budgetCycles_, UNIT_TEST_LOCATION, ##__VA_ARGS__)
 
 #define print(_fmt_, ...) UNIT_TEST_PRINTF(_fmt_, ##__VA_ARGS__)
 
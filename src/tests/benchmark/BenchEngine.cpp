@@ -0,0 +1,180 @@
+#include "sim/Simulator.h"
+
+#include "drivers/Adc.h"
+#include "drivers/ClockTimer.h"
+#include "drivers/Dac.h"
+#include "drivers/Dio.h"
+#include "drivers/GateOutput.h"
+#include "drivers/Midi.h"
+#include "drivers/UsbMidi.h"
+
+#include "model/Model.h"
+#include "engine/Engine.h"
+
+#include <chrono>
+#include <memory>
+
+#include <cstdio>
+#include <cstdlib>
+
+// Benchmarks engine throughput against a worst-case project: note tracks
+// playing full sequences with every probability/variation feature enabled,
+// curve tracks in fast (1 kHz) cv update mode and all routes active. Runs the engine over virtual time as fast as the host
+// allows and reports ticks/s plus the per-track cost collected by the
+// performance monitor, so regressions in the track engines show up before a
+// release hits hardware. An optional second argument selects the tick
+// resolution (192 or 384 ppqn) to prove the engine sustains the
+// high-resolution clock mode.
+
+struct BenchApp {
+    // drivers
+    ClockTimer clockTimer;
+    Adc adc;
+    Dac dac;
+    Dio dio;
+    GateOutput gateOutput;
+    Midi midi;
+    UsbMidi usbMidi;
+
+    // application
+    Model model;
+    Engine engine;
+
+    BenchApp(ClockSetup::Ppqn ppqn) :
+        engine(model, clockTimer, adc, dac, dio, gateOutput, midi, usbMidi)
+    {
+        model.init();
+        engine.init();
+
+        setupWorstCase(ppqn);
+
+        engine.clockStart();
+    }
+
+    void setupWorstCase(ClockSetup::Ppqn ppqn) {
+        auto &project = model.project();
+
+        project.clockSetup().setPpqn(ppqn);
+
+        // half the tracks run as curve tracks in fast (1 kHz) update mode so
+        // the benchmark covers the per-update curve evaluation cost as well
+        for (int trackIndex = CONFIG_TRACK_COUNT / 2; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+            project.setTrackMode(trackIndex, Track::TrackMode::Curve);
+            auto &curveTrack = project.track(trackIndex).curveTrack();
+            curveTrack.setCvUpdateMode(CurveTrack::CvUpdateMode::Fast);
+            auto &sequence = curveTrack.sequence(0);
+            sequence.setFirstStep(0);
+            sequence.setLastStep(CONFIG_STEP_COUNT - 1);
+            for (int stepIndex = 0; stepIndex < CONFIG_STEP_COUNT; ++stepIndex) {
+                auto &step = sequence.step(stepIndex);
+                step.setShape(stepIndex % 8);
+                step.setShapeVariation((stepIndex + 1) % 8);
+                step.setShapeVariationProbability(4);
+                step.setMin(0);
+                step.setMax(CurveSequence::Max::Max);
+                step.setGate(0xf);
+                step.setGateProbability(CurveSequence::GateProbability::Max - 1);
+            }
+        }
+
+        // full sequences with all features enabled on the remaining note tracks
+        for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT / 2; ++trackIndex) {
+            auto &sequence = project.track(trackIndex).noteTrack().sequence(0);
+            sequence.setFirstStep(0);
+            sequence.setLastStep(CONFIG_STEP_COUNT - 1);
+            for (int stepIndex = 0; stepIndex < CONFIG_STEP_COUNT; ++stepIndex) {
+                auto &step = sequence.step(stepIndex);
+                step.setGate(true);
+                step.setGateProbability(NoteSequence::GateProbability::Max - 1);
+                step.setRetrigger(3);
+                step.setRetriggerProbability(NoteSequence::RetriggerProbability::Max - 1);
+                step.setLength(NoteSequence::Length::Max / 2);
+                step.setLengthVariationRange(NoteSequence::LengthVariationRange::Max / 2);
+                step.setLengthVariationProbability(NoteSequence::LengthVariationProbability::Max - 1);
+                step.setNote(stepIndex % 24);
+                step.setNoteVariationRange(12);
+                step.setNoteVariationProbability(NoteSequence::NoteVariationProbability::Max - 1);
+            }
+        }
+
+        // all routes in use, targeting all tracks
+        static const Routing::Target targets[] = {
+            Routing::Target::Octave,
+            Routing::Target::Transpose,
+            Routing::Target::GateProbabilityBias,
+            Routing::Target::RetriggerProbabilityBias,
+            Routing::Target::LengthBias,
+            Routing::Target::NoteProbabilityBias,
+        };
+        for (int routeIndex = 0; routeIndex < CONFIG_ROUTE_COUNT; ++routeIndex) {
+            auto &route = project.routing().route(routeIndex);
+            route.setTarget(targets[routeIndex % (sizeof(targets) / sizeof(targets[0]))]);
+            route.setTracks(0xff);
+            route.setSource(Routing::Source(int(Routing::Source::CvIn1) + routeIndex % 4));
+        }
+    }
+
+    void update() {
+        engine.update();
+    }
+};
+
+static void printTimings(const BenchApp &app) {
+    const auto &monitor = app.engine.performanceMonitor();
+
+    printf("per-track cost:\n");
+    printf("track  tick avg/max (us)  update avg/max (us)\n");
+    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        const auto &tick = monitor.trackTickTiming(trackIndex);
+        const auto &update = monitor.trackUpdateTiming(trackIndex);
+        printf("%5d  %8u / %-8u  %10u / %-8u\n",
+            trackIndex + 1,
+            unsigned(tick.avgUs()), unsigned(tick.maxUs()),
+            unsigned(update.avgUs()), unsigned(update.maxUs())
+        );
+    }
+
+    printf("tick latency histogram (power-of-two us bins):\n");
+    const auto &histogram = monitor.tickLatencyHistogram();
+    for (int bin = 0; bin < PerformanceMonitor::HistogramBins; ++bin) {
+        if (histogram[bin] > 0) {
+            printf("  <= %5u us: %u\n", 1u << bin, unsigned(histogram[bin]));
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int virtualSeconds = argc > 1 ? atoi(argv[1]) : 10;
+    int ppqnValue = argc > 2 ? atoi(argv[2]) : CONFIG_PPQN;
+    auto ppqn = ppqnValue == 384 ? ClockSetup::Ppqn::Ppqn384 : ClockSetup::Ppqn::Ppqn192;
+
+    std::unique_ptr<BenchApp> app;
+
+    sim::Simulator sim({
+        .create = [&] () {
+            app.reset(new BenchApp(ppqn));
+        },
+        .destroy = [&] () {
+            app.reset();
+        },
+        .update = [&] () {
+            app->update();
+        }
+    });
+
+    printf("running engine at %d ppqn for %d s of virtual time ...\n", ClockSetup::ppqnValue(ppqn), virtualSeconds);
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    sim.wait(virtualSeconds * 1000);
+    auto endTime = std::chrono::high_resolution_clock::now();
+
+    double wallSeconds = std::chrono::duration<double>(endTime - startTime).count();
+    uint32_t ticks = app->engine.tick();
+
+    printf("processed %u ticks in %.3f s wall time (%.0f ticks/s, %.1fx realtime)\n",
+        unsigned(ticks), wallSeconds, ticks / wallSeconds, virtualSeconds / wallSeconds);
+
+    printTimings(*app);
+
+    return 0;
+}
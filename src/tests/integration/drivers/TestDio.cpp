@@ -7,10 +7,10 @@ public:
     void init() override {
         dio.init();
 
-        dio.clockInput.setHandler([this] (bool) {
+        dio.clockInput.setHandler([this] (bool, uint32_t) {
             ++clockInputCount;
         });
-        dio.resetInput.setHandler([this] (bool) {
+        dio.resetInput.setHandler([this] (bool, uint32_t) {
             ++resetInputCount;
         });
     }
@@ -4,6 +4,9 @@
 
 #include "drivers/SdCard.h"
 
+#include <algorithm>
+#include <cinttypes>
+
 class TestSdCard : public IntegrationTest {
 public:
     void init() override {
@@ -39,6 +42,8 @@ public:
 
         uint32_t writeTime = 0;
         uint32_t readTime = 0;
+        uint32_t worstWriteTime = 0;
+        uint32_t worstReadTime = 0;
 
         Timer timer;
 
@@ -53,7 +58,9 @@ public:
             if (!sdCard.write(data, 0, SectorCount)) {
                 DBG("write failed");
             }
-            writeTime += timer.elapsed();
+            uint32_t elapsed = timer.elapsed();
+            writeTime += elapsed;
+            worstWriteTime = std::max(worstWriteTime, elapsed);
 
             sdCard.sync();
 
@@ -62,7 +69,9 @@ public:
             if (!sdCard.read(buf, 0, SectorCount)) {
                 DBG("read failed");
             }
-            readTime += timer.elapsed();
+            elapsed = timer.elapsed();
+            readTime += elapsed;
+            worstReadTime = std::max(worstReadTime, elapsed);
 
             // verify data
             bool success = true;
@@ -76,9 +85,11 @@ public:
             EXPECT(success, "invalid data");
         }
 
-        // report throughput
+        // report throughput and worst-case latency
         DBG("Write throughput: %.1f kB/s", (DataLength / 1024.0) * 1000000.0 / writeTime);
         DBG("Read throughput: %.1f kB/s", (DataLength / 1024.0) * 1000000.0 / readTime);
+        DBG("Worst write latency: %" PRIu32 " us", worstWriteTime);
+        DBG("Worst read latency: %" PRIu32 " us", worstReadTime);
     }
 
 private:
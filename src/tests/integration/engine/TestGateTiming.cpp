@@ -0,0 +1,137 @@
+#include "TraceCompare.h"
+
+#include "sim/Simulator.h"
+#include "sim/TargetTrace.h"
+#include "sim/TargetTraceRecorder.h"
+
+#include "drivers/Adc.h"
+#include "drivers/ClockTimer.h"
+#include "drivers/Dac.h"
+#include "drivers/Dio.h"
+#include "drivers/GateOutput.h"
+#include "drivers/Midi.h"
+#include "drivers/UsbMidi.h"
+
+#include "model/Model.h"
+#include "engine/Engine.h"
+
+#include <memory>
+
+#include <cstdio>
+#include <cstdlib>
+
+// Gate timing regression test. Runs the engine headless over virtual time
+// with a deterministic project and asserts that gate transitions captured in
+// the target trace stay on the expected step grid, and that two identical
+// runs produce identical traces. Catches timing regressions in the clock and
+// track engine code that previously only our ears would notice.
+
+static bool failed = false;
+
+#define EXPECT(_cond_, _fmt_, ...)              \
+    if (!(_cond_)) {                            \
+        printf("FAILED: " _fmt_ "\n", ##__VA_ARGS__); \
+        failed = true;                          \
+    }
+
+struct TestApp {
+    // drivers
+    ClockTimer clockTimer;
+    Adc adc;
+    Dac dac;
+    Dio dio;
+    GateOutput gateOutput;
+    Midi midi;
+    UsbMidi usbMidi;
+
+    // application
+    Model model;
+    Engine engine;
+
+    TestApp(int swing) :
+        engine(model, clockTimer, adc, dac, dio, gateOutput, midi, usbMidi)
+    {
+        model.init();
+        engine.init();
+
+        auto &project = model.project();
+        project.setSwing(swing);
+
+        // deterministic sequence on track 0: all gates on, no probabilities
+        auto &sequence = project.track(0).noteTrack().sequence(0);
+        sequence.setFirstStep(0);
+        sequence.setLastStep(15);
+        for (int stepIndex = 0; stepIndex < 16; ++stepIndex) {
+            sequence.step(stepIndex).setGate(true);
+        }
+
+        engine.clockStart();
+    }
+};
+
+// runs the engine for the given number of bars and returns the captured trace
+static sim::TargetTrace run(int bars, int swing) {
+    std::unique_ptr<TestApp> app;
+
+    sim::Simulator sim({
+        .create = [&] () {
+            app.reset(new TestApp(swing));
+        },
+        .destroy = [&] () {
+            app.reset();
+        },
+        .update = [&] () {
+            app->engine.update();
+        }
+    });
+
+    sim::TargetTrace targetTrace;
+    sim::TargetTraceRecorder targetTraceRecorder(targetTrace);
+    sim.registerTargetTickObserver(&targetTraceRecorder);
+    sim.registerTargetOutputObserver(&targetTraceRecorder);
+
+    sim.wait(1);
+    uint32_t lastTick = uint32_t(bars) * app->engine.measureDivisor();
+    while (app->engine.tick() < lastTick) {
+        sim.wait(1);
+    }
+
+    return targetTrace;
+}
+
+int main() {
+    // 120 bpm, 16th note steps -> a rising edge every 125 ms of virtual time
+    static constexpr uint32_t StepMs = 125;
+    static constexpr uint32_t ToleranceMs = 2;
+
+    auto trace = run(4, 50);
+
+    // rising edges stay on the step grid
+    uint32_t firstEdge = 0;
+    int edges = 0;
+    test::forEachGateRisingEdge(trace.gateOutput, 0, [&] (uint32_t time) {
+        if (edges == 0) {
+            firstEdge = time;
+        } else {
+            uint32_t offset = (time - firstEdge) % StepMs;
+            EXPECT(offset <= ToleranceMs || offset >= StepMs - ToleranceMs,
+                "edge %d at %u ms is %u ms off the step grid", edges, unsigned(time), unsigned(offset));
+        }
+        ++edges;
+    });
+    EXPECT(edges >= 4 * 16 - 1, "expected at least %d rising edges, got %d", 4 * 16 - 1, edges);
+
+    // identical runs produce identical traces
+    auto traceRepeat = run(4, 50);
+    auto result = test::compareStateTrace(trace.gateOutput, traceRepeat.gateOutput);
+    EXPECT(result.matches(0), "identical runs diverge (%zu/%zu items, %zu state mismatches, %u ms max delta)",
+        result.itemsA, result.itemsB, result.stateMismatches, unsigned(result.maxTimeDelta));
+
+    // the comparison detects a timing change (swing shifts the off-beats)
+    auto traceSwing = run(4, 75);
+    auto swingResult = test::compareStateTrace(trace.gateOutput, traceSwing.gateOutput);
+    EXPECT(swingResult.maxTimeDelta > ToleranceMs, "swing run should deviate from straight run");
+
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed ? 1 : 0;
+}
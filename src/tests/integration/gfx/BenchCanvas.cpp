@@ -0,0 +1,96 @@
+#include "IntegrationTest.h"
+
+#include "core/gfx/Canvas.h"
+#include "core/utils/StringBuilder.h"
+
+#include "SystemConfig.h"
+
+#include <cinttypes>
+#include <cstdint>
+
+// Canvas rasterization micro-benchmark. Renders workloads representative of
+// the heavy UI pages (step grid, curve drawing, text-heavy pages) into an
+// off-screen frame buffer and reports per-frame cost and pixel throughput.
+// Runs on the simulator and, through the console, on hardware.
+
+class BenchCanvas : public IntegrationTest {
+public:
+    static constexpr int Iterations = 100;
+
+    void once() override {
+        benchmark("fill", [] (Canvas &canvas) {
+            canvas.setColor(0xf);
+            canvas.fill();
+        });
+
+        // step grid as drawn by the note sequence edit page: 16 cells with
+        // outline, fill and a centered label
+        benchmark("step grid", [] (Canvas &canvas) {
+            canvas.setFont(Font::Tiny);
+            for (int i = 0; i < 16; ++i) {
+                int x = i * 16;
+                canvas.setColor(i % 2 ? 0xf : 0x7);
+                canvas.drawRect(x + 2, 18, 12, 12);
+                canvas.setColor(0x3);
+                canvas.fillRect(x + 4, 20, 8, 8);
+                FixedStringBuilder<8> str;
+                str.appendInt(i + 1);
+                canvas.setColor(0xf);
+                canvas.drawTextCentered(x, 2, 16, 8, str);
+            }
+        });
+
+        // curve rendering as drawn by the curve sequence edit page: one line
+        // segment per column
+        benchmark("curves", [] (Canvas &canvas) {
+            canvas.setColor(0xf);
+            float lastY = 32.f;
+            for (int x = 1; x < CONFIG_LCD_WIDTH; ++x) {
+                float y = 32.f + 24.f * ((x * 7919) % 64 - 32) * (1.f / 32.f);
+                canvas.line(float(x - 1), lastY, float(x), y);
+                lastY = y;
+            }
+        });
+
+        // text-heavy page in both fonts
+        benchmark("text", [] (Canvas &canvas) {
+            canvas.setColor(0xf);
+            canvas.setFont(Font::Tiny);
+            for (int i = 0; i < 4; ++i) {
+                canvas.drawText(4, 8 + i * 8, "Knob Mode, Note Style & CV Range 12345");
+            }
+            canvas.setFont(Font::Small);
+            for (int i = 0; i < 3; ++i) {
+                canvas.drawText(4, 42 + i * 10, "PERFORMER sequencer");
+            }
+        });
+    }
+
+private:
+    template<typename Workload>
+    void benchmark(const char *name, Workload workload) {
+        FrameBuffer8bit frameBuffer(CONFIG_LCD_WIDTH, CONFIG_LCD_HEIGHT, _pixels);
+        Canvas canvas(frameBuffer);
+
+        canvas.setBlendMode(BlendMode::Set);
+        canvas.setColor(0);
+        canvas.fill();
+        canvas.setBlendMode(BlendMode::Set);
+
+        Timer timer;
+        timer.reset();
+        for (int i = 0; i < Iterations; ++i) {
+            workload(canvas);
+        }
+        uint32_t elapsedUs = timer.elapsed();
+
+        uint32_t usPerFrame = elapsedUs / Iterations;
+        uint32_t pixelsPerSec = elapsedUs > 0 ? uint32_t(uint64_t(CONFIG_LCD_WIDTH) * CONFIG_LCD_HEIGHT * Iterations * 1000000 / elapsedUs) : 0;
+
+        DBG("%-10s %6" PRIu32 " us/frame, %" PRIu32 " px/s frame equivalent", name, usPerFrame, pixelsPerSec);
+    }
+
+    uint8_t _pixels[CONFIG_LCD_WIDTH * CONFIG_LCD_HEIGHT];
+};
+
+INTEGRATION_TEST(BenchCanvas, "BenchCanvas", false)
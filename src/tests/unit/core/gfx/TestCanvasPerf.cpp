@@ -0,0 +1,61 @@
+#include "UnitTest.h"
+
+#include "core/gfx/Canvas.h"
+
+#include <cstdint>
+
+UNIT_TEST("CanvasPerf") {
+
+    static constexpr int Width = 256;
+    static constexpr int Height = 64;
+    static uint8_t pixels[Width * Height];
+
+    FrameBuffer8bit frameBuffer(Width, Height, pixels);
+    Canvas canvas(frameBuffer);
+
+    CASE("fill") {
+        canvas.setBlendMode(BlendMode::Set);
+        canvas.setColor(0xf);
+
+        expectDurationLt([&] () {
+            canvas.fill();
+        }, 200000);
+    }
+
+    CASE("fillRect") {
+        canvas.setBlendMode(BlendMode::Set);
+        canvas.setColor(0x7);
+
+        expectDurationLt([&] () {
+            for (int i = 0; i < 16; ++i) {
+                canvas.fillRect(i, i, Width - 2 * i, Height - 2 * i);
+            }
+        }, 500000);
+    }
+
+    CASE("lines") {
+        canvas.setBlendMode(BlendMode::Add);
+        canvas.setColor(0x3);
+
+        expectDurationLt([&] () {
+            for (int y = 0; y < Height; ++y) {
+                canvas.hline(0, y, Width);
+            }
+            for (int x = 0; x < Width; x += 4) {
+                canvas.vline(x, 0, Height);
+            }
+        }, 500000);
+    }
+
+    CASE("text") {
+        canvas.setBlendMode(BlendMode::Set);
+        canvas.setColor(0xf);
+        canvas.setFont(Font::Small);
+
+        expectDurationLt([&] () {
+            for (int i = 0; i < 8; ++i) {
+                canvas.drawText(4, 8 + i * 7, "PERFORMER 0123456789");
+            }
+        }, 500000);
+    }
+}
@@ -0,0 +1,24 @@
+#include "UnitTest.h"
+
+#include "core/hash/FnvHash.h"
+
+#include <cstring>
+
+UNIT_TEST("FnvHash") {
+
+    CASE("constexpr") {
+        // compile-time evaluation
+        static_assert(fnv1a("") == 0x811c9dc5, "empty string hashes to the basis");
+        static_assert(fnv1a("PRO") != fnv1a("SCA"), "distinct strings hash differently");
+    }
+
+    CASE("matches incremental hash") {
+        const char *strings[] = { "", "A", "PRO", "SCA", "PROJECTS/001.PRO" };
+        for (auto str : strings) {
+            FnvHash hash;
+            hash(str, std::strlen(str));
+            expectEqual(fnv1a(str), hash.result());
+        }
+    }
+
+}
@@ -0,0 +1,111 @@
+#include "UnitTest.h"
+
+#include "core/io/ConsoleFrame.h"
+
+#include <vector>
+
+#include <cstdint>
+
+typedef ConsoleFrame::Decoder Decoder;
+typedef ConsoleFrame::Decoder::Result Result;
+
+// assembles a frame according to the documented layout: marker, type,
+// payload length (16 bit little endian), payload, checksum
+static std::vector<uint8_t> makeFrame(uint8_t type, const std::vector<uint8_t> &payload) {
+    std::vector<uint8_t> frame;
+    frame.push_back(ConsoleFrame::Marker);
+    frame.push_back(type);
+    frame.push_back(payload.size() & 0xff);
+    frame.push_back((payload.size() >> 8) & 0xff);
+    uint8_t checksum = frame[1] + frame[2] + frame[3];
+    for (auto c : payload) {
+        frame.push_back(c);
+        checksum += c;
+    }
+    frame.push_back(checksum);
+    return frame;
+}
+
+UNIT_TEST("ConsoleFrame") {
+
+    CASE("decode") {
+        std::vector<uint8_t> payload = { 0x12, 0x34, 0x56, 0x78 };
+        auto frame = makeFrame(ConsoleFrame::ProfilerReport, payload);
+
+        Decoder decoder;
+        for (size_t i = 0; i < frame.size() - 1; ++i) {
+            expectEqual(int(decoder.feed(frame[i])), int(Result::Consumed));
+        }
+        expectEqual(int(decoder.feed(frame.back())), int(Result::Frame));
+
+        expectEqual(int(decoder.type()), int(ConsoleFrame::ProfilerReport));
+        expectEqual(decoder.length(), payload.size());
+        for (size_t i = 0; i < payload.size(); ++i) {
+            expectEqual(int(decoder.payload()[i]), int(payload[i]));
+        }
+    }
+
+    CASE("emptyPayload") {
+        auto frame = makeFrame(ConsoleFrame::TaskStats, {});
+
+        Decoder decoder;
+        Result result = Result::PassThrough;
+        for (auto c : frame) {
+            result = decoder.feed(c);
+        }
+        expectEqual(int(result), int(Result::Frame));
+        expectEqual(decoder.length(), size_t(0));
+    }
+
+    CASE("passThrough") {
+        auto frame = makeFrame(ConsoleFrame::ProfilerReport, { 0xff });
+
+        std::vector<uint8_t> stream;
+        const char *prefix = "hello\n";
+        const char *suffix = "world\n";
+        stream.insert(stream.end(), prefix, prefix + 6);
+        stream.insert(stream.end(), frame.begin(), frame.end());
+        stream.insert(stream.end(), suffix, suffix + 6);
+
+        Decoder decoder;
+        int passedThrough = 0;
+        int frames = 0;
+        for (auto c : stream) {
+            switch (decoder.feed(c)) {
+            case Result::PassThrough: ++passedThrough; break;
+            case Result::Frame: ++frames; break;
+            default: break;
+            }
+        }
+        expectEqual(passedThrough, 12);
+        expectEqual(frames, 1);
+    }
+
+    CASE("checksumError") {
+        auto frame = makeFrame(ConsoleFrame::ProfilerReport, { 0x01, 0x02 });
+        frame.back() ^= 0xff;
+
+        Decoder decoder;
+        Result result = Result::PassThrough;
+        for (auto c : frame) {
+            result = decoder.feed(c);
+        }
+        expectEqual(int(result), int(Result::Error));
+
+        // decoder recovers and decodes the next frame
+        auto good = makeFrame(ConsoleFrame::ProfilerReport, { 0x01, 0x02 });
+        for (size_t i = 0; i < good.size() - 1; ++i) {
+            decoder.feed(good[i]);
+        }
+        expectEqual(int(decoder.feed(good.back())), int(Result::Frame));
+    }
+
+    CASE("oversized") {
+        Decoder decoder;
+        decoder.feed(ConsoleFrame::Marker);
+        decoder.feed(ConsoleFrame::ProfilerReport);
+        decoder.feed(0xff);
+        expectEqual(int(decoder.feed(0xff)), int(Result::Error));
+    }
+
+}
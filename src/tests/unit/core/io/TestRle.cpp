@@ -0,0 +1,97 @@
+#include "UnitTest.h"
+
+#include "MemoryReaderWriter.h"
+
+#include "core/io/RleWriter.h"
+#include "core/io/RleReader.h"
+
+#include <cstdlib>
+
+static uint8_t original[1024];
+static uint8_t encoded[2048];
+static uint8_t decoded[1024];
+
+static size_t encode(const uint8_t *data, size_t len) {
+    MemoryWriter memoryWriter(encoded, sizeof(encoded));
+    RleWriter writer([&memoryWriter] (const void *data, size_t len) { memoryWriter.write(data, len); });
+    writer.write(data, len);
+    writer.finish();
+    return memoryWriter.bytesWritten();
+}
+
+static void decode(uint8_t *data, size_t len) {
+    MemoryReader memoryReader(encoded, sizeof(encoded));
+    RleReader reader([&memoryReader] (void *data, size_t len) { memoryReader.read(data, len); });
+    reader.read(data, len);
+}
+
+static void expectRoundtrip(size_t len) {
+    encode(original, len);
+    decode(decoded, len);
+    for (size_t i = 0; i < len; ++i) {
+        expectEqual(decoded[i], original[i]);
+    }
+}
+
+UNIT_TEST("Rle") {
+
+    CASE("empty") {
+        expectEqual(encode(original, 0), size_t(0));
+    }
+
+    CASE("runs") {
+        // runs longer than the maximum packet length
+        for (size_t i = 0; i < sizeof(original); ++i) {
+            original[i] = i < 512 ? 0x00 : 0xff;
+        }
+        size_t encodedLen = encode(original, sizeof(original));
+        expectTrue(encodedLen < sizeof(original) / 8);
+        decode(decoded, sizeof(original));
+        for (size_t i = 0; i < sizeof(original); ++i) {
+            expectEqual(decoded[i], original[i]);
+        }
+    }
+
+    CASE("literals") {
+        // incompressible data must survive the roundtrip
+        for (size_t i = 0; i < sizeof(original); ++i) {
+            original[i] = i * 7 + 13;
+        }
+        expectRoundtrip(sizeof(original));
+    }
+
+    CASE("mixed") {
+        std::srand(0);
+        for (size_t i = 0; i < sizeof(original); ) {
+            size_t runLength = 1 + std::rand() % 16;
+            uint8_t value = std::rand() % 4 == 0 ? std::rand() & 0xff : 0;
+            while (runLength > 0 && i < sizeof(original)) {
+                original[i++] = value;
+                --runLength;
+            }
+        }
+        expectRoundtrip(sizeof(original));
+    }
+
+    CASE("chunked reads") {
+        // decoding in odd sized chunks must not lose packet state
+        for (size_t i = 0; i < sizeof(original); ++i) {
+            original[i] = i % 3 == 0 ? 0x55 : uint8_t(i);
+        }
+        encode(original, sizeof(original));
+        MemoryReader memoryReader(encoded, sizeof(encoded));
+        RleReader reader([&memoryReader] (void *data, size_t len) { memoryReader.read(data, len); });
+        size_t pos = 0;
+        size_t chunk = 1;
+        while (pos < sizeof(original)) {
+            size_t len = std::min(chunk, sizeof(original) - pos);
+            reader.read(&decoded[pos], len);
+            pos += len;
+            chunk = chunk % 7 + 1;
+        }
+        for (size_t i = 0; i < sizeof(original); ++i) {
+            expectEqual(decoded[i], original[i]);
+        }
+    }
+
+}
@@ -0,0 +1,56 @@
+#include "UnitTest.h"
+
+#include "core/math/Fixed.h"
+
+UNIT_TEST("Fixed") {
+
+    CASE("int conversion") {
+        expectEqual(Fixed32_32::fromInt(0).toInt(), 0);
+        expectEqual(Fixed32_32::fromInt(120).toInt(), 120);
+        expectEqual(Fixed32_32::fromInt(-120).toInt(), -120);
+    }
+
+    CASE("float conversion") {
+        expectEqual(Fixed32_32::fromFloat(1.5f).toFloat(), 1.5f);
+        expectEqual(Fixed32_32::fromFloat(-0.25f).toFloat(), -0.25f);
+    }
+
+    CASE("ratio") {
+        expectEqual(Fixed32_32::fromRatio(1, 2).toFloat(), 0.5f);
+        expectEqual(Fixed32_32::fromRatio(3, 4).toFloat(), 0.75f);
+        // master clock period at 120 bpm and 192 ppqn
+        expectEqual(Fixed32_32::fromRatio(60 * 1000000, 120 * 192).toInt(), 2604);
+    }
+
+    CASE("integer division") {
+        // master clock period at 120 bpm and 192 ppqn
+        expectEqual(int(Fixed32_32::idiv(60 * 1000000, Fixed32_32::fromInt(120).mulInt(192))), 2604);
+        // fractional tempo
+        expectEqual(int(Fixed32_32::idiv(60 * 1000000, Fixed32_32::fromFloat(132.5f).mulInt(192))), 2358);
+    }
+
+    CASE("arithmetic") {
+        auto a = Fixed32_32::fromFloat(1.5f);
+        auto b = Fixed32_32::fromFloat(2.25f);
+
+        expectEqual((a + b).toFloat(), 3.75f);
+        expectEqual((b - a).toFloat(), 0.75f);
+        expectEqual((-a).toFloat(), -1.5f);
+        expectEqual((a * b).toFloat(), 3.375f);
+        expectEqual((a * -b).toFloat(), -3.375f);
+        expectEqual(a.mulInt(4).toFloat(), 6.f);
+        expectEqual(a.divInt(2).toFloat(), 0.75f);
+    }
+
+    CASE("comparison") {
+        auto a = Fixed32_32::fromInt(1);
+        auto b = Fixed32_32::fromInt(2);
+
+        expect(a == a);
+        expect(a != b);
+        expect(a < b);
+        expect(a <= a);
+        expect(b > a);
+        expect(b >= b);
+    }
+}
@@ -0,0 +1,35 @@
+#include "UnitTest.h"
+
+#include "core/midi/MidiParser.h"
+
+#include <cstdint>
+
+UNIT_TEST("MidiParserPerf") {
+
+    // a dense burst of note on/off messages with running status, the kind of
+    // stream a busy midi input delivers within a single engine update
+    CASE("note burst") {
+        static constexpr int MessageCount = 256;
+        static uint8_t stream[2 + MessageCount * 2];
+
+        size_t length = 0;
+        stream[length++] = 0x90;
+        for (int i = 0; i < MessageCount; ++i) {
+            stream[length++] = uint8_t(i & 0x7f);
+            stream[length++] = uint8_t(i & 1 ? 100 : 0);
+        }
+
+        MidiParser parser;
+        volatile uint32_t sink = 0;
+
+        expectDurationLt([&] () {
+            uint32_t count = 0;
+            parser.feed(stream, length, [&] (const MidiMessage &message) {
+                count += message.note();
+            });
+            sink += count;
+        }, 100000);
+
+        expect(sink > 0);
+    }
+}
@@ -0,0 +1,46 @@
+#include "UnitTest.h"
+
+#include "core/utils/BumpAllocator.h"
+
+#include <cstdint>
+
+UNIT_TEST("BumpAllocator") {
+
+    CASE("allocate") {
+        BumpAllocator<64> allocator;
+
+        auto a = allocator.allocate<uint8_t>(16);
+        expectTrue(a != nullptr, "allocation succeeds");
+        expectEqual(allocator.used(), size_t(16), "used");
+
+        auto b = allocator.allocate<uint8_t>(16);
+        expectTrue(b != nullptr, "allocation succeeds");
+        expectEqual(size_t(b - a), size_t(16), "allocations are consecutive");
+    }
+
+    CASE("alignment") {
+        BumpAllocator<64> allocator;
+
+        allocator.allocate<uint8_t>(1);
+        auto p = allocator.allocate<uint32_t>(1);
+        expectEqual(reinterpret_cast<uintptr_t>(p) % alignof(uint32_t), uintptr_t(0), "allocation is aligned");
+    }
+
+    CASE("exhausted") {
+        BumpAllocator<64> allocator;
+
+        expectTrue(allocator.allocate<uint8_t>(64) != nullptr, "allocation succeeds");
+        expectTrue(allocator.allocate<uint8_t>(1) == nullptr, "allocation fails when exhausted");
+    }
+
+    CASE("reset") {
+        BumpAllocator<64> allocator;
+
+        allocator.allocate<uint8_t>(48);
+        allocator.reset();
+        expectEqual(allocator.used(), size_t(0), "used after reset");
+        expectEqual(allocator.maxUsed(), size_t(48), "maxUsed survives reset");
+        expectTrue(allocator.allocate<uint8_t>(64) != nullptr, "full capacity available after reset");
+    }
+
+}
@@ -0,0 +1,40 @@
+#include "UnitTest.h"
+
+#include "apps/sequencer/model/Bitfield.h"
+
+#include <cstdint>
+
+UNIT_TEST("BitfieldPerf") {
+
+    // field layout modelled after NoteSequence::Step::_data0
+    typedef BitField<uint32_t, 0, 1> Gate;
+    typedef BitField<uint32_t, 2, 3> GateProbability;
+    typedef BitField<uint32_t, 15, 7> Note;
+
+    static constexpr int StepCount = 64;
+    static uint32_t words[StepCount];
+
+    // extract and re-insert fields across a whole sequence worth of packed
+    // step words, the pattern used by generators and bulk layer edits
+    CASE("extract/insert sweep") {
+        for (int i = 0; i < StepCount; ++i) {
+            words[i] = uint32_t(i) * 0x9e3779b9;
+        }
+
+        volatile uint32_t sink = 0;
+
+        expectDurationLt([&] () {
+            uint32_t acc = 0;
+            for (int i = 0; i < StepCount; ++i) {
+                uint32_t word = words[i];
+                acc += Gate::extract(word) + GateProbability::extract(word) + Note::extract(word);
+                word = Note::insert(word, (Note::extract(word) + 1) & 0x7f);
+                word = Gate::insert(word, ~Gate::extract(word) & 0x1);
+                words[i] = word;
+            }
+            sink += acc;
+        }, 20000);
+
+        expect(sink > 0);
+    }
+}
@@ -84,4 +84,18 @@ UNIT_TEST("Curve") {
 
 #endif // PLATFORM_SIM
 
+    CASE("morph endpoints") {
+        // at weight 0 and 256 the morphed evaluation has to reproduce the
+        // plain sampled shapes exactly
+        for (int type = 0; type < Curve::Last - 1; ++type) {
+            auto a = Curve::Type(type);
+            auto b = Curve::Type(type + 1);
+            for (int i = 0; i <= 16; ++i) {
+                float x = float(i) / 16;
+                expectEqual(Curve::evalMorphed(a, b, 0, x), Curve::evalSampled(a, x));
+                expectEqual(Curve::evalMorphed(a, b, 256, x), Curve::evalSampled(b, x));
+            }
+        }
+    }
+
 }
@@ -0,0 +1,101 @@
+#include "UnitTest.h"
+
+#include "apps/sequencer/engine/HeapQueue.h"
+
+UNIT_TEST("HeapQueue") {
+
+    struct Event {
+        uint32_t tick;
+        int id;
+    };
+
+    struct EventCompare {
+        bool operator()(const Event &a, const Event &b) {
+            return a.tick < b.tick;
+        }
+    };
+
+    typedef HeapQueue<Event, 16, EventCompare> Queue;
+
+    CASE("push/pop ordering") {
+        Queue queue;
+
+        expect(queue.empty());
+        expectEqual(queue.capacity(), size_t(16));
+
+        queue.push({ 30, 0 });
+        queue.push({ 10, 1 });
+        queue.push({ 20, 2 });
+        expectEqual(queue.size(), size_t(3));
+
+        expectEqual(queue.front().tick, uint32_t(10));
+        queue.pop();
+        expectEqual(queue.front().tick, uint32_t(20));
+        queue.pop();
+        expectEqual(queue.front().tick, uint32_t(30));
+        queue.pop();
+        expect(queue.empty());
+    }
+
+    CASE("stable ordering of equal elements") {
+        Queue queue;
+
+        queue.push({ 10, 0 });
+        queue.push({ 10, 1 });
+        queue.push({ 5, 2 });
+        queue.push({ 10, 3 });
+
+        expectEqual(queue.front().id, 2);
+        queue.pop();
+        expectEqual(queue.front().id, 0);
+        queue.pop();
+        expectEqual(queue.front().id, 1);
+        queue.pop();
+        expectEqual(queue.front().id, 3);
+        queue.pop();
+    }
+
+    CASE("pushReplace drops later elements") {
+        Queue queue;
+
+        queue.push({ 10, 0 });
+        queue.push({ 20, 1 });
+        queue.push({ 30, 2 });
+
+        queue.pushReplace({ 15, 3 });
+        expectEqual(queue.size(), size_t(2));
+
+        expectEqual(queue.front().tick, uint32_t(10));
+        queue.pop();
+        expectEqual(queue.front().tick, uint32_t(15));
+        queue.pop();
+        expect(queue.empty());
+    }
+
+    CASE("pushReplace keeps equal elements") {
+        Queue queue;
+
+        queue.push({ 10, 0 });
+        queue.push({ 20, 1 });
+
+        queue.pushReplace({ 20, 2 });
+        expectEqual(queue.size(), size_t(3));
+
+        queue.pop();
+        expectEqual(queue.front().id, 1);
+        queue.pop();
+        expectEqual(queue.front().id, 2);
+        queue.pop();
+        expect(queue.empty());
+    }
+
+    CASE("clear") {
+        Queue queue;
+
+        queue.push({ 10, 0 });
+        queue.push({ 20, 1 });
+        queue.clear();
+        expect(queue.empty());
+        expectEqual(queue.size(), size_t(0));
+    }
+}
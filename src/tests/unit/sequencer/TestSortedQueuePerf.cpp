@@ -0,0 +1,43 @@
+#include "UnitTest.h"
+
+#include "apps/sequencer/engine/SortedQueue.h"
+
+#include "core/utils/Random.h"
+
+UNIT_TEST("SortedQueuePerf") {
+
+    struct Event {
+        uint32_t tick;
+        int id;
+    };
+
+    struct EventCompare {
+        bool operator()(const Event &a, const Event &b) {
+            return a.tick < b.tick;
+        }
+    };
+
+    typedef SortedQueue<Event, 32, EventCompare> Queue;
+
+    // fill the queue from a pseudo random tick sequence and drain it again,
+    // modelling a worst-case burst of gate events in the note track engine
+    CASE("fill/drain") {
+        Queue queue;
+        Random rng(1234);
+
+        volatile uint32_t sink = 0;
+
+        expectDurationLt([&] () {
+            queue.clear();
+            for (int i = 0; i < 31; ++i) {
+                queue.push({ rng.next() & 0xffff, i });
+            }
+            while (!queue.empty()) {
+                sink += queue.front().tick;
+                queue.pop();
+            }
+        }, 50000);
+
+        expect(sink > 0);
+    }
+}
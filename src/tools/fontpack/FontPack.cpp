@@ -0,0 +1,131 @@
+// Converts the packed font headers in fonts/ into the row aligned format
+// used by the canvas glyph blitter and writes them to the given output
+// directory (src/core/gfx/fonts in the source tree):
+//
+//     fontpack <outputdir>
+//
+// In the packed source format each glyph is a continuous little-endian bit
+// stream, so the blitter has to gather every row from up to two bytes at an
+// arbitrary bit offset. The generated format stores one byte per glyph row
+// (bit 0 = leftmost pixel), which the blitter can feed to its nibble mask
+// expansion directly. New fonts are added here in the packed format as
+// produced by the font generator and inherit the row aligned format by
+// being listed in the table below.
+
+#include "fonts/tiny5x5.h"
+#include "fonts/ati8x8.h"
+#include "fonts/commodore.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct FontEntry {
+    const BitmapFont *font;
+    const char *name;
+    int glyphCount;
+};
+
+template<int N>
+static constexpr int glyphCount(BitmapFontGlyph (&)[N]) { return N; }
+
+static const FontEntry fontEntries[] = {
+    { &tiny5x5, "tiny5x5", glyphCount(tiny5x5_glyphs) },
+    { &ati8x8, "ati8x8", glyphCount(ati8x8_glyphs) },
+    { &commodore, "commodore", glyphCount(commodore_glyphs) },
+};
+
+static bool writeFont(const FontEntry &entry, const char *outputDir) {
+    const auto &font = *entry.font;
+
+    if (font.bpp != 1 || !font.bitmap || !font.glyphs) {
+        fprintf(stderr, "%s: only 1bpp bitmap fonts are supported\n", entry.name);
+        return false;
+    }
+
+    // repack each glyph into one byte per row
+    std::vector<uint8_t> bitmap;
+    std::vector<BitmapFontGlyph> glyphs;
+    for (int i = 0; i < entry.glyphCount; ++i) {
+        auto glyph = font.glyphs[i];
+        if (glyph.width > 8) {
+            fprintf(stderr, "%s: glyph %d is wider than 8 pixels\n", entry.name, i);
+            return false;
+        }
+        const uint8_t *src = &font.bitmap[glyph.offset];
+        uint16_t offset = uint16_t(bitmap.size());
+        for (int row = 0; row < glyph.height; ++row) {
+            uint8_t bits = 0;
+            for (int x = 0; x < glyph.width; ++x) {
+                int index = row * glyph.width + x;
+                bits |= ((src[index >> 3] >> (index & 7)) & 1) << x;
+            }
+            bitmap.push_back(bits);
+        }
+        glyph.offset = offset;
+        glyphs.push_back(glyph);
+    }
+
+    std::string upperName = entry.name;
+    for (auto &c : upperName) {
+        c = toupper(c);
+    }
+
+    std::string path = std::string(outputDir) + "/" + entry.name + ".h";
+    FILE *file = fopen(path.c_str(), "w");
+    if (!file) {
+        fprintf(stderr, "failed to open '%s' for writing\n", path.c_str());
+        return false;
+    }
+
+    fprintf(file, "// Generated by fontpack from src/tools/fontpack/fonts/%s.h - do not edit!\n", entry.name);
+    fprintf(file, "// Glyph rows are stored one byte per row (bit 0 = leftmost pixel).\n\n");
+    fprintf(file, "#ifndef __%s_H__\n", upperName.c_str());
+    fprintf(file, "#define __%s_H__\n\n", upperName.c_str());
+    fprintf(file, "#include \"BitmapFont.h\"\n\n");
+
+    fprintf(file, "static uint8_t %s_bitmap[] = {\n", entry.name);
+    for (size_t i = 0; i < bitmap.size(); ++i) {
+        fprintf(file, "%s0x%02x,%s",
+            i % 16 == 0 ? "    " : " ",
+            bitmap[i],
+            i % 16 == 15 || i == bitmap.size() - 1 ? "\n" : "");
+    }
+    fprintf(file, "};\n\n");
+
+    fprintf(file, "static BitmapFontGlyph %s_glyphs[] = {\n", entry.name);
+    for (size_t i = 0; i < glyphs.size(); ++i) {
+        const auto &glyph = glyphs[i];
+        int c = font.first + int(i);
+        fprintf(file, "    { %d, %d, %d, %d, %d, %d },", glyph.offset, glyph.width, glyph.height, glyph.xAdvance, glyph.xOffset, glyph.yOffset);
+        if (c >= 0x20 && c <= 0x7e) {
+            fprintf(file, " // '%c'", char(c));
+        }
+        fprintf(file, "\n");
+    }
+    fprintf(file, "};\n\n");
+
+    fprintf(file, "static BitmapFont %s = {\n", entry.name);
+    fprintf(file, "    %d, %s_bitmap, %s_glyphs, %d, %d, %d\n", font.bpp, entry.name, entry.name, font.first, font.last, font.yAdvance);
+    fprintf(file, "};\n\n");
+    fprintf(file, "#endif // __%s_H__\n", upperName.c_str());
+
+    fclose(file);
+
+    printf("%s: %d glyphs, %zu bytes\n", path.c_str(), entry.glyphCount, bitmap.size());
+
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    const char *outputDir = argc > 1 ? argv[1] : ".";
+
+    for (const auto &entry : fontEntries) {
+        if (!writeFont(entry, outputDir)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,144 @@
+#include "core/io/ConsoleFrame.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// Decodes binary console frames out of a captured console stream, e.g. a
+// serial capture from the hardware or a redirected simulator console. Plain
+// text in between frames passes through untouched, known frame types print
+// as text, unknown ones print type and size.
+//
+// usage: framedecoder [capture]
+//
+// reads from stdin when no capture file is given, so it can be attached
+// directly to a serial port:
+//
+//   cat /dev/ttyUSB0 | framedecoder
+
+// bounds-checked reader over a frame payload
+struct PayloadReader {
+    const uint8_t *p;
+    const uint8_t *end;
+
+    PayloadReader(const uint8_t *payload, size_t length) :
+        p(payload), end(payload + length)
+    {}
+
+    bool u8(uint8_t &value) {
+        if (p >= end) {
+            return false;
+        }
+        value = *p++;
+        return true;
+    }
+
+    bool u32(uint32_t &value) {
+        if (end - p < 4) {
+            return false;
+        }
+        value = uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+        p += 4;
+        return true;
+    }
+
+    bool name(char *buf, size_t size) {
+        uint8_t length;
+        if (!u8(length) || end - p < length || length >= size) {
+            return false;
+        }
+        std::memcpy(buf, p, length);
+        buf[length] = '\0';
+        p += length;
+        return true;
+    }
+};
+
+// payload: u8 interval count, u8 counter count, then one record per entry:
+// u8 name length, name, u32 avg cycles + u32 last cycles for intervals,
+// u32 count for counters
+static bool printProfilerReport(const uint8_t *payload, size_t length) {
+    PayloadReader reader(payload, length);
+
+    uint8_t numIntervals, numCounters;
+    if (!reader.u8(numIntervals) || !reader.u8(numCounters)) {
+        return false;
+    }
+
+    printf("Profiler:\n");
+    printf("---------------------------------------------\n");
+    if (numIntervals > 0) {
+        printf("Intervals:\n");
+        for (int i = 0; i < numIntervals; ++i) {
+            char name[64];
+            uint32_t avg, last;
+            if (!reader.name(name, sizeof(name)) || !reader.u32(avg) || !reader.u32(last)) {
+                return false;
+            }
+            printf("  %s: %u cycles avg, %u cycles last\n", name, avg, last);
+        }
+    }
+    if (numCounters > 0) {
+        printf("Counters:\n");
+        for (int i = 0; i < numCounters; ++i) {
+            char name[64];
+            uint32_t count;
+            if (!reader.name(name, sizeof(name)) || !reader.u32(count)) {
+                return false;
+            }
+            printf("  %s: %u\n", name, count);
+        }
+    }
+    printf("---------------------------------------------\n");
+
+    return true;
+}
+
+static void printFrame(const ConsoleFrame::Decoder &decoder) {
+    switch (decoder.type()) {
+    case ConsoleFrame::ProfilerReport:
+        if (printProfilerReport(decoder.payload(), decoder.length())) {
+            return;
+        }
+        break;
+    default:
+        break;
+    }
+    printf("[frame type 0x%02x, %zu bytes]\n", decoder.type(), decoder.length());
+}
+
+int main(int argc, char *argv[]) {
+    FILE *input = stdin;
+    if (argc > 1) {
+        input = fopen(argv[1], "rb");
+        if (!input) {
+            fprintf(stderr, "failed to open '%s'\n", argv[1]);
+            return 1;
+        }
+    }
+
+    ConsoleFrame::Decoder decoder;
+
+    int c;
+    while ((c = fgetc(input)) != EOF) {
+        switch (decoder.feed(uint8_t(c))) {
+        case ConsoleFrame::Decoder::Result::PassThrough:
+            fputc(c, stdout);
+            break;
+        case ConsoleFrame::Decoder::Result::Consumed:
+            break;
+        case ConsoleFrame::Decoder::Result::Frame:
+            printFrame(decoder);
+            break;
+        case ConsoleFrame::Decoder::Result::Error:
+            fprintf(stderr, "framedecoder: corrupt frame\n");
+            break;
+        }
+    }
+
+    if (input != stdin) {
+        fclose(input);
+    }
+
+    return 0;
+}